@@ -159,6 +159,14 @@ static int defaultChunkSize = 1024;
         }
         return nil;
     }];
+
+    // Revalidates a cached response
+    AWSURLResponseCache *responseCache = self.configuration.responseCache;
+    __block AWSCachedURLResponse *cachedResponse = nil;
+    task = [task continueWithSuccessBlock:^id(AWSTask *task) {
+        cachedResponse = [responseCache prepareRequest:request];
+        return nil;
+    }];
     
     // Refreshes credentials if necessary
     task = [task continueWithSuccessBlock:^id(AWSTask *task) {
@@ -189,12 +197,18 @@ static int defaultChunkSize = 1024;
             } else {
                 
                 NSHTTPURLResponse *HTTPResponse = (NSHTTPURLResponse *)response;
+                if (responseCache && [HTTPResponse isKindOfClass:[NSHTTPURLResponse class]]) {
+                    HTTPResponse = [responseCache responseForResponse:HTTPResponse
+                                                              request:request
+                                                       cachedResponse:cachedResponse
+                                                                 data:&data];
+                }
                 NSDictionary *HTTPHeaderFields = HTTPResponse.allHeaderFields;
                 NSInteger HTTPStatusCode = HTTPResponse.statusCode;
                 
                 [completionSource setResult:[[AWSAPIGatewayResponse alloc] initWithHeaders:HTTPHeaderFields
                                                                               responseData:data
-                                                                       NSURLResponseObject:response
+                                                                       NSURLResponseObject:HTTPResponse
                                                                                 statusCode:HTTPStatusCode]];
             }
         };
@@ -231,6 +245,10 @@ static int defaultChunkSize = 1024;
         }
     }
 
+    // Revalidates a cached response
+    AWSURLResponseCache *responseCache = self.configuration.responseCache;
+    AWSCachedURLResponse *cachedResponse = [responseCache prepareRequest:request];
+
     // Refreshes credentials if necessary
     AWSTask *task = [AWSTask taskWithResult:nil];
     task = [task continueWithSuccessBlock:^id(AWSTask *task) {
@@ -261,6 +279,14 @@ static int defaultChunkSize = 1024;
                 return;
             }
 
+            NSHTTPURLResponse *HTTPResponse = (NSHTTPURLResponse *)response;
+            if (responseCache && [HTTPResponse isKindOfClass:[NSHTTPURLResponse class]]) {
+                HTTPResponse = [responseCache responseForResponse:HTTPResponse
+                                                          request:request
+                                                   cachedResponse:cachedResponse
+                                                             data:&data];
+            }
+
             // Serializes the HTTP body
             id JSONObject = nil;
             if (data && [data length] > 0) {
@@ -278,8 +304,6 @@ static int defaultChunkSize = 1024;
             }
 
             // Handles developer defined errors
-            NSHTTPURLResponse *HTTPResponse = (NSHTTPURLResponse *)response;
-
             NSDictionary *HTTPHeaderFields = HTTPResponse.allHeaderFields;
             NSInteger HTTPStatusCode = HTTPResponse.statusCode;
             if (HTTPStatusCode/100 == 4 || HTTPStatusCode/100 == 5) {
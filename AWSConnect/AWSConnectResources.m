@@ -15,6 +15,10 @@
 
 #import "AWSConnectResources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSServiceDefinition.h>
+
+// The SHA-256 of `definitionString`, kept up to date by Scripts/compile_service_definitions.py.
+static NSString *const AWSConnectDefinitionDigest = @"84fc00536a6d6004227a4dfd17fd24280f950c006cccd82a6f04fafad9553f69";
 
 @interface AWSConnectResources ()
 
@@ -42,13 +46,18 @@
 - (instancetype)init {
     if (self = [super init]) {
         //init method
-        NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
+        _definitionDictionary = [AWSServiceDefinition definitionNamed:@"AWSConnect"
+                                                          bundleClass:[self class]
+                                                   resourceBundleName:@"AWSConnect"
+                                                               digest:AWSConnectDefinitionDigest];
         if (_definitionDictionary == nil) {
-            if (error) {
-                AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+            NSError *error = nil;
+            _definitionDictionary = [AWSServiceDefinition definitionWithJSONString:[self definitionString]
+                                                                             error:&error];
+            if (_definitionDictionary == nil) {
+                if (error) {
+                    AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+                }
             }
         }
     }
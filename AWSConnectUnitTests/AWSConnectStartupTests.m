@@ -0,0 +1,58 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSServiceStartupTestCase.h"
+#import "AWSConnectService.h"
+
+// Measures the cost of the first DescribeUser call of a process: loading the service definition and serializing one request.
+@interface AWSConnectStartupTests : AWSServiceStartupTestCase
+
+@end
+
+@implementation AWSConnectStartupTests
+
+- (void)setUp {
+    [super setUp];
+    self.resourcesClass = [AWSConnectResources class];
+    self.requestSerializerClass = [AWSJSONRequestSerializer class];
+    self.actionName = @"DescribeUser";
+    self.URL = [NSURL URLWithString:@"https://connect.us-east-1.amazonaws.com"];
+    self.HTTPMethod = @"GET";
+
+    AWSConnectDescribeUserRequest *describeUser = [AWSConnectDescribeUserRequest new];
+    describeUser.instanceId = @"12345678-aaaa-bbbb-cccc-123456789012";
+    describeUser.userId = @"87654321-dddd-eeee-ffff-210987654321";
+    self.input = describeUser;
+}
+
+- (void)testDefinitionsSerializeTheSameRequest {
+    [self assertDefinitionsSerializeTheSameRequest];
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceFirstRequestWithParsedDefinition {
+    [self measureFirstRequestWithParsedDefinition];
+}
+
+- (void)testPerformanceFirstRequestWithLazyDefinition {
+    [self measureFirstRequestWithLazyDefinition];
+}
+
+- (void)testPerformanceFirstRequestWithBundledDefinition {
+    [self measureFirstRequestWithBundledDefinition];
+}
+
+@end
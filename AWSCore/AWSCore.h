@@ -42,6 +42,7 @@ FOUNDATION_EXPORT const unsigned char AWSCoreVersionString[] DEPRECATED_MSG_ATTR
 
 #import "AWSServiceEnum.h"
 #import "AWSService.h"
+#import "AWSPaginator.h"
 #import "AWSCredentialsProvider.h"
 #import "AWSIdentityProvider.h"
 #import "AWSModel.h"
@@ -53,9 +54,11 @@ FOUNDATION_EXPORT const unsigned char AWSCoreVersionString[] DEPRECATED_MSG_ATTR
 #import "AWSSynchronizedMutableDictionary.h"
 #import "AWSXMLDictionary.h"
 #import "AWSSerialization.h"
+#import "AWSServiceDefinition.h"
 #import "AWSTimestampSerialization.h"
 #import "AWSURLRequestSerialization.h"
 #import "AWSURLResponseSerialization.h"
+#import "AWSURLResponseCache.h"
 #import "AWSURLSessionManager.h"
 #import "AWSSignature.h"
 #import "AWSURLRequestRetryHandler.h"
@@ -65,6 +68,7 @@ FOUNDATION_EXPORT const unsigned char AWSCoreVersionString[] DEPRECATED_MSG_ATTR
 
 #import "AWSBolts.h"
 #import "AWSGZIP.h"
+#import "AWSGZIPStream.h"
 #import "AWSFMDB.h"
 #import "AWSKSReachability.h"
 #import "AWSUICKeyChainStore.h"
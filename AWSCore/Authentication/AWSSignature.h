@@ -19,7 +19,18 @@
 FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Algorithm;
 FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Terminator;
 
+/**
+ The smallest data chunk size accepted by `AWSS3ChunkedEncodingInputStream`. Amazon S3 rejects smaller non-final chunks.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSS3ChunkedEncodingMinimumChunkSize;
+
+/**
+ The largest data chunk size accepted by `AWSS3ChunkedEncodingInputStream`.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSS3ChunkedEncodingMaximumChunkSize;
+
 @class AWSEndpoint;
+@class AWSCredentials;
 
 @protocol AWSCredentialsProvider;
 
@@ -37,12 +48,105 @@ FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Terminator;
 + (NSString * _Nonnull)hexEncode:(NSString * _Nullable)string;
 + (NSString * _Nullable)HMACSign:(NSData * _Nullable)data withKey:(NSString * _Nonnull)key usingAlgorithm:(uint32_t)algorithm;
 
+/**
+ Records on `HTTPBody`, the body of `request`, its SHA-256 digest, computed while the body was written, so that signing
+ the request does not hash the body again. Nothing is recorded for a mutable body.
+ */
++ (void)setPayloadHash:(NSData * _Nonnull)payloadHash forHTTPBody:(NSData * _Nonnull)HTTPBody ofRequest:(NSMutableURLRequest * _Nonnull)request;
+
+/**
+ Records on the `HTTPBodyStream` of `request` the SHA-256 digest of the bytes it produces, for a body stream whose
+ contents were hashed before the stream was set.
+ */
++ (void)setPayloadHash:(NSData * _Nonnull)payloadHash forHTTPBodyStreamOfRequest:(NSMutableURLRequest * _Nonnull)request;
+
+/**
+ Returns the SHA-256 digest of the body of `request`: the digest recorded on its body or body stream if there is one,
+ otherwise the digest of its `HTTPBody`.
+ */
++ (NSData * _Nullable)payloadHashOfRequest:(NSURLRequest * _Nonnull)request;
+
+@end
+
+/**
+ A thread-safe, bounded cache of SigV4 derived signing keys.
+
+ Deriving a signing key takes four chained HMAC-SHA256 rounds, but the result only depends on the secret key,
+ the date stamp, the region and the service, so it can be reused for every request signed within the same day.
+ Entries are keyed by a SHA-256 digest of the secret key rather than the secret key itself. When the cache is full,
+ the oldest entry is evicted.
+ */
+@interface AWSSignatureV4SigningKeyCache : NSObject
+
+/**
+ The maximum number of signing keys held by the cache. The default value is 64. Setting it to 0 disables caching.
+ */
+@property (nonatomic, assign) NSUInteger countLimit;
+
+/**
+ The number of lookups served from the cache since the last call to `resetStatistics`.
+ */
+@property (nonatomic, assign, readonly) uint64_t hitCount;
+
+/**
+ The number of lookups that had to derive a new signing key since the last call to `resetStatistics`.
+ */
+@property (nonatomic, assign, readonly) uint64_t missCount;
+
+/**
+ The number of signing keys currently held by the cache.
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ Returns the cache shared by `AWSSignatureV4Signer`, the presigned URL builders and the AWS IoT WebSocket signer.
+
+ @return The shared signing key cache.
+ */
++ (instancetype _Nonnull)sharedCache;
+
+/**
+ Returns the signing key for the given scope, deriving and caching it if it is not cached yet.
+
+ @param secretKey the secret access key
+ @param dateStamp the date stamp of the credential scope, e.g. "20150830"
+ @param regionName the region of the credential scope, e.g. "us-east-1"
+ @param serviceName the service of the credential scope, e.g. "iam"
+ @return The SigV4 signing key.
+ */
+- (NSData * _Nonnull)signingKeyForSecretKey:(NSString * _Nullable)secretKey
+                                  dateStamp:(NSString * _Nullable)dateStamp
+                                 regionName:(NSString * _Nullable)regionName
+                                serviceName:(NSString * _Nullable)serviceName;
+
+/**
+ Removes all of the signing keys from the cache.
+ */
+- (void)removeAllSigningKeys;
+
+/**
+ Resets `hitCount` and `missCount` to 0.
+ */
+- (void)resetStatistics;
+
 @end
 
 @interface AWSSignatureV4Signer : NSObject <AWSNetworkingRequestInterceptor>
 
 @property (nonatomic, strong, readonly) id<AWSCredentialsProvider> _Nonnull credentialsProvider;
 
+/**
+ The data chunk size used when signing Amazon S3 streaming uploads. See `AWSS3ChunkedEncodingInputStream`.
+ The default value is 0, which sizes the chunks to fit the buffer the request body is read into.
+ */
+@property (nonatomic, assign) NSUInteger chunkedEncodingChunkSize;
+
+/**
+ How the payload of Amazon S3 requests is signed. The default value is `AWSS3PayloadSigningModeSigned`.
+ Requests that are not sent over HTTPS are always signed with `AWSS3PayloadSigningModeSigned`.
+ */
+@property (nonatomic, assign) AWSS3PayloadSigningMode payloadSigningMode;
+
 - (instancetype _Nonnull)initWithCredentialsProvider:(id<AWSCredentialsProvider> _Nonnull)credentialsProvider
                                    endpoint:(AWSEndpoint * _Nonnull)endpoint;
 
@@ -98,12 +202,64 @@ FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Terminator;
                                                 signBody:(BOOL)signBody
                                         signSessionToken:(BOOL)signSessionToken;
 
+/**
+ Returns URLs signed using the SigV4 algorithm with credentials that have already been resolved, in the order of
+ `requests`.
+
+ The credential scope, the dates and the signing key are computed once for the whole batch, and the requests are
+ canonicalized and signed concurrently. Use it instead of calling
+ `sigV4SignedURLWithRequest:credentialProvider:regionName:serviceName:date:expireDuration:signBody:signSessionToken:`
+ in a loop when many URLs are signed at once.
+
+ @param requests the NSURLRequests to sign
+ @param expireDurations the duration in seconds each signed URL will be valid for, one per request
+ @param credentials the credentials to sign with
+ @param regionName the string representing the AWS region of the endpoint to be signed.
+ @param serviceName the name of the AWS service the requests are for
+ @param date the date of the signed credential
+ @param signBody if true and the httpMethod is GET, sign an empty string as part of the signature content
+ @param signSessionToken if true, include the sessionKey of the credentials in the signed payload.
+        If false, appends the X-AMZ-Security-Token to the end of the signed URL request parameters
+ @return The signed URLs. An element is `NSNull` if its URL could not be built.
+ */
++ (NSArray * _Nonnull)sigV4SignedURLsWithRequests:(NSArray<NSURLRequest *> * _Nonnull)requests
+                                  expireDurations:(NSArray<NSNumber *> * _Nonnull)expireDurations
+                                      credentials:(AWSCredentials * _Nonnull)credentials
+                                       regionName:(NSString * _Nonnull)regionName
+                                      serviceName:(NSString * _Nonnull)serviceName
+                                             date:(NSDate * _Nonnull)date
+                                         signBody:(BOOL)signBody
+                                 signSessionToken:(BOOL)signSessionToken;
+
 + (NSString * _Nonnull)getCanonicalizedRequest:(NSString * _Nonnull)method
                                  path:(NSString * _Nonnull)path
                                 query:(NSString * _Nullable)query
                               headers:(NSDictionary * _Nullable)headers
-                        contentSha256:(NSString * _Nullable)contentSha256;
+                        contentSha256:(NSString * _Nonnull)contentSha256;
+
+/**
+ Returns the hex encoded SHA-256 digest of the canonical request.
 
+ The result is identical to hex encoding the SHA-256 digest of `getCanonicalizedRequest:path:query:headers:contentSha256:`,
+ but the canonical request is streamed straight into the digest instead of being built as a string first.
+
+ @param method the HTTP method
+ @param path the canonical URI
+ @param query the URI encoded query string
+ @param headers the headers to sign
+ @param contentSha256 the hex encoded SHA-256 digest of the payload, or a payload marker such as "UNSIGNED-PAYLOAD".
+                      It must not be nil, as with `getCanonicalizedRequest:path:query:headers:contentSha256:`.
+ @return The hex encoded digest of the canonical request.
+ */
++ (NSString * _Nonnull)getCanonicalizedRequestHash:(NSString * _Nonnull)method
+                                              path:(NSString * _Nonnull)path
+                                             query:(NSString * _Nullable)query
+                                           headers:(NSDictionary * _Nullable)headers
+                                     contentSha256:(NSString * _Nonnull)contentSha256;
+
+/**
+ Returns the SigV4 signing key for the given scope. Keys are served from `+[AWSSignatureV4SigningKeyCache sharedCache]`.
+ */
 + (NSData * _Nonnull)getV4DerivedKey:(NSString * _Nullable)secret
                        date:(NSString * _Nullable)dateStamp
                      region:(NSString * _Nullable)regionName
@@ -127,11 +283,22 @@ FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Terminator;
 
 /**
  * A subclass of NSInputStream that wraps an input stream and adds
- * signature of chunk data.
+ * signature of chunk data, or a checksum trailer for unsigned uploads.
  **/
 @interface AWSS3ChunkedEncodingInputStream : NSInputStream <NSStreamDelegate>
 
+/**
+ * The number of bytes added by the encoding so far, i.e. chunk headers,
+ * signatures and trailers.
+ **/
 @property (atomic, assign) int64_t totalLengthOfChunkSignatureSent;
+
+/**
+ * The size of the data in each chunk, or 0 if the chunks are sized to fit
+ * the buffer passed to `read:maxLength:`.
+ **/
+@property (nonatomic, assign, readonly) NSUInteger chunkSize;
+
 /**
  * Initialize the input stream with date, scope, signing key and signature
  * of request headers.
@@ -142,9 +309,47 @@ FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Terminator;
                                      kSigning:(NSData * _Nullable)kSigning
                               headerSignature:(NSString * _Nullable)headerSignature;
 
+/**
+ * Initialize the input stream with date, scope, signing key, signature
+ * of request headers and the size of the data in each chunk. The chunk
+ * size is clamped to `AWSS3ChunkedEncodingMinimumChunkSize` and
+ * `AWSS3ChunkedEncodingMaximumChunkSize`; 0 sizes the chunks to fit the
+ * buffer passed to `read:maxLength:`. Larger chunks mean fewer signatures
+ * per byte uploaded.
+ **/
+- (instancetype _Nonnull )initWithInputStream:(NSInputStream * _Nonnull)stream
+                                         date:(NSDate * _Nullable)date
+                                        scope:(NSString * _Nullable)scope
+                                     kSigning:(NSData * _Nullable)kSigning
+                              headerSignature:(NSString * _Nullable)headerSignature
+                                    chunkSize:(NSUInteger)chunkSize;
+
+/**
+ * Initialize the input stream for `STREAMING-UNSIGNED-PAYLOAD-TRAILER`
+ * uploads. Chunks are not signed; instead a CRC32C checksum of the data is
+ * computed as the stream is read, and sent in the `x-amz-checksum-crc32c`
+ * trailer after the final chunk.
+ **/
+- (instancetype _Nonnull )initWithUnsignedInputStream:(NSInputStream * _Nonnull)stream
+                                            chunkSize:(NSUInteger)chunkSize;
+
 /**
  * Computes new content length after data being chunked encoded.
  **/
 + (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength;
 
+/**
+ * Computes new content length after data being chunked encoded with
+ * the given chunk size.
+ **/
++ (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength
+                                       chunkSize:(NSUInteger)chunkSize;
+
+/**
+ * Computes new content length after data being chunked encoded without
+ * chunk signatures, including the checksum trailer.
+ **/
++ (NSUInteger)computeContentLengthForUnsignedChunkedData:(NSUInteger)dataLength
+                                               chunkSize:(NSUInteger)chunkSize;
+
 @end
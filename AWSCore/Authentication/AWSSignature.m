@@ -15,16 +15,32 @@
 #import "AWSSignature.h"
 
 #import <CommonCrypto/CommonCrypto.h>
+#import <objc/runtime.h>
+#import <stdatomic.h>
 #import "AWSCategory.h"
 #import "AWSService.h"
 #import "AWSCredentialsProvider.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSBolts.h"
 #import "AWSNetworkingHelpers.h"
+#import "aws_sigv4_canonical.h"
+#import "aws_crc32c.h"
+#import "aws_encoding.h"
 
 static NSString *const AWSSigV4Marker = @"AWS4";
 NSString *const AWSSignatureV4Algorithm = @"AWS4-HMAC-SHA256";
 NSString *const AWSSignatureV4Terminator = @"aws4_request";
+static NSString *const AWSSignatureV4UnsignedPayload = @"UNSIGNED-PAYLOAD";
+// The key of the digest recorded on a request body or body stream.
+static void *AWSSignaturePayloadHashKey = &AWSSignaturePayloadHashKey;
+
+// The base64 encoded, big endian CRC32C checksum, as sent in x-amz-checksum-crc32c.
+static NSString *AWSS3CRC32CChecksum(uint32_t crc) {
+    uint8_t bytes[4] = {(uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc};
+    char checksum[AWS_BASE64_ENCODED_LENGTH(sizeof(bytes))];
+    aws_base64_encode(bytes, sizeof(bytes), checksum);
+    return [[NSString alloc] initWithBytes:checksum length:sizeof(checksum) encoding:NSASCIIStringEncoding];
+}
 
 @implementation AWSSignatureSignerUtility
 
@@ -73,6 +89,32 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     return [[NSData alloc] initWithBytes:result length:CC_SHA256_DIGEST_LENGTH];
 }
 
+// The digest is attached to the body object itself, so that it goes away with the body, is carried by copies of the
+// request, and is never returned for a body that replaced it. Mutable bodies are not recorded, as they may change after.
++ (void)setPayloadHash:(NSData *)payloadHash forHTTPBody:(NSData *)HTTPBody ofRequest:(NSMutableURLRequest *)request {
+    if ([HTTPBody isKindOfClass:[NSMutableData class]]) {
+        return;
+    }
+    objc_setAssociatedObject(HTTPBody, AWSSignaturePayloadHashKey, payloadHash, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
++ (void)setPayloadHash:(NSData *)payloadHash forHTTPBodyStreamOfRequest:(NSMutableURLRequest *)request {
+    NSInputStream *HTTPBodyStream = [request HTTPBodyStream];
+    if (HTTPBodyStream) {
+        objc_setAssociatedObject(HTTPBodyStream, AWSSignaturePayloadHashKey, payloadHash, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+}
+
++ (NSData *)payloadHashOfRequest:(NSURLRequest *)request {
+    NSData *body = [request HTTPBody];
+    id bodyObject = body ?: [request HTTPBodyStream];
+    NSData *recorded = bodyObject ? objc_getAssociatedObject(bodyObject, AWSSignaturePayloadHashKey) : nil;
+    if (recorded) {
+        return recorded;
+    }
+    return [self hashData:body];
+}
+
 + (NSString *)hexEncode:(NSString *)string {
     NSUInteger len = [string length];
     if (len == 0) {
@@ -87,6 +129,20 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
     [string getCharacters:chars];
 
+    // Strings made from raw bytes, such as digests, hold one byte per character and take the hex kernel.
+    uint8_t *bytes = (uint8_t *)chars;
+    NSUInteger i = 0;
+    for (; i < len && chars[i] <= 0xFF; i++) {
+        bytes[i] = (uint8_t)chars[i];
+    }
+    if (i == len) {
+        NSString *hexString = [[NSData dataWithBytesNoCopy:bytes length:len freeWhenDone:NO] aws_hexEncodedString];
+        free(chars);
+        return hexString;
+    }
+    // Wider characters are formatted with as many digits as they need.
+    [string getCharacters:chars];
+
     NSMutableString *hexString = [NSMutableString new];
     for (NSUInteger i = 0; i < len; i++) {
         if ((int)chars[i] < 16) {
@@ -128,19 +184,300 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
     CCHmacFinal(&context, digestRaw);
 
-    NSData *digestData = [NSData dataWithBytes:digestRaw length:digestLength];
+    NSData *digestData = [NSData dataWithBytesNoCopy:digestRaw length:digestLength freeWhenDone:NO];
 
-    return [digestData base64EncodedStringWithOptions:kNilOptions];
+    return [digestData aws_base64EncodedString];
 }
 
 @end
 
+#pragma mark - AWSSignatureV4SigningKeyCache
+
+static NSUInteger const AWSSignatureV4SigningKeyCacheDefaultCountLimit = 64;
+
+@interface AWSSignatureV4SigningKeyCache() {
+    _Atomic(uint64_t) _hitCount;
+    _Atomic(uint64_t) _missCount;
+}
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSData *> *signingKeys;
+// Cache keys in insertion order, used to evict the oldest entry when the cache is full.
+@property (nonatomic, strong) NSMutableArray<NSString *> *insertionOrder;
+@property (nonatomic, strong) dispatch_queue_t dispatchQueue;
+
+@end
+
+@implementation AWSSignatureV4SigningKeyCache
+
+@synthesize countLimit = _countLimit;
+
++ (instancetype)sharedCache {
+    static AWSSignatureV4SigningKeyCache *_sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _sharedCache = [AWSSignatureV4SigningKeyCache new];
+    });
+
+    return _sharedCache;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _countLimit = AWSSignatureV4SigningKeyCacheDefaultCountLimit;
+        _signingKeys = [NSMutableDictionary new];
+        _insertionOrder = [NSMutableArray new];
+        _dispatchQueue = dispatch_queue_create("com.amazonaws.AWSSignatureV4SigningKeyCache", DISPATCH_QUEUE_CONCURRENT);
+        atomic_init(&_hitCount, 0);
+        atomic_init(&_missCount, 0);
+    }
+
+    return self;
+}
+
+- (uint64_t)hitCount {
+    return atomic_load(&_hitCount);
+}
+
+- (uint64_t)missCount {
+    return atomic_load(&_missCount);
+}
+
+- (NSUInteger)count {
+    __block NSUInteger count = 0;
+    dispatch_sync(self.dispatchQueue, ^{
+        count = [self.signingKeys count];
+    });
+    return count;
+}
+
+- (NSUInteger)countLimit {
+    __block NSUInteger countLimit = 0;
+    dispatch_sync(self.dispatchQueue, ^{
+        countLimit = self->_countLimit;
+    });
+    return countLimit;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit {
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        self->_countLimit = countLimit;
+        [self evictToCountLimit];
+    });
+}
+
+- (NSData *)signingKeyForSecretKey:(NSString *)secretKey
+                         dateStamp:(NSString *)dateStamp
+                        regionName:(NSString *)regionName
+                       serviceName:(NSString *)serviceName {
+    NSString *cacheKey = [AWSSignatureV4SigningKeyCache cacheKeyForSecretKey:secretKey
+                                                                   dateStamp:dateStamp
+                                                                  regionName:regionName
+                                                                 serviceName:serviceName];
+
+    __block NSData *signingKey = nil;
+    dispatch_sync(self.dispatchQueue, ^{
+        signingKey = self.signingKeys[cacheKey];
+    });
+    if (signingKey) {
+        atomic_fetch_add(&_hitCount, 1);
+        return signingKey;
+    }
+
+    atomic_fetch_add(&_missCount, 1);
+    signingKey = [AWSSignatureV4SigningKeyCache deriveSigningKeyForSecretKey:secretKey
+                                                                   dateStamp:dateStamp
+                                                                  regionName:regionName
+                                                                 serviceName:serviceName];
+
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        if (self->_countLimit == 0 || self.signingKeys[cacheKey]) {
+            return;
+        }
+        self.signingKeys[cacheKey] = signingKey;
+        [self.insertionOrder addObject:cacheKey];
+        [self evictToCountLimit];
+    });
+
+    return signingKey;
+}
+
+- (void)removeAllSigningKeys {
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        [self.signingKeys removeAllObjects];
+        [self.insertionOrder removeAllObjects];
+    });
+}
+
+- (void)resetStatistics {
+    atomic_store(&_hitCount, 0);
+    atomic_store(&_missCount, 0);
+}
+
+// Must be called on `dispatchQueue` with a barrier.
+- (void)evictToCountLimit {
+    while ([self.insertionOrder count] > _countLimit) {
+        NSString *oldestKey = [self.insertionOrder firstObject];
+        [self.insertionOrder removeObjectAtIndex:0];
+        [self.signingKeys removeObjectForKey:oldestKey];
+    }
+}
+
++ (NSString *)cacheKeyForSecretKey:(NSString *)secretKey
+                         dateStamp:(NSString *)dateStamp
+                        regionName:(NSString *)regionName
+                       serviceName:(NSString *)serviceName {
+    // Identify the secret key by its digest so that the cache never holds on to the secret key itself.
+    NSData *secretKeyData = [secretKey dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char secretKeyDigest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256([secretKeyData bytes], (CC_LONG)[secretKeyData length], secretKeyDigest);
+    NSString *secretKeyIdentity = [[NSData dataWithBytes:secretKeyDigest length:CC_SHA256_DIGEST_LENGTH] aws_base64EncodedString];
+
+    return [NSString stringWithFormat:@"%@/%@/%@/%@", secretKeyIdentity, dateStamp, regionName, serviceName];
+}
+
++ (NSData *)deriveSigningKeyForSecretKey:(NSString *)secretKey
+                               dateStamp:(NSString *)dateStamp
+                              regionName:(NSString *)regionName
+                             serviceName:(NSString *)serviceName {
+    // AWS4 uses a series of derived keys, formed by hashing different pieces of data
+    NSString *kSecret = [NSString stringWithFormat:@"%@%@", AWSSigV4Marker, secretKey];
+    NSData *kDate = [AWSSignatureSignerUtility sha256HMacWithData:[dateStamp dataUsingEncoding:NSUTF8StringEncoding]
+                                                          withKey:[kSecret dataUsingEncoding:NSUTF8StringEncoding]];
+    NSData *kRegion = [AWSSignatureSignerUtility sha256HMacWithData:[regionName dataUsingEncoding:NSASCIIStringEncoding]
+                                                            withKey:kDate];
+    NSData *kService = [AWSSignatureSignerUtility sha256HMacWithData:[serviceName dataUsingEncoding:NSUTF8StringEncoding]
+                                                             withKey:kRegion];
+    NSData *kSigning = [AWSSignatureSignerUtility sha256HMacWithData:[AWSSignatureV4Terminator dataUsingEncoding:NSUTF8StringEncoding]
+                                                             withKey:kService];
+    return kSigning;
+}
+
+@end
+
+#pragma mark - Canonical request streaming
+
+// Requests with up to this many headers are canonicalized without touching the heap.
+static NSUInteger const AWSSignatureV4InlineHeaderCount = 32;
+
+// Number of presigned URLs signed per dispatch_apply iteration by the batch API.
+static size_t const AWSSignatureV4PresignStride = 64;
+
+static void AWSSignatureV4SHA256Write(void *context, const uint8_t *bytes, size_t length) {
+    CC_SHA256_Update((CC_SHA256_CTX *)context, bytes, (CC_LONG)length);
+}
+
+static void AWSSignatureV4HMACWrite(void *context, const uint8_t *bytes, size_t length) {
+    CCHmacUpdate((CCHmacContext *)context, bytes, length);
+}
+
+static void AWSSignatureV4AppendUTF8String(const aws_sigv4_sink *sink, NSString *string) {
+    const char *bytes = [string UTF8String];
+    if (bytes) {
+        sink->write(sink->context, (const uint8_t *)bytes, strlen(bytes));
+    }
+}
+
+// Streams the canonical request into `sink`. Returns NO if the scratch memory could not be allocated.
+static BOOL AWSSignatureV4WriteCanonicalRequest(NSString *method,
+                                                NSString *path,
+                                                NSString *query,
+                                                NSDictionary *headers,
+                                                NSString *contentSha256,
+                                                const aws_sigv4_sink *sink) {
+    NSUInteger headerCount = [headers count];
+    aws_sigv4_header inlineHeaders[AWSSignatureV4InlineHeaderCount];
+    aws_sigv4_header *sigv4Headers = inlineHeaders;
+    if (headerCount > AWSSignatureV4InlineHeaderCount) {
+        sigv4Headers = malloc(headerCount * sizeof(aws_sigv4_header));
+        if (sigv4Headers == NULL) {
+            return NO;
+        }
+    }
+
+    // The UTF-8 buffers are owned by the strings, which outlive this function.
+    NSUInteger index = 0;
+    for (NSString *name in headers) {
+        NSString *value = [headers objectForKey:name];
+        const char *nameBytes = [name UTF8String] ?: "";
+        const char *valueBytes = [[value description] UTF8String] ?: "";
+        sigv4Headers[index].name = (const uint8_t *)nameBytes;
+        sigv4Headers[index].name_length = strlen(nameBytes);
+        sigv4Headers[index].value = (const uint8_t *)valueBytes;
+        sigv4Headers[index].value_length = strlen(valueBytes);
+        index++;
+    }
+    aws_sigv4_sort_headers(sigv4Headers, headerCount);
+
+    const char *methodBytes = [method UTF8String] ?: "";
+    const char *pathBytes = [path UTF8String] ?: "";
+    const char *queryBytes = [query UTF8String] ?: "";
+    const char *payloadHashBytes = [contentSha256 UTF8String] ?: "";
+
+    aws_sigv4_canonical_request canonicalRequest;
+    canonicalRequest.method = (const uint8_t *)methodBytes;
+    canonicalRequest.method_length = strlen(methodBytes);
+    canonicalRequest.path = (const uint8_t *)pathBytes;
+    canonicalRequest.path_length = strlen(pathBytes);
+    canonicalRequest.query = (const uint8_t *)queryBytes;
+    canonicalRequest.query_length = strlen(queryBytes);
+    canonicalRequest.headers = sigv4Headers;
+    canonicalRequest.header_count = headerCount;
+    canonicalRequest.payload_hash = (const uint8_t *)payloadHashBytes;
+    canonicalRequest.payload_hash_length = strlen(payloadHashBytes);
+
+    int result = aws_sigv4_write_canonical_request(&canonicalRequest, sink);
+
+    if (sigv4Headers != inlineHeaders) {
+        free(sigv4Headers);
+    }
+    return result == AWS_SIGV4_OK;
+}
+
+static NSString *AWSSignatureV4HexString(const uint8_t *bytes, size_t length) {
+    char hex[2 * CC_SHA256_DIGEST_LENGTH];
+    NSCAssert(length <= CC_SHA256_DIGEST_LENGTH, @"Digest is too long");
+    aws_hex_encode(bytes, length, hex);
+    return [[NSString alloc] initWithBytes:hex length:2 * length encoding:NSASCIIStringEncoding];
+}
+
+// Computes the hex encoded signature of the string to sign without materializing the string to sign.
+static NSString *AWSSignatureV4Signature(NSString *amzDate,
+                                         NSString *scope,
+                                         NSString *canonicalRequestHash,
+                                         NSData *kSigning) {
+    CCHmacContext context;
+    CCHmacInit(&context, kCCHmacAlgSHA256, [kSigning bytes], [kSigning length]);
+    aws_sigv4_sink sink = {AWSSignatureV4HMACWrite, &context};
+
+    AWSSignatureV4AppendUTF8String(&sink, AWSSignatureV4Algorithm);
+    sink.write(sink.context, (const uint8_t *)"\n", 1);
+    AWSSignatureV4AppendUTF8String(&sink, amzDate);
+    sink.write(sink.context, (const uint8_t *)"\n", 1);
+    AWSSignatureV4AppendUTF8String(&sink, scope);
+    sink.write(sink.context, (const uint8_t *)"\n", 1);
+    AWSSignatureV4AppendUTF8String(&sink, canonicalRequestHash);
+
+    unsigned char signature[CC_SHA256_DIGEST_LENGTH];
+    CCHmacFinal(&context, signature);
+    return AWSSignatureV4HexString(signature, CC_SHA256_DIGEST_LENGTH);
+}
+
 #pragma mark - AWSSignatureV4Signer
 
 @interface AWSSignatureV4Signer()
 
 @property (nonatomic, strong) AWSEndpoint *endpoint;
 
++ (NSURL *)sigV4SignedURLWithRequest:(NSURLRequest *)request
+                         credentials:(AWSCredentials *)credentials
+                         serviceName:(NSString *)serviceName
+                    credentialsScope:(NSString *)credentialsScope
+                             amzDate:(NSString *)amzDate
+                            kSigning:(NSData *)kSigning
+                      expireDuration:(int32_t)expireDuration
+                            signBody:(BOOL)signBody
+                    signSessionToken:(BOOL)signSessionToken;
+
 @end
 
 @implementation AWSSignatureV4Signer
@@ -232,19 +569,46 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         query = [NSString stringWithFormat:@""];
     }
 
+    // Payloads are only left unsigned when TLS protects them.
+    AWSS3PayloadSigningMode payloadSigningMode = self.payloadSigningMode;
+    if ([[urlRequest.URL scheme] caseInsensitiveCompare:@"https"] != NSOrderedSame) {
+        payloadSigningMode = AWSS3PayloadSigningModeSigned;
+    }
+
     // Compute contentSha256
     NSString *contentSha256;
     NSInputStream *stream = [urlRequest HTTPBodyStream];
     NSUInteger contentLength = [[urlRequest allHTTPHeaderFields][@"Content-Length"] integerValue];
-    if (nil != stream) {
+    if (nil != stream && payloadSigningMode == AWSS3PayloadSigningModeUnsigned) {
+        contentSha256 = AWSSignatureV4UnsignedPayload;
+        if (contentLength == 0) {
+            [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"];
+        }
+    } else if (nil != stream && payloadSigningMode == AWSS3PayloadSigningModeUnsignedWithChecksum) {
+        contentSha256 = @"STREAMING-UNSIGNED-PAYLOAD-TRAILER";
+        [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"]; //remove Content-Length header if it is a HTTPBodyStream
+        [urlRequest addValue:@"aws-chunked" forHTTPHeaderField:@"Content-Encoding"];
+        [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)contentLength] forHTTPHeaderField:@"x-amz-decoded-content-length"];
+        [urlRequest setValue:@"x-amz-checksum-crc32c" forHTTPHeaderField:@"x-amz-trailer"];
+    } else if (nil != stream) {
         contentSha256 = @"STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
-        [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)[AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:contentLength]]
+        [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)[AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:contentLength
+                                                                                                                           chunkSize:self.chunkedEncodingChunkSize]]
           forHTTPHeaderField:@"Content-Length"];
         [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"]; //remove Content-Length header if it is a HTTPBodyStream
         [urlRequest addValue:@"aws-chunked" forHTTPHeaderField:@"Content-Encoding"]; //add aws-chunked keyword for s3 chunk upload
         [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)contentLength] forHTTPHeaderField:@"x-amz-decoded-content-length"];
     } else {
-        contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hashData:[urlRequest HTTPBody]] encoding:NSASCIIStringEncoding]];
+        if (payloadSigningMode == AWSS3PayloadSigningModeSigned) {
+            contentSha256 = [[AWSSignatureSignerUtility payloadHashOfRequest:urlRequest] aws_hexEncodedString];
+        } else {
+            contentSha256 = AWSSignatureV4UnsignedPayload;
+            NSData *body = [urlRequest HTTPBody];
+            if (payloadSigningMode == AWSS3PayloadSigningModeUnsignedWithChecksum && [body length] > 0) {
+                [urlRequest setValue:AWSS3CRC32CChecksum(aws_crc32c(0, [body bytes], [body length]))
+                  forHTTPHeaderField:@"x-amz-checksum-crc32c"];
+            }
+        }
         //using Content-Length with value of '0' cause auth issue, remove it.
         if (contentLength == 0) {
             [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"];
@@ -270,29 +634,26 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     
     NSMutableDictionary *headers = [[urlRequest allHTTPHeaderFields] mutableCopy];
 
-    NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:httpMethod
-                                                                          path:path
-                                                                         query:query
-                                                                       headers:headers
-                                                                 contentSha256:contentSha256];
-    AWSDDLogVerbose(@"Canonical request: [%@]", canonicalRequest);
+    NSString *canonicalRequestHash = [AWSSignatureV4Signer getCanonicalizedRequestHash:httpMethod
+                                                                                  path:path
+                                                                                 query:query
+                                                                               headers:headers
+                                                                         contentSha256:contentSha256];
+    AWSDDLogVerbose(@"Canonical request: [%@]", [AWSSignatureV4Signer getCanonicalizedRequest:httpMethod
+                                                                                          path:path
+                                                                                         query:query
+                                                                                       headers:headers
+                                                                                 contentSha256:contentSha256]);
 
-    NSString *stringToSign = [NSString stringWithFormat:@"%@\n%@\n%@\n%@",
-                              AWSSignatureV4Algorithm,
-                              [urlRequest valueForHTTPHeaderField:@"X-Amz-Date"],
-                              scope,
-                              [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
-    AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
+    NSString *amzDate = [urlRequest valueForHTTPHeaderField:@"X-Amz-Date"];
+    AWSDDLogVerbose(@"AWS4 String to Sign: [%@\n%@\n%@\n%@]", AWSSignatureV4Algorithm, amzDate, scope, canonicalRequestHash);
 
     NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
                                                          date:dateStamp
                                                        region:self.endpoint.regionName
                                                       service:self.endpoint.serviceName];
 
-    NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                              withKey:kSigning];
-    NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                           encoding:NSASCIIStringEncoding]];
+    NSString *signatureString = AWSSignatureV4Signature(amzDate, scope, canonicalRequestHash, kSigning);
 
     NSString *authorization = [NSString stringWithFormat:@"%@ Credential=%@, SignedHeaders=%@, Signature=%@",
                                AWSSignatureV4Algorithm,
@@ -300,12 +661,17 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
                                [AWSSignatureV4Signer getSignedHeadersString:headers],
                                signatureString];
 
-    if (nil != stream) {
+    if (nil != stream && payloadSigningMode == AWSS3PayloadSigningModeUnsignedWithChecksum) {
+        AWSS3ChunkedEncodingInputStream *chunkedStream = [[AWSS3ChunkedEncodingInputStream alloc] initWithUnsignedInputStream:stream
+                                                                                                                    chunkSize:self.chunkedEncodingChunkSize];
+        [urlRequest setHTTPBodyStream:chunkedStream];
+    } else if (nil != stream && payloadSigningMode == AWSS3PayloadSigningModeSigned) {
         AWSS3ChunkedEncodingInputStream *chunkedStream = [[AWSS3ChunkedEncodingInputStream alloc] initWithInputStream:stream
                                                                                                            date:date
                                                                                                           scope:scope
                                                                                                        kSigning:kSigning
-                                                                                                headerSignature:signatureString];
+                                                                                                headerSignature:signatureString
+                                                                                                      chunkSize:self.chunkedEncodingChunkSize];
         [urlRequest setHTTPBodyStream:chunkedStream];
     }
 
@@ -337,15 +703,19 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         query = [NSString stringWithFormat:@""];
     }
 
-    NSString *contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hashData:request.HTTPBody] encoding:NSASCIIStringEncoding]];
+    NSString *contentSha256 = [[AWSSignatureSignerUtility payloadHashOfRequest:request] aws_hexEncodedString];
 
-    NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
-                                                                          path:path
-                                                                         query:query
-                                                                       headers:request.allHTTPHeaderFields
-                                                                 contentSha256:contentSha256];
+    NSString *canonicalRequestHash = [AWSSignatureV4Signer getCanonicalizedRequestHash:request.HTTPMethod
+                                                                                  path:path
+                                                                                 query:query
+                                                                               headers:request.allHTTPHeaderFields
+                                                                         contentSha256:contentSha256];
 
-    AWSDDLogVerbose(@"AWS4 Canonical Request: [%@]", canonicalRequest);
+    AWSDDLogVerbose(@"AWS4 Canonical Request: [%@]", [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
+                                                                                               path:path
+                                                                                              query:query
+                                                                                            headers:request.allHTTPHeaderFields
+                                                                                      contentSha256:contentSha256]);
     AWSDDLogVerbose(@"payload %@",[[NSString alloc] initWithData:request.HTTPBody encoding:NSUTF8StringEncoding]);
 
     NSString *scope = [NSString stringWithFormat:@"%@/%@/%@/%@",
@@ -356,24 +726,19 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     NSString *signingCredentials = [NSString stringWithFormat:@"%@/%@",
                                     credentials.accessKey,
                                     scope];
-    NSString *stringToSign = [NSString stringWithFormat:@"%@\n%@\n%@\n%@",
-                              AWSSignatureV4Algorithm,
-                              [request valueForHTTPHeaderField:@"X-Amz-Date"],
-                              scope,
-                              [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
+    NSString *amzDate = [request valueForHTTPHeaderField:@"X-Amz-Date"];
 
-    AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
+    AWSDDLogVerbose(@"AWS4 String to Sign: [%@\n%@\n%@\n%@]", AWSSignatureV4Algorithm, amzDate, scope, canonicalRequestHash);
 
     NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
                                                          date:dateStamp
                                                        region:self.endpoint.regionName
                                                       service:self.endpoint.signingName];
-    NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                              withKey:kSigning];
+    NSString *signatureString = AWSSignatureV4Signature(amzDate, scope, canonicalRequestHash, kSigning);
 
     NSString *credentialsAuthorizationHeader = [NSString stringWithFormat:@"Credential=%@", signingCredentials];
     NSString *signedHeadersAuthorizationHeader = [NSString stringWithFormat:@"SignedHeaders=%@", [AWSSignatureV4Signer getSignedHeadersString:request.allHTTPHeaderFields]];
-    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature encoding:NSASCIIStringEncoding]]];
+    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", signatureString];
 
     NSString *authorization = [NSString stringWithFormat:@"%@ %@, %@, %@",
                                AWSSignatureV4Algorithm,
@@ -440,146 +805,224 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         }
 
         AWSCredentials *credentials = task.result;
-
-        // Deconstruct the incoming URL into components for easier manipulation and inspection of individual pieces.
-        // We'll use the mutated components at the end of this method to construct the signed URL
-        NSURLComponents *urlComponents = [[NSURLComponents alloc] initWithURL:request.URL
-                                                      resolvingAgainstBaseURL:NO];
-
-        // Implementation of V4 signature http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-query-string-auth.html
-        // Start with existing query string parameters; signature parameters will be appended to them
-        NSMutableArray<NSURLQueryItem *> *queryItems = [[NSMutableArray alloc] initWithArray:urlComponents.queryItems];
-
-        //Append Identifies the version of AWS Signature and the algorithm that you used to calculate the signature.
-        [queryItems addObject:[NSURLQueryItem queryItemWithName:@"X-Amz-Algorithm" value:AWSSignatureV4Algorithm]];
-
         NSString *credentialsScope = [self getCredentialScopeForDate:date
                                                           regionName:regionName
                                                          serviceName:serviceName];
-        NSString *credential = [NSString stringWithFormat:@"%@/%@", credentials.accessKey, credentialsScope];
-        [queryItems addObject:[NSURLQueryItem queryItemWithName:@"X-Amz-Credential" value:credential]];
+        NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
+                                                             date:[date aws_stringValue:AWSDateShortDateFormat1]
+                                                           region:regionName
+                                                          service:serviceName];
 
-        //X-Amz-Date in ISO 8601 format, for example, 20130721T201207Z. This value must match the date value used to calculate the signature.
-        NSString *iso8601Date = [date aws_stringValue:AWSDateISO8601DateFormat2];
-        [queryItems addObject:[NSURLQueryItem queryItemWithName:@"X-Amz-Date" value:iso8601Date]];
+        return [self sigV4SignedURLWithRequest:request
+                                   credentials:credentials
+                                   serviceName:serviceName
+                              credentialsScope:credentialsScope
+                                       amzDate:[date aws_stringValue:AWSDateISO8601DateFormat2]
+                                      kSigning:kSigning
+                                expireDuration:expireDuration
+                                      signBody:signBody
+                              signSessionToken:signSessionToken];
+    }];
+}
 
-        //X-Amz-Expires, Provides the time period, in seconds, for which the generated presigned URL is valid.
-        //For example, 86400 (24 hours). This value is an integer. The minimum value you can set is 1, and the maximum is 604800 (seven days).
-        NSString *expireString = [NSString stringWithFormat:@"%d", expireDuration];
-        [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Expires" value:expireString]];
-        
-        /*
-         X-Amz-SignedHeaders Lists the headers that you used to calculate the signature. The HTTP host header is required.
-         Any x-amz-* headers that you plan to add to the request are also required for signature calculation.
-         In general, for added security, you should sign all the request headers that you plan to include in your request.
-         */
-        NSDictionary *headers = request.allHTTPHeaderFields;
-        NSString *signedHeaders = [self getSignedHeadersString:headers];
-        [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-SignedHeaders" value:signedHeaders]];
-
-        // Add security-token as part of signed payload if present, and `signSessionToken` is true
-        if (signSessionToken && credentials.sessionKey.length > 0) {
-            [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Security-Token" value:credentials.sessionKey]];
++ (NSArray *)sigV4SignedURLsWithRequests:(NSArray<NSURLRequest *> *)requests
+                         expireDurations:(NSArray<NSNumber *> *)expireDurations
+                             credentials:(AWSCredentials *)credentials
+                              regionName:(NSString *)regionName
+                             serviceName:(NSString *)serviceName
+                                    date:(NSDate *)date
+                                signBody:(BOOL)signBody
+                        signSessionToken:(BOOL)signSessionToken {
+    NSUInteger count = [requests count];
+    if (count == 0) {
+        return @[];
+    }
+    if ([expireDurations count] != count) {
+        @throw [NSException exceptionWithName:NSInvalidArgumentException
+                                       reason:@"`requests` and `expireDurations` must have the same number of elements."
+                                     userInfo:nil];
+    }
+
+    // Everything that only depends on the credentials, the date and the scope is computed once for the whole batch.
+    NSString *credentialsScope = [self getCredentialScopeForDate:date
+                                                      regionName:regionName
+                                                     serviceName:serviceName];
+    NSString *amzDate = [date aws_stringValue:AWSDateISO8601DateFormat2];
+    NSData *kSigning = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
+                                                        date:[date aws_stringValue:AWSDateShortDateFormat1]
+                                                      region:regionName
+                                                     service:serviceName];
+
+    // Canonicalization and signing are independent per request, so they are spread across cores in strides large
+    // enough to amortize the dispatch overhead. Each request writes to its own slot, which keeps the results in order.
+    __strong id *URLs = (__strong id *)calloc(count, sizeof(id));
+    if (URLs == NULL) {
+        @throw [NSException exceptionWithName:NSMallocException
+                                       reason:@"Failed to allocate the presigned URL results."
+                                     userInfo:nil];
+    }
+    size_t stride = AWSSignatureV4PresignStride;
+    size_t iterations = (count + stride - 1) / stride;
+    dispatch_apply(iterations, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t iteration) {
+        NSUInteger end = MIN((iteration + 1) * stride, count);
+        for (NSUInteger i = iteration * stride; i < end; i++) {
+            @autoreleasepool {
+                NSURL *URL = [self sigV4SignedURLWithRequest:requests[i]
+                                                 credentials:credentials
+                                                 serviceName:serviceName
+                                            credentialsScope:credentialsScope
+                                                     amzDate:amzDate
+                                                    kSigning:kSigning
+                                              expireDuration:[expireDurations[i] intValue]
+                                                    signBody:signBody
+                                            signSessionToken:signSessionToken];
+                URLs[i] = URL ?: [NSNull null];
+            }
         }
-        
-        // =============  generate v4 signature string ===================
-        
-        /* Canonical Request Format:
-         *
-         * HTTP-VERB + "\n" +  (e.g. GET, PUT, POST)
-         * Canonical URI + "\n" + (e.g. /test.txt)
-         * Canonical Query String + "\n" (multiple queryString need to sorted by QueryParameter)
-         * Canonical Headers + "\n" + (multiple headers need to be sorted by HeaderName)
-         * Signed Headers + "\n" + (multiple headers need to be sorted by HeaderName)
-         * "UNSIGNED-PAYLOAD"
-         */
-        
-        // CanonicalURI is the URI-encoded version of the absolute path component of the URI—everything starting with
-        // the "/" that follows the domain name and up to the end of the string or to the question mark character ('?')
-        // if you have query string parameters. e.g. https://s3.amazonaws.com/examplebucket/myphoto.jpg
-        // /examplebucket/myphoto.jpg is the absolute path. In the absolute path, you don't encode the "/".
+    });
 
-        NSString *pathToEncode;
+    NSArray *result = [NSArray arrayWithObjects:URLs count:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        URLs[i] = nil;
+    }
+    free(URLs);
 
-        if ([urlComponents.path hasPrefix:@"/"]) {
-            NSRange firstCharacter = NSMakeRange(0, 1);
-            pathToEncode = [urlComponents.path stringByReplacingCharactersInRange:firstCharacter withString:@""];
-        } else {
-            pathToEncode = urlComponents.path;
-        }
-        
-        NSString *canonicalURI;
-        if ([[serviceName lowercaseString] isEqualToString:@"s3"]) {
-            canonicalURI = [NSString stringWithFormat:@"/%@", [pathToEncode aws_stringWithURLEncodingPath]];
-        } else {
-            NSCharacterSet *pathChars = [NSCharacterSet URLPathAllowedCharacterSet];
-            canonicalURI = [NSString stringWithFormat:@"/%@",
-                                     [[[[pathToEncode stringByRemovingPercentEncoding]
-                                        stringByRemovingPercentEncoding]
-                                       stringByAddingPercentEncodingWithAllowedCharacters: pathChars]
-                                      aws_stringWithURLEncodingPathWithoutPriorDecoding]];
-        }
+    return result;
+}
 
-        NSString *contentSha256;
-        if(signBody && [request.HTTPMethod isEqualToString:@"GET"]){
-            //in case of http get we sign the body as an empty string only if the sign body flag is set to true
-            NSData *emptyData = [@"" dataUsingEncoding:NSUTF8StringEncoding];
-            NSData *emptyDataHash = [AWSSignatureSignerUtility hashData:emptyData];
-            NSString *emptyDataEncodedString = [[NSString alloc] initWithData:emptyDataHash
-                                                                     encoding:NSASCIIStringEncoding];
-            contentSha256 = [AWSSignatureSignerUtility hexEncode:emptyDataEncodedString];
-        } else {
-            contentSha256 = @"UNSIGNED-PAYLOAD";
-        }
++ (NSURL *)sigV4SignedURLWithRequest:(NSURLRequest *)request
+                         credentials:(AWSCredentials *)credentials
+                         serviceName:(NSString *)serviceName
+                    credentialsScope:(NSString *)credentialsScope
+                             amzDate:(NSString *)amzDate
+                            kSigning:(NSData *)kSigning
+                      expireDuration:(int32_t)expireDuration
+                            signBody:(BOOL)signBody
+                    signSessionToken:(BOOL)signSessionToken {
+
+    // Deconstruct the incoming URL into components for easier manipulation and inspection of individual pieces.
+    // We'll use the mutated components at the end of this method to construct the signed URL
+    NSURLComponents *urlComponents = [[NSURLComponents alloc] initWithURL:request.URL
+                                                  resolvingAgainstBaseURL:NO];
+
+    // Implementation of V4 signature http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-query-string-auth.html
+    // Start with existing query string parameters; signature parameters will be appended to them
+    NSMutableArray<NSURLQueryItem *> *queryItems = [[NSMutableArray alloc] initWithArray:urlComponents.queryItems];
+
+    //Append Identifies the version of AWS Signature and the algorithm that you used to calculate the signature.
+    [queryItems addObject:[NSURLQueryItem queryItemWithName:@"X-Amz-Algorithm" value:AWSSignatureV4Algorithm]];
+
+    NSString *credential = [NSString stringWithFormat:@"%@/%@", credentials.accessKey, credentialsScope];
+    [queryItems addObject:[NSURLQueryItem queryItemWithName:@"X-Amz-Credential" value:credential]];
+
+    //X-Amz-Date in ISO 8601 format, for example, 20130721T201207Z. This value must match the date value used to calculate the signature.
+    [queryItems addObject:[NSURLQueryItem queryItemWithName:@"X-Amz-Date" value:amzDate]];
+
+    //X-Amz-Expires, Provides the time period, in seconds, for which the generated presigned URL is valid.
+    //For example, 86400 (24 hours). This value is an integer. The minimum value you can set is 1, and the maximum is 604800 (seven days).
+    NSString *expireString = [NSString stringWithFormat:@"%d", expireDuration];
+    [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Expires" value:expireString]];
+    
+    /*
+     X-Amz-SignedHeaders Lists the headers that you used to calculate the signature. The HTTP host header is required.
+     Any x-amz-* headers that you plan to add to the request are also required for signature calculation.
+     In general, for added security, you should sign all the request headers that you plan to include in your request.
+     */
+    NSDictionary *headers = request.allHTTPHeaderFields;
+    NSString *signedHeaders = [self getSignedHeadersString:headers];
+    [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-SignedHeaders" value:signedHeaders]];
+
+    // Add security-token as part of signed payload if present, and `signSessionToken` is true
+    if (signSessionToken && credentials.sessionKey.length > 0) {
+        [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Security-Token" value:credentials.sessionKey]];
+    }
+    
+    // =============  generate v4 signature string ===================
+    
+    /* Canonical Request Format:
+     *
+     * HTTP-VERB + "\n" +  (e.g. GET, PUT, POST)
+     * Canonical URI + "\n" + (e.g. /test.txt)
+     * Canonical Query String + "\n" (multiple queryString need to sorted by QueryParameter)
+     * Canonical Headers + "\n" + (multiple headers need to be sorted by HeaderName)
+     * Signed Headers + "\n" + (multiple headers need to be sorted by HeaderName)
+     * "UNSIGNED-PAYLOAD"
+     */
+    
+    // CanonicalURI is the URI-encoded version of the absolute path component of the URI—everything starting with
+    // the "/" that follows the domain name and up to the end of the string or to the question mark character ('?')
+    // if you have query string parameters. e.g. https://s3.amazonaws.com/examplebucket/myphoto.jpg
+    // /examplebucket/myphoto.jpg is the absolute path. In the absolute path, you don't encode the "/".
+
+    NSString *pathToEncode;
 
-        // Generate Canonical Request
+    if ([urlComponents.path hasPrefix:@"/"]) {
+        NSRange firstCharacter = NSMakeRange(0, 1);
+        pathToEncode = [urlComponents.path stringByReplacingCharactersInRange:firstCharacter withString:@""];
+    } else {
+        pathToEncode = urlComponents.path;
+    }
+    
+    NSString *canonicalURI;
+    if ([[serviceName lowercaseString] isEqualToString:@"s3"]) {
+        canonicalURI = [NSString stringWithFormat:@"/%@", [pathToEncode aws_stringWithURLEncodingPath]];
+    } else {
+        NSCharacterSet *pathChars = [NSCharacterSet URLPathAllowedCharacterSet];
+        canonicalURI = [NSString stringWithFormat:@"/%@",
+                                 [[[[pathToEncode stringByRemovingPercentEncoding]
+                                    stringByRemovingPercentEncoding]
+                                   stringByAddingPercentEncodingWithAllowedCharacters: pathChars]
+                                  aws_stringWithURLEncodingPathWithoutPriorDecoding]];
+    }
 
-        // Get the URL encoded query string
-        NSString *queryString = [self getURIEncodedQueryStringForSigV4:queryItems];
+    NSString *contentSha256;
+    if(signBody && [request.HTTPMethod isEqualToString:@"GET"]){
+        //in case of http get we sign the body as an empty string only if the sign body flag is set to true
+        NSData *emptyData = [@"" dataUsingEncoding:NSUTF8StringEncoding];
+        NSData *emptyDataHash = [AWSSignatureSignerUtility hashData:emptyData];
+        contentSha256 = [emptyDataHash aws_hexEncodedString];
+    } else {
+        contentSha256 = AWSSignatureV4UnsignedPayload;
+    }
 
-        NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
-                                                                              path:canonicalURI
-                                                                             query:queryString
-                                                                           headers:request.allHTTPHeaderFields
-                                                                     contentSha256:contentSha256];
-        AWSDDLogVerbose(@"AWSS4 PresignedURL Canonical request: [%@]", canonicalRequest);
-        
-        //Generate String to Sign
-        NSString *stringToSign = [NSString stringWithFormat:@"%@\n%@\n%@\n%@",
-                                  AWSSignatureV4Algorithm,
-                                  [date aws_stringValue:AWSDateISO8601DateFormat2],
-                                  credentialsScope,
-                                  [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
-        
-        AWSDDLogVerbose(@"AWS4 PresignedURL String to Sign: [%@]", stringToSign);
-        
-        // Generate Signature
-        NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
-                                                             date:[date aws_stringValue:AWSDateShortDateFormat1]
-                                                           region:regionName
-                                                          service:serviceName];
-        NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                                  withKey:kSigning];
-        NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                               encoding:NSASCIIStringEncoding]];
-        
-        // ============  generate v4 signature string (END) ===================
-        
-        // Add security-token as part of the postamble if present, and `signSessionToken` is false
-        if (!signSessionToken && credentials.sessionKey.length > 0) {
-            [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Security-Token" value:credentials.sessionKey]];
-        }
+    // Generate Canonical Request
+
+    // Get the URL encoded query string
+    NSString *queryString = [self getURIEncodedQueryStringForSigV4:queryItems];
+
+    NSString *canonicalRequestHash = [AWSSignatureV4Signer getCanonicalizedRequestHash:request.HTTPMethod
+                                                                                  path:canonicalURI
+                                                                                 query:queryString
+                                                                               headers:request.allHTTPHeaderFields
+                                                                         contentSha256:contentSha256];
+    AWSDDLogVerbose(@"AWSS4 PresignedURL Canonical request: [%@]", [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
+                                                                                                             path:canonicalURI
+                                                                                                            query:queryString
+                                                                                                          headers:request.allHTTPHeaderFields
+                                                                                                    contentSha256:contentSha256]);
+    
+    //Generate String to Sign
+    AWSDDLogVerbose(@"AWS4 PresignedURL String to Sign: [%@\n%@\n%@\n%@]", AWSSignatureV4Algorithm, amzDate, credentialsScope, canonicalRequestHash);
+    
+    // Generate Signature
+    NSString *signatureString = AWSSignatureV4Signature(amzDate, credentialsScope, canonicalRequestHash, kSigning);
+    
+    // ============  generate v4 signature string (END) ===================
+    
+    // Add security-token as part of the postamble if present, and `signSessionToken` is false
+    if (!signSessionToken && credentials.sessionKey.length > 0) {
+        [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Security-Token" value:credentials.sessionKey]];
+    }
 
-        [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Signature" value:signatureString]];
+    [queryItems addObject:[NSURLQueryItem queryItemWithName: @"X-Amz-Signature" value:signatureString]];
 
-        // Regenerate the escaped query string now that we've added the signature
-        queryString = [self getURIEncodedQueryStringForSigV4:queryItems];
+    // Regenerate the escaped query string now that we've added the signature
+    queryString = [self getURIEncodedQueryStringForSigV4:queryItems];
 
-        urlComponents.percentEncodedQuery = queryString;
+    urlComponents.percentEncodedQuery = queryString;
 
-        AWSDDLogVerbose(@"AWS4 PresignedURL: [%@]", urlComponents.URL);
-        return urlComponents.URL;
-    }];
+    AWSDDLogVerbose(@"AWS4 PresignedURL: [%@]", urlComponents.URL);
+    return urlComponents.URL;
 }
 
 + (NSString *)getCredentialScopeForDate:(NSDate *)date
@@ -613,6 +1056,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 + (NSString *)getCanonicalizedRequest:(NSString *)method path:(NSString *)path query:(NSString *)query headers:(NSDictionary *)headers contentSha256:(NSString *)contentSha256 {
+    NSParameterAssert(contentSha256);
     NSMutableString *canonicalRequest = [NSMutableString new];
     [canonicalRequest appendString:method];
     [canonicalRequest appendString:@"\n"];
@@ -633,6 +1077,35 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     return canonicalRequest;
 }
 
++ (NSString *)getCanonicalizedRequestHash:(NSString *)method
+                                     path:(NSString *)path
+                                    query:(NSString *)query
+                                  headers:(NSDictionary *)headers
+                            contentSha256:(NSString *)contentSha256 {
+    NSParameterAssert(contentSha256);
+    CC_SHA256_CTX context;
+    CC_SHA256_Init(&context);
+    aws_sigv4_sink sink = {AWSSignatureV4SHA256Write, &context};
+
+    // A missing payload hash goes through the string builder too, so that both write it the same way when assertions
+    // are disabled.
+    if (contentSha256 == nil || !AWSSignatureV4WriteCanonicalRequest(method, path, query, headers, contentSha256, &sink)) {
+        if (contentSha256) {
+            AWSDDLogWarn(@"Failed to allocate memory for the canonical request, falling back to the string builder.");
+        }
+        NSString *canonicalRequest = [self getCanonicalizedRequest:method
+                                                              path:path
+                                                             query:query
+                                                           headers:headers
+                                                     contentSha256:contentSha256];
+        return [[AWSSignatureSignerUtility hashData:[canonicalRequest dataUsingEncoding:NSUTF8StringEncoding]] aws_hexEncodedString];
+    }
+
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256_Final(digest, &context);
+    return AWSSignatureV4HexString(digest, CC_SHA256_DIGEST_LENGTH);
+}
+
 + (NSString *)getCanonicalizedQueryString:(NSString *)query {
     NSMutableDictionary<NSString *, NSMutableArray<NSString *> *> *queryDictionary = [NSMutableDictionary new];
     [[query componentsSeparatedByString:@"&"] enumerateObjectsUsingBlock:^(id obj, NSUInteger idx, BOOL *stop) {
@@ -723,19 +1196,10 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 + (NSData *)getV4DerivedKey:(NSString *)secret date:(NSString *)dateStamp region:(NSString *)regionName service:(NSString *)serviceName {
-    // AWS4 uses a series of derived keys, formed by hashing different pieces of data
-    NSString *kSecret = [NSString stringWithFormat:@"%@%@", AWSSigV4Marker, secret];
-    NSData *kDate = [AWSSignatureSignerUtility sha256HMacWithData:[dateStamp dataUsingEncoding:NSUTF8StringEncoding]
-                                                          withKey:[kSecret dataUsingEncoding:NSUTF8StringEncoding]];
-    NSData *kRegion = [AWSSignatureSignerUtility sha256HMacWithData:[regionName dataUsingEncoding:NSASCIIStringEncoding]
-                                                            withKey:kDate];
-    NSData *kService = [AWSSignatureSignerUtility sha256HMacWithData:[serviceName dataUsingEncoding:NSUTF8StringEncoding]
-                                                             withKey:kRegion];
-    NSData *kSigning = [AWSSignatureSignerUtility sha256HMacWithData:[AWSSignatureV4Terminator dataUsingEncoding:NSUTF8StringEncoding]
-                                                             withKey:kService];
-
-    //TODO: cache this derived key?
-    return kSigning;
+    return [[AWSSignatureV4SigningKeyCache sharedCache] signingKeyForSecretKey:secret
+                                                                      dateStamp:dateStamp
+                                                                     regionName:regionName
+                                                                    serviceName:serviceName];
 }
 
 // For SigV2
@@ -845,32 +1309,78 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
 #pragma mark - S3ChunkedEncodingInputStream
 
-static NSUInteger defaultChunkSize = 32 * 1024 - 91;
-static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+NSUInteger const AWSS3ChunkedEncodingMinimumChunkSize = 8 * 1024;
+NSUInteger const AWSS3ChunkedEncodingMaximumChunkSize = 8 * 1024 * 1024;
+
+// Used when no chunk size is given, until the reader tells us how much it wants per read.
+static NSUInteger const AWSS3ChunkedEncodingDefaultChunkSize = 32 * 1024 - 91;
+
+static char const AWSS3EmptyStringSha256[] = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static char const AWSS3ChunkSignaturePrefix[] = ";chunk-signature=";
+
+// <6 hex digits>;chunk-signature=<64 hex digits>\r\n<data>\r\n
+enum {
+    AWSS3ChunkSizeHexLength = 6,
+    AWSS3ChunkSignatureLength = 2 * CC_SHA256_DIGEST_LENGTH,
+    AWSS3ChunkHeaderLength = AWSS3ChunkSizeHexLength + sizeof(AWSS3ChunkSignaturePrefix) - 1 + AWSS3ChunkSignatureLength + 2,
+    AWSS3ChunkTrailerLength = 2,
+};
+
+// 0\r\nx-amz-checksum-crc32c:<8 base64 characters>\r\n\r\n
+static char const AWSS3ChecksumTrailerPrefix[] = "x-amz-checksum-crc32c:";
+enum {
+    AWSS3ChecksumLength = 8,
+    AWSS3ChecksumTrailerLength = sizeof(AWSS3ChecksumTrailerPrefix) - 1 + AWSS3ChecksumLength + 4,
+};
+
+static NSUInteger AWSS3ChunkedEncodingClampChunkSize(NSUInteger chunkSize) {
+    return MIN(MAX(chunkSize, AWSS3ChunkedEncodingMinimumChunkSize), AWSS3ChunkedEncodingMaximumChunkSize);
+}
+
+// Number of hex digits in the chunk size of an unsigned chunk.
+static size_t AWSS3UnsignedChunkSizeHexLength(NSUInteger dataLength) {
+    size_t length = 1;
+    while (dataLength >>= 4) {
+        length++;
+    }
+    return length;
+}
+
+@interface AWSS3ChunkedEncodingInputStream() {
+    // One frame holds the chunk header, the chunk data and the trailing CRLF. The data is read straight into place,
+    // and the header is written in front of it once the data has been signed.
+    uint8_t *_frame;
+    NSUInteger _frameDataCapacity;
+    NSUInteger _frameStart;
+    NSUInteger _frameLength;
+
+    // Unsigned chunks have a shorter header, and a CRC32C of the data instead of a signature chain.
+    BOOL _signsChunks;
+    uint32_t _crc32c;
 
-@interface AWSS3ChunkedEncodingInputStream()
+    // Signature of previous chunk. It's initialized as that of headers.
+    char _priorSignature[AWSS3ChunkSignatureLength];
+    size_t _priorSignatureLength;
+
+    // Data chunk size to use when `chunkSize` is 0. It follows the reader's buffer size.
+    NSUInteger _adaptiveChunkSize;
+}
 
 // original input stream
 @property (nonatomic, strong) NSInputStream *stream;
 
-// buffer for chunked data plus header
-@property (nonatomic, strong) NSMutableData *chunkData;
-
-// Mark the location of chunkData to be read
+// Mark the location of the current frame to be read
 @property (nonatomic, assign) NSUInteger location;
 
-// A flag indicates end of stream
+// A flag indicates the original input stream has no more data
+@property (nonatomic, assign) BOOL sourceExhausted;
+
+// A flag indicates end of stream, i.e. the final zero length chunk has been produced
 @property (nonatomic, assign) BOOL endOfStream;
 
 // SigV4 related properties
-// Date, used in signing
-@property (nonatomic, strong) NSDate *date;
-
-// Keypath/Scope
-@property (nonatomic, strong) NSString *scope;
-
-// Signature of previous chunk. It's initialized as that of headers.
-@property (nonatomic, strong) NSString *priorSha256;
+// "AWS4-HMAC-SHA256-PAYLOAD\n<date>\n<scope>\n", the part of the string to sign shared by every chunk
+@property (nonatomic, strong) NSData *stringToSignPrefix;
 
 // SigV4 signing key
 @property (nonatomic, strong) NSData *kSigning;
@@ -886,22 +1396,58 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
                               scope:(NSString *)scope
                            kSigning:(NSData *)kSigning
                     headerSignature:(NSString *)headerSignature {
+    return [self initWithInputStream:stream
+                                date:date
+                               scope:scope
+                            kSigning:kSigning
+                     headerSignature:headerSignature
+                           chunkSize:0];
+}
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                               date:(NSDate *)date
+                              scope:(NSString *)scope
+                           kSigning:(NSData *)kSigning
+                    headerSignature:(NSString *)headerSignature
+                          chunkSize:(NSUInteger)chunkSize {
     if (self = [super init]) {
         _stream = stream;
         _stream.delegate = self;
-        _date = [date copy];
-        _scope = [scope copy];
         _kSigning = [kSigning copy];
-        _priorSha256 = [headerSignature copy];
+        _signsChunks = YES;
+        _chunkSize = chunkSize > 0 ? AWSS3ChunkedEncodingClampChunkSize(chunkSize) : 0;
+        _adaptiveChunkSize = AWSS3ChunkedEncodingDefaultChunkSize;
+
+        NSString *stringToSignPrefix = [NSString stringWithFormat:@"AWS4-HMAC-SHA256-PAYLOAD\n%@\n%@\n",
+                                        [date aws_stringValue:AWSDateISO8601DateFormat2],
+                                        scope];
+        _stringToSignPrefix = [stringToSignPrefix dataUsingEncoding:NSUTF8StringEncoding];
+
+        NSData *headerSignatureData = [headerSignature dataUsingEncoding:NSUTF8StringEncoding];
+        _priorSignatureLength = MIN([headerSignatureData length], sizeof(_priorSignature));
+        memcpy(_priorSignature, [headerSignatureData bytes], _priorSignatureLength);
+    }
+
+    return self;
+}
 
-        // Chunk size plus signature header
-        NSUInteger chunkSize = defaultChunkSize + [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:defaultChunkSize];
-        _chunkData = [[NSMutableData alloc] initWithCapacity:chunkSize];
+- (instancetype)initWithUnsignedInputStream:(NSInputStream *)stream
+                                  chunkSize:(NSUInteger)chunkSize {
+    if (self = [super init]) {
+        _stream = stream;
+        _stream.delegate = self;
+        _signsChunks = NO;
+        _chunkSize = chunkSize > 0 ? AWSS3ChunkedEncodingClampChunkSize(chunkSize) : 0;
+        _adaptiveChunkSize = AWSS3ChunkedEncodingDefaultChunkSize;
     }
 
     return self;
 }
 
+- (void)dealloc {
+    free(_frame);
+}
+
 - (void)stream:(NSStream *)aStream handleEvent:(NSStreamEvent)eventCode {
     if ((eventCode & (1 << 4))) {
         // toggle the NSStreamEventEndEncountered bit.
@@ -912,6 +1458,23 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
     }
 }
 
+// Makes sure the frame can hold `chunkSize` bytes of data. The frame only grows, so once the reader settles on a buffer
+// size no more allocations are made.
+- (BOOL)reserveFrameForChunkSize:(NSUInteger)chunkSize {
+    if (_frame != NULL && _frameDataCapacity >= chunkSize) {
+        return YES;
+    }
+
+    uint8_t *frame = realloc(_frame, AWSS3ChunkHeaderLength + chunkSize + AWSS3ChunkTrailerLength);
+    if (frame == NULL) {
+        AWSDDLogError(@"Failed to allocate a %lu bytes chunk buffer.", (unsigned long)chunkSize);
+        return NO;
+    }
+    _frame = frame;
+    _frameDataCapacity = chunkSize;
+    return YES;
+}
+
 // Read next chunk of data from stream, and sign the chunk.
 // Returns YES on a successful read, NO otherwise.
 - (BOOL)nextChunk {
@@ -919,70 +1482,135 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
         return NO;
     }
 
-    // clear current chunkData for next chunk
-    [self.chunkData setLength:0];
-
-    uint8_t *chunkBuffer = calloc(defaultChunkSize, sizeof(uint8_t));
-    NSInteger read = [self.stream read:chunkBuffer maxLength:defaultChunkSize];
+    NSUInteger chunkSize = self.chunkSize > 0 ? self.chunkSize : _adaptiveChunkSize;
+    if (![self reserveFrameForChunkSize:chunkSize]) {
+        return NO;
+    }
 
-    // mark end of stream if no data is read
-    self.endOfStream = (read <= 0);
+    // Fill the chunk, as S3 rejects non-final chunks smaller than 8 KiB.
+    uint8_t *data = _frame + AWSS3ChunkHeaderLength;
+    NSUInteger dataLength = 0;
+    while (!self.sourceExhausted && dataLength < chunkSize) {
+        NSInteger read = [self.stream read:data + dataLength maxLength:chunkSize - dataLength];
+
+        // return NO if stream read failed
+        if (read < 0) {
+            self.endOfStream = YES;
+            AWSDDLogError(@"stream read failed streamStatus: %lu streamError: %@", (unsigned long)[self.stream streamStatus], [self.stream streamError].description);
+            return NO;
+        }
 
-    // return NO if stream read failed
-    if (read < 0) {
-        free(chunkBuffer);
-        AWSDDLogError(@"stream read failed streamStatus: %lu streamError: %@", (unsigned long)[self.stream streamStatus], [self.stream streamError].description);
-        return NO;
+        self.sourceExhausted = (read == 0);
+        dataLength += read;
     }
 
-    NSData *data = [NSData dataWithBytesNoCopy:chunkBuffer length:read];
-    [self.chunkData appendData:[self getSignedChunk:data]];
+    // an empty chunk marks the end of stream
+    self.endOfStream = (dataLength == 0);
+
+    if (_signsChunks) {
+        [self signChunkWithLength:dataLength];
+    } else {
+        [self checksumChunkWithLength:dataLength];
+    }
 
-    AWSDDLogVerbose(@"stream read: %ld, chunk size: %lu", (long)read, (unsigned long)[self.chunkData length]);
+    AWSDDLogVerbose(@"stream read: %lu, chunk size: %lu", (unsigned long)dataLength, (unsigned long)_frameLength);
 
     return YES;
 }
 
-// Signs data
-- (NSData *)getSignedChunk:(NSData *)data {
-    NSString *chunkSha256 = [self dataToHexString:[AWSSignatureSignerUtility hashData:data]];
-    NSString *stringToSign = [NSString stringWithFormat:
-                              @"%@\n%@\n%@\n%@\n%@\n%@",
-                              @"AWS4-HMAC-SHA256-PAYLOAD",
-                              [self.date aws_stringValue:AWSDateISO8601DateFormat2],
-                              self.scope,
-                              self.priorSha256,
-                              emptyStringSha256,
-                              chunkSha256];
-    AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
+// Signs the data at the front of the frame and writes the chunk header and trailer around it.
+- (void)signChunkWithLength:(NSUInteger)dataLength {
+    uint8_t *data = _frame + AWSS3ChunkHeaderLength;
 
-    NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                              withKey:self.kSigning];
-    self.priorSha256 = [self dataToHexString:signature];
-    NSString *chunkedHeader = [NSString stringWithFormat:@"%06lx;chunk-signature=%@\r\n", (unsigned long)[data length], self.priorSha256];
-    AWSDDLogVerbose(@"AWS4 Chunked Header: [%@]", chunkedHeader);
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data, (CC_LONG)dataLength, digest);
+    char chunkSha256[AWSS3ChunkSignatureLength];
+    aws_hex_encode(digest, CC_SHA256_DIGEST_LENGTH, chunkSha256);
 
-    NSMutableData *signedChunk = [NSMutableData data];
-    [signedChunk appendData:[chunkedHeader dataUsingEncoding:NSUTF8StringEncoding]];
-    [signedChunk appendData:data];
-    [signedChunk appendData:[@"\r\n" dataUsingEncoding:NSUTF8StringEncoding]];
-
-    self.totalLengthOfChunkSignatureSent += [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:0];
-    return signedChunk;
+    // AWS4-HMAC-SHA256-PAYLOAD\n<date>\n<scope>\n<prior signature>\n<empty string sha256>\n<chunk sha256>
+    CCHmacContext context;
+    CCHmacInit(&context, kCCHmacAlgSHA256, [self.kSigning bytes], [self.kSigning length]);
+    CCHmacUpdate(&context, [self.stringToSignPrefix bytes], [self.stringToSignPrefix length]);
+    CCHmacUpdate(&context, _priorSignature, _priorSignatureLength);
+    CCHmacUpdate(&context, "\n", 1);
+    CCHmacUpdate(&context, AWSS3EmptyStringSha256, AWSS3ChunkSignatureLength);
+    CCHmacUpdate(&context, "\n", 1);
+    CCHmacUpdate(&context, chunkSha256, sizeof(chunkSha256));
+    CCHmacFinal(&context, digest);
+    aws_hex_encode(digest, CC_SHA256_DIGEST_LENGTH, _priorSignature);
+    _priorSignatureLength = sizeof(_priorSignature);
+
+    static const char hexDigits[] = "0123456789abcdef";
+    uint8_t *header = _frame;
+    NSUInteger remaining = dataLength;
+    for (size_t i = AWSS3ChunkSizeHexLength; i > 0; i--) {
+        header[i - 1] = hexDigits[remaining & 0xf];
+        remaining >>= 4;
+    }
+    header += AWSS3ChunkSizeHexLength;
+    memcpy(header, AWSS3ChunkSignaturePrefix, sizeof(AWSS3ChunkSignaturePrefix) - 1);
+    header += sizeof(AWSS3ChunkSignaturePrefix) - 1;
+    memcpy(header, _priorSignature, AWSS3ChunkSignatureLength);
+    header += AWSS3ChunkSignatureLength;
+    memcpy(header, "\r\n", 2);
+    memcpy(data + dataLength, "\r\n", AWSS3ChunkTrailerLength);
+
+    _frameStart = 0;
+    _frameLength = AWSS3ChunkHeaderLength + dataLength + AWSS3ChunkTrailerLength;
+    AWSDDLogVerbose(@"AWS4 Chunked Header: [%@]", [[NSString alloc] initWithBytes:_frame
+                                                                            length:AWSS3ChunkHeaderLength
+                                                                          encoding:NSASCIIStringEncoding]);
+
+    self.totalLengthOfChunkSignatureSent += AWSS3ChunkHeaderLength + AWSS3ChunkTrailerLength;
 }
 
-- (NSString *)dataToHexString:(NSData *) data {
-    return [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:data
-                                                                      encoding:NSASCIIStringEncoding]];
+// Adds the data at the front of the frame to the running checksum and writes the unsigned chunk header in front of it.
+// The final chunk carries the checksum trailer instead of the CRLF after the data.
+- (void)checksumChunkWithLength:(NSUInteger)dataLength {
+    uint8_t *data = _frame + AWSS3ChunkHeaderLength;
+    _crc32c = aws_crc32c(_crc32c, data, dataLength);
+
+    static const char hexDigits[] = "0123456789abcdef";
+    size_t hexLength = AWSS3UnsignedChunkSizeHexLength(dataLength);
+    uint8_t *header = data - hexLength - 2;
+    NSUInteger remaining = dataLength;
+    for (size_t i = hexLength; i > 0; i--) {
+        header[i - 1] = hexDigits[remaining & 0xf];
+        remaining >>= 4;
+    }
+    memcpy(header + hexLength, "\r\n", 2);
+    _frameStart = header - _frame;
+
+    uint8_t *trailer = data + dataLength;
+    if (dataLength > 0) {
+        memcpy(trailer, "\r\n", AWSS3ChunkTrailerLength);
+        trailer += AWSS3ChunkTrailerLength;
+    } else {
+        NSString *checksum = AWSS3CRC32CChecksum(_crc32c);
+        memcpy(trailer, AWSS3ChecksumTrailerPrefix, sizeof(AWSS3ChecksumTrailerPrefix) - 1);
+        trailer += sizeof(AWSS3ChecksumTrailerPrefix) - 1;
+        memcpy(trailer, [checksum UTF8String], AWSS3ChecksumLength);
+        trailer += AWSS3ChecksumLength;
+        memcpy(trailer, "\r\n\r\n", 4);
+        trailer += 4;
+        AWSDDLogVerbose(@"Checksum trailer: x-amz-checksum-crc32c:%@", checksum);
+    }
+
+    _frameLength = trailer - header;
+    self.totalLengthOfChunkSignatureSent += _frameLength - dataLength;
 }
 
 #pragma mark NSInputStream methods
 
 - (NSInteger)read:(uint8_t *)buffer maxLength:(NSUInteger)len {
-    //change the defaultChunkSize according to caller reading capacity.
-    defaultChunkSize = len - [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:0];
+    // Without an explicit chunk size, size the chunks so that one frame fits the caller's reading capacity.
+    if (self.chunkSize == 0) {
+        NSUInteger overhead = AWSS3ChunkHeaderLength + AWSS3ChunkTrailerLength;
+        _adaptiveChunkSize = AWSS3ChunkedEncodingClampChunkSize(len > overhead ? len - overhead : 0);
+    }
+
     // check whether there is data available
-    if ([self.chunkData length] <= self.location) {
+    if (_frameLength <= self.location) {
         // set up next chunk
         if ([self nextChunk]) {
             // rewind location
@@ -993,9 +1621,8 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
     }
 
     // compute how many bytes to read from chunk
-    NSUInteger length = MIN(len, [self.chunkData length] - self.location);
-    NSRange range = {self.location, length};
-    [self.chunkData getBytes:(void *)buffer range:range];
+    NSUInteger length = MIN(len, _frameLength - self.location);
+    memcpy(buffer, _frame + _frameStart + self.location, length);
 
     // Update location
     self.location += length;
@@ -1074,24 +1701,49 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
  * <data>\r\n
  **/
 + (NSUInteger)oneChunkedDataSize:(NSUInteger)dataLength {
-    return [[NSString stringWithFormat:@"%06lx;chunk-signature=%@\r\n",  (unsigned long)dataLength, emptyStringSha256] length] + dataLength + [@"\r\n" length];
+    return AWSS3ChunkHeaderLength + dataLength + AWSS3ChunkTrailerLength;
 }
 
 + (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength {
+    return [self computeContentLengthForChunkedData:dataLength chunkSize:0];
+}
+
++ (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength
+                                       chunkSize:(NSUInteger)chunkSize {
+    chunkSize = chunkSize > 0 ? AWSS3ChunkedEncodingClampChunkSize(chunkSize) : AWSS3ChunkedEncodingDefaultChunkSize;
     NSUInteger result = 0;
 
     // length of full chunks
-    result += (dataLength / defaultChunkSize) * [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:defaultChunkSize];
-    
+    result += (dataLength / chunkSize) * [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:chunkSize];
+
     // length of remaining data
-    NSUInteger remainingDataLength = dataLength % defaultChunkSize;
+    NSUInteger remainingDataLength = dataLength % chunkSize;
     if (remainingDataLength > 0) {
         result += [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:remainingDataLength];
     }
-    
+
     // length of final chunk
     result += [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:0];
-    
+
+    return result;
+}
+
++ (NSUInteger)computeContentLengthForUnsignedChunkedData:(NSUInteger)dataLength
+                                               chunkSize:(NSUInteger)chunkSize {
+    chunkSize = chunkSize > 0 ? AWSS3ChunkedEncodingClampChunkSize(chunkSize) : AWSS3ChunkedEncodingDefaultChunkSize;
+    NSUInteger result = dataLength;
+
+    // <size in hex>\r\n<data>\r\n for each chunk with data
+    NSUInteger fullChunks = dataLength / chunkSize;
+    result += fullChunks * (AWSS3UnsignedChunkSizeHexLength(chunkSize) + 4);
+    NSUInteger remainingDataLength = dataLength % chunkSize;
+    if (remainingDataLength > 0) {
+        result += AWSS3UnsignedChunkSizeHexLength(remainingDataLength) + 4;
+    }
+
+    // 0\r\n followed by the checksum trailer
+    result += 3 + AWSS3ChecksumTrailerLength;
+
     return result;
 }
 
@@ -0,0 +1,130 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#include "aws_crc32c.h"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+#if defined(__ARM_FEATURE_CRC32) || defined(__SSE4_2__)
+
+static inline uint32_t aws_crc32c_u8(uint32_t crc, uint8_t value) {
+#if defined(__ARM_FEATURE_CRC32)
+    return __crc32cb(crc, value);
+#else
+    return _mm_crc32_u8(crc, value);
+#endif
+}
+
+static inline uint32_t aws_crc32c_u64(uint32_t crc, uint64_t value) {
+#if defined(__ARM_FEATURE_CRC32)
+    return __crc32cd(crc, value);
+#else
+    return (uint32_t)_mm_crc32_u64(crc, value);
+#endif
+}
+
+uint32_t aws_crc32c(uint32_t crc, const uint8_t *bytes, size_t length) {
+    crc = ~crc;
+
+    /* Align to 8 bytes, then consume a word at a time. */
+    while (length > 0 && ((uintptr_t)bytes & 7) != 0) {
+        crc = aws_crc32c_u8(crc, *bytes++);
+        length--;
+    }
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, bytes, sizeof(word));
+        crc = aws_crc32c_u64(crc, word);
+        bytes += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = aws_crc32c_u8(crc, *bytes++);
+        length--;
+    }
+
+    return ~crc;
+}
+
+#else
+
+/* Reflected Castagnoli polynomial. */
+#define AWS_CRC32C_POLYNOMIAL 0x82F63B78u
+
+static uint32_t aws_crc32c_table[8][256];
+static int aws_crc32c_table_ready = 0;
+
+static void aws_crc32c_init_table(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ AWS_CRC32C_POLYNOMIAL : crc >> 1;
+        }
+        aws_crc32c_table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = aws_crc32c_table[0][i];
+        for (int slice = 1; slice < 8; slice++) {
+            crc = aws_crc32c_table[0][crc & 0xFF] ^ (crc >> 8);
+            aws_crc32c_table[slice][i] = crc;
+        }
+    }
+}
+
+uint32_t aws_crc32c(uint32_t crc, const uint8_t *bytes, size_t length) {
+    /*
+     * Building the table twice from racing threads is harmless: every writer
+     * stores the same values.
+     */
+    if (!__atomic_load_n(&aws_crc32c_table_ready, __ATOMIC_ACQUIRE)) {
+        aws_crc32c_init_table();
+        __atomic_store_n(&aws_crc32c_table_ready, 1, __ATOMIC_RELEASE);
+    }
+
+    crc = ~crc;
+
+    /* Slicing-by-8 on little endian words. */
+    while (length >= 8) {
+        uint32_t low;
+        uint32_t high;
+        memcpy(&low, bytes, sizeof(low));
+        memcpy(&high, bytes + 4, sizeof(high));
+        low ^= crc;
+        crc = aws_crc32c_table[7][low & 0xFF] ^
+              aws_crc32c_table[6][(low >> 8) & 0xFF] ^
+              aws_crc32c_table[5][(low >> 16) & 0xFF] ^
+              aws_crc32c_table[4][low >> 24] ^
+              aws_crc32c_table[3][high & 0xFF] ^
+              aws_crc32c_table[2][(high >> 8) & 0xFF] ^
+              aws_crc32c_table[1][(high >> 16) & 0xFF] ^
+              aws_crc32c_table[0][high >> 24];
+        bytes += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = aws_crc32c_table[0][(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+        length--;
+    }
+
+    return ~crc;
+}
+
+#endif
@@ -0,0 +1,39 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#ifndef AWS_CRC32C_H
+#define AWS_CRC32C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CRC32C (Castagnoli), as used by the x-amz-checksum-crc32c header and trailer.
+ *
+ * The checksum can be computed incrementally: start from 0 and feed the
+ * previous result back in as crc. Uses the ARMv8 CRC32 instructions or
+ * SSE 4.2 when the target has them, and a slicing-by-8 table otherwise.
+ */
+uint32_t aws_crc32c(uint32_t crc, const uint8_t *bytes, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_CRC32C_H */
@@ -0,0 +1,377 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#include "aws_sigv4_canonical.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Query strings with up to this many parameters are sorted without touching the heap. */
+#define AWS_SIGV4_INLINE_QUERY_PARAMETERS 32
+
+/* Size of the staging buffer used to batch small writes into the sink. */
+#define AWS_SIGV4_STAGING_BUFFER_SIZE 256
+
+static const uint8_t aws_sigv4_newline = '\n';
+
+static void aws_sigv4_write(const aws_sigv4_sink *sink, const uint8_t *bytes, size_t length) {
+    if (length > 0) {
+        sink->write(sink->context, bytes, length);
+    }
+}
+
+/* --- Whitespace --- */
+
+/*
+ * Returns the length in bytes of the whitespace character starting at bytes, or 0.
+ * Matches +[NSCharacterSet whitespaceCharacterSet]: tab and the Unicode space separators (Zs).
+ */
+static size_t aws_sigv4_whitespace_prefix_length(const uint8_t *bytes, size_t length) {
+    if (length == 0) {
+        return 0;
+    }
+    switch (bytes[0]) {
+        case 0x09:
+        case 0x20:
+            return 1;
+        case 0xC2:
+            /* U+00A0 */
+            return (length >= 2 && bytes[1] == 0xA0) ? 2 : 0;
+        case 0xE1:
+            /* U+1680 */
+            return (length >= 3 && bytes[1] == 0x9A && bytes[2] == 0x80) ? 3 : 0;
+        case 0xE2:
+            if (length < 3) {
+                return 0;
+            }
+            /* U+2000 - U+200A, U+202F */
+            if (bytes[1] == 0x80 && ((bytes[2] >= 0x80 && bytes[2] <= 0x8A) || bytes[2] == 0xAF)) {
+                return 3;
+            }
+            /* U+205F */
+            return (bytes[1] == 0x81 && bytes[2] == 0x9F) ? 3 : 0;
+        case 0xE3:
+            /* U+3000 */
+            return (length >= 3 && bytes[1] == 0x80 && bytes[2] == 0x80) ? 3 : 0;
+        default:
+            return 0;
+    }
+}
+
+/* Returns the length in bytes of the whitespace character ending at bytes + length, or 0. */
+static size_t aws_sigv4_whitespace_suffix_length(const uint8_t *bytes, size_t length) {
+    if (length == 0) {
+        return 0;
+    }
+    if (bytes[length - 1] == 0x09 || bytes[length - 1] == 0x20) {
+        return 1;
+    }
+    if (length >= 2 && aws_sigv4_whitespace_prefix_length(bytes + length - 2, 2) == 2) {
+        return 2;
+    }
+    if (length >= 3 && aws_sigv4_whitespace_prefix_length(bytes + length - 3, 3) == 3) {
+        return 3;
+    }
+    return 0;
+}
+
+static void aws_sigv4_trim(const uint8_t **bytes, size_t *length) {
+    size_t whitespace;
+    while ((whitespace = aws_sigv4_whitespace_prefix_length(*bytes, *length)) > 0) {
+        *bytes += whitespace;
+        *length -= whitespace;
+    }
+    while ((whitespace = aws_sigv4_whitespace_suffix_length(*bytes, *length)) > 0) {
+        *length -= whitespace;
+    }
+}
+
+/*
+ * Collapses every run of whitespace into a single space and drops leading and trailing
+ * whitespace, batching the output into a small staging buffer.
+ */
+typedef struct aws_sigv4_collapsing_writer {
+    const aws_sigv4_sink *sink;
+    int has_output;
+    int pending_space;
+    size_t staged;
+    uint8_t staging[AWS_SIGV4_STAGING_BUFFER_SIZE];
+} aws_sigv4_collapsing_writer;
+
+static void aws_sigv4_collapsing_writer_flush(aws_sigv4_collapsing_writer *writer) {
+    aws_sigv4_write(writer->sink, writer->staging, writer->staged);
+    writer->staged = 0;
+}
+
+static void aws_sigv4_collapsing_writer_put(aws_sigv4_collapsing_writer *writer, uint8_t byte) {
+    if (writer->staged == AWS_SIGV4_STAGING_BUFFER_SIZE) {
+        aws_sigv4_collapsing_writer_flush(writer);
+    }
+    writer->staging[writer->staged++] = byte;
+}
+
+static void aws_sigv4_collapsing_writer_write(aws_sigv4_collapsing_writer *writer, const uint8_t *bytes, size_t length) {
+    size_t i = 0;
+    while (i < length) {
+        size_t whitespace = aws_sigv4_whitespace_prefix_length(bytes + i, length - i);
+        if (whitespace > 0) {
+            writer->pending_space = writer->has_output;
+            i += whitespace;
+            continue;
+        }
+        if (writer->pending_space) {
+            aws_sigv4_collapsing_writer_put(writer, ' ');
+            writer->pending_space = 0;
+        }
+        aws_sigv4_collapsing_writer_put(writer, bytes[i]);
+        writer->has_output = 1;
+        i++;
+    }
+}
+
+/* --- Headers --- */
+
+static uint8_t aws_sigv4_ascii_lowercase(uint8_t byte) {
+    return (byte >= 'A' && byte <= 'Z') ? (uint8_t)(byte + ('a' - 'A')) : byte;
+}
+
+static int aws_sigv4_compare_header_names(const void *lhs, const void *rhs) {
+    const aws_sigv4_header *left = (const aws_sigv4_header *)lhs;
+    const aws_sigv4_header *right = (const aws_sigv4_header *)rhs;
+    size_t length = left->name_length < right->name_length ? left->name_length : right->name_length;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t l = aws_sigv4_ascii_lowercase(left->name[i]);
+        uint8_t r = aws_sigv4_ascii_lowercase(right->name[i]);
+        if (l != r) {
+            return l < r ? -1 : 1;
+        }
+    }
+    if (left->name_length == right->name_length) {
+        return 0;
+    }
+    return left->name_length < right->name_length ? -1 : 1;
+}
+
+void aws_sigv4_sort_headers(aws_sigv4_header *headers, size_t header_count) {
+    if (header_count > 1) {
+        qsort(headers, header_count, sizeof(aws_sigv4_header), aws_sigv4_compare_header_names);
+    }
+}
+
+void aws_sigv4_write_canonical_headers(const aws_sigv4_header *headers, size_t header_count, const aws_sigv4_sink *sink) {
+    aws_sigv4_collapsing_writer writer;
+    writer.sink = sink;
+    writer.has_output = 0;
+    writer.pending_space = 0;
+    writer.staged = 0;
+
+    for (size_t i = 0; i < header_count; i++) {
+        const aws_sigv4_header *header = &headers[i];
+        for (size_t j = 0; j < header->name_length; j++) {
+            uint8_t lowercase = aws_sigv4_ascii_lowercase(header->name[j]);
+            aws_sigv4_collapsing_writer_write(&writer, &lowercase, 1);
+        }
+        aws_sigv4_collapsing_writer_write(&writer, (const uint8_t *)":", 1);
+
+        const uint8_t *value = header->value;
+        size_t value_length = header->value_length;
+        aws_sigv4_trim(&value, &value_length);
+        aws_sigv4_collapsing_writer_write(&writer, value, value_length);
+        aws_sigv4_collapsing_writer_write(&writer, &aws_sigv4_newline, 1);
+    }
+
+    aws_sigv4_collapsing_writer_flush(&writer);
+}
+
+void aws_sigv4_write_signed_headers(const aws_sigv4_header *headers, size_t header_count, const aws_sigv4_sink *sink) {
+    uint8_t staging[AWS_SIGV4_STAGING_BUFFER_SIZE];
+    size_t staged = 0;
+
+    for (size_t i = 0; i < header_count; i++) {
+        const aws_sigv4_header *header = &headers[i];
+        for (size_t j = (i == 0 ? 1 : 0); j < header->name_length + 1; j++) {
+            if (staged == AWS_SIGV4_STAGING_BUFFER_SIZE) {
+                aws_sigv4_write(sink, staging, staged);
+                staged = 0;
+            }
+            /* Index 0 is the separator that precedes every name but the first one. */
+            staging[staged++] = (j == 0) ? ';' : aws_sigv4_ascii_lowercase(header->name[j - 1]);
+        }
+    }
+
+    aws_sigv4_write(sink, staging, staged);
+}
+
+/* --- Query --- */
+
+typedef struct aws_sigv4_query_parameter {
+    const uint8_t *name;
+    size_t name_length;
+    const uint8_t *value;
+    size_t value_length;
+} aws_sigv4_query_parameter;
+
+static int aws_sigv4_compare_bytes(const uint8_t *left, size_t left_length, const uint8_t *right, size_t right_length) {
+    size_t length = left_length < right_length ? left_length : right_length;
+    int result = length > 0 ? memcmp(left, right, length) : 0;
+    if (result != 0) {
+        return result;
+    }
+    if (left_length == right_length) {
+        return 0;
+    }
+    return left_length < right_length ? -1 : 1;
+}
+
+static int aws_sigv4_compare_query_parameters(const void *lhs, const void *rhs) {
+    const aws_sigv4_query_parameter *left = (const aws_sigv4_query_parameter *)lhs;
+    const aws_sigv4_query_parameter *right = (const aws_sigv4_query_parameter *)rhs;
+    int result = aws_sigv4_compare_bytes(left->name, left->name_length, right->name, right->name_length);
+    if (result != 0) {
+        return result;
+    }
+    return aws_sigv4_compare_bytes(left->value, left->value_length, right->value, right->value_length);
+}
+
+/*
+ * Parses the query into parameters. When parameters is NULL, only counts them.
+ * Returns the number of parameters kept.
+ */
+static size_t aws_sigv4_parse_query(const uint8_t *query, size_t query_length, aws_sigv4_query_parameter *parameters) {
+    size_t count = 0;
+    size_t start = 0;
+    while (start <= query_length) {
+        const uint8_t *segment = query + start;
+        const uint8_t *end = query_length > start ? memchr(segment, '&', query_length - start) : NULL;
+        size_t segment_length = end ? (size_t)(end - segment) : query_length - start;
+
+        const uint8_t *separator = segment_length > 0 ? memchr(segment, '=', segment_length) : NULL;
+        size_t name_length = separator ? (size_t)(separator - segment) : segment_length;
+        int has_second_separator = separator && memchr(separator + 1, '=', segment_length - name_length - 1) != NULL;
+
+        /* `a=b` and `a` are kept, `=b`, `a=b=c` and empty segments are dropped. */
+        if (name_length > 0 && !has_second_separator) {
+            if (parameters) {
+                parameters[count].name = segment;
+                parameters[count].name_length = name_length;
+                parameters[count].value = separator ? separator + 1 : segment + segment_length;
+                parameters[count].value_length = separator ? segment_length - name_length - 1 : 0;
+            }
+            count++;
+        }
+
+        start += segment_length + 1;
+    }
+    return count;
+}
+
+/*
+ * Returns 1 if every parameter of the query has a name and exactly one '=',
+ * and the parameters are already sorted, as in a form body written by
+ * AWSQueryBodyWriter. Such a query is its own canonical form.
+ */
+static int aws_sigv4_query_is_canonical(const uint8_t *query, size_t query_length) {
+    aws_sigv4_query_parameter previous = {0};
+    size_t start = 0;
+    while (start <= query_length) {
+        const uint8_t *segment = query + start;
+        const uint8_t *end = query_length > start ? memchr(segment, '&', query_length - start) : NULL;
+        size_t segment_length = end ? (size_t)(end - segment) : query_length - start;
+
+        const uint8_t *separator = segment_length > 0 ? memchr(segment, '=', segment_length) : NULL;
+        if (separator == NULL || separator == segment) {
+            return 0;
+        }
+        aws_sigv4_query_parameter parameter;
+        parameter.name = segment;
+        parameter.name_length = (size_t)(separator - segment);
+        parameter.value = separator + 1;
+        parameter.value_length = segment_length - parameter.name_length - 1;
+        if (memchr(parameter.value, '=', parameter.value_length) != NULL) {
+            return 0;
+        }
+        if (previous.name && aws_sigv4_compare_query_parameters(&previous, &parameter) > 0) {
+            return 0;
+        }
+
+        previous = parameter;
+        start += segment_length + 1;
+    }
+    return 1;
+}
+
+int aws_sigv4_write_canonical_query(const uint8_t *query, size_t query_length, const aws_sigv4_sink *sink) {
+    if (query_length == 0) {
+        return AWS_SIGV4_OK;
+    }
+
+    if (aws_sigv4_query_is_canonical(query, query_length)) {
+        aws_sigv4_write(sink, query, query_length);
+        return AWS_SIGV4_OK;
+    }
+
+    aws_sigv4_query_parameter inline_parameters[AWS_SIGV4_INLINE_QUERY_PARAMETERS];
+    aws_sigv4_query_parameter *parameters = inline_parameters;
+    size_t count = aws_sigv4_parse_query(query, query_length, NULL);
+    if (count > AWS_SIGV4_INLINE_QUERY_PARAMETERS) {
+        parameters = malloc(count * sizeof(aws_sigv4_query_parameter));
+        if (parameters == NULL) {
+            return AWS_SIGV4_ERROR_NO_MEMORY;
+        }
+    }
+    aws_sigv4_parse_query(query, query_length, parameters);
+
+    if (count > 1) {
+        qsort(parameters, count, sizeof(aws_sigv4_query_parameter), aws_sigv4_compare_query_parameters);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (i > 0) {
+            aws_sigv4_write(sink, (const uint8_t *)"&", 1);
+        }
+        aws_sigv4_write(sink, parameters[i].name, parameters[i].name_length);
+        aws_sigv4_write(sink, (const uint8_t *)"=", 1);
+        aws_sigv4_write(sink, parameters[i].value, parameters[i].value_length);
+    }
+
+    if (parameters != inline_parameters) {
+        free(parameters);
+    }
+    return AWS_SIGV4_OK;
+}
+
+/* --- Canonical request --- */
+
+int aws_sigv4_write_canonical_request(const aws_sigv4_canonical_request *request, const aws_sigv4_sink *sink) {
+    aws_sigv4_write(sink, request->method, request->method_length);
+    aws_sigv4_write(sink, &aws_sigv4_newline, 1);
+    aws_sigv4_write(sink, request->path, request->path_length);
+    aws_sigv4_write(sink, &aws_sigv4_newline, 1);
+
+    int result = aws_sigv4_write_canonical_query(request->query, request->query_length, sink);
+    if (result != AWS_SIGV4_OK) {
+        return result;
+    }
+    aws_sigv4_write(sink, &aws_sigv4_newline, 1);
+
+    aws_sigv4_write_canonical_headers(request->headers, request->header_count, sink);
+    aws_sigv4_write(sink, &aws_sigv4_newline, 1);
+
+    aws_sigv4_write_signed_headers(request->headers, request->header_count, sink);
+    aws_sigv4_write(sink, &aws_sigv4_newline, 1);
+
+    aws_sigv4_write(sink, request->payload_hash, request->payload_hash_length);
+    return AWS_SIGV4_OK;
+}
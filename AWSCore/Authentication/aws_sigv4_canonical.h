@@ -0,0 +1,93 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#ifndef AWS_SIGV4_CANONICAL_H
+#define AWS_SIGV4_CANONICAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Byte oriented SigV4 canonical request builder.
+ *
+ * The canonical request is never materialized: every piece is streamed into a
+ * caller supplied sink, typically an incremental SHA-256 context. The output is
+ * byte-identical to -[AWSSignatureV4Signer getCanonicalizedRequest:...]:
+ *
+ *   - query parameters are split on '&' and '=', parameters with an empty name
+ *     or more than one '=' are dropped, and the rest are sorted by name, then
+ *     by value, in byte order;
+ *   - headers are sorted by ASCII case-insensitive name, names are lowercased,
+ *     values are trimmed, and every run of whitespace (space, tab and the
+ *     Unicode space separators) is collapsed to a single space.
+ *
+ * All strings are UTF-8 and are not required to be NUL terminated.
+ */
+
+#define AWS_SIGV4_OK 0
+#define AWS_SIGV4_ERROR_NO_MEMORY -1
+
+typedef void (*aws_sigv4_write_fn)(void *context, const uint8_t *bytes, size_t length);
+
+typedef struct aws_sigv4_sink {
+    aws_sigv4_write_fn write;
+    void *context;
+} aws_sigv4_sink;
+
+typedef struct aws_sigv4_header {
+    const uint8_t *name;
+    size_t name_length;
+    const uint8_t *value;
+    size_t value_length;
+} aws_sigv4_header;
+
+typedef struct aws_sigv4_canonical_request {
+    const uint8_t *method;
+    size_t method_length;
+    const uint8_t *path;
+    size_t path_length;
+    const uint8_t *query;
+    size_t query_length;
+    /* Must be sorted with aws_sigv4_sort_headers before use. */
+    const aws_sigv4_header *headers;
+    size_t header_count;
+    const uint8_t *payload_hash;
+    size_t payload_hash_length;
+} aws_sigv4_canonical_request;
+
+/* Sorts headers in place in canonical order. */
+void aws_sigv4_sort_headers(aws_sigv4_header *headers, size_t header_count);
+
+/* Writes the canonical query string. Returns AWS_SIGV4_OK or AWS_SIGV4_ERROR_NO_MEMORY. */
+int aws_sigv4_write_canonical_query(const uint8_t *query, size_t query_length, const aws_sigv4_sink *sink);
+
+/* Writes the canonical headers block, including the trailing newline of the last header. */
+void aws_sigv4_write_canonical_headers(const aws_sigv4_header *headers, size_t header_count, const aws_sigv4_sink *sink);
+
+/* Writes the semicolon separated list of lowercased header names. */
+void aws_sigv4_write_signed_headers(const aws_sigv4_header *headers, size_t header_count, const aws_sigv4_sink *sink);
+
+/* Writes the full canonical request. Returns AWS_SIGV4_OK or AWS_SIGV4_ERROR_NO_MEMORY. */
+int aws_sigv4_write_canonical_request(const aws_sigv4_canonical_request *request, const aws_sigv4_sink *sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_SIGV4_CANONICAL_H */
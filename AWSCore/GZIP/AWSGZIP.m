@@ -29,6 +29,9 @@
 //
 //  3. This notice may not be removed or altered from any source distribution.
 //
+//  Modified for the AWS SDK: output buffers are sized from the input length
+//  instead of grown in fixed steps.
+//
 
 
 #import "AWSGZIP.h"
@@ -39,6 +42,24 @@ void awsgzip_loadGZIP(void){
 
 static const NSUInteger ChunkSize = 16384;
 
+// The gzip trailer ends with the length of the uncompressed data modulo 2^32. It is only a hint: the
+// data may have several members, or be zlib data, so it is bounded by the largest deflate ratio.
+static NSUInteger AWSGZIPExpectedLength(NSData *data)
+{
+    NSUInteger length = [data length];
+    const uint8_t *bytes = [data bytes];
+    if (length >= 18 && bytes[0] == 0x1f && bytes[1] == 0x8b)
+    {
+        const uint8_t *trailer = bytes + length - 4;
+        NSUInteger expected = (NSUInteger)trailer[0] | ((NSUInteger)trailer[1] << 8) | ((NSUInteger)trailer[2] << 16) | ((NSUInteger)trailer[3] << 24);
+        if (expected > 0 && expected / 1032 <= length)
+        {
+            return expected;
+        }
+    }
+    return MAX(length * 2, ChunkSize);
+}
+
 
 @implementation NSData (AWSGZIP)
 
@@ -58,20 +79,25 @@ static const NSUInteger ChunkSize = 16384;
         int compression = (level < 0.0f)? Z_DEFAULT_COMPRESSION: (int)(roundf(level * 9));
         if (deflateInit2(&stream, compression, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) == Z_OK)
         {
-            NSMutableData *data = [NSMutableData dataWithLength:ChunkSize];
-            while (stream.avail_out == 0)
+            // deflateBound is an upper bound of the output, so the body is compressed in one call
+            // without resizing the buffer.
+            NSMutableData *data = [NSMutableData dataWithLength:deflateBound(&stream, (uLong)[self length])];
+            stream.next_out = (uint8_t *)[data mutableBytes];
+            stream.avail_out = (uInt)[data length];
+            int status = deflate(&stream, Z_FINISH);
+            while (status == Z_OK)
             {
-                if (stream.total_out >= [data length])
-                {
-                    data.length += ChunkSize;
-                }
+                data.length += ChunkSize;
                 stream.next_out = (uint8_t *)[data mutableBytes] + stream.total_out;
                 stream.avail_out = (uInt)([data length] - stream.total_out);
-                deflate(&stream, Z_FINISH);
+                status = deflate(&stream, Z_FINISH);
             }
             deflateEnd(&stream);
-            data.length = stream.total_out;
-            return data;
+            if (status == Z_STREAM_END)
+            {
+                data.length = stream.total_out;
+                return data;
+            }
         }
     }
     return nil;
@@ -94,7 +120,7 @@ static const NSUInteger ChunkSize = 16384;
         stream.total_out = 0;
         stream.avail_out = 0;
         
-        NSMutableData *data = [NSMutableData dataWithLength:(NSUInteger)([self length] * 1.5)];
+        NSMutableData *data = [NSMutableData dataWithLength:AWSGZIPExpectedLength(self)];
         if (inflateInit2(&stream, 47) == Z_OK)
         {
             int status = Z_OK;
@@ -102,7 +128,7 @@ static const NSUInteger ChunkSize = 16384;
             {
                 if (stream.total_out >= [data length])
                 {
-                    data.length += [self length] / 2;
+                    data.length += MAX([data length] / 2, ChunkSize);
                 }
                 stream.next_out = (uint8_t *)[data mutableBytes] + stream.total_out;
                 stream.avail_out = (uInt)([data length] - stream.total_out);
@@ -0,0 +1,97 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+FOUNDATION_EXPORT NSString *const AWSGZIPErrorDomain;
+
+typedef NS_ENUM(NSInteger, AWSGZIPErrorType) {
+    AWSGZIPErrorUnknown,
+    AWSGZIPErrorInvalidData,
+    AWSGZIPErrorTruncatedData,
+};
+
+/**
+ An input stream that reads the gzip encoding of another stream, compressing it as it is read. Only one compression
+ buffer is held at any time, so it can be used as the `HTTPBodyStream` of a request whose compressed body would
+ otherwise be held in memory next to the uncompressed one.
+
+ Compressing the same bytes with the same compression level always produces the same output, so the length and
+ digest of a body can be computed by reading one stream before another is sent.
+ */
+@interface AWSGZIPInputStream : NSInputStream <NSStreamDelegate>
+
+/**
+ The number of compressed bytes read so far.
+ */
+@property (nonatomic, assign, readonly) uint64_t totalBytesRead;
+
+/**
+ @param stream The stream to compress. It is opened and closed with the receiver.
+ @param level  The compression level from `0.0` (fastest) to `1.0` (smallest), as with
+               `awsgzip_gzippedDataWithCompressionLevel:`. A negative level uses the zlib default.
+ */
+- (instancetype)initWithInputStream:(NSInputStream *)stream compressionLevel:(float)level;
+
+- (instancetype)initWithData:(NSData *)data compressionLevel:(float)level;
+
+@end
+
+/**
+ Decodes gzip, zlib or raw deflate data that arrives in pieces, such as the body of a response read as it is
+ received, and hands the decoded bytes to a block as each output buffer fills. Concatenated gzip members are decoded
+ as one stream.
+ */
+@interface AWSGZIPInflater : NSObject
+
+/**
+ The number of decoded bytes passed to the output handler so far.
+ */
+@property (nonatomic, assign, readonly) uint64_t totalBytesInflated;
+
+/**
+ Whether the end of the compressed data has been reached.
+ */
+@property (nonatomic, assign, readonly, getter=isFinished) BOOL finished;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ @param outputHandler Called with each decoded buffer. `bytes` are only valid during the call.
+ */
+- (instancetype)initWithOutputHandler:(void (^)(const void *bytes, NSUInteger length))outputHandler;
+
+/**
+ @param bufferSize The size of the output buffer. A size close to the expected decoded length, such as a multiple of
+                   the compressed length, reduces the number of calls to the output handler.
+ */
+- (instancetype)initWithBufferSize:(NSUInteger)bufferSize
+                     outputHandler:(void (^)(const void *bytes, NSUInteger length))outputHandler NS_DESIGNATED_INITIALIZER;
+
+/**
+ Decodes `data`. Returns `NO` and sets `error`, in `AWSGZIPErrorDomain`, if `data` is not valid compressed data.
+ */
+- (BOOL)appendData:(NSData *)data error:(NSError **)error;
+
+/**
+ Returns `NO` and sets `error` if the compressed data ended before the end of the stream.
+ */
+- (BOOL)finishWithError:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,365 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSGZIPStream.h"
+#import <zlib.h>
+
+NSString *const AWSGZIPErrorDomain = @"com.amazonaws.AWSGZIPErrorDomain";
+
+static NSUInteger const AWSGZIPBufferSize = 16384;
+
+// windowBits values selecting the gzip and zlib wrappers, and raw deflate.
+static int const AWSGZIPWindowBitsGZIP = 15 + 16;
+static int const AWSGZIPWindowBitsZlib = 15;
+static int const AWSGZIPWindowBitsRaw = -15;
+
+static int AWSGZIPCompressionLevel(float level) {
+    if (level < 0.0f) {
+        return Z_DEFAULT_COMPRESSION;
+    }
+    return (int)roundf(MIN(level, 1.0f) * 9);
+}
+
+static NSError *AWSGZIPError(AWSGZIPErrorType code, z_stream *stream, NSString *description) {
+    if (stream && stream->msg) {
+        description = [NSString stringWithFormat:@"%@ (%s)", description, stream->msg];
+    }
+    return [NSError errorWithDomain:AWSGZIPErrorDomain
+                               code:code
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+#pragma mark - AWSGZIPInputStream
+
+@interface AWSGZIPInputStream()
+
+@property (nonatomic, strong) NSInputStream *stream;
+
+@end
+
+@implementation AWSGZIPInputStream {
+    z_stream _zstream;
+    BOOL _initialized;
+    uint8_t _inputBuffer[AWSGZIPBufferSize];
+    BOOL _sourceExhausted;
+    BOOL _endOfStream;
+    NSError *_error;
+}
+
+@synthesize delegate = _delegate;
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream compressionLevel:(float)level {
+    if (self = [super init]) {
+        _stream = stream;
+        _stream.delegate = self;
+        _initialized = deflateInit2(&_zstream, AWSGZIPCompressionLevel(level), Z_DEFLATED, AWSGZIPWindowBitsGZIP, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        if (!_initialized) {
+            _error = AWSGZIPError(AWSGZIPErrorUnknown, NULL, @"Failed to initialize the gzip encoder.");
+        }
+    }
+    return self;
+}
+
+- (instancetype)initWithData:(NSData *)data compressionLevel:(float)level {
+    return [self initWithInputStream:[NSInputStream inputStreamWithData:data] compressionLevel:level];
+}
+
+- (void)dealloc {
+    if (_initialized) {
+        deflateEnd(&_zstream);
+    }
+}
+
+- (uint64_t)totalBytesRead {
+    return _zstream.total_out;
+}
+
+- (void)stream:(NSStream *)aStream handleEvent:(NSStreamEvent)eventCode {
+    if ((eventCode & NSStreamEventEndEncountered) && !_endOfStream) {
+        // The source ending is not the end of the compressed stream, which still has to be flushed.
+        eventCode ^= NSStreamEventEndEncountered;
+    }
+    if ([self.delegate respondsToSelector:@selector(stream:handleEvent:)]) {
+        [self.delegate stream:self handleEvent:eventCode];
+    }
+}
+
+#pragma mark NSInputStream methods
+
+- (NSInteger)read:(uint8_t *)buffer maxLength:(NSUInteger)len {
+    if (_error) {
+        return -1;
+    }
+    if (_endOfStream || len == 0) {
+        return 0;
+    }
+
+    _zstream.next_out = buffer;
+    _zstream.avail_out = (uInt)MIN(len, UINT_MAX);
+    while (_zstream.avail_out > 0) {
+        if (_zstream.avail_in == 0 && !_sourceExhausted) {
+            NSInteger bytesRead = [self.stream read:_inputBuffer maxLength:AWSGZIPBufferSize];
+            if (bytesRead < 0) {
+                _error = [self.stream streamError] ?: AWSGZIPError(AWSGZIPErrorUnknown, NULL, @"Failed to read the stream to compress.");
+                return -1;
+            }
+            _sourceExhausted = bytesRead == 0;
+            _zstream.next_in = _inputBuffer;
+            _zstream.avail_in = (uInt)bytesRead;
+        }
+
+        int status = deflate(&_zstream, _sourceExhausted ? Z_FINISH : Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            _endOfStream = YES;
+            break;
+        }
+        if (status != Z_OK && status != Z_BUF_ERROR) {
+            _error = AWSGZIPError(AWSGZIPErrorUnknown, &_zstream, @"Failed to compress the stream.");
+            return -1;
+        }
+        // Return what is ready rather than wait for more of the source.
+        if (_zstream.avail_in == 0 && !_sourceExhausted && _zstream.avail_out < len) {
+            break;
+        }
+    }
+
+    return len - _zstream.avail_out;
+}
+
+- (BOOL)hasBytesAvailable {
+    return !_endOfStream && !_error;
+}
+
+- (BOOL)getBuffer:(uint8_t **)buffer length:(NSUInteger *)len {
+    return NO;
+}
+
+- (void)open {
+    [self.stream open];
+}
+
+- (void)close {
+    [self.stream close];
+}
+
+- (void)setDelegate:(id<NSStreamDelegate>)delegate {
+    if (delegate == nil) {
+        _delegate = self;
+    } else {
+        _delegate = delegate;
+    }
+}
+
+- (void)scheduleInRunLoop:(NSRunLoop *)aRunLoop forMode:(NSString *)mode {
+    [self.stream scheduleInRunLoop:aRunLoop forMode:mode];
+}
+
+- (void)removeFromRunLoop:(NSRunLoop *)aRunLoop forMode:(NSString *)mode {
+    [self.stream removeFromRunLoop:aRunLoop forMode:mode];
+}
+
+- (id)propertyForKey:(NSString *)key {
+    return [self.stream propertyForKey:key];
+}
+
+- (BOOL)setProperty:(id)property forKey:(NSString *)key {
+    return [self.stream setProperty:property forKey:key];
+}
+
+- (NSStreamStatus)streamStatus {
+    if (_error) {
+        return NSStreamStatusError;
+    }
+    NSStreamStatus status = [self.stream streamStatus];
+    if (status == NSStreamStatusAtEnd && !_endOfStream) {
+        return NSStreamStatusOpen;
+    }
+    return status;
+}
+
+- (NSError *)streamError {
+    return _error ?: [self.stream streamError];
+}
+
+- (NSMethodSignature *)methodSignatureForSelector:(SEL)aSelector {
+    return [self.stream methodSignatureForSelector:aSelector];
+}
+
+- (void)forwardInvocation:(NSInvocation *)anInvocation {
+    [anInvocation invokeWithTarget:self.stream];
+}
+
+@end
+
+#pragma mark - AWSGZIPInflater
+
+@interface AWSGZIPInflater()
+
+@property (nonatomic, copy) void (^outputHandler)(const void *bytes, NSUInteger length);
+
+@end
+
+@implementation AWSGZIPInflater {
+    z_stream _zstream;
+    BOOL _initialized;
+    int _windowBits;
+    // The format is chosen from the first two bytes, which may arrive separately.
+    uint8_t _header[2];
+    NSUInteger _headerLength;
+    uint8_t *_buffer;
+    NSUInteger _bufferSize;
+    NSError *_error;
+}
+
+- (instancetype)initWithOutputHandler:(void (^)(const void *bytes, NSUInteger length))outputHandler {
+    return [self initWithBufferSize:AWSGZIPBufferSize outputHandler:outputHandler];
+}
+
+- (instancetype)initWithBufferSize:(NSUInteger)bufferSize
+                     outputHandler:(void (^)(const void *bytes, NSUInteger length))outputHandler {
+    if (self = [super init]) {
+        _outputHandler = [outputHandler copy];
+        _bufferSize = MIN(MAX(bufferSize, (NSUInteger)1024), (NSUInteger)UINT_MAX);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_initialized) {
+        inflateEnd(&_zstream);
+    }
+    free(_buffer);
+}
+
+- (BOOL)appendData:(NSData *)data error:(NSError **)error {
+    if (_error) {
+        if (error) {
+            *error = _error;
+        }
+        return NO;
+    }
+
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+    if (!_initialized) {
+        NSUInteger headerBytes = MIN(length, sizeof(_header) - _headerLength);
+        memcpy(_header + _headerLength, bytes, headerBytes);
+        _headerLength += headerBytes;
+        bytes += headerBytes;
+        length -= headerBytes;
+        if (_headerLength < sizeof(_header)) {
+            return YES;
+        }
+        if (![self initializeWithError:error]) {
+            return NO;
+        }
+        if (![self inflateBytes:_header length:_headerLength error:error]) {
+            return NO;
+        }
+    }
+
+    return [self inflateBytes:bytes length:length error:error];
+}
+
+- (BOOL)finishWithError:(NSError **)error {
+    if (_error) {
+        if (error) {
+            *error = _error;
+        }
+        return NO;
+    }
+    if (_finished || (!_initialized && _headerLength == 0)) {
+        return YES;
+    }
+    _error = AWSGZIPError(AWSGZIPErrorTruncatedData, NULL, @"The compressed data ended unexpectedly.");
+    if (error) {
+        *error = _error;
+    }
+    return NO;
+}
+
+- (BOOL)initializeWithError:(NSError **)error {
+    unsigned int zlibHeader = (_header[0] << 8) | _header[1];
+    if (_header[0] == 0x1f && _header[1] == 0x8b) {
+        _windowBits = AWSGZIPWindowBitsGZIP;
+    } else if ((_header[0] & 0x0f) == Z_DEFLATED && (_header[0] >> 4) <= 7 && zlibHeader % 31 == 0) {
+        _windowBits = AWSGZIPWindowBitsZlib;
+    } else {
+        // Some servers send raw deflate data as `Content-Encoding: deflate`.
+        _windowBits = AWSGZIPWindowBitsRaw;
+    }
+
+    _buffer = malloc(_bufferSize);
+    _initialized = _buffer && inflateInit2(&_zstream, _windowBits) == Z_OK;
+    if (!_initialized) {
+        return [self failWithError:AWSGZIPError(AWSGZIPErrorUnknown, NULL, @"Failed to initialize the gzip decoder.") error:error];
+    }
+    return YES;
+}
+
+- (BOOL)inflateBytes:(const uint8_t *)bytes length:(NSUInteger)length error:(NSError **)error {
+    while (length > 0) {
+        uInt chunkLength = (uInt)MIN(length, UINT_MAX);
+        _zstream.next_in = (Bytef *)bytes;
+        _zstream.avail_in = chunkLength;
+
+        for (;;) {
+            if (_finished) {
+                if (_zstream.avail_in == 0) {
+                    break;
+                }
+                if (_windowBits != AWSGZIPWindowBitsGZIP) {
+                    return [self failWithError:AWSGZIPError(AWSGZIPErrorInvalidData, NULL, @"Unexpected data after the end of the compressed stream.") error:error];
+                }
+                // Another gzip member follows.
+                inflateReset(&_zstream);
+                _finished = NO;
+            }
+
+            _zstream.next_out = _buffer;
+            _zstream.avail_out = (uInt)_bufferSize;
+            int status = inflate(&_zstream, Z_NO_FLUSH);
+            NSUInteger produced = _bufferSize - _zstream.avail_out;
+            if (produced > 0) {
+                _totalBytesInflated += produced;
+                self.outputHandler(_buffer, produced);
+            }
+
+            if (status == Z_STREAM_END) {
+                _finished = YES;
+            } else if (status == Z_BUF_ERROR) {
+                break;
+            } else if (status != Z_OK) {
+                return [self failWithError:AWSGZIPError(AWSGZIPErrorInvalidData, &_zstream, @"The compressed data is invalid.") error:error];
+            } else if (_zstream.avail_in == 0 && _zstream.avail_out > 0) {
+                break;
+            }
+        }
+
+        bytes += chunkLength;
+        length -= chunkLength;
+    }
+    return YES;
+}
+
+- (BOOL)failWithError:(NSError *)failure error:(NSError **)error {
+    _error = failure;
+    if (error) {
+        *error = failure;
+    }
+    return NO;
+}
+
+@end
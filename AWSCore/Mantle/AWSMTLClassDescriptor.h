@@ -0,0 +1,90 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+// What Mantle resolves about one property of a model class: its JSON mapping,
+// its transformer and how to read and write it.
+@interface AWSMTLPropertyDescriptor : NSObject
+
+// The property key.
+@property (nonatomic, copy, readonly) NSString *key;
+
+// The JSON key path of the property, or nil if it is not mapped to JSON.
+@property (nonatomic, copy, readonly) NSString *JSONKeyPath;
+
+// Whether JSONKeyPath names a single key, which can be read with
+// -objectForKey: instead of key-value coding.
+@property (nonatomic, assign, readonly) BOOL JSONKeyPathIsKey;
+
+// The transformer returned by +<key>JSONTransformer or
+// +JSONTransformerForKey:, or nil if the value is not transformed.
+@property (nonatomic, strong, readonly) NSValueTransformer *JSONTransformer;
+
+@property (nonatomic, assign, readonly) SEL getter;
+@property (nonatomic, assign, readonly) SEL setter;
+
+// The class of an object property, or nil if the property is of type id or
+// not an object.
+@property (nonatomic, assign, readonly) Class objectClass;
+
+// The @encode() type of the property.
+@property (nonatomic, copy, readonly) NSString *type;
+
+// Whether the model class implements -validate<Key>:error: for the property.
+@property (nonatomic, assign, readonly) BOOL validates;
+
+// Returns the value of the property on `model`.
+//
+// Object properties are read with their getter. Other properties go through
+// key-value coding, which boxes them.
+- (id)valueForModel:(id)model;
+
+// Sets the property on `model` without validating the value.
+//
+// Writable object properties are set with their setter. Other properties go
+// through key-value coding, which unboxes them and writes read-only properties
+// to their instance variable.
+- (void)setValue:(id)value forModel:(id)model;
+
+@end
+
+// The properties of a model class, resolved once and cached on the class.
+//
+// The JSON adapter and the model use the descriptor instead of looking up
+// key paths, transformers and accessors for every model they read or write.
+@interface AWSMTLClassDescriptor : NSObject
+
+// Returns the descriptor of `modelClass`, building it on first use.
+//
+// modelClass - A subclass of AWSMTLModel. This argument must not be nil.
++ (instancetype)descriptorForClass:(Class)modelClass;
+
+@property (nonatomic, assign, readonly) Class modelClass;
+
+// The descriptors of +propertyKeys.
+@property (nonatomic, copy, readonly) NSArray<AWSMTLPropertyDescriptor *> *properties;
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, AWSMTLPropertyDescriptor *> *propertiesByKey;
+
+// The properties mapped to JSON, keyed by their JSON key path. Empty if the
+// class does not conform to <AWSMTLJSONSerializing>.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, AWSMTLPropertyDescriptor *> *propertiesByJSONKeyPath;
+
+// Whether +JSONKeyPathsByPropertyKey only maps properties of the class, to key
+// paths or NSNull. AWSMTLJSONAdapter does not decode classes for which this is
+// NO.
+@property (nonatomic, assign, readonly) BOOL hasValidJSONMapping;
+
+@end
@@ -0,0 +1,188 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSMTLClassDescriptor.h"
+#import "AWSMTLJSONAdapter.h"
+#import "AWSMTLModel.h"
+#import "AWSMTLReflection.h"
+#import "AWSEXTRuntimeExtensions.h"
+#import "AWSEXTScope.h"
+#import <objc/message.h>
+#import <objc/runtime.h>
+
+// Used to cache the descriptor on its class, as +propertyKeys caches its keys.
+static void *AWSMTLClassDescriptorKey = &AWSMTLClassDescriptorKey;
+
+@interface AWSMTLPropertyDescriptor ()
+
+@property (nonatomic, copy, readwrite) NSString *key;
+@property (nonatomic, copy, readwrite) NSString *JSONKeyPath;
+@property (nonatomic, assign, readwrite) BOOL JSONKeyPathIsKey;
+@property (nonatomic, strong, readwrite) NSValueTransformer *JSONTransformer;
+@property (nonatomic, assign, readwrite) SEL getter;
+@property (nonatomic, assign, readwrite) SEL setter;
+@property (nonatomic, assign, readwrite) Class objectClass;
+@property (nonatomic, copy, readwrite) NSString *type;
+@property (nonatomic, assign, readwrite) BOOL validates;
+
+// Whether the getter and setter are called directly.
+@property (nonatomic, assign) BOOL usesAccessors;
+
+@end
+
+@implementation AWSMTLPropertyDescriptor
+
+- (id)valueForModel:(id)model {
+	if (self.usesAccessors) {
+		return ((id (*)(id, SEL))objc_msgSend)(model, self.getter);
+	}
+
+	return [model valueForKey:self.key];
+}
+
+- (void)setValue:(id)value forModel:(id)model {
+	if (self.usesAccessors) {
+		((void (*)(id, SEL, id))objc_msgSend)(model, self.setter, value);
+		return;
+	}
+
+	[model setValue:value forKey:self.key];
+}
+
+@end
+
+@interface AWSMTLClassDescriptor ()
+
+@property (nonatomic, assign, readwrite) Class modelClass;
+@property (nonatomic, copy, readwrite) NSArray<AWSMTLPropertyDescriptor *> *properties;
+@property (nonatomic, copy, readwrite) NSDictionary<NSString *, AWSMTLPropertyDescriptor *> *propertiesByKey;
+@property (nonatomic, copy, readwrite) NSDictionary<NSString *, AWSMTLPropertyDescriptor *> *propertiesByJSONKeyPath;
+@property (nonatomic, assign, readwrite) BOOL hasValidJSONMapping;
+
+@end
+
+@implementation AWSMTLClassDescriptor
+
++ (instancetype)descriptorForClass:(Class)modelClass {
+	NSParameterAssert(modelClass != nil);
+
+	AWSMTLClassDescriptor *descriptor = objc_getAssociatedObject(modelClass, AWSMTLClassDescriptorKey);
+	if (descriptor != nil) return descriptor;
+
+	descriptor = [[self alloc] initWithModelClass:modelClass];
+
+	// As with +propertyKeys, another thread may build the same descriptor at
+	// the same time. Either one can be kept.
+	objc_setAssociatedObject(modelClass, AWSMTLClassDescriptorKey, descriptor, OBJC_ASSOCIATION_RETAIN);
+
+	return descriptor;
+}
+
+- (instancetype)initWithModelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+
+	NSSet *propertyKeys = [modelClass propertyKeys];
+	NSMutableArray *properties = [[NSMutableArray alloc] initWithCapacity:propertyKeys.count];
+	NSMutableDictionary *propertiesByKey = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+	for (NSString *key in propertyKeys) {
+		AWSMTLPropertyDescriptor *property = [self propertyDescriptorForKey:key];
+		[properties addObject:property];
+		propertiesByKey[key] = property;
+	}
+
+	_properties = [properties copy];
+	_propertiesByKey = [propertiesByKey copy];
+	_propertiesByJSONKeyPath = @{};
+	_hasValidJSONMapping = YES;
+
+	if ([modelClass conformsToProtocol:@protocol(AWSMTLJSONSerializing)]) {
+		[self resolveJSONMapping];
+	}
+
+	return self;
+}
+
+- (AWSMTLPropertyDescriptor *)propertyDescriptorForKey:(NSString *)key {
+	AWSMTLPropertyDescriptor *descriptor = [[AWSMTLPropertyDescriptor alloc] init];
+	descriptor.key = key;
+
+	objc_property_t property = class_getProperty(self.modelClass, key.UTF8String);
+	awsmtl_propertyAttributes *attributes = property ? awsmtl_copyPropertyAttributes(property) : NULL;
+	if (attributes == NULL) {
+		descriptor.type = @"";
+		return descriptor;
+	}
+
+	@onExit {
+		free(attributes);
+	};
+
+	descriptor.getter = attributes->getter;
+	descriptor.setter = attributes->setter;
+	descriptor.objectClass = attributes->objectClass;
+	descriptor.type = @(attributes->type);
+	descriptor.validates = [self.modelClass instancesRespondToSelector:AWSMTLSelectorWithCapitalizedKeyPattern("validate", key, ":error:")];
+	descriptor.usesAccessors = attributes->type[0] == '@'
+		&& !attributes->readonly
+		&& [self.modelClass instancesRespondToSelector:attributes->getter]
+		&& [self.modelClass instancesRespondToSelector:attributes->setter];
+
+	return descriptor;
+}
+
+- (void)resolveJSONMapping {
+	Class modelClass = self.modelClass;
+	NSDictionary *JSONKeyPathsByPropertyKey = [modelClass JSONKeyPathsByPropertyKey];
+
+	for (NSString *mappedPropertyKey in JSONKeyPathsByPropertyKey) {
+		id JSONKeyPath = JSONKeyPathsByPropertyKey[mappedPropertyKey];
+		if (self.propertiesByKey[mappedPropertyKey] == nil
+			|| (![JSONKeyPath isKindOfClass:NSString.class] && JSONKeyPath != NSNull.null)) {
+			_hasValidJSONMapping = NO;
+		}
+	}
+
+	NSMutableDictionary *propertiesByJSONKeyPath = [[NSMutableDictionary alloc] initWithCapacity:self.properties.count];
+	for (AWSMTLPropertyDescriptor *property in self.properties) {
+		id JSONKeyPath = JSONKeyPathsByPropertyKey[property.key] ?: property.key;
+		if (![JSONKeyPath isKindOfClass:NSString.class]) continue;
+
+		property.JSONKeyPath = JSONKeyPath;
+		property.JSONKeyPathIsKey = [JSONKeyPath rangeOfString:@"."].location == NSNotFound && ![JSONKeyPath hasPrefix:@"@"];
+		property.JSONTransformer = [self JSONTransformerForKey:property.key];
+		propertiesByJSONKeyPath[JSONKeyPath] = property;
+	}
+	_propertiesByJSONKeyPath = [propertiesByJSONKeyPath copy];
+}
+
+- (NSValueTransformer *)JSONTransformerForKey:(NSString *)key {
+	Class modelClass = self.modelClass;
+
+	SEL selector = AWSMTLSelectorWithKeyPattern(key, "JSONTransformer");
+	if ([modelClass respondsToSelector:selector]) {
+		return ((NSValueTransformer *(*)(id, SEL))objc_msgSend)(modelClass, selector);
+	}
+
+	if ([modelClass respondsToSelector:@selector(JSONTransformerForKey:)]) {
+		return [modelClass JSONTransformerForKey:key];
+	}
+
+	return nil;
+}
+
+@end
@@ -7,6 +7,7 @@
 //
 
 #import "AWSMTLJSONAdapter.h"
+#import "AWSMTLClassDescriptor.h"
 #import "AWSMTLModel.h"
 #import "AWSMTLReflection.h"
 
@@ -27,8 +28,8 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 // completed.
 @property (nonatomic, strong, readonly) Class modelClass;
 
-// A cached copy of the return value of +JSONKeyPathsByPropertyKey.
-@property (nonatomic, copy, readonly) NSDictionary *JSONKeyPathsByPropertyKey;
+// The cached key paths and transformers of `modelClass`.
+@property (nonatomic, strong, readonly) AWSMTLClassDescriptor *descriptor;
 
 // Looks up the NSValueTransformer that should be used for the given key.
 //
@@ -138,33 +139,22 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 	if (self == nil) return nil;
 
 	_modelClass = modelClass;
-	_JSONKeyPathsByPropertyKey = [[modelClass JSONKeyPathsByPropertyKey] copy];
+	_descriptor = [AWSMTLClassDescriptor descriptorForClass:modelClass];
 
-	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
-
-	NSSet *propertyKeys = [self.modelClass propertyKeys];
-
-	for (NSString *mappedPropertyKey in self.JSONKeyPathsByPropertyKey) {
-		if (![propertyKeys containsObject:mappedPropertyKey]) {
-			NSAssert(NO, @"%@ is not a property of %@.", mappedPropertyKey, modelClass);
-			return nil;
-		}
-
-		id value = self.JSONKeyPathsByPropertyKey[mappedPropertyKey];
-
-		if (![value isKindOfClass:NSString.class] && value != NSNull.null) {
-			NSAssert(NO, @"%@ must either map to a JSON key path or NSNull, got: %@.",mappedPropertyKey, value);
-			return nil;
-		}
+	if (!self.descriptor.hasValidJSONMapping) {
+		NSAssert(NO, @"+JSONKeyPathsByPropertyKey of %@ must map properties of the class to a JSON key path or NSNull, got: %@.", modelClass, [modelClass JSONKeyPathsByPropertyKey]);
+		return nil;
 	}
 
-	for (NSString *propertyKey in propertyKeys) {
-		NSString *JSONKeyPath = [self JSONKeyPathForPropertyKey:propertyKey];
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+
+	for (AWSMTLPropertyDescriptor *property in self.descriptor.properties) {
+		NSString *JSONKeyPath = property.JSONKeyPath;
 		if (JSONKeyPath == nil) continue;
 
 		id value;
 		@try {
-			value = [JSONDictionary valueForKeyPath:JSONKeyPath];
+			value = property.JSONKeyPathIsKey ? JSONDictionary[JSONKeyPath] : [JSONDictionary valueForKeyPath:JSONKeyPath];
 		} @catch (NSException *ex) {
 			if (error != NULL) {
 				NSDictionary *userInfo = @{
@@ -182,7 +172,7 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 		if (value == nil) continue;
 
 		@try {
-			NSValueTransformer *transformer = [self JSONTransformerForKey:propertyKey];
+			NSValueTransformer *transformer = property.JSONTransformer;
 			if (transformer != nil) {
 				// Map NSNull -> nil for the transformer, and then back for the
 				// dictionary we're going to insert into.
@@ -190,7 +180,7 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 				value = [transformer transformedValue:value] ?: NSNull.null;
 			}
 
-			dictionaryValue[propertyKey] = value;
+			dictionaryValue[property.key] = value;
 		} @catch (NSException *ex) {
 			NSLog(@"*** Caught exception %@ parsing JSON key path \"%@\" from: %@", ex, JSONKeyPath, JSONDictionary);
 
@@ -227,7 +217,7 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 
 	_model = model;
 	_modelClass = model.class;
-	_JSONKeyPathsByPropertyKey = [[model.class JSONKeyPathsByPropertyKey] copy];
+	_descriptor = [AWSMTLClassDescriptor descriptorForClass:model.class];
 
 	return self;
 }
@@ -238,11 +228,15 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 	NSDictionary *dictionaryValue = self.model.dictionaryValue;
 	NSMutableDictionary *JSONDictionary = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
 
+	NSDictionary *propertiesByKey = self.descriptor.propertiesByKey;
+
 	[dictionaryValue enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, id value, BOOL *stop) {
-		NSString *JSONKeyPath = [self JSONKeyPathForPropertyKey:propertyKey];
+		// Keys that a subclass adds to -dictionaryValue have no descriptor.
+		AWSMTLPropertyDescriptor *property = propertiesByKey[propertyKey];
+		NSString *JSONKeyPath = property != nil ? property.JSONKeyPath : [self JSONKeyPathForPropertyKey:propertyKey];
 		if (JSONKeyPath == nil) return;
 
-		NSValueTransformer *transformer = [self JSONTransformerForKey:propertyKey];
+		NSValueTransformer *transformer = property != nil ? property.JSONTransformer : [self JSONTransformerForKey:propertyKey];
 		if ([transformer.class allowsReverseTransformation]) {
 			// Map NSNull -> nil for the transformer, and then back for the
 			// dictionaryValue we're going to insert into.
@@ -250,6 +244,11 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 			value = [transformer reverseTransformedValue:value] ?: NSNull.null;
 		}
 
+		if (property.JSONKeyPathIsKey) {
+			JSONDictionary[JSONKeyPath] = value;
+			return;
+		}
+
 		NSArray *keyPathComponents = [JSONKeyPath componentsSeparatedByString:@"."];
 
 		// Set up dictionaries at each step of the key path.
@@ -273,6 +272,9 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 - (NSValueTransformer *)JSONTransformerForKey:(NSString *)key {
 	NSParameterAssert(key != nil);
 
+	AWSMTLPropertyDescriptor *property = self.descriptor.propertiesByKey[key];
+	if (property != nil) return property.JSONTransformer;
+
 	SEL selector = AWSMTLSelectorWithKeyPattern(key, "JSONTransformer");
 	if ([self.modelClass respondsToSelector:selector]) {
 		NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[self.modelClass methodSignatureForSelector:selector]];
@@ -295,7 +297,10 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 - (NSString *)JSONKeyPathForPropertyKey:(NSString *)key {
 	NSParameterAssert(key != nil);
 
-	id JSONKeyPath = self.JSONKeyPathsByPropertyKey[key];
+	AWSMTLPropertyDescriptor *property = self.descriptor.propertiesByKey[key];
+	if (property != nil) return property.JSONKeyPath;
+
+	id JSONKeyPath = [self.modelClass JSONKeyPathsByPropertyKey][key];
 	if ([JSONKeyPath isEqual:NSNull.null]) return nil;
 
 	if (JSONKeyPath == nil) {
@@ -8,6 +8,7 @@
 
 #import "NSError+AWSMTLModelException.h"
 #import "AWSMTLModel.h"
+#import "AWSMTLClassDescriptor.h"
 #import "AWSEXTRuntimeExtensions.h"
 #import "AWSEXTScope.h"
 #import "AWSMTLReflection.h"
@@ -65,6 +66,39 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	}
 }
 
+// Sets a property that has no validation method, without going through
+// -validateValue:forKey:error:.
+//
+// obj      - The object for which the value is being set. This value must not
+//            be nil.
+// property - The descriptor of one of `obj`s properties. This value must not
+//            be nil.
+// value    - The new value for the property.
+// error    - If not NULL, this may be set to any error that occurs while
+//            setting the value.
+//
+// Returns YES if `value` could be set, or NO if an error occurred.
+static BOOL MTLSetValue(id obj, AWSMTLPropertyDescriptor *property, id value, NSError **error) {
+	@try {
+		[property setValue:value forModel:obj];
+
+		return YES;
+	} @catch (NSException *ex) {
+		NSLog(@"*** Caught exception setting key \"%@\" : %@", property.key, ex);
+
+		// Fail fast in Debug builds.
+		#if DEBUG
+		@throw ex;
+		#else
+		if (error != NULL) {
+			*error = [NSError awsmtl_modelErrorWithException:ex];
+		}
+
+		return NO;
+		#endif
+	}
+}
+
 @interface AWSMTLModel ()
 
 // Enumerates all properties of the receiver's class hierarchy, starting at the
@@ -93,6 +127,8 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	self = [self init];
 	if (self == nil) return nil;
 
+	NSDictionary *propertiesByKey = [AWSMTLClassDescriptor descriptorForClass:self.class].propertiesByKey;
+
 	for (NSString *key in dictionary) {
 		// Mark this as being autoreleased, because validateValue may return
 		// a new object to be stored in this variable (and we don't want ARC to
@@ -101,7 +137,9 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	
 		if ([value isEqual:NSNull.null]) value = nil;
 
-		BOOL success = MTLValidateAndSetValue(self, key, value, YES, error);
+		// Without a -validate<Key>:error: method, validation always succeeds.
+		AWSMTLPropertyDescriptor *property = propertiesByKey[key];
+		BOOL success = (property != nil && !property.validates) ? MTLSetValue(self, property, value, error) : MTLValidateAndSetValue(self, key, value, YES, error);
 		if (!success) return nil;
 	}
 
@@ -158,7 +196,14 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 }
 
 - (NSDictionary *)dictionaryValue {
-	return [self dictionaryWithValuesForKeys:self.class.propertyKeys.allObjects];
+	NSArray *properties = [AWSMTLClassDescriptor descriptorForClass:self.class].properties;
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:properties.count];
+
+	for (AWSMTLPropertyDescriptor *property in properties) {
+		dictionaryValue[property.key] = [property valueForModel:self] ?: NSNull.null;
+	}
+
+	return dictionaryValue;
 }
 
 #pragma mark Merging
@@ -220,8 +265,8 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 - (NSUInteger)hash {
 	NSUInteger value = 0;
 
-	for (NSString *key in self.class.propertyKeys) {
-		value ^= [[self valueForKey:key] hash];
+	for (AWSMTLPropertyDescriptor *property in [AWSMTLClassDescriptor descriptorForClass:self.class].properties) {
+		value ^= [[property valueForModel:self] hash];
 	}
 
 	return value;
@@ -231,9 +276,9 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	if (self == model) return YES;
 	if (![model isMemberOfClass:self.class]) return NO;
 
-	for (NSString *key in self.class.propertyKeys) {
-		id selfValue = [self valueForKey:key];
-		id modelValue = [model valueForKey:key];
+	for (AWSMTLPropertyDescriptor *property in [AWSMTLClassDescriptor descriptorForClass:self.class].properties) {
+		id selfValue = [property valueForModel:self];
+		id modelValue = [property valueForModel:model];
 
 		BOOL valuesEqual = ((selfValue == nil && modelValue == nil) || [selfValue isEqual:modelValue]);
 		if (!valuesEqual) return NO;
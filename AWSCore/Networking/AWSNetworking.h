@@ -32,11 +32,55 @@ typedef NS_ENUM(NSInteger, AWSNetworkingRetryType) {
     AWSNetworkingRetryTypeResetStreamAndRetry
 };
 
+/**
+ How a client limits its retries and its sending rate when a service fails or throttles its requests.
+ */
+typedef NS_ENUM(NSInteger, AWSRetryMode) {
+    /**
+     Every failed request is retried as its retry handler decides, independently of the other requests. This is the
+     default.
+     */
+    AWSRetryModeLegacy,
+    /**
+     Retries are also drawn from a retry quota shared by the requests of the client, which stops retries when most
+     requests are failing and refills as requests succeed.
+     */
+    AWSRetryModeStandard,
+    /**
+     Like `AWSRetryModeStandard`, and requests are also sent through a rate limiter that backs off when the service
+     throttles the client and probes for a higher rate when it does not. Requests wait in the rate limiter instead of
+     being throttled, so far fewer of them fail, at the cost of a lower throughput and a much longer tail latency
+     while the service throttles the client: use it when failed requests are more costly than slow ones.
+     */
+    AWSRetryModeAdaptive
+};
+
+/**
+ How the payload of an Amazon S3 request is covered by its SigV4 signature.
+ */
+typedef NS_ENUM(NSInteger, AWSS3PayloadSigningMode) {
+    /**
+     The payload is hashed with SHA-256, and streamed payloads are sent with a signature on every chunk. This is the default.
+     */
+    AWSS3PayloadSigningModeSigned,
+    /**
+     HTTPS requests are signed with `UNSIGNED-PAYLOAD` and rely on TLS for the integrity of the payload.
+     */
+    AWSS3PayloadSigningModeUnsigned,
+    /**
+     HTTPS requests are signed with `UNSIGNED-PAYLOAD` and carry a CRC32C checksum of the payload. Streamed payloads
+     are sent as `STREAMING-UNSIGNED-PAYLOAD-TRAILER`, with the checksum computed while the stream is read and sent
+     in the `x-amz-checksum-crc32c` trailer.
+     */
+    AWSS3PayloadSigningModeUnsignedWithChecksum
+};
+
 /** UserInfo dictionary key for response errors */
 FOUNDATION_EXPORT NSString *const AWSResponseObjectErrorUserInfoKey;
 
 @class AWSNetworkingConfiguration;
 @class AWSNetworkingRequest;
+@class AWSURLResponseCache;
 @class AWSTask<__covariant ResultType>;
 
 typedef void (^AWSNetworkingUploadProgressBlock) (int64_t bytesSent, int64_t totalBytesSent, int64_t totalBytesExpectedToSend);
@@ -80,6 +124,14 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
                      headers:(NSDictionary *)headers
                   parameters:(NSDictionary *)parameters;
 
+@optional
+
+/**
+ Whether the operation of the serialized requests only reads, so that identical requests may share a response even
+ though they are not `GET` or `HEAD` requests.
+ */
+- (BOOL)isReadOnlyOperation;
+
 @end
 
 @protocol AWSNetworkingRequestInterceptor <NSObject>
@@ -136,6 +188,14 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
 
 - (NSDictionary *)resetParameters:(NSDictionary *)parameters;
 
+/**
+ Whether the service throttled the request. The rate limiter of `AWSRetryModeAdaptive` slows down on throttling
+ responses. When not implemented, `429` responses are throttling responses.
+ */
+- (BOOL)isThrottlingResponse:(NSHTTPURLResponse *)response
+                        data:(NSData *)data
+                       error:(NSError *)error;
+
 @end
 
 
@@ -172,6 +232,70 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
  */
 @property (nonatomic, assign) NSTimeInterval timeoutIntervalForResource;
 
+/**
+ The maximum number of simultaneous connections to a host. The default value is 0, which uses the system default.
+ HTTPS endpoints that negotiate HTTP/2 multiplex concurrent requests over one connection, whatever this limit.
+ */
+@property (nonatomic, assign) NSInteger HTTPMaximumConnectionsPerHost;
+
+/**
+ Whether requests are pipelined on HTTP/1.1 connections. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL HTTPShouldUsePipelining;
+
+/**
+ Whether requests wait for connectivity, instead of failing right away, when the device is offline. The default value
+ is `NO`. A request that waits still fails after `timeoutIntervalForResource`.
+ */
+@property (nonatomic, assign) BOOL waitsForConnectivity;
+
+/**
+ Whether the client sends its requests through an `NSURLSession`, and the connections it keeps open, shared with the
+ other clients of the same endpoint that set this property and have the same connection settings. The default value
+ is `NO`, which gives every client a session of its own.
+ */
+@property (nonatomic, assign) BOOL sharesURLSession;
+
+/**
+ Whether identical read requests of the client that are in flight at the same time are sent once, and every caller
+ gets the one response. `GET` and `HEAD` requests, and requests of operations flagged `readonly` in the service
+ definition, are coalesced. Requests are identical when they only differ by their signature. Requests that download to
+ a file are never coalesced. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL coalescesIdenticalRequests;
+
+/**
+ The cache `GET` responses are revalidated against. When set, the validators of a cached response are sent with the
+ request for it, and a `304 Not Modified` answer is served from the cache. Requests that download to a file do not use
+ the cache. The default value is `nil`.
+ */
+@property (nonatomic, strong) AWSURLResponseCache *responseCache;
+
+/**
+ How the client limits its retries and its sending rate. The retry quota and the rate limiter are shared by the
+ requests of one client. The default value is `AWSRetryModeLegacy`.
+ */
+@property (nonatomic, assign) AWSRetryMode retryMode;
+
+/**
+ Whether the client sends a read again when it takes longer than most of its recent reads. The first of the two
+ requests to complete is used, and the other is cancelled. Reads are the requests `coalescesIdenticalRequests` applies
+ to; requests that download to a file or send a body stream are never hedged, nor are requests held back by the rate
+ limiter of `AWSRetryModeAdaptive`. The default value is `NO`.
+ */
+@property (nonatomic, assign) BOOL hedgesReadRequests;
+
+/**
+ The percentile of the latencies of the recent reads of the client after which a read is hedged. The default value is
+ `0.95`.
+ */
+@property (nonatomic, assign) double hedgingDelayPercentile;
+
+/**
+ The largest fraction of the reads of the client that are hedged. The default value is `0.05`.
+ */
+@property (nonatomic, assign) double maximumHedgedRequestRatio;
+
 @end
 
 #pragma mark - AWSNetworkingRequest
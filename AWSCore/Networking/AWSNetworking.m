@@ -111,6 +111,8 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     if (self = [super init]) {
         _maxRetryCount = 3;
         _allowsCellularAccess = YES;
+        _hedgingDelayPercentile = 0.95;
+        _maximumHedgedRequestRatio = 0.05;
     }
     return self;
 }
@@ -166,6 +168,16 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     configuration.maxRetryCount = self.maxRetryCount;
     configuration.timeoutIntervalForRequest = self.timeoutIntervalForRequest;
     configuration.timeoutIntervalForResource = self.timeoutIntervalForResource;
+    configuration.HTTPMaximumConnectionsPerHost = self.HTTPMaximumConnectionsPerHost;
+    configuration.HTTPShouldUsePipelining = self.HTTPShouldUsePipelining;
+    configuration.waitsForConnectivity = self.waitsForConnectivity;
+    configuration.sharesURLSession = self.sharesURLSession;
+    configuration.coalescesIdenticalRequests = self.coalescesIdenticalRequests;
+    configuration.responseCache = self.responseCache;
+    configuration.retryMode = self.retryMode;
+    configuration.hedgesReadRequests = self.hedgesReadRequests;
+    configuration.hedgingDelayPercentile = self.hedgingDelayPercentile;
+    configuration.maximumHedgedRequestRatio = self.maximumHedgedRequestRatio;
 
     return configuration;
 }
@@ -0,0 +1,193 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A response held by an `AWSURLResponseCache`, with the validators used to revalidate it.
+ */
+@interface AWSCachedURLResponse : NSObject <NSSecureCoding>
+
+@property (nonatomic, assign, readonly) NSInteger statusCode;
+@property (nonatomic, strong, readonly) NSDictionary<NSString *, NSString *> *headerFields;
+@property (nonatomic, strong, readonly) NSData *data;
+
+/**
+ The value of the `ETag` header of the response, if any.
+ */
+@property (nonatomic, strong, readonly, nullable) NSString *entityTag;
+
+/**
+ The value of the `Last-Modified` header of the response, if any.
+ */
+@property (nonatomic, strong, readonly, nullable) NSString *lastModified;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithResponse:(NSHTTPURLResponse *)response data:(NSData *)data NS_DESIGNATED_INITIALIZER;
+
+- (nullable instancetype)initWithCoder:(NSCoder *)coder NS_DESIGNATED_INITIALIZER;
+
+/**
+ Returns the cached response as an `NSHTTPURLResponse` for the given URL.
+ */
+- (NSHTTPURLResponse *)HTTPURLResponseForURL:(NSURL *)URL;
+
+@end
+
+/**
+ Where an `AWSURLResponseCache` keeps its responses. Implementations must be safe to call from any thread.
+ */
+@protocol AWSURLResponseCacheStorage <NSObject>
+
+- (nullable AWSCachedURLResponse *)cachedResponseForKey:(NSString *)key;
+
+- (void)storeCachedResponse:(AWSCachedURLResponse *)cachedResponse forKey:(NSString *)key;
+
+- (void)removeCachedResponseForKey:(NSString *)key;
+
+- (void)removeAllCachedResponses;
+
+@optional
+
+/**
+ The size, in bytes, of the largest response body the storage keeps. Larger responses are not handed to the storage.
+ */
+@property (nonatomic, assign, readonly) NSUInteger maximumDataLength;
+
+@end
+
+/**
+ The storage used by `AWSURLResponseCache` unless another one is given. Responses are kept in memory and on disk, and
+ each tier evicts its least recently used responses when it grows over its capacity. Responses larger than the
+ capacity of a tier are not kept in that tier.
+ */
+@interface AWSURLResponseCacheDefaultStorage : NSObject <AWSURLResponseCacheStorage>
+
+/**
+ The maximum size, in bytes, of the response bodies kept in memory.
+ */
+@property (nonatomic, assign, readonly) NSUInteger memoryCapacity;
+
+/**
+ The maximum size, in bytes, of the responses kept on disk. A capacity of 0 keeps responses in memory only.
+ */
+@property (nonatomic, assign, readonly) NSUInteger diskCapacity;
+
+/**
+ The directory the responses are written to.
+ */
+@property (nonatomic, strong, readonly) NSURL *directoryURL;
+
+@property (nonatomic, assign, readonly) NSUInteger currentMemoryUsage;
+
+@property (nonatomic, assign, readonly) NSUInteger currentDiskUsage;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a storage with the given capacities. When `directoryURL` is `nil`, responses are written to a directory of
+ the storage's own in the `com.amazonaws.AWSURLResponseCache` directory in the caches directory of the app, which is
+ removed when the storage is deallocated. Pass a `directoryURL` to keep responses across launches of the app.
+ */
+- (instancetype)initWithMemoryCapacity:(NSUInteger)memoryCapacity
+                          diskCapacity:(NSUInteger)diskCapacity
+                          directoryURL:(nullable NSURL *)directoryURL NS_DESIGNATED_INITIALIZER;
+
+@end
+
+/**
+ A cache of the responses to `GET` requests that carry an `ETag` or a `Last-Modified` validator.
+
+ When a client whose configuration has a `responseCache` sends a `GET` request for a cached response, the validators
+ are sent as `If-None-Match` and `If-Modified-Since` headers, and a `304 Not Modified` answer is handed to the client
+ as the cached response. Responses are keyed by URL and `Range` header, so a cache should not be shared by clients
+ that call the same endpoints with different identities.
+ */
+@interface AWSURLResponseCache : NSObject
+
+@property (nonatomic, strong, readonly) id<AWSURLResponseCacheStorage> storage;
+
+/**
+ The number of requests looked up in the cache since the last call to `resetStatistics`.
+ */
+@property (nonatomic, assign, readonly) uint64_t lookupCount;
+
+/**
+ The number of `304 Not Modified` responses answered from the cache since the last call to `resetStatistics`.
+ */
+@property (nonatomic, assign, readonly) uint64_t hitCount;
+
+/**
+ The ratio of `hitCount` to `lookupCount`, or 0 before the first lookup.
+ */
+@property (nonatomic, assign, readonly) double hitRate;
+
+/**
+ The number of response body bytes answered from the cache instead of downloaded since the last call to
+ `resetStatistics`.
+ */
+@property (nonatomic, assign, readonly) uint64_t bytesSaved;
+
+/**
+ Returns a cache that keeps up to 4 MB in memory and 20 MB on disk.
+ */
+- (instancetype)init;
+
+- (instancetype)initWithMemoryCapacity:(NSUInteger)memoryCapacity
+                          diskCapacity:(NSUInteger)diskCapacity
+                          directoryURL:(nullable NSURL *)directoryURL;
+
+- (instancetype)initWithStorage:(id<AWSURLResponseCacheStorage>)storage NS_DESIGNATED_INITIALIZER;
+
+- (void)resetStatistics;
+
+- (nullable AWSCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request;
+
+/**
+ Stores the response to `request` if it can be revalidated: a `200` or `206` response to a `GET` request, with an
+ `ETag` or a `Last-Modified` header, and without `Cache-Control: no-store`. Otherwise, a successful response removes the
+ response cached for the request.
+ */
+- (void)storeResponse:(NSHTTPURLResponse *)response data:(NSData *)data forRequest:(NSURLRequest *)request;
+
+- (void)removeCachedResponseForRequest:(NSURLRequest *)request;
+
+- (void)removeAllCachedResponses;
+
+/**
+ Looks up the response cached for `request` and adds its validators to `request`. Only `GET` requests that have no
+ `If-None-Match` or `If-Modified-Since` header of their own are looked up.
+
+ @param request The request about to be sent.
+ @return The cached response the validators were taken from, to be passed to `responseForResponse:request:cachedResponse:data:`.
+ */
+- (nullable AWSCachedURLResponse *)prepareRequest:(NSMutableURLRequest *)request;
+
+/**
+ Returns the response a client should handle in place of `response`. A `304 Not Modified` answer to a request prepared
+ with `cachedResponse` is replaced by the cached response, and `data` by its body. Other responses are stored with
+ `storeResponse:data:forRequest:` and returned as they are.
+ */
+- (NSHTTPURLResponse *)responseForResponse:(NSHTTPURLResponse *)response
+                                   request:(NSURLRequest *)request
+                            cachedResponse:(nullable AWSCachedURLResponse *)cachedResponse
+                                      data:(NSData * _Nullable * _Nonnull)data;
+
+@end
+
+NS_ASSUME_NONNULL_END
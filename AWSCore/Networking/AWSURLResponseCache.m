@@ -0,0 +1,477 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSURLResponseCache.h"
+#import <stdatomic.h>
+#import "AWSCocoaLumberjack.h"
+#import "AWSSignature.h"
+
+static NSUInteger const AWSURLResponseCacheDefaultMemoryCapacity = 4 * 1024 * 1024;
+static NSUInteger const AWSURLResponseCacheDefaultDiskCapacity = 20 * 1024 * 1024;
+static NSString *const AWSURLResponseCacheDirectoryName = @"com.amazonaws.AWSURLResponseCache";
+
+static NSString *AWSURLResponseCacheHeaderValue(NSDictionary<NSString *, NSString *> *headerFields, NSString *name) {
+    NSString *value = headerFields[name];
+    if (value) {
+        return value;
+    }
+    for (NSString *key in headerFields) {
+        if ([key caseInsensitiveCompare:name] == NSOrderedSame) {
+            return headerFields[key];
+        }
+    }
+    return nil;
+}
+
+#pragma mark - AWSCachedURLResponse
+
+@implementation AWSCachedURLResponse
+
++ (BOOL)supportsSecureCoding {
+    return YES;
+}
+
+- (instancetype)initWithResponse:(NSHTTPURLResponse *)response data:(NSData *)data {
+    if (self = [super init]) {
+        _statusCode = response.statusCode;
+        _headerFields = [response.allHeaderFields copy] ?: @{};
+        _data = [data copy] ?: [NSData data];
+    }
+    return self;
+}
+
+- (instancetype)initWithCoder:(NSCoder *)coder {
+    NSSet *headerClasses = [NSSet setWithObjects:[NSDictionary class], [NSString class], nil];
+    NSDictionary *headerFields = [coder decodeObjectOfClasses:headerClasses forKey:@"headerFields"];
+    NSData *data = [coder decodeObjectOfClass:[NSData class] forKey:@"data"];
+    if (![headerFields isKindOfClass:[NSDictionary class]] || !data) {
+        return nil;
+    }
+
+    if (self = [super init]) {
+        _statusCode = [coder decodeIntegerForKey:@"statusCode"];
+        _headerFields = headerFields;
+        _data = data;
+    }
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder {
+    [coder encodeInteger:self.statusCode forKey:@"statusCode"];
+    [coder encodeObject:self.headerFields forKey:@"headerFields"];
+    [coder encodeObject:self.data forKey:@"data"];
+}
+
+- (NSString *)entityTag {
+    return AWSURLResponseCacheHeaderValue(self.headerFields, @"ETag");
+}
+
+- (NSString *)lastModified {
+    return AWSURLResponseCacheHeaderValue(self.headerFields, @"Last-Modified");
+}
+
+- (NSHTTPURLResponse *)HTTPURLResponseForURL:(NSURL *)URL {
+    return [[NSHTTPURLResponse alloc] initWithURL:URL
+                                       statusCode:self.statusCode
+                                      HTTPVersion:@"HTTP/1.1"
+                                     headerFields:self.headerFields];
+}
+
+@end
+
+#pragma mark - AWSURLResponseCacheDefaultStorage
+
+@interface AWSURLResponseCacheDefaultStorage()
+
+@property (nonatomic, strong) dispatch_queue_t dispatchQueue;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSCachedURLResponse *> *memoryResponses;
+// Keys and file names in order of use, least recently used first.
+@property (nonatomic, strong) NSMutableOrderedSet<NSString *> *memoryOrder;
+@property (nonatomic, strong) NSMutableOrderedSet<NSString *> *diskOrder;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *diskFileSizes;
+// Set when the storage created a directory of its own, which it removes when it is deallocated.
+@property (nonatomic, assign) BOOL ownsDirectory;
+
+@end
+
+@implementation AWSURLResponseCacheDefaultStorage
+
+@synthesize currentMemoryUsage = _currentMemoryUsage;
+@synthesize currentDiskUsage = _currentDiskUsage;
+
+- (instancetype)initWithMemoryCapacity:(NSUInteger)memoryCapacity
+                          diskCapacity:(NSUInteger)diskCapacity
+                          directoryURL:(NSURL *)directoryURL {
+    if (self = [super init]) {
+        _memoryCapacity = memoryCapacity;
+        _diskCapacity = diskCapacity;
+        if (directoryURL) {
+            _directoryURL = directoryURL;
+        } else {
+            // A directory per storage, so that storages do not evict or remove each other's responses.
+            NSURL *cachesURL = [[[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory
+                                                                       inDomains:NSUserDomainMask] firstObject];
+            _directoryURL = [[cachesURL URLByAppendingPathComponent:AWSURLResponseCacheDirectoryName isDirectory:YES]
+                             URLByAppendingPathComponent:[NSUUID UUID].UUIDString isDirectory:YES];
+            _ownsDirectory = YES;
+        }
+        _dispatchQueue = dispatch_queue_create("com.amazonaws.AWSURLResponseCacheDefaultStorage", DISPATCH_QUEUE_SERIAL);
+        _memoryResponses = [NSMutableDictionary new];
+        _memoryOrder = [NSMutableOrderedSet new];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_ownsDirectory) {
+        [[NSFileManager defaultManager] removeItemAtURL:_directoryURL error:nil];
+    }
+}
+
+- (NSUInteger)currentMemoryUsage {
+    __block NSUInteger currentMemoryUsage = 0;
+    dispatch_sync(self.dispatchQueue, ^{
+        currentMemoryUsage = self->_currentMemoryUsage;
+    });
+    return currentMemoryUsage;
+}
+
+- (NSUInteger)currentDiskUsage {
+    __block NSUInteger currentDiskUsage = 0;
+    dispatch_sync(self.dispatchQueue, ^{
+        [self loadDiskIndex];
+        currentDiskUsage = self->_currentDiskUsage;
+    });
+    return currentDiskUsage;
+}
+
+- (NSUInteger)maximumDataLength {
+    return MAX(self.memoryCapacity, self.diskCapacity);
+}
+
+- (AWSCachedURLResponse *)cachedResponseForKey:(NSString *)key {
+    __block AWSCachedURLResponse *cachedResponse = nil;
+    dispatch_sync(self.dispatchQueue, ^{
+        cachedResponse = self.memoryResponses[key];
+        if (cachedResponse) {
+            [self.memoryOrder removeObject:key];
+            [self.memoryOrder addObject:key];
+            return;
+        }
+
+        NSString *fileName = [self fileNameForKey:key];
+        [self loadDiskIndex];
+        if (!self.diskFileSizes[fileName]) {
+            return;
+        }
+
+        NSData *archive = [NSData dataWithContentsOfURL:[self.directoryURL URLByAppendingPathComponent:fileName]];
+        NSError *error = nil;
+        if (archive) {
+            cachedResponse = [NSKeyedUnarchiver unarchivedObjectOfClass:[AWSCachedURLResponse class]
+                                                               fromData:archive
+                                                                  error:&error];
+        }
+        if (!cachedResponse) {
+            AWSDDLogDebug(@"Failed to read a cached response. %@", error);
+            [self removeFileNamed:fileName];
+            return;
+        }
+
+        [self.diskOrder removeObject:fileName];
+        [self.diskOrder addObject:fileName];
+        [self storeInMemoryCachedResponse:cachedResponse forKey:key];
+    });
+    return cachedResponse;
+}
+
+- (void)storeCachedResponse:(AWSCachedURLResponse *)cachedResponse forKey:(NSString *)key {
+    dispatch_async(self.dispatchQueue, ^{
+        [self removeFromMemoryKey:key];
+        [self storeInMemoryCachedResponse:cachedResponse forKey:key];
+
+        NSString *fileName = [self fileNameForKey:key];
+        [self loadDiskIndex];
+        [self removeFileNamed:fileName];
+        // The archive is larger than the body, so a body over the capacity is not archived.
+        if (cachedResponse.data.length > self.diskCapacity) {
+            return;
+        }
+
+        NSError *error = nil;
+        NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:cachedResponse
+                                                requiringSecureCoding:YES
+                                                                error:&error];
+        if (!archive || archive.length > self.diskCapacity) {
+            return;
+        }
+        [[NSFileManager defaultManager] createDirectoryAtURL:self.directoryURL
+                                 withIntermediateDirectories:YES
+                                                  attributes:nil
+                                                       error:nil];
+        if (![archive writeToURL:[self.directoryURL URLByAppendingPathComponent:fileName]
+                         options:NSDataWritingAtomic
+                           error:&error]) {
+            AWSDDLogDebug(@"Failed to write a cached response. %@", error);
+            return;
+        }
+        self.diskFileSizes[fileName] = @(archive.length);
+        [self.diskOrder addObject:fileName];
+        self->_currentDiskUsage += archive.length;
+        [self evictFromDisk];
+    });
+}
+
+- (void)removeCachedResponseForKey:(NSString *)key {
+    dispatch_async(self.dispatchQueue, ^{
+        [self removeFromMemoryKey:key];
+        [self loadDiskIndex];
+        [self removeFileNamed:[self fileNameForKey:key]];
+    });
+}
+
+- (void)removeAllCachedResponses {
+    dispatch_async(self.dispatchQueue, ^{
+        [self.memoryResponses removeAllObjects];
+        [self.memoryOrder removeAllObjects];
+        self->_currentMemoryUsage = 0;
+
+        [[NSFileManager defaultManager] removeItemAtURL:self.directoryURL error:nil];
+        self.diskFileSizes = [NSMutableDictionary new];
+        self.diskOrder = [NSMutableOrderedSet new];
+        self->_currentDiskUsage = 0;
+    });
+}
+
+#pragma mark - Memory
+
+- (void)storeInMemoryCachedResponse:(AWSCachedURLResponse *)cachedResponse forKey:(NSString *)key {
+    if (cachedResponse.data.length > self.memoryCapacity) {
+        return;
+    }
+    self.memoryResponses[key] = cachedResponse;
+    [self.memoryOrder addObject:key];
+    _currentMemoryUsage += cachedResponse.data.length;
+
+    while (_currentMemoryUsage > self.memoryCapacity && self.memoryOrder.count > 0) {
+        [self removeFromMemoryKey:self.memoryOrder.firstObject];
+    }
+}
+
+- (void)removeFromMemoryKey:(NSString *)key {
+    AWSCachedURLResponse *cachedResponse = self.memoryResponses[key];
+    if (cachedResponse) {
+        _currentMemoryUsage -= cachedResponse.data.length;
+        [self.memoryResponses removeObjectForKey:key];
+        [self.memoryOrder removeObject:key];
+    }
+}
+
+#pragma mark - Disk
+
+- (NSString *)fileNameForKey:(NSString *)key {
+    return [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:key]];
+}
+
+// Lists the files written by earlier instances the first time the disk is used. The modification dates of the files
+// approximate the order in which they were last used.
+- (void)loadDiskIndex {
+    if (self.diskFileSizes) {
+        return;
+    }
+    self.diskFileSizes = [NSMutableDictionary new];
+    self.diskOrder = [NSMutableOrderedSet new];
+    _currentDiskUsage = 0;
+
+    NSArray<NSURLResourceKey> *resourceKeys = @[NSURLFileSizeKey, NSURLContentModificationDateKey];
+    NSArray<NSURL *> *fileURLs = [[NSFileManager defaultManager] contentsOfDirectoryAtURL:self.directoryURL
+                                                                 includingPropertiesForKeys:resourceKeys
+                                                                                    options:NSDirectoryEnumerationSkipsHiddenFiles
+                                                                                      error:nil];
+    NSMutableDictionary<NSString *, NSDate *> *modificationDates = [NSMutableDictionary new];
+    for (NSURL *fileURL in fileURLs) {
+        NSDictionary<NSURLResourceKey, id> *resourceValues = [fileURL resourceValuesForKeys:resourceKeys error:nil];
+        NSString *fileName = fileURL.lastPathComponent;
+        NSNumber *fileSize = resourceValues[NSURLFileSizeKey];
+        self.diskFileSizes[fileName] = fileSize ?: @0;
+        modificationDates[fileName] = resourceValues[NSURLContentModificationDateKey] ?: [NSDate distantPast];
+        _currentDiskUsage += fileSize.unsignedIntegerValue;
+    }
+    NSArray<NSString *> *fileNames = [modificationDates keysSortedByValueUsingSelector:@selector(compare:)];
+    [self.diskOrder addObjectsFromArray:fileNames];
+
+    [self evictFromDisk];
+}
+
+- (void)evictFromDisk {
+    while (_currentDiskUsage > self.diskCapacity && self.diskOrder.count > 0) {
+        [self removeFileNamed:self.diskOrder.firstObject];
+    }
+}
+
+- (void)removeFileNamed:(NSString *)fileName {
+    NSNumber *fileSize = self.diskFileSizes[fileName];
+    if (!fileSize) {
+        return;
+    }
+    [[NSFileManager defaultManager] removeItemAtURL:[self.directoryURL URLByAppendingPathComponent:fileName] error:nil];
+    _currentDiskUsage -= fileSize.unsignedIntegerValue;
+    [self.diskFileSizes removeObjectForKey:fileName];
+    [self.diskOrder removeObject:fileName];
+}
+
+@end
+
+#pragma mark - AWSURLResponseCache
+
+@interface AWSURLResponseCache() {
+    _Atomic(uint64_t) _lookupCount;
+    _Atomic(uint64_t) _hitCount;
+    _Atomic(uint64_t) _bytesSaved;
+}
+
+@end
+
+@implementation AWSURLResponseCache
+
+- (instancetype)init {
+    return [self initWithMemoryCapacity:AWSURLResponseCacheDefaultMemoryCapacity
+                           diskCapacity:AWSURLResponseCacheDefaultDiskCapacity
+                           directoryURL:nil];
+}
+
+- (instancetype)initWithMemoryCapacity:(NSUInteger)memoryCapacity
+                          diskCapacity:(NSUInteger)diskCapacity
+                          directoryURL:(NSURL *)directoryURL {
+    return [self initWithStorage:[[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:memoryCapacity
+                                                                                      diskCapacity:diskCapacity
+                                                                                      directoryURL:directoryURL]];
+}
+
+- (instancetype)initWithStorage:(id<AWSURLResponseCacheStorage>)storage {
+    if (self = [super init]) {
+        _storage = storage;
+        atomic_init(&_lookupCount, 0);
+        atomic_init(&_hitCount, 0);
+        atomic_init(&_bytesSaved, 0);
+    }
+    return self;
+}
+
+- (uint64_t)lookupCount {
+    return atomic_load(&_lookupCount);
+}
+
+- (uint64_t)hitCount {
+    return atomic_load(&_hitCount);
+}
+
+- (double)hitRate {
+    uint64_t lookupCount = self.lookupCount;
+    return lookupCount == 0 ? 0 : (double)self.hitCount / lookupCount;
+}
+
+- (uint64_t)bytesSaved {
+    return atomic_load(&_bytesSaved);
+}
+
+- (void)resetStatistics {
+    atomic_store(&_lookupCount, 0);
+    atomic_store(&_hitCount, 0);
+    atomic_store(&_bytesSaved, 0);
+}
+
+- (NSString *)keyForRequest:(NSURLRequest *)request {
+    if (![request.HTTPMethod isEqualToString:@"GET"] || !request.URL) {
+        return nil;
+    }
+    NSString *range = [request valueForHTTPHeaderField:@"Range"];
+    return [NSString stringWithFormat:@"%@ %@", request.URL.absoluteString, range ?: @""];
+}
+
+- (AWSCachedURLResponse *)cachedResponseForRequest:(NSURLRequest *)request {
+    NSString *key = [self keyForRequest:request];
+    return key ? [self.storage cachedResponseForKey:key] : nil;
+}
+
+- (void)storeResponse:(NSHTTPURLResponse *)response data:(NSData *)data forRequest:(NSURLRequest *)request {
+    NSString *key = [self keyForRequest:request];
+    if (!key) {
+        return;
+    }
+
+    NSDictionary *headerFields = response.allHeaderFields;
+    NSString *cacheControl = AWSURLResponseCacheHeaderValue(headerFields, @"Cache-Control");
+    BOOL storable = (response.statusCode == 200 || response.statusCode == 206)
+    && data
+    && (![self.storage respondsToSelector:@selector(maximumDataLength)] || data.length <= self.storage.maximumDataLength)
+    && (AWSURLResponseCacheHeaderValue(headerFields, @"ETag") || AWSURLResponseCacheHeaderValue(headerFields, @"Last-Modified"))
+    && [cacheControl rangeOfString:@"no-store" options:NSCaseInsensitiveSearch].location == NSNotFound;
+
+    if (storable) {
+        [self.storage storeCachedResponse:[[AWSCachedURLResponse alloc] initWithResponse:response data:data] forKey:key];
+    } else if (response.statusCode / 100 == 2 || response.statusCode == 404 || response.statusCode == 410) {
+        [self.storage removeCachedResponseForKey:key];
+    }
+}
+
+- (void)removeCachedResponseForRequest:(NSURLRequest *)request {
+    NSString *key = [self keyForRequest:request];
+    if (key) {
+        [self.storage removeCachedResponseForKey:key];
+    }
+}
+
+- (void)removeAllCachedResponses {
+    [self.storage removeAllCachedResponses];
+}
+
+- (AWSCachedURLResponse *)prepareRequest:(NSMutableURLRequest *)request {
+    if ([request valueForHTTPHeaderField:@"If-None-Match"]
+        || [request valueForHTTPHeaderField:@"If-Modified-Since"]) {
+        return nil;
+    }
+    NSString *key = [self keyForRequest:request];
+    if (!key) {
+        return nil;
+    }
+
+    atomic_fetch_add(&_lookupCount, 1);
+    AWSCachedURLResponse *cachedResponse = [self.storage cachedResponseForKey:key];
+    if (cachedResponse.entityTag) {
+        [request setValue:cachedResponse.entityTag forHTTPHeaderField:@"If-None-Match"];
+    }
+    if (cachedResponse.lastModified) {
+        [request setValue:cachedResponse.lastModified forHTTPHeaderField:@"If-Modified-Since"];
+    }
+    return cachedResponse;
+}
+
+- (NSHTTPURLResponse *)responseForResponse:(NSHTTPURLResponse *)response
+                                   request:(NSURLRequest *)request
+                            cachedResponse:(AWSCachedURLResponse *)cachedResponse
+                                      data:(NSData **)data {
+    if (response.statusCode == 304 && cachedResponse) {
+        atomic_fetch_add(&_hitCount, 1);
+        atomic_fetch_add(&_bytesSaved, cachedResponse.data.length);
+        *data = cachedResponse.data;
+        return [cachedResponse HTTPURLResponseForURL:response.URL ?: request.URL];
+    }
+
+    [self storeResponse:response data:*data forRequest:request];
+    return response;
+}
+
+@end
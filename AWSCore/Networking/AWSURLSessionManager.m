@@ -20,6 +20,8 @@
 #import "AWSSignature.h"
 #import "AWSBolts.h"
 #import "AWSCredentialsProvider.h"
+#import "AWSURLResponseCache.h"
+#import "AWSURLRequestRetryHandler.h"
 
 NSString* const AWSResponseObjectErrorUserInfoKey = @"ResponseObjectError";
 
@@ -34,6 +36,24 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     AWSURLSessionTaskTypeUpload
 };
 
+/**
+ A read that may be sent a second time. The first of its requests to get a response is used, and the other is
+ cancelled. A request that fails without a response is used only if the other one has already failed too.
+ */
+@interface AWSURLSessionHedgedRead : NSObject
+
+@property (nonatomic, assign) NSTimeInterval startTime;
+@property (nonatomic, strong) NSURLSessionTask *task;
+@property (nonatomic, strong) NSURLSessionTask *hedgedTask;
+@property (nonatomic, assign, getter=isCompleted) BOOL completed;
+@property (nonatomic, assign) BOOL failedWithoutResponse;
+
+@end
+
+@implementation AWSURLSessionHedgedRead
+
+@end
+
 @interface AWSURLSessionManagerDelegate : NSObject
 
 @property (nonatomic, assign) AWSURLSessionTaskType taskType;
@@ -54,6 +74,15 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 @property (atomic, assign) int64_t lastTotalLengthOfChunkSignatureSent;
 @property (atomic, assign) int64_t payloadTotalBytesWritten;
 
+// Set on the delegate that sends a request identical requests wait for.
+@property (nonatomic, strong) NSString *coalescingKey;
+// The cached response whose validators were sent with the request.
+@property (nonatomic, strong) AWSCachedURLResponse *cachedResponse;
+// The retry quota tokens taken for the last retry of the request.
+@property (nonatomic, assign) NSUInteger retryQuotaCost;
+// Shared with the delegate of the hedged request, if one was sent.
+@property (nonatomic, strong) AWSURLSessionHedgedRead *hedgedRead;
+
 @end
 
 @implementation AWSURLSessionManagerDelegate
@@ -68,6 +97,222 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
 @end
 
+#pragma mark - AWSSharedURLSession
+
+/**
+ An `NSURLSession` shared by the session managers of the clients of an endpoint that set `sharesURLSession`. The session
+ calls this object, which passes the events of each task on to the session manager that created the task.
+ */
+@interface AWSSharedURLSession : NSObject <NSURLSessionDataDelegate>
+
+@property (nonatomic, strong, readonly) NSURLSession *session;
+
++ (instancetype)sharedSessionForConfiguration:(AWSNetworkingConfiguration *)configuration
+                         sessionConfiguration:(NSURLSessionConfiguration *)sessionConfiguration;
+
+- (void)addTask:(NSURLSessionTask *)task sessionManager:(AWSURLSessionManager *)sessionManager;
+
+/**
+ Called by a session manager that no longer sends requests. The session is invalidated, once its tasks are finished,
+ when the last session manager that used it relinquishes it.
+ */
+- (void)relinquish;
+
+@end
+
+@interface AWSSharedURLSession()
+
+@property (nonatomic, strong) NSString *key;
+@property (nonatomic, strong) NSURLSession *session;
+@property (nonatomic, strong) AWSSynchronizedMutableDictionary *sessionManagers;
+@property (nonatomic, assign) NSUInteger referenceCount;
+
+@end
+
+@implementation AWSSharedURLSession
+
+static NSMutableDictionary<NSString *, AWSSharedURLSession *> *_sharedSessions = nil;
+
+// Clients share a session only if the settings of the session would be the same.
++ (NSString *)keyForConfiguration:(AWSNetworkingConfiguration *)configuration {
+    NSURL *URL = configuration.baseURL ?: [NSURL URLWithString:configuration.URLString];
+    return [NSString stringWithFormat:@"%@://%@:%@ %ld %d %d %d %f %f %@",
+            [URL.scheme lowercaseString],
+            [URL.host lowercaseString],
+            URL.port,
+            (long)configuration.HTTPMaximumConnectionsPerHost,
+            configuration.HTTPShouldUsePipelining,
+            configuration.waitsForConnectivity,
+            configuration.allowsCellularAccess,
+            configuration.timeoutIntervalForRequest,
+            configuration.timeoutIntervalForResource,
+            configuration.sharedContainerIdentifier];
+}
+
++ (instancetype)sharedSessionForConfiguration:(AWSNetworkingConfiguration *)configuration
+                         sessionConfiguration:(NSURLSessionConfiguration *)sessionConfiguration {
+    NSString *key = [self keyForConfiguration:configuration];
+    @synchronized([AWSSharedURLSession class]) {
+        if (!_sharedSessions) {
+            _sharedSessions = [NSMutableDictionary new];
+        }
+        AWSSharedURLSession *sharedSession = _sharedSessions[key];
+        if (!sharedSession) {
+            sharedSession = [AWSSharedURLSession new];
+            sharedSession.key = key;
+            sharedSession.sessionManagers = [AWSSynchronizedMutableDictionary new];
+            sharedSession.session = [NSURLSession sessionWithConfiguration:sessionConfiguration
+                                                                  delegate:sharedSession
+                                                             delegateQueue:nil];
+            _sharedSessions[key] = sharedSession;
+        }
+        sharedSession.referenceCount++;
+        return sharedSession;
+    }
+}
+
+- (void)addTask:(NSURLSessionTask *)task sessionManager:(AWSURLSessionManager *)sessionManager {
+    [self.sessionManagers setObject:sessionManager forKey:@(task.taskIdentifier)];
+}
+
+- (void)relinquish {
+    @synchronized([AWSSharedURLSession class]) {
+        if (--self.referenceCount > 0) {
+            return;
+        }
+        [_sharedSessions removeObjectForKey:self.key];
+    }
+    [self.session finishTasksAndInvalidate];
+}
+
+#pragma mark - NSURLSessionTaskDelegate
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
+    AWSURLSessionManager *sessionManager = [self.sessionManagers objectForKey:@(task.taskIdentifier)];
+    [self.sessionManagers removeObjectForKey:@(task.taskIdentifier)];
+    [sessionManager URLSession:session task:task didCompleteWithError:error];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didSendBodyData:(int64_t)bytesSent totalBytesSent:(int64_t)totalBytesSent totalBytesExpectedToSend:(int64_t)totalBytesExpectedToSend {
+    AWSURLSessionManager *sessionManager = [self.sessionManagers objectForKey:@(task.taskIdentifier)];
+    [sessionManager URLSession:session
+                          task:task
+               didSendBodyData:bytesSent
+                totalBytesSent:totalBytesSent
+      totalBytesExpectedToSend:totalBytesExpectedToSend];
+}
+
+#pragma mark - NSURLSessionDataDelegate
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition disposition))completionHandler {
+    AWSURLSessionManager *sessionManager = [self.sessionManagers objectForKey:@(dataTask.taskIdentifier)];
+    if (sessionManager) {
+        [sessionManager URLSession:session dataTask:dataTask didReceiveResponse:response completionHandler:completionHandler];
+    } else {
+        completionHandler(NSURLSessionResponseCancel);
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
+    AWSURLSessionManager *sessionManager = [self.sessionManagers objectForKey:@(dataTask.taskIdentifier)];
+    [sessionManager URLSession:session dataTask:dataTask didReceiveData:data];
+}
+
+@end
+
+#pragma mark - AWSURLSessionHedger
+
+#define AWSURLSessionHedgerSampleCount 128
+static NSUInteger const AWSURLSessionHedgerMinimumSampleCount = 20;
+// The number of hedged requests a burst of slow reads can send at once.
+static double const AWSURLSessionHedgerMaximumBalance = 10;
+
+/**
+ Keeps the latencies of the recent reads of a session manager, and the budget its hedged requests are paid from. Every
+ read adds `maximumHedgedRequestRatio` to the budget and every hedged request takes 1 from it, so no more than that
+ fraction of the reads are hedged.
+ */
+@interface AWSURLSessionHedger : NSObject
+
+- (instancetype)initWithDelayPercentile:(double)delayPercentile
+              maximumHedgedRequestRatio:(double)maximumHedgedRequestRatio;
+
+/**
+ Adds a read to the budget, and returns how long it waits before it is hedged, or a negative value until enough reads
+ completed to tell.
+ */
+- (NSTimeInterval)hedgingDelayForRead;
+
+/**
+ Takes a hedged request from the budget. Returns `NO` if the budget is spent.
+ */
+- (BOOL)acquireHedgedRequest;
+
+- (void)recordLatency:(NSTimeInterval)latency;
+
+@end
+
+static int AWSURLSessionHedgerCompareLatencies(const void *latency1, const void *latency2) {
+    NSTimeInterval difference = *(const NSTimeInterval *)latency1 - *(const NSTimeInterval *)latency2;
+    return difference < 0 ? -1 : (difference > 0 ? 1 : 0);
+}
+
+@implementation AWSURLSessionHedger {
+    double _delayPercentile;
+    double _maximumHedgedRequestRatio;
+    double _balance;
+    NSTimeInterval _latencies[AWSURLSessionHedgerSampleCount];
+    NSUInteger _latencyCount;
+    NSUInteger _nextLatencyIndex;
+}
+
+- (instancetype)initWithDelayPercentile:(double)delayPercentile
+              maximumHedgedRequestRatio:(double)maximumHedgedRequestRatio {
+    if (self = [super init]) {
+        _delayPercentile = MIN(MAX(delayPercentile, 0), 1);
+        _maximumHedgedRequestRatio = MIN(MAX(maximumHedgedRequestRatio, 0), 1);
+    }
+
+    return self;
+}
+
+- (NSTimeInterval)hedgingDelayForRead {
+    NSTimeInterval latencies[AWSURLSessionHedgerSampleCount];
+    NSUInteger latencyCount = 0;
+    @synchronized(self) {
+        _balance = MIN(_balance + _maximumHedgedRequestRatio, AWSURLSessionHedgerMaximumBalance);
+        if (_latencyCount < AWSURLSessionHedgerMinimumSampleCount) {
+            return -1;
+        }
+        latencyCount = _latencyCount;
+        memcpy(latencies, _latencies, latencyCount * sizeof(NSTimeInterval));
+    }
+
+    qsort(latencies, latencyCount, sizeof(NSTimeInterval), AWSURLSessionHedgerCompareLatencies);
+    return latencies[MIN(latencyCount - 1, (NSUInteger)(_delayPercentile * latencyCount))];
+}
+
+- (BOOL)acquireHedgedRequest {
+    @synchronized(self) {
+        if (_balance < 1) {
+            return NO;
+        }
+        _balance -= 1;
+        return YES;
+    }
+}
+
+- (void)recordLatency:(NSTimeInterval)latency {
+    @synchronized(self) {
+        _latencies[_nextLatencyIndex] = latency;
+        _nextLatencyIndex = (_nextLatencyIndex + 1) % AWSURLSessionHedgerSampleCount;
+        _latencyCount = MIN(_latencyCount + 1, AWSURLSessionHedgerSampleCount);
+    }
+}
+
+@end
+
 #pragma mark - AWSNetworkingRequest
 
 @interface AWSNetworkingRequest()
@@ -83,7 +328,13 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 @interface AWSURLSessionManager()
 
 @property (nonatomic, strong) NSURLSession *session;
+@property (nonatomic, strong) AWSSharedURLSession *sharedSession;
 @property (nonatomic, strong) AWSSynchronizedMutableDictionary *sessionManagerDelegates;
+// The delegates waiting for an identical request in flight, by coalescing key.
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray<AWSURLSessionManagerDelegate *> *> *coalescedDelegates;
+@property (nonatomic, strong) AWSRetryQuota *retryQuota;
+@property (nonatomic, strong) AWSClientSideRateLimiter *rateLimiter;
+@property (nonatomic, strong) AWSURLSessionHedger *hedger;
 @property (nonatomic) BOOL isSessionValid;
 
 @end
@@ -116,11 +367,33 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
         }
         sessionConfiguration.allowsCellularAccess = configuration.allowsCellularAccess;
         sessionConfiguration.sharedContainerIdentifier = configuration.sharedContainerIdentifier;
-        
-        _session = [NSURLSession sessionWithConfiguration:sessionConfiguration
-                                                 delegate:self
-                                            delegateQueue:nil];
+        if (configuration.HTTPMaximumConnectionsPerHost > 0) {
+            sessionConfiguration.HTTPMaximumConnectionsPerHost = configuration.HTTPMaximumConnectionsPerHost;
+        }
+        sessionConfiguration.HTTPShouldUsePipelining = configuration.HTTPShouldUsePipelining;
+        sessionConfiguration.waitsForConnectivity = configuration.waitsForConnectivity;
+
+        if (configuration.sharesURLSession) {
+            _sharedSession = [AWSSharedURLSession sharedSessionForConfiguration:configuration
+                                                           sessionConfiguration:sessionConfiguration];
+            _session = _sharedSession.session;
+        } else {
+            _session = [NSURLSession sessionWithConfiguration:sessionConfiguration
+                                                     delegate:self
+                                                delegateQueue:nil];
+        }
         _sessionManagerDelegates = [AWSSynchronizedMutableDictionary new];
+        _coalescedDelegates = [NSMutableDictionary new];
+        if (configuration.retryMode == AWSRetryModeStandard || configuration.retryMode == AWSRetryModeAdaptive) {
+            _retryQuota = [AWSRetryQuota new];
+        }
+        if (configuration.retryMode == AWSRetryModeAdaptive) {
+            _rateLimiter = [AWSClientSideRateLimiter new];
+        }
+        if (configuration.hedgesReadRequests) {
+            _hedger = [[AWSURLSessionHedger alloc] initWithDelayPercentile:configuration.hedgingDelayPercentile
+                                                 maximumHedgedRequestRatio:configuration.maximumHedgedRequestRatio];
+        }
         _isSessionValid = YES;
     }
 
@@ -155,6 +428,8 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     delegate.responseData = nil;
     delegate.responseObject = nil;
     delegate.error = nil;
+    delegate.cachedResponse = nil;
+    delegate.hedgedRead = nil;
     NSMutableURLRequest *mutableRequest = [NSMutableURLRequest requestWithURL:delegate.request.URL];
     mutableRequest.cachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
 
@@ -176,6 +451,14 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                                                 parameters:request.parameters];
     }
 
+    AWSURLResponseCache *responseCache = self.configuration.responseCache;
+    if (responseCache && !delegate.downloadingFileURL) {
+        task = [task continueWithSuccessBlock:^id(AWSTask *task) {
+            delegate.cachedResponse = [responseCache prepareRequest:mutableRequest];
+            return nil;
+        }];
+    }
+
     for(id<AWSNetworkingRequestInterceptor>interceptor in request.requestInterceptors) {
         task = [task continueWithSuccessBlock:^id(AWSTask *task) {
             return [interceptor interceptRequest:mutableRequest];
@@ -186,57 +469,280 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
         AWSNetworkingRequest *request = delegate.request;
         return [request.requestSerializer validateRequest:mutableRequest];
     }] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
-        switch (delegate.taskType) {
-            case AWSURLSessionTaskTypeData:
-                delegate.request.task = [self.session dataTaskWithRequest:mutableRequest];
-                break;
+        if ([self coalesceDelegate:delegate request:mutableRequest]) {
+            return nil;
+        }
 
-            default:
-                break;
+        if (self.rateLimiter) {
+            return [[self.rateLimiter acquireToken] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+                return [self resumeTaskWithDelegate:delegate request:mutableRequest];
+            }];
+        }
+        return [self resumeTaskWithDelegate:delegate request:mutableRequest];
+    }] continueWithBlock:^id(AWSTask *task) {
+        if (task.error) {
+            NSError *error = task.error;
+            delegate.taskCompletionSource.error = error;
         }
+        return nil;
+    }];
+}
 
-        if (delegate.request.task) {
-            if (!self.session || !self.isSessionValid) {
-                AWSDDLogError(@"Invalid AWSURLSessionTaskType.");
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
-                                                                  code:AWSNetworkingErrorSessionInvalid
-                                                              userInfo:@{NSLocalizedDescriptionKey: @"URLSession is nil or invalidated."}]];
-            }
+- (AWSTask *)resumeTaskWithDelegate:(AWSURLSessionManagerDelegate *)delegate request:(NSURLRequest *)URLRequest {
+    // The request may have been cancelled while it was signed or waited for the rate limiter.
+    if (delegate.request.isCancelled) {
+        return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                          code:AWSNetworkingErrorCancelled
+                                                      userInfo:nil]];
+    }
 
-            [self.sessionManagerDelegates setObject:delegate
-                                             forKey:@(((NSURLSessionTask *)delegate.request.task).taskIdentifier)];
+    switch (delegate.taskType) {
+        case AWSURLSessionTaskTypeData:
+            delegate.request.task = [self.session dataTaskWithRequest:URLRequest];
+            break;
 
-            [self printHTTPHeadersAndBodyForRequest:delegate.request.task.originalRequest];
+        default:
+            break;
+    }
 
-            [delegate.request.task resume];
-        } else {
+    if (delegate.request.task) {
+        if (!self.session || !self.isSessionValid) {
             AWSDDLogError(@"Invalid AWSURLSessionTaskType.");
             return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
-                                                              code:AWSNetworkingErrorUnknown
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"Invalid AWSURLSessionTaskType."}]];
+                                                              code:AWSNetworkingErrorSessionInvalid
+                                                          userInfo:@{NSLocalizedDescriptionKey: @"URLSession is nil or invalidated."}]];
         }
 
-        return nil;
-    }] continueWithBlock:^id(AWSTask *task) {
-        if (task.error) {
-            NSError *error = task.error;
-            delegate.taskCompletionSource.error = error;
+        [self.sessionManagerDelegates setObject:delegate
+                                         forKey:@(((NSURLSessionTask *)delegate.request.task).taskIdentifier)];
+        [self.sharedSession addTask:delegate.request.task sessionManager:self];
+
+        [self printHTTPHeadersAndBodyForRequest:delegate.request.task.originalRequest];
+
+        [self scheduleHedgedRequestForDelegate:delegate request:URLRequest];
+        [delegate.request.task resume];
+    } else {
+        AWSDDLogError(@"Invalid AWSURLSessionTaskType.");
+        return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                          code:AWSNetworkingErrorUnknown
+                                                      userInfo:@{NSLocalizedDescriptionKey: @"Invalid AWSURLSessionTaskType."}]];
+    }
+
+    return nil;
+}
+
+- (BOOL)isThrottlingResponse:(NSHTTPURLResponse *)response
+                        data:(NSData *)data
+                       error:(NSError *)error
+                retryHandler:(id<AWSURLRequestRetryHandler>)retryHandler {
+    if ([retryHandler respondsToSelector:@selector(isThrottlingResponse:data:error:)]) {
+        return [retryHandler isThrottlingResponse:response data:data error:error];
+    }
+    return response.statusCode == 429;
+}
+
+#pragma mark - Hedging
+
+- (void)scheduleHedgedRequestForDelegate:(AWSURLSessionManagerDelegate *)delegate request:(NSURLRequest *)URLRequest {
+    if (!self.hedger
+        || delegate.taskType != AWSURLSessionTaskTypeData
+        || delegate.shouldWriteToFile
+        || URLRequest.HTTPBodyStream
+        || self.rateLimiter.isEnabled
+        || ![self isReadOnlyRequest:URLRequest serializer:delegate.request.requestSerializer]) {
+        return;
+    }
+
+    AWSURLSessionHedgedRead *hedgedRead = [AWSURLSessionHedgedRead new];
+    hedgedRead.startTime = [NSProcessInfo processInfo].systemUptime;
+    hedgedRead.task = delegate.request.task;
+    delegate.hedgedRead = hedgedRead;
+
+    NSTimeInterval delay = [self.hedger hedgingDelayForRead];
+    if (delay < 0) {
+        return;
+    }
+    __weak AWSURLSessionManager *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        [weakSelf sendHedgedRequestForDelegate:delegate hedgedRead:hedgedRead request:URLRequest];
+    });
+}
+
+- (void)sendHedgedRequestForDelegate:(AWSURLSessionManagerDelegate *)delegate
+                          hedgedRead:(AWSURLSessionHedgedRead *)hedgedRead
+                             request:(NSURLRequest *)URLRequest {
+    @synchronized(hedgedRead) {
+        if (hedgedRead.isCompleted
+            || delegate.request.isCancelled
+            || !self.session
+            || !self.isSessionValid
+            || ![self.hedger acquireHedgedRequest]) {
+            return;
         }
+
+        AWSURLSessionManagerDelegate *hedgedDelegate = [AWSURLSessionManagerDelegate new];
+        hedgedDelegate.taskType = delegate.taskType;
+        hedgedDelegate.taskCompletionSource = delegate.taskCompletionSource;
+        hedgedDelegate.request = delegate.request;
+        hedgedDelegate.shouldWriteDirectly = delegate.shouldWriteDirectly;
+        hedgedDelegate.currentRetryCount = delegate.currentRetryCount;
+        hedgedDelegate.coalescingKey = delegate.coalescingKey;
+        hedgedDelegate.cachedResponse = delegate.cachedResponse;
+        hedgedDelegate.retryQuotaCost = delegate.retryQuotaCost;
+        hedgedDelegate.hedgedRead = hedgedRead;
+
+        hedgedRead.hedgedTask = [self.session dataTaskWithRequest:URLRequest];
+        [self.sessionManagerDelegates setObject:hedgedDelegate
+                                         forKey:@(hedgedRead.hedgedTask.taskIdentifier)];
+        [self.sharedSession addTask:hedgedRead.hedgedTask sessionManager:self];
+
+        AWSDDLogDebug(@"Hedging the request to %@.", URLRequest.URL);
+        [hedgedRead.hedgedTask resume];
+    }
+}
+
+/**
+ Returns `NO` if the other request of `hedgedRead` completed first, or if `task` failed without a response while the
+ other request is still in flight. Otherwise, cancels the other request, if it was sent.
+ */
+- (BOOL)completeHedgedRead:(AWSURLSessionHedgedRead *)hedgedRead
+                      task:(NSURLSessionTask *)task
+                   request:(AWSNetworkingRequest *)request {
+    NSURLSessionTask *otherTask = nil;
+    @synchronized(hedgedRead) {
+        if (hedgedRead.isCompleted) {
+            return NO;
+        }
+        otherTask = task == hedgedRead.task ? hedgedRead.hedgedTask : hedgedRead.task;
+        if (!task.response
+            && otherTask
+            && !hedgedRead.failedWithoutResponse
+            && !request.isCancelled) {
+            hedgedRead.failedWithoutResponse = YES;
+            return NO;
+        }
+        hedgedRead.completed = YES;
+    }
+
+    [otherTask cancel];
+    if (task.response) {
+        [self.hedger recordLatency:[NSProcessInfo processInfo].systemUptime - hedgedRead.startTime];
+    }
+    return YES;
+}
+
+#pragma mark - Coalescing
+
+/**
+ Returns `YES` if an identical request is already in flight, in which case `delegate` completes with its response.
+ Otherwise, if the request can be coalesced, `delegate` becomes the one identical requests wait for.
+ */
+- (BOOL)coalesceDelegate:(AWSURLSessionManagerDelegate *)delegate request:(NSURLRequest *)request {
+    if (!self.configuration.coalescesIdenticalRequests
+        || delegate.coalescingKey
+        || delegate.shouldWriteToFile
+        || ![self isReadOnlyRequest:request serializer:delegate.request.requestSerializer]) {
+        return NO;
+    }
+    NSString *key = [self coalescingKeyForRequest:request];
+    if (!key) {
+        return NO;
+    }
+
+    @synchronized(self.coalescedDelegates) {
+        NSMutableArray<AWSURLSessionManagerDelegate *> *waitingDelegates = self.coalescedDelegates[key];
+        if (waitingDelegates) {
+            [waitingDelegates addObject:delegate];
+            return YES;
+        }
+        self.coalescedDelegates[key] = [NSMutableArray new];
+    }
+
+    delegate.coalescingKey = key;
+    [delegate.taskCompletionSource.task continueWithBlock:^id(AWSTask *task) {
+        [self completeDelegatesCoalescedWithKey:key task:task];
         return nil;
     }];
+    return NO;
+}
+
+- (void)completeDelegatesCoalescedWithKey:(NSString *)key task:(AWSTask *)task {
+    NSArray<AWSURLSessionManagerDelegate *> *waitingDelegates = nil;
+    @synchronized(self.coalescedDelegates) {
+        waitingDelegates = self.coalescedDelegates[key];
+        [self.coalescedDelegates removeObjectForKey:key];
+    }
+
+    BOOL cancelled = ([task.error.domain isEqualToString:AWSNetworkingErrorDomain] && task.error.code == AWSNetworkingErrorCancelled)
+    || ([task.error.domain isEqualToString:NSURLErrorDomain] && task.error.code == NSURLErrorCancelled);
+    for (AWSURLSessionManagerDelegate *delegate in waitingDelegates) {
+        if (delegate.request.isCancelled) {
+            delegate.taskCompletionSource.error = [NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                                      code:AWSNetworkingErrorCancelled
+                                                                  userInfo:nil];
+        } else if (cancelled) {
+            // Only the caller of the request that was sent cancelled it, so the others send theirs.
+            [self taskWithDelegate:delegate];
+        } else if (task.error) {
+            delegate.taskCompletionSource.error = task.error;
+        } else {
+            delegate.taskCompletionSource.result = task.result;
+        }
+    }
+}
+
+- (BOOL)isReadOnlyRequest:(NSURLRequest *)request serializer:(id<AWSURLRequestSerializer>)serializer {
+    if ([request.HTTPMethod isEqualToString:@"GET"] || [request.HTTPMethod isEqualToString:@"HEAD"]) {
+        return YES;
+    }
+    return [serializer respondsToSelector:@selector(isReadOnlyOperation)] && [serializer isReadOnlyOperation];
+}
+
+/**
+ Returns the method, URL, headers and SHA-256 of the body of `request`, without the headers that differ between
+ signatures of the same request, or `nil` for a body stream that was not hashed.
+ */
+- (NSString *)coalescingKeyForRequest:(NSURLRequest *)request {
+    NSData *payloadHash = [AWSSignatureSignerUtility payloadHashOfRequest:request];
+    if (!payloadHash) {
+        if (request.HTTPBodyStream) {
+            return nil;
+        }
+        payloadHash = [AWSSignatureSignerUtility hashData:request.HTTPBody ?: [NSData data]];
+    }
+
+    NSMutableString *key = [NSMutableString stringWithFormat:@"%@ %@\n", request.HTTPMethod, request.URL.absoluteString];
+    NSDictionary<NSString *, NSString *> *headers = request.allHTTPHeaderFields;
+    for (NSString *name in [[headers allKeys] sortedArrayUsingSelector:@selector(caseInsensitiveCompare:)]) {
+        if ([name caseInsensitiveCompare:@"Authorization"] == NSOrderedSame
+            || [name caseInsensitiveCompare:@"X-Amz-Date"] == NSOrderedSame
+            || [name caseInsensitiveCompare:@"X-Amz-Security-Token"] == NSOrderedSame) {
+            continue;
+        }
+        [key appendFormat:@"%@:%@\n", [name lowercaseString], headers[name]];
+    }
+    [key appendString:[payloadHash aws_hexEncodedString]];
+    return key;
 }
 
 /**
  Invalidates the underlying NSURLSession to avoid memory leaks. Internally, calls
  `-[NSURLSession finishTasksAndInvalidate]` so that any in-process tasks are allowed
- to complete before invalidating.
+ to complete before invalidating. A shared session is only invalidated once no other
+ session manager uses it.
 
  @warning Before calling this method, make sure no method is running on this manager.
  */
 - (void)invalidate {
     // Invalidate the session so its strong reference to self is released.
     self.isSessionValid = NO;
-    [self.session finishTasksAndInvalidate];
+    if (self.sharedSession) {
+        [self.sharedSession relinquish];
+        self.sharedSession = nil;
+        self.session = nil;
+    } else {
+        [self.session finishTasksAndInvalidate];
+    }
 }
 
 #pragma mark - NSURLSessionDelegate
@@ -253,15 +759,20 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 #pragma mark - NSURLSessionTaskDelegate
 
 - (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)sessionTask didCompleteWithError:(NSError *)error {
-    if (error) {
-        AWSDDLogError(@"Session task failed with error: %@", error);
-    }
-
     [self printHTTPHeadersForResponse:sessionTask.response];
 
     [[[AWSTask taskWithResult:nil] continueWithSuccessBlock:^id(AWSTask *task) {
         AWSURLSessionManagerDelegate *delegate = [self.sessionManagerDelegates objectForKey:@(sessionTask.taskIdentifier)];
 
+        // The request that loses a hedged read is cancelled, or its error is superseded, so it is not reported.
+        if (delegate.hedgedRead && ![self completeHedgedRead:delegate.hedgedRead task:sessionTask request:delegate.request]) {
+            return nil;
+        }
+
+        if (error) {
+            AWSDDLogError(@"Session task failed with error: %@", error);
+        }
+
         if (delegate.responseFilehandle) {
             [delegate.responseFilehandle closeFile];
         }
@@ -279,7 +790,19 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
         if (!delegate.error
             && [sessionTask.response isKindOfClass:[NSHTTPURLResponse class]]) {
             NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *)sessionTask.response;
-            
+
+            AWSURLResponseCache *responseCache = self.configuration.responseCache;
+            if (responseCache && !delegate.downloadingFileURL) {
+                NSData *data = delegate.responseData;
+                httpResponse = [responseCache responseForResponse:httpResponse
+                                                          request:sessionTask.originalRequest
+                                                   cachedResponse:delegate.cachedResponse
+                                                             data:&data];
+                if (data != delegate.responseData) {
+                    delegate.responseData = [data mutableCopy];
+                }
+            }
+
             for(id<AWSNetworkingHTTPResponseInterceptor>interceptor in delegate.request.responseInterceptors) {
                 [interceptor interceptResponse:httpResponse
                                           data:nil
@@ -355,6 +878,14 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
             }
         }
 
+        if (self.rateLimiter && [sessionTask.response isKindOfClass:[NSHTTPURLResponse class]]) {
+            BOOL throttled = [self isThrottlingResponse:(NSHTTPURLResponse *)sessionTask.response
+                                                   data:delegate.responseData
+                                                  error:delegate.error
+                                           retryHandler:delegate.request.retryHandler];
+            [self.rateLimiter updateSendingRateWithThrottlingResponse:throttled];
+        }
+
         if (delegate.error
             && ([sessionTask.response isKindOfClass:[NSHTTPURLResponse class]] || sessionTask.response == nil)
             && delegate.request.retryHandler) {
@@ -371,6 +902,14 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                                                                                  response:(NSHTTPURLResponse *)sessionTask.response
                                                                                      data:delegate.responseData
                                                                                     error:delegate.error];
+            if (retryType != AWSNetworkingRetryTypeShouldNotRetry && self.retryQuota) {
+                delegate.retryQuotaCost = [self.retryQuota acquireTokensForRetryAfterError:delegate.error];
+                if (delegate.retryQuotaCost == 0) {
+                    AWSDDLogDebug(@"The retry quota is exhausted. The request is not retried.");
+                    retryType = AWSNetworkingRetryTypeShouldNotRetry;
+                }
+            }
+
             switch (retryType) {
                 case AWSNetworkingRetryTypeShouldCorrectClockSkewAndRetry: {
                     //Correct Clock Skew
@@ -440,6 +979,10 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                 [retryHandler setValue:@NO forKey:@"isClockSkewRetried"];
             }
 
+            if (!delegate.error) {
+                [self.retryQuota releaseTokensAfterSuccessWithCost:delegate.retryQuotaCost];
+            }
+
             if (delegate.error) {
                 NSError *error = delegate.error;
                 delegate.taskCompletionSource.error = error;
@@ -0,0 +1,51 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Writes the JSON body of a request straight from its parameters, following the shape rules of the input.
+
+ `AWSJSONBuilder` converts the parameters into a new dictionary and `NSJSONSerialization` then encodes that
+ dictionary. The writer encodes the parameters into a single growable buffer, which becomes the body without being
+ copied, and computes the SHA-256 of the body as it is written, so the signer does not read the body again.
+ */
+@interface AWSJSONBodyWriter : NSObject
+
+- (instancetype)initWithServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+/**
+ Initializes a writer that does not retain `serviceDefinitionRule`, for callers that cache writers per definition and
+ must not keep the definition alive. Once the definition is deallocated, the writer returns `nil` for every body.
+ */
+- (instancetype)initWithUnretainedServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+/**
+ Returns the JSON body for `parameters` with the input rules of `actionName`, or `nil` if the body has to be built by
+ `AWSJSONBuilder` instead: for example when the input has a payload member or the service definition has no shapes.
+
+ @param payloadSHA256 Set to the SHA-256 digest of the returned body.
+ @param error         Set if a value does not match its shape, in which case `nil` is returned. `AWSJSONBuilder` would
+                      fail with the same error.
+ */
+- (nullable NSData *)bodyForParameters:(NSDictionary *)parameters
+                            actionName:(NSString *)actionName
+                         payloadSHA256:(NSData * _Nullable __autoreleasing * _Nullable)payloadSHA256
+                                 error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
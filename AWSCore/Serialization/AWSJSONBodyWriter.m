@@ -0,0 +1,552 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import "AWSJSONBodyWriter.h"
+#import <CommonCrypto/CommonDigest.h>
+#import "AWSSerialization.h"
+#import "AWSTimestampSerialization.h"
+#import "aws_encoding.h"
+
+// Bytes are hashed in runs of this size, while they are still in the cache.
+static const size_t AWSJSONBodyHashRunLength = 16 * 1024;
+static const size_t AWSJSONBodyInitialCapacity = 4 * 1024;
+
+typedef NS_ENUM(NSInteger, AWSJSONBodyShapeType) {
+    AWSJSONBodyShapeTypeScalar,
+    AWSJSONBodyShapeTypeStructure,
+    AWSJSONBodyShapeTypeList,
+    AWSJSONBodyShapeTypeMap,
+    AWSJSONBodyShapeTypeTimestamp,
+    AWSJSONBodyShapeTypeBlob,
+};
+
+@class AWSJSONBodyShape;
+
+// A member of a structure, or the member of a list or the value of a map.
+@interface AWSJSONBodyMember : NSObject {
+@public
+    AWSJSONDictionary *_rules;
+    // The key the member is written with: its locationName, or its name.
+    NSString *_JSONKey;
+    // Members located in the URI, headers or query string are not written to the body.
+    BOOL _skipped;
+    BOOL _timestampIsString;
+    AWSJSONBodyShape *_shape;
+}
+
+@end
+
+@implementation AWSJSONBodyMember
+
+@end
+
+@interface AWSJSONBodyShape : NSObject {
+@public
+    AWSJSONBodyShapeType _type;
+    NSDictionary *_memberRules;
+    NSMutableDictionary<NSString *, id> *_members;
+    AWSJSONBodyMember *_member;
+    AWSJSONBodyMember *_value;
+    BOOL _hasPayload;
+}
+
+@end
+
+@implementation AWSJSONBodyShape
+
+@end
+
+typedef struct {
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+    size_t hashedLength;
+    CC_SHA256_CTX context;
+} AWSJSONBodyBuffer;
+
+static void AWSJSONBodyBufferHash(AWSJSONBodyBuffer *buffer) {
+    while (buffer->hashedLength < buffer->length) {
+        size_t length = MIN(buffer->length - buffer->hashedLength, (size_t)UINT32_MAX);
+        CC_SHA256_Update(&buffer->context, buffer->bytes + buffer->hashedLength, (CC_LONG)length);
+        buffer->hashedLength += length;
+    }
+}
+
+// Returns space for `length` more bytes, which the caller fills and then commits.
+static uint8_t *AWSJSONBodyBufferReserve(AWSJSONBodyBuffer *buffer, size_t length) {
+    if (buffer->length - buffer->hashedLength >= AWSJSONBodyHashRunLength) {
+        AWSJSONBodyBufferHash(buffer);
+    }
+    if (buffer->capacity - buffer->length < length) {
+        size_t capacity = MAX(buffer->capacity * 2, buffer->length + length);
+        uint8_t *bytes = realloc(buffer->bytes, capacity);
+        if (bytes == NULL) {
+            [NSException raise:NSMallocException format:@"Failed to grow a JSON body to %zu bytes", capacity];
+        }
+        buffer->bytes = bytes;
+        buffer->capacity = capacity;
+    }
+    return buffer->bytes + buffer->length;
+}
+
+static void AWSJSONBodyBufferAppend(AWSJSONBodyBuffer *buffer, const void *bytes, size_t length) {
+    memcpy(AWSJSONBodyBufferReserve(buffer, length), bytes, length);
+    buffer->length += length;
+}
+
+static void AWSJSONBodyBufferAppendByte(AWSJSONBodyBuffer *buffer, uint8_t byte) {
+    *AWSJSONBodyBufferReserve(buffer, 1) = byte;
+    buffer->length += 1;
+}
+
+// Escapes quotes, backslashes and control characters, as RFC 8259 requires. Other bytes are copied in runs.
+static void AWSJSONBodyBufferAppendEscaped(AWSJSONBodyBuffer *buffer, const uint8_t *bytes, size_t length) {
+    static const char hexDigits[] = "0123456789abcdef";
+    size_t runStart = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = bytes[i];
+        if (byte >= 0x20 && byte != '"' && byte != '\\') {
+            continue;
+        }
+        AWSJSONBodyBufferAppend(buffer, bytes + runStart, i - runStart);
+        runStart = i + 1;
+
+        char escape[6] = {'\\', 0, 0, 0, 0, 0};
+        size_t escapeLength = 2;
+        switch (byte) {
+            case '"': escape[1] = '"'; break;
+            case '\\': escape[1] = '\\'; break;
+            case '\b': escape[1] = 'b'; break;
+            case '\f': escape[1] = 'f'; break;
+            case '\n': escape[1] = 'n'; break;
+            case '\r': escape[1] = 'r'; break;
+            case '\t': escape[1] = 't'; break;
+            default:
+                escape[1] = 'u';
+                escape[2] = '0';
+                escape[3] = '0';
+                escape[4] = hexDigits[byte >> 4];
+                escape[5] = hexDigits[byte & 0xf];
+                escapeLength = 6;
+                break;
+        }
+        AWSJSONBodyBufferAppend(buffer, escape, escapeLength);
+    }
+    AWSJSONBodyBufferAppend(buffer, bytes + runStart, length - runStart);
+}
+
+static void AWSJSONBodyBufferAppendString(AWSJSONBodyBuffer *buffer, NSString *string) {
+    AWSJSONBodyBufferAppendByte(buffer, '"');
+
+    // Strings are converted to UTF-8 in blocks, through a buffer on the stack.
+    uint8_t block[1024];
+    NSRange remainingRange = NSMakeRange(0, [string length]);
+    while (remainingRange.length > 0) {
+        NSUInteger usedLength = 0;
+        BOOL converted = [string getBytes:block
+                                maxLength:sizeof(block)
+                               usedLength:&usedLength
+                                 encoding:NSUTF8StringEncoding
+                                  options:0
+                                    range:remainingRange
+                           remainingRange:&remainingRange];
+        if (!converted || usedLength == 0) {
+            // An unpaired surrogate cannot be converted; the rest of the string is converted lossily instead.
+            NSData *data = [[string substringWithRange:remainingRange] dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:YES];
+            AWSJSONBodyBufferAppendEscaped(buffer, [data bytes], [data length]);
+            break;
+        }
+        AWSJSONBodyBufferAppendEscaped(buffer, block, usedLength);
+    }
+
+    AWSJSONBodyBufferAppendByte(buffer, '"');
+}
+
+static void AWSJSONBodyBufferAppendFormat(AWSJSONBodyBuffer *buffer, const char *format, ...) {
+    char text[32];
+    va_list arguments;
+    va_start(arguments, format);
+    int length = vsnprintf(text, sizeof(text), format, arguments);
+    va_end(arguments);
+    AWSJSONBodyBufferAppend(buffer, text, (size_t)MIN(MAX(length, 0), (int)sizeof(text) - 1));
+}
+
+// Writes the shortest representation that reads back as the same double. Returns NO for NaN and infinity, which JSON
+// cannot represent.
+static BOOL AWSJSONBodyBufferAppendDouble(AWSJSONBodyBuffer *buffer, double value) {
+    if (!isfinite(value)) {
+        return NO;
+    }
+    char text[32];
+    snprintf(text, sizeof(text), "%.15g", value);
+    if (strtod(text, NULL) != value) {
+        snprintf(text, sizeof(text), "%.17g", value);
+    }
+    AWSJSONBodyBufferAppend(buffer, text, strlen(text));
+    return YES;
+}
+
+static BOOL AWSJSONBodyBufferAppendNumber(AWSJSONBodyBuffer *buffer, NSNumber *number) {
+    if (number == (id)kCFBooleanTrue) {
+        AWSJSONBodyBufferAppend(buffer, "true", 4);
+        return YES;
+    }
+    if (number == (id)kCFBooleanFalse) {
+        AWSJSONBodyBufferAppend(buffer, "false", 5);
+        return YES;
+    }
+
+    const char *type = [number objCType];
+    switch (type[0]) {
+        case 'f':
+        case 'd':
+            return AWSJSONBodyBufferAppendDouble(buffer, [number doubleValue]);
+        case 'Q':
+            AWSJSONBodyBufferAppendFormat(buffer, "%llu", [number unsignedLongLongValue]);
+            return YES;
+        default:
+            AWSJSONBodyBufferAppendFormat(buffer, "%lld", [number longLongValue]);
+            return YES;
+    }
+}
+
+@implementation AWSJSONBodyWriter {
+    __weak NSDictionary *_serviceDefinitionRule;
+    // Set unless the writer was initialized with an unretained definition.
+    NSDictionary *_retainedServiceDefinitionRule;
+    NSMutableDictionary<NSString *, AWSJSONBodyShape *> *_shapes;
+    AWSJSONBodyBuffer _buffer;
+    NSError *_error;
+    // Set for a value AWSJSONBuilder serializes in a way the writer does not reproduce.
+    BOOL _unsupported;
+}
+
+- (instancetype)initWithServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    if (self = [self initWithUnretainedServiceDefinitionRule:serviceDefinitionRule]) {
+        _retainedServiceDefinitionRule = serviceDefinitionRule;
+    }
+    return self;
+}
+
+- (instancetype)initWithUnretainedServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    if (self = [super init]) {
+        _serviceDefinitionRule = serviceDefinitionRule;
+        _shapes = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_buffer.bytes);
+}
+
+- (NSData *)bodyForParameters:(NSDictionary *)parameters
+                   actionName:(NSString *)actionName
+                payloadSHA256:(NSData *__autoreleasing *)payloadSHA256
+                        error:(NSError *__autoreleasing *)error {
+    // Empty bodies, and definitions AWSJSONBuilder does not serialize with, are left to AWSJSONBuilder.
+    NSDictionary *serviceDefinitionRule = _serviceDefinitionRule;
+    if ([parameters count] == 0 || serviceDefinitionRule == nil) {
+        return nil;
+    }
+    NSDictionary *actionRule = [[[serviceDefinitionRule objectForKey:@"operations"] objectForKey:actionName] objectForKey:@"input"];
+    NSDictionary *definitionRules = [serviceDefinitionRule objectForKey:@"shapes"];
+    if (![actionRule isKindOfClass:[NSDictionary class]]
+        || [actionRule count] == 0
+        || ![definitionRules isKindOfClass:[NSDictionary class]]
+        || [definitionRules count] == 0) {
+        return nil;
+    }
+
+    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONBodyMember *root = [self memberWithRules:rules];
+    AWSJSONBodyShape *shape = [self shapeOfMember:root];
+    if (shape->_type != AWSJSONBodyShapeTypeStructure || shape->_hasPayload) {
+        return nil;
+    }
+
+    free(_buffer.bytes);
+    memset(&_buffer, 0, sizeof(_buffer));
+    _buffer.bytes = malloc(AWSJSONBodyInitialCapacity);
+    if (_buffer.bytes == NULL) {
+        return nil;
+    }
+    _buffer.capacity = AWSJSONBodyInitialCapacity;
+    CC_SHA256_Init(&_buffer.context);
+    _error = nil;
+    _unsupported = NO;
+
+    [self writeValue:parameters member:root];
+    if (_unsupported) {
+        return nil;
+    }
+    if (_error) {
+        if (error) {
+            *error = _error;
+        }
+        return nil;
+    }
+
+    AWSJSONBodyBufferHash(&_buffer);
+    if (payloadSHA256) {
+        NSMutableData *digest = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+        CC_SHA256_Final([digest mutableBytes], &_buffer.context);
+        *payloadSHA256 = digest;
+    }
+
+    // The buffer is handed to the body as it is.
+    NSData *body = [NSData dataWithBytesNoCopy:_buffer.bytes length:_buffer.length freeWhenDone:YES];
+    memset(&_buffer, 0, sizeof(_buffer));
+    return body;
+}
+
+#pragma mark - Shapes
+
+- (AWSJSONBodyMember *)memberWithRules:(AWSJSONDictionary *)rules {
+    AWSJSONBodyMember *member = [AWSJSONBodyMember new];
+    member->_rules = rules ?: (AWSJSONDictionary *)@{};
+    member->_timestampIsString = [member->_rules[@"timestampFormat"] isEqualToString:@"iso8601"] || [member->_rules[@"timestampFormat"] isEqualToString:@"rfc822"];
+    return member;
+}
+
+- (AWSJSONBodyShape *)shapeOfMember:(AWSJSONBodyMember *)member {
+    if (member->_shape == nil) {
+        member->_shape = [self shapeForRules:member->_rules];
+    }
+    return member->_shape;
+}
+
+- (AWSJSONBodyShape *)shapeForRules:(AWSJSONDictionary *)rules {
+    NSString *shapeName = [rules objectForKey:@"shape"];
+    AWSJSONBodyShape *shape = shapeName ? _shapes[shapeName] : nil;
+    if (shape) {
+        return shape;
+    }
+
+    shape = [AWSJSONBodyShape new];
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"structure"]) {
+        shape->_type = AWSJSONBodyShapeTypeStructure;
+        shape->_memberRules = rules[@"members"];
+        shape->_members = [NSMutableDictionary new];
+        shape->_hasPayload = rules[@"payload"] != nil;
+    } else if ([type isEqualToString:@"list"]) {
+        shape->_type = AWSJSONBodyShapeTypeList;
+        shape->_member = [self memberWithRules:rules[@"member"]];
+    } else if ([type isEqualToString:@"map"]) {
+        shape->_type = AWSJSONBodyShapeTypeMap;
+        shape->_value = [self memberWithRules:rules[@"value"]];
+    } else if ([type isEqualToString:@"timestamp"]) {
+        shape->_type = AWSJSONBodyShapeTypeTimestamp;
+    } else if ([type isEqualToString:@"blob"]) {
+        shape->_type = AWSJSONBodyShapeTypeBlob;
+    }
+    if (shapeName) {
+        _shapes[shapeName] = shape;
+    }
+    return shape;
+}
+
+// Structure members are resolved on first use, so that only the members a request sets are visited.
+- (AWSJSONBodyMember *)member:(NSString *)name ofShape:(AWSJSONBodyShape *)shape {
+    id member = shape->_members[name];
+    if (member == nil) {
+        AWSJSONDictionary *rules = shape->_memberRules[name];
+        if (rules) {
+            AWSJSONBodyMember *structureMember = [self memberWithRules:rules];
+            structureMember->_JSONKey = rules[@"locationName"] ?: name;
+            structureMember->_skipped = rules[@"location"] != nil;
+            member = structureMember;
+        } else {
+            member = [NSNull null];
+        }
+        shape->_members[name] = member;
+    }
+    return member == [NSNull null] ? nil : member;
+}
+
+#pragma mark - Writing
+
+- (void)failWithDescription:(NSString *)description {
+    if (_error == nil) {
+        _error = [NSError errorWithDomain:AWSJSONBuilderErrorDomain
+                                     code:AWSJSONBuilderInvalidParameter
+                                 userInfo:@{NSLocalizedDescriptionKey : description}];
+    }
+}
+
+// Writes `value` as AWSJSONBuilder serializes it, then NSJSONSerialization encodes it.
+- (void)writeValue:(id)value member:(AWSJSONBodyMember *)member {
+    AWSJSONBodyShape *shape = [self shapeOfMember:member];
+    AWSJSONBodyBuffer *buffer = &_buffer;
+
+    switch (shape->_type) {
+        case AWSJSONBodyShapeTypeStructure: {
+            if (shape->_hasPayload) {
+                _unsupported = YES;
+                return;
+            }
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                if (![value isKindOfClass:[NSNull class]]) {
+                    [self failWithDescription:[NSString stringWithFormat:@"a structure input should be a dictionary but got:%@", value]];
+                }
+                AWSJSONBodyBufferAppend(buffer, "{}", 2);
+                return;
+            }
+            AWSJSONBodyBufferAppendByte(buffer, '{');
+            BOOL first = YES;
+            for (NSString *name in value) {
+                AWSJSONBodyMember *structureMember = [self member:name ofShape:shape];
+                if (structureMember == nil || structureMember->_skipped) {
+                    continue;
+                }
+                if (!first) {
+                    AWSJSONBodyBufferAppendByte(buffer, ',');
+                }
+                first = NO;
+                AWSJSONBodyBufferAppendString(buffer, structureMember->_JSONKey);
+                AWSJSONBodyBufferAppendByte(buffer, ':');
+                [self writeValue:value[name] member:structureMember];
+            }
+            AWSJSONBodyBufferAppendByte(buffer, '}');
+            return;
+        }
+        case AWSJSONBodyShapeTypeList: {
+            if (![value isKindOfClass:[NSArray class]]) {
+                if (![value isKindOfClass:[NSNull class]]) {
+                    [self failWithDescription:[NSString stringWithFormat:@"a list input should be an array but got:%@", value]];
+                }
+                AWSJSONBodyBufferAppend(buffer, "[]", 2);
+                return;
+            }
+            AWSJSONBodyBufferAppendByte(buffer, '[');
+            BOOL first = YES;
+            for (id memberValue in value) {
+                if (!first) {
+                    AWSJSONBodyBufferAppendByte(buffer, ',');
+                }
+                first = NO;
+                [self writeValue:memberValue member:shape->_member];
+            }
+            AWSJSONBodyBufferAppendByte(buffer, ']');
+            return;
+        }
+        case AWSJSONBodyShapeTypeMap: {
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                if (![value isKindOfClass:[NSNull class]]) {
+                    [self failWithDescription:[NSString stringWithFormat:@"a map input should be a dictionary but got:%@", value]];
+                }
+                AWSJSONBodyBufferAppend(buffer, "{}", 2);
+                return;
+            }
+            [self writeObject:value valueMember:shape->_value];
+            return;
+        }
+        case AWSJSONBodyShapeTypeTimestamp: {
+            NSError *error = nil;
+            NSString *timestampString = [AWSJSONTimestampSerialization serializeTimestamp:member->_rules value:value error:&error];
+            if (error) {
+                _error = _error ?: error;
+            }
+            if (timestampString == nil) {
+                // AWSJSONBuilder leaves the member out of the body.
+                _unsupported = YES;
+                return;
+            }
+            if (member->_timestampIsString) {
+                [self writeJSONValue:timestampString];
+            } else if (!AWSJSONBodyBufferAppendDouble(buffer, [timestampString doubleValue])) {
+                [self failWithDescription:[NSString stringWithFormat:@"the timestamp value is invalid:%@", value]];
+            }
+            return;
+        }
+        case AWSJSONBodyShapeTypeBlob: {
+            if ([value isKindOfClass:[NSString class]]) {
+                value = [value dataUsingEncoding:NSUTF8StringEncoding];
+            }
+            if (![value isKindOfClass:[NSData class]]) {
+                [self failWithDescription:@"'blob' value should be a NSData type."];
+                AWSJSONBodyBufferAppend(buffer, "\"\"", 2);
+                return;
+            }
+            // Base64 needs no escaping, so it is encoded in place.
+            size_t encodedLength = AWS_BASE64_ENCODED_LENGTH([value length]);
+            uint8_t *bytes = AWSJSONBodyBufferReserve(buffer, encodedLength + 2);
+            bytes[0] = '"';
+            aws_base64_encode([value bytes], [value length], (char *)bytes + 1);
+            bytes[encodedLength + 1] = '"';
+            buffer->length += encodedLength + 2;
+            return;
+        }
+        case AWSJSONBodyShapeTypeScalar:
+            [self writeJSONValue:value];
+            return;
+    }
+}
+
+// Writes a value that AWSJSONBuilder passes through unchanged, such as a string, a number or a document.
+- (void)writeJSONValue:(id)value {
+    AWSJSONBodyBuffer *buffer = &_buffer;
+    if ([value isKindOfClass:[NSString class]]) {
+        AWSJSONBodyBufferAppendString(buffer, value);
+    } else if ([value isKindOfClass:[NSNumber class]]) {
+        if (!AWSJSONBodyBufferAppendNumber(buffer, value)) {
+            [self failWithDescription:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@", value]];
+        }
+    } else if (value == nil || [value isKindOfClass:[NSNull class]]) {
+        AWSJSONBodyBufferAppend(buffer, "null", 4);
+    } else if ([value isKindOfClass:[NSArray class]]) {
+        AWSJSONBodyBufferAppendByte(buffer, '[');
+        BOOL first = YES;
+        for (id memberValue in value) {
+            if (!first) {
+                AWSJSONBodyBufferAppendByte(buffer, ',');
+            }
+            first = NO;
+            [self writeJSONValue:memberValue];
+        }
+        AWSJSONBodyBufferAppendByte(buffer, ']');
+    } else if ([value isKindOfClass:[NSDictionary class]]) {
+        [self writeObject:value valueMember:nil];
+    } else {
+        [self failWithDescription:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@", value]];
+    }
+}
+
+// Writes a map, or a dictionary inside a document when `valueMember` is nil.
+- (void)writeObject:(NSDictionary *)object valueMember:(AWSJSONBodyMember *)valueMember {
+    AWSJSONBodyBuffer *buffer = &_buffer;
+    AWSJSONBodyBufferAppendByte(buffer, '{');
+    BOOL first = YES;
+    for (id key in object) {
+        if (![key isKindOfClass:[NSString class]]) {
+            [self failWithDescription:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@", object]];
+            return;
+        }
+        if (!first) {
+            AWSJSONBodyBufferAppendByte(buffer, ',');
+        }
+        first = NO;
+        AWSJSONBodyBufferAppendString(buffer, key);
+        AWSJSONBodyBufferAppendByte(buffer, ':');
+        if (valueMember) {
+            [self writeValue:object[key] member:valueMember];
+        } else {
+            [self writeJSONValue:object[key]];
+        }
+    }
+    AWSJSONBodyBufferAppendByte(buffer, '}');
+}
+
+@end
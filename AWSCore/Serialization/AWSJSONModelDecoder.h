@@ -0,0 +1,49 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSSerialization.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Decodes the JSON body of a successful response straight into an `AWSModel` subclass, following the shape rules of
+ the output.
+
+ `AWSJSONParser` converts the parsed JSON into a new dictionary, and `AWSMTLJSONAdapter` then walks that dictionary
+ again to build the models. The decoder does both in one walk: structures become models as they are reached, and
+ scalars are converted once and handed to the transformer of their property. A decoder caches the shapes and model
+ classes it resolves, so it should be used for one response.
+ */
+@interface AWSJSONModelDecoder : NSObject
+
+- (instancetype)initWithServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+/**
+ Returns an instance of `modelClass` decoded from `JSONObject` with the output rules of `actionName`, or `nil` if the
+ response has to go through `AWSJSONParser` and `AWSMTLJSONAdapter` instead: for example when it has a payload member,
+ when a value does not match its shape or when a shape has no model class.
+
+ @param additionalValues Members read from outside the body, such as headers, keyed by member name. They are set as
+                         `AWSMTLJSONAdapter` would set them from the parsed dictionary.
+ */
+- (nullable id)modelOfClass:(Class)modelClass
+                 JSONObject:(id)JSONObject
+                 actionName:(NSString *)actionName
+           additionalValues:(nullable NSDictionary *)additionalValues;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,341 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSJSONModelDecoder.h"
+#import "AWSModel.h"
+#import "AWSMTLClassDescriptor.h"
+
+@interface AWSJSONParser (AWSJSONModelDecoder)
+
++ (id)serializeMember:(NSDictionary *)shape value:(id)value target:(id)target error:(NSError *__autoreleasing *)error;
+
+@end
+
+@class AWSJSONModelShape;
+
+// A member of a structure, or the member of a list or the value of a map.
+@interface AWSJSONModelMember : NSObject {
+@public
+    NSString *_name;
+    AWSJSONDictionary *_rules;
+    AWSJSONModelShape *_shape;
+}
+
+@end
+
+@implementation AWSJSONModelMember
+
+@end
+
+@interface AWSJSONModelShape : NSObject {
+@public
+    NSString *_type;
+    Class _modelClass;
+    NSDictionary<NSString *, AWSJSONModelMember *> *_membersByJSONKey;
+    AWSJSONModelMember *_member;
+    AWSJSONModelMember *_value;
+    // A list or map whose values are, or contain, structures. Its values are decoded into models instead of being
+    // handed to the property transformer.
+    BOOL _containsStructure;
+}
+
+@end
+
+@implementation AWSJSONModelShape
+
+@end
+
+@implementation AWSJSONModelDecoder {
+    NSDictionary *_serviceDefinitionRule;
+    NSString *_classPrefix;
+    NSMutableDictionary<NSString *, AWSJSONModelShape *> *_shapes;
+    NSMapTable<Class, id> *_descriptors;
+    BOOL _failed;
+}
+
+- (instancetype)initWithServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    if (self = [super init]) {
+        _serviceDefinitionRule = serviceDefinitionRule;
+        _shapes = [NSMutableDictionary new];
+        _descriptors = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality
+                                            valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    return self;
+}
+
+- (id)modelOfClass:(Class)modelClass
+        JSONObject:(id)JSONObject
+        actionName:(NSString *)actionName
+  additionalValues:(NSDictionary *)additionalValues {
+    // Error bodies are left to the service response serializers.
+    if (![JSONObject isKindOfClass:[NSDictionary class]] || JSONObject[@"__type"]) {
+        return nil;
+    }
+
+    NSDictionary *actionRule = [[[_serviceDefinitionRule objectForKey:@"operations"] objectForKey:actionName] objectForKey:@"output"];
+    NSDictionary *definitionRules = [_serviceDefinitionRule objectForKey:@"shapes"];
+    if (![actionRule isKindOfClass:[NSDictionary class]]
+        || ![definitionRules isKindOfClass:[NSDictionary class]]
+        || [definitionRules count] == 0) {
+        return nil;
+    }
+
+    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    if (rules[@"payload"]) {
+        return nil;
+    }
+
+    // Model classes are named after their shapes, with the prefix of the service, such as AWSDynamoDBQueryOutput for
+    // the QueryOutput shape.
+    NSString *shapeName = actionRule[@"shape"];
+    NSString *className = NSStringFromClass(modelClass);
+    if (shapeName.length == 0 || ![className hasSuffix:shapeName]) {
+        return nil;
+    }
+    _classPrefix = [className substringToIndex:className.length - shapeName.length];
+
+    AWSJSONModelShape *shape = [self shapeForRules:rules];
+    if (shape->_modelClass != modelClass) {
+        return nil;
+    }
+
+    id model = nil;
+    @try {
+        model = [self modelOfShape:shape JSONDictionary:JSONObject additionalValues:additionalValues];
+    } @catch (NSException *exception) {
+        // AWSMTLJSONAdapter reports exceptions thrown by transformers.
+        return nil;
+    }
+    return _failed ? nil : model;
+}
+
+#pragma mark - Shapes
+
+- (AWSJSONModelShape *)shapeForRules:(AWSJSONDictionary *)rules {
+    NSString *shapeName = [rules objectForKey:@"shape"];
+    AWSJSONModelShape *shape = shapeName ? _shapes[shapeName] : nil;
+    if (shape) {
+        return shape;
+    }
+
+    shape = [AWSJSONModelShape new];
+    shape->_type = rules[@"type"];
+    if (shapeName) {
+        // Cached before its members are resolved, as structures can refer to themselves.
+        _shapes[shapeName] = shape;
+    }
+
+    if ([shape->_type isEqualToString:@"structure"]) {
+        Class modelClass = shapeName ? NSClassFromString([_classPrefix stringByAppendingString:shapeName]) : nil;
+        if ([modelClass isSubclassOfClass:[AWSModel class]]) {
+            shape->_modelClass = modelClass;
+        }
+
+        // Members are matched by locationName first, then by name, as AWSJSONParser does.
+        NSDictionary *members = rules[@"members"];
+        NSMutableDictionary *membersByJSONKey = [NSMutableDictionary dictionaryWithCapacity:[members count]];
+        NSMutableDictionary *membersByLocationName = [NSMutableDictionary new];
+        for (NSString *memberName in members) {
+            AWSJSONModelMember *member = [AWSJSONModelMember new];
+            member->_name = memberName;
+            member->_rules = members[memberName];
+            membersByJSONKey[memberName] = member;
+            NSString *locationName = member->_rules[@"locationName"];
+            if (locationName) {
+                membersByLocationName[locationName] = member;
+            }
+        }
+        [membersByJSONKey addEntriesFromDictionary:membersByLocationName];
+        shape->_membersByJSONKey = membersByJSONKey;
+    } else if ([shape->_type isEqualToString:@"list"]) {
+        shape->_member = [self memberWithRules:rules[@"member"]];
+        shape->_containsStructure = [self containsStructure:shape->_member];
+    } else if ([shape->_type isEqualToString:@"map"]) {
+        shape->_value = [self memberWithRules:rules[@"value"]];
+        shape->_containsStructure = [self containsStructure:shape->_value];
+    }
+    return shape;
+}
+
+- (AWSJSONModelMember *)memberWithRules:(AWSJSONDictionary *)rules {
+    AWSJSONModelMember *member = [AWSJSONModelMember new];
+    member->_rules = rules ?: (AWSJSONDictionary *)@{};
+    return member;
+}
+
+- (BOOL)containsStructure:(AWSJSONModelMember *)member {
+    AWSJSONModelShape *shape = [self shapeOfMember:member];
+    return [shape->_type isEqualToString:@"structure"] || shape->_containsStructure;
+}
+
+// Structure members are resolved on first use, so that only the shapes a response contains are visited.
+- (AWSJSONModelShape *)shapeOfMember:(AWSJSONModelMember *)member {
+    if (member->_shape == nil) {
+        member->_shape = [self shapeForRules:member->_rules];
+    }
+    return member->_shape;
+}
+
+#pragma mark - Model classes
+
+// Returns the descriptor of a model class this decoder can build, or nil for one it leaves to AWSMTLJSONAdapter.
+- (AWSMTLClassDescriptor *)descriptorForClass:(Class)modelClass {
+    id descriptor = [_descriptors objectForKey:modelClass];
+    if (descriptor == nil) {
+        descriptor = [self supportedDescriptorForClass:modelClass] ?: [NSNull null];
+        [_descriptors setObject:descriptor forKey:modelClass];
+    }
+    return descriptor == [NSNull null] ? nil : descriptor;
+}
+
+- (AWSMTLClassDescriptor *)supportedDescriptorForClass:(Class)modelClass {
+    if ([modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)]) {
+        return nil;
+    }
+
+    AWSMTLClassDescriptor *descriptor = [AWSMTLClassDescriptor descriptorForClass:modelClass];
+    if (!descriptor.hasValidJSONMapping) {
+        return nil;
+    }
+    // Key paths into nested dictionaries are left to AWSMTLJSONAdapter.
+    for (AWSMTLPropertyDescriptor *property in descriptor.properties) {
+        if (property.JSONKeyPath && !property.JSONKeyPathIsKey) {
+            return nil;
+        }
+    }
+    return descriptor;
+}
+
+#pragma mark - Decoding
+
+- (id)modelOfShape:(AWSJSONModelShape *)shape
+    JSONDictionary:(NSDictionary *)JSONDictionary
+  additionalValues:(NSDictionary *)additionalValues {
+    Class modelClass = shape->_modelClass;
+    AWSMTLClassDescriptor *descriptor = modelClass ? [self descriptorForClass:modelClass] : nil;
+    if (descriptor == nil) {
+        _failed = YES;
+        return nil;
+    }
+
+    NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+    for (NSString *JSONKey in JSONDictionary) {
+        AWSJSONModelMember *member = shape->_membersByJSONKey[JSONKey];
+        AWSMTLPropertyDescriptor *property = member ? descriptor.propertiesByJSONKeyPath[member->_name] : nil;
+        if (property == nil) {
+            continue;
+        }
+
+        id value = JSONDictionary[JSONKey];
+        AWSJSONModelShape *memberShape = [self shapeOfMember:member];
+        if ([memberShape->_type isEqualToString:@"structure"] || memberShape->_containsStructure) {
+            value = [self decodedValue:value member:member];
+        } else {
+            NSError *error = nil;
+            value = [AWSJSONParser serializeMember:member->_rules value:value target:nil error:&error];
+            if (error) {
+                _failed = YES;
+            }
+            value = [self transformedValue:value property:property];
+        }
+        if (_failed) {
+            return nil;
+        }
+        dictionaryValue[property.key] = value;
+    }
+
+    for (NSString *memberName in additionalValues) {
+        AWSMTLPropertyDescriptor *property = descriptor.propertiesByJSONKeyPath[memberName];
+        if (property) {
+            dictionaryValue[property.key] = [self transformedValue:additionalValues[memberName] property:property];
+        }
+    }
+
+    NSError *error = nil;
+    id model = [modelClass modelWithDictionary:dictionaryValue error:&error];
+    if (model == nil) {
+        _failed = YES;
+    }
+    return model;
+}
+
+// Values with structures inside are built into models here; AWSJSONParser would have turned null containers into
+// empty ones before the transformer of the property built the models from them.
+- (id)decodedValue:(id)value member:(AWSJSONModelMember *)member {
+    AWSJSONModelShape *shape = [self shapeOfMember:member];
+    if ([shape->_type isEqualToString:@"structure"]) {
+        if (value == [NSNull null]) {
+            value = @{};
+        }
+        if (![value isKindOfClass:[NSDictionary class]]) {
+            _failed = YES;
+            return nil;
+        }
+        return [self modelOfShape:shape JSONDictionary:value additionalValues:nil];
+    }
+
+    if ([shape->_type isEqualToString:@"list"]) {
+        if (value == [NSNull null]) {
+            return [NSMutableArray new];
+        }
+        if (![value isKindOfClass:[NSArray class]]) {
+            _failed = YES;
+            return nil;
+        }
+        NSMutableArray *list = [NSMutableArray arrayWithCapacity:[value count]];
+        for (id memberValue in value) {
+            id decodedValue = [self decodedValue:memberValue member:shape->_member];
+            if (_failed) {
+                return nil;
+            }
+            [list addObject:decodedValue];
+        }
+        return list;
+    }
+
+    if (value == [NSNull null]) {
+        return [NSMutableDictionary new];
+    }
+    if (![value isKindOfClass:[NSDictionary class]]) {
+        _failed = YES;
+        return nil;
+    }
+    NSMutableDictionary *map = [NSMutableDictionary dictionaryWithCapacity:[value count]];
+    for (NSString *key in value) {
+        id decodedValue = [self decodedValue:value[key] member:shape->_value];
+        if (_failed) {
+            return nil;
+        }
+        map[key] = decodedValue;
+    }
+    return map;
+}
+
+// The same mapping AWSMTLJSONAdapter applies to a value of the parsed dictionary.
+- (id)transformedValue:(id)value property:(AWSMTLPropertyDescriptor *)property {
+    if (value == nil) {
+        return nil;
+    }
+    NSValueTransformer *transformer = property.JSONTransformer;
+    if (transformer) {
+        if (value == [NSNull null]) {
+            value = nil;
+        }
+        value = [transformer transformedValue:value] ?: [NSNull null];
+    }
+    return value;
+}
+
+@end
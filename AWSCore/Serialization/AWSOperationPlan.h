@@ -0,0 +1,94 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The parts of a request that an operation's service definition decides before any parameter is known: the HTTP method,
+ the request URI template split into literal and member segments, the input members bound to the URI, headers, query
+ string or body stream, and the query members in the order they are written. A plan also maps the response headers
+ of the operation to the output members they are bound to.
+
+ `AWSJSONRequestSerializer` and `AWSXMLRequestSerializer` used to resolve all of this from the service definition for
+ every request, and `AWSQueryStringRequestSerializer` created body writers that compiled the input shapes again for
+ every request. A plan is built the first time an operation is serialized and shared by every later request, together
+ with the body writers of its service.
+ */
+@interface AWSOperationPlan : NSObject
+
+/**
+ Returns the plan of `actionName`, building it the first time. Plans are kept for as long as `serviceDefinitionRule`
+ is alive, and are safe to use from any thread.
+ */
++ (nullable instancetype)planForActionName:(NSString *)actionName
+                     serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+/**
+ Builds a plan that is not cached, from input rules that were resolved by the caller.
+ */
+- (instancetype)initWithInputRules:(nullable NSDictionary *)inputRules
+                         uriSchema:(nullable NSString *)uriSchema
+                        hostPrefix:(nullable NSString *)hostPrefix;
+
+/**
+ Builds a plan that is not cached, for the output members of `outputRules` bound to the response.
+ */
+- (instancetype)initWithOutputRules:(nullable NSDictionary *)outputRules;
+
+@property (nonatomic, readonly, nullable) NSString *HTTPMethod;
+@property (nonatomic, readonly, nullable) NSString *uriSchema;
+@property (nonatomic, readonly, nullable) NSString *hostPrefix;
+
+/**
+ Whether the operation is flagged `readonly` in the service definition, i.e. it only reads, whatever its HTTP method.
+ */
+@property (nonatomic, readonly, getter=isReadOnly) BOOL readOnly;
+
+/**
+ Sets the URI, host prefix, headers and body stream of `request` from the members of `parameters` the plan binds. The
+ URI is appended to the URL of `request`.
+
+ @return `NO`, with `error` set, if a body stream URL is not reachable or the URI has a placeholder that could not be
+         filled in.
+ */
+- (BOOL)bindParameters:(NSDictionary *)parameters
+             toRequest:(NSMutableURLRequest *)request
+                 error:(NSError *__autoreleasing *)error;
+
+/**
+ Sets the output members bound to the headers and status code of `response` in `dictionary`. Header names are matched
+ without regard to case, and the headers are read once whatever the number of output members.
+ */
+- (void)setResponseMembersOfResponse:(NSHTTPURLResponse *)response inDictionary:(nullable NSMutableDictionary *)dictionary;
+
+/**
+ Returns the JSON body of the operation from a body writer of the service. See `-[AWSJSONBodyWriter bodyForParameters:actionName:payloadSHA256:error:]`.
+ */
+- (nullable NSData *)JSONBodyForParameters:(NSDictionary *)parameters
+                             payloadSHA256:(NSData * _Nullable __autoreleasing * _Nullable)payloadSHA256
+                                     error:(NSError *__autoreleasing *)error;
+
+/**
+ Returns the form body of the operation from a body writer of the service. See `-[AWSQueryBodyWriter bodyForParameters:actionName:payloadSHA256:error:]`.
+ */
+- (nullable NSData *)formBodyForParameters:(NSDictionary *)parameters
+                              usesEC2Rules:(BOOL)usesEC2Rules
+                             payloadSHA256:(NSData * _Nullable __autoreleasing * _Nullable)payloadSHA256
+                                     error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,629 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSOperationPlan.h"
+
+#import "AWSCategory.h"
+#import "AWSCocoaLumberjack.h"
+#import "AWSJSONBodyWriter.h"
+#import "AWSQueryBodyWriter.h"
+#import "AWSSerialization.h"
+#import "AWSValidation.h"
+
+// Idle body writers kept per service and protocol. Writers only hold compiled shapes between requests.
+static NSUInteger const AWSOperationPlanMaximumIdleWriters = 4;
+
+typedef NS_OPTIONS(NSUInteger, AWSOperationPlanBinding) {
+    AWSOperationPlanBindingHeader = 1 << 0,
+    // A map member whose entries are headers named with the member's location name as a prefix.
+    AWSOperationPlanBindingHeaderMap = 1 << 1,
+    AWSOperationPlanBindingURI = 1 << 2,
+    AWSOperationPlanBindingGreedyURI = 1 << 3,
+    AWSOperationPlanBindingQueryString = 1 << 4,
+    // A streaming member named Body or body.
+    AWSOperationPlanBindingBody = 1 << 5,
+    AWSOperationPlanBindingBlobStream = 1 << 6,
+    AWSOperationPlanBindingStatusCode = 1 << 7,
+};
+
+typedef NS_ENUM(NSInteger, AWSOperationPlanMemberType) {
+    AWSOperationPlanMemberTypeOther,
+    AWSOperationPlanMemberTypeInteger,
+    AWSOperationPlanMemberTypeLong,
+    AWSOperationPlanMemberTypeFloat,
+    AWSOperationPlanMemberTypeDouble,
+    AWSOperationPlanMemberTypeBoolean,
+    AWSOperationPlanMemberTypeString,
+    AWSOperationPlanMemberTypeTimestamp,
+    AWSOperationPlanMemberTypeList,
+};
+
+@interface AWSOperationPlanMember : NSObject {
+@public
+    NSString *_name;
+    NSString *_locationName;
+    // The query string name, percent-encoded.
+    NSString *_encodedLocationName;
+    // The name prefix of the headers of an output header map.
+    NSString *_headerPrefix;
+    AWSOperationPlanMemberType _type;
+    AWSOperationPlanBinding _bindings;
+}
+
+@end
+
+@implementation AWSOperationPlanMember
+
+@end
+
+// The plans and idle body writers of one service definition. Neither they nor the writers retain the definition, which
+// keys them weakly in the cache.
+@interface AWSServiceOperationPlans : NSObject {
+@public
+    __weak NSDictionary *_serviceDefinitionRule;
+    NSMutableDictionary<NSString *, AWSOperationPlan *> *_plans;
+    NSMutableArray<AWSJSONBodyWriter *> *_JSONWriters;
+    NSMutableArray<AWSQueryBodyWriter *> *_queryWriters;
+    NSMutableArray<AWSQueryBodyWriter *> *_EC2Writers;
+}
+
+@end
+
+@implementation AWSServiceOperationPlans
+
+@end
+
+@implementation AWSOperationPlan {
+    NSString *_actionName;
+    __weak AWSServiceOperationPlans *_service;
+    BOOL _bindsInput;
+    BOOL _uriSchemaContainsQuestionMark;
+    // Members bound to the request, in the order the input rules enumerate them.
+    NSArray<AWSOperationPlanMember *> *_members;
+    // Query string members, sorted by location name.
+    NSArray<AWSOperationPlanMember *> *_queryMembers;
+    // Literal NSString segments of the URI, and AWSOperationPlanMember segments for placeholders. NSNull stands for a
+    // placeholder no member fills in, which is removed.
+    NSArray *_uriSegments;
+    // Output members bound to a header, by lowercase header name.
+    NSDictionary<NSString *, NSArray<AWSOperationPlanMember *> *> *_responseHeaderMembers;
+    // Output maps of the headers starting with a prefix.
+    NSArray<AWSOperationPlanMember *> *_responseHeaderMapMembers;
+    NSArray<AWSOperationPlanMember *> *_statusCodeMembers;
+}
+
++ (instancetype)planForActionName:(NSString *)actionName serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    if (actionName == nil || serviceDefinitionRule == nil) {
+        return nil;
+    }
+
+    static NSMapTable<NSDictionary *, AWSServiceOperationPlans *> *services = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        services = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality
+                                         valueOptions:NSPointerFunctionsStrongMemory];
+    });
+
+    AWSServiceOperationPlans *service = nil;
+    @synchronized(services) {
+        service = [services objectForKey:serviceDefinitionRule];
+        if (service == nil) {
+            service = [AWSServiceOperationPlans new];
+            service->_serviceDefinitionRule = serviceDefinitionRule;
+            service->_plans = [NSMutableDictionary new];
+            service->_JSONWriters = [NSMutableArray new];
+            service->_queryWriters = [NSMutableArray new];
+            service->_EC2Writers = [NSMutableArray new];
+            [services setObject:service forKey:serviceDefinitionRule];
+        }
+    }
+
+    @synchronized(service) {
+        AWSOperationPlan *plan = service->_plans[actionName];
+        if (plan == nil) {
+            NSDictionary *actionRules = [[serviceDefinitionRule objectForKey:@"operations"] objectForKey:actionName];
+            NSDictionary *actionHTTPRule = [actionRules objectForKey:@"http"];
+            AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[actionRules objectForKey:@"input"]
+                                                                       JSONDefinitionRule:[serviceDefinitionRule objectForKey:@"shapes"]];
+            plan = [[AWSOperationPlan alloc] initWithInputRules:inputRules
+                                                      uriSchema:[actionHTTPRule objectForKey:@"requestUri"]
+                                                     hostPrefix:[[actionRules objectForKey:@"endpoint"] objectForKey:@"hostPrefix"]];
+            [plan compileMembersOfOutputRules:[[AWSJSONDictionary alloc] initWithDictionary:[actionRules objectForKey:@"output"]
+                                                                        JSONDefinitionRule:[serviceDefinitionRule objectForKey:@"shapes"]]];
+            plan->_HTTPMethod = [actionHTTPRule objectForKey:@"method"];
+            plan->_readOnly = [[actionRules objectForKey:@"readonly"] boolValue];
+            plan->_actionName = actionName;
+            plan->_service = service;
+            service->_plans[actionName] = plan;
+        }
+        return plan;
+    }
+}
+
+- (instancetype)initWithInputRules:(NSDictionary *)inputRules
+                         uriSchema:(NSString *)uriSchema
+                        hostPrefix:(NSString *)hostPrefix {
+    if (self = [super init]) {
+        _uriSchema = uriSchema;
+        _hostPrefix = hostPrefix;
+        _uriSchemaContainsQuestionMark = [uriSchema rangeOfString:@"?"].location != NSNotFound;
+        _bindsInput = inputRules != (id)[NSNull null] && [inputRules count] > 0;
+        if (_bindsInput) {
+            [self compileMembersOfInputRules:inputRules];
+        }
+    }
+    return self;
+}
+
+- (instancetype)initWithOutputRules:(NSDictionary *)outputRules {
+    if (self = [super init]) {
+        [self compileMembersOfOutputRules:outputRules];
+    }
+    return self;
+}
+
+#pragma mark - Compiling
+
+static AWSOperationPlanMemberType AWSOperationPlanMemberTypeOfRules(NSDictionary *rules) {
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"integer"]) {
+        return AWSOperationPlanMemberTypeInteger;
+    } else if ([type isEqualToString:@"long"]) {
+        return AWSOperationPlanMemberTypeLong;
+    } else if ([type isEqualToString:@"float"]) {
+        return AWSOperationPlanMemberTypeFloat;
+    } else if ([type isEqualToString:@"double"]) {
+        return AWSOperationPlanMemberTypeDouble;
+    } else if ([type isEqualToString:@"boolean"]) {
+        return AWSOperationPlanMemberTypeBoolean;
+    } else if ([type isEqualToString:@"string"]) {
+        return AWSOperationPlanMemberTypeString;
+    } else if ([type isEqualToString:@"timestamp"]) {
+        return AWSOperationPlanMemberTypeTimestamp;
+    } else if ([type isEqualToString:@"list"]) {
+        return AWSOperationPlanMemberTypeList;
+    }
+    return AWSOperationPlanMemberTypeOther;
+}
+
+static BOOL AWSOperationPlanMemberTypeIsNumber(AWSOperationPlanMemberType type) {
+    return type == AWSOperationPlanMemberTypeInteger
+    || type == AWSOperationPlanMemberTypeLong
+    || type == AWSOperationPlanMemberTypeFloat
+    || type == AWSOperationPlanMemberTypeDouble;
+}
+
+- (void)compileMembersOfInputRules:(NSDictionary *)inputRules {
+    NSString *uriSchema = _uriSchema ?: @"";
+    NSMutableArray<AWSOperationPlanMember *> *members = [NSMutableArray new];
+    NSMutableDictionary<NSString *, AWSOperationPlanMember *> *placeholders = [NSMutableDictionary new];
+
+    NSDictionary *memberRules = inputRules[@"members"] ?: @{};
+    [memberRules enumerateKeysAndObjectsUsingBlock:^(NSString *memberName, id rules, BOOL *stop) {
+        if (![rules isKindOfClass:[NSDictionary class]]) {
+            return;
+        }
+        AWSOperationPlanMember *member = [AWSOperationPlanMember new];
+        member->_name = memberName;
+        member->_locationName = rules[@"locationName"];
+        NSString *xmlElementName = member->_locationName ?: memberName;
+        NSString *location = rules[@"location"];
+        NSString *type = rules[@"type"];
+        member->_type = AWSOperationPlanMemberTypeOfRules(rules);
+
+        if ([location isEqualToString:@"header"]) {
+            member->_bindings |= AWSOperationPlanBindingHeader;
+        }
+        if ([location isEqualToString:@"headers"] && [type isEqualToString:@"map"]) {
+            member->_bindings |= AWSOperationPlanBindingHeaderMap;
+        }
+        if ([location isEqualToString:@"uri"]) {
+            // A member is bound to its plain placeholder if the URI has one, and to its greedy placeholder otherwise.
+            NSString *greedyName = [xmlElementName stringByAppendingString:@"+"];
+            if ([uriSchema rangeOfString:[NSString stringWithFormat:@"{%@}", xmlElementName]].location != NSNotFound) {
+                member->_bindings |= AWSOperationPlanBindingURI;
+                placeholders[xmlElementName] = member;
+            } else if ([uriSchema rangeOfString:[NSString stringWithFormat:@"{%@}", greedyName]].location != NSNotFound) {
+                member->_bindings |= AWSOperationPlanBindingGreedyURI;
+                placeholders[greedyName] = member;
+            }
+        }
+        if ([location isEqualToString:@"querystring"] && member->_locationName) {
+            member->_bindings |= AWSOperationPlanBindingQueryString;
+            member->_encodedLocationName = [member->_locationName aws_stringWithURLEncoding];
+        }
+        if (([xmlElementName isEqualToString:@"Body"] || [xmlElementName isEqualToString:@"body"]) && [rules[@"streaming"] boolValue]) {
+            member->_bindings |= AWSOperationPlanBindingBody;
+        }
+        if ([rules[@"shape"] isEqualToString:@"BlobStream"]) {
+            member->_bindings |= AWSOperationPlanBindingBlobStream;
+        }
+
+        if (member->_bindings != 0) {
+            [members addObject:member];
+        }
+    }];
+
+    _members = members;
+    _queryMembers = [[members filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(AWSOperationPlanMember *member, NSDictionary *bindings) {
+        return (member->_bindings & AWSOperationPlanBindingQueryString) != 0;
+    }]] sortedArrayUsingComparator:^NSComparisonResult(AWSOperationPlanMember *member1, AWSOperationPlanMember *member2) {
+        return [member1->_locationName caseInsensitiveCompare:member2->_locationName];
+    }];
+    _uriSegments = [self segmentsOfURISchema:uriSchema placeholders:placeholders];
+}
+
+- (void)compileMembersOfOutputRules:(NSDictionary *)outputRules {
+    if (outputRules == (id)[NSNull null] || [outputRules count] == 0) {
+        return;
+    }
+
+    NSMutableDictionary<NSString *, NSArray<AWSOperationPlanMember *> *> *headerMembers = [NSMutableDictionary new];
+    NSMutableArray<AWSOperationPlanMember *> *headerMapMembers = [NSMutableArray new];
+    NSMutableArray<AWSOperationPlanMember *> *statusCodeMembers = [NSMutableArray new];
+
+    NSDictionary *memberRules = outputRules[@"members"] ?: @{};
+    [memberRules enumerateKeysAndObjectsUsingBlock:^(NSString *memberName, id rules, BOOL *stop) {
+        if (![rules isKindOfClass:[NSDictionary class]]) {
+            return;
+        }
+        NSString *location = rules[@"location"];
+        AWSOperationPlanMember *member = [AWSOperationPlanMember new];
+        member->_name = memberName;
+        member->_locationName = rules[@"locationName"];
+        member->_type = AWSOperationPlanMemberTypeOfRules(rules);
+
+        if ([location isEqualToString:@"header"]) {
+            // Booleans and lists in headers are not decoded.
+            if (AWSOperationPlanMemberTypeIsNumber(member->_type)
+                || member->_type == AWSOperationPlanMemberTypeString
+                || member->_type == AWSOperationPlanMemberTypeTimestamp) {
+                member->_bindings = AWSOperationPlanBindingHeader;
+                NSString *headerName = [member->_locationName ?: memberName lowercaseString];
+                headerMembers[headerName] = [(headerMembers[headerName] ?: @[]) arrayByAddingObject:member];
+            }
+        } else if ([location isEqualToString:@"headers"] && [rules[@"type"] isEqualToString:@"map"]) {
+            // Without a location name, the map holds every header.
+            member->_bindings = AWSOperationPlanBindingHeaderMap;
+            member->_headerPrefix = member->_locationName ?: @"";
+            [headerMapMembers addObject:member];
+        } else if ([location isEqualToString:@"statusCode"]) {
+            if (AWSOperationPlanMemberTypeIsNumber(member->_type) || member->_type == AWSOperationPlanMemberTypeString) {
+                member->_bindings = AWSOperationPlanBindingStatusCode;
+                [statusCodeMembers addObject:member];
+            }
+        }
+    }];
+
+    _responseHeaderMembers = headerMembers;
+    _responseHeaderMapMembers = headerMapMembers;
+    _statusCodeMembers = statusCodeMembers;
+}
+
+- (NSArray *)segmentsOfURISchema:(NSString *)uriSchema
+                    placeholders:(NSDictionary<NSString *, AWSOperationPlanMember *> *)placeholders {
+    NSMutableArray *segments = [NSMutableArray new];
+    NSUInteger length = [uriSchema length];
+    NSUInteger location = 0;
+    while (location < length) {
+        NSRange open = [uriSchema rangeOfString:@"{" options:NSLiteralSearch range:NSMakeRange(location, length - location)];
+        NSRange close = open.location == NSNotFound
+        ? open
+        : [uriSchema rangeOfString:@"}" options:NSLiteralSearch range:NSMakeRange(NSMaxRange(open), length - NSMaxRange(open))];
+        if (close.location == NSNotFound) {
+            // An unterminated brace is left in the URI, which then fails validation.
+            [segments addObject:[uriSchema substringFromIndex:location]];
+            break;
+        }
+        if (open.location > location) {
+            [segments addObject:[uriSchema substringWithRange:NSMakeRange(location, open.location - location)]];
+        }
+        NSString *name = [uriSchema substringWithRange:NSMakeRange(NSMaxRange(open), close.location - NSMaxRange(open))];
+        [segments addObject:placeholders[name] ?: [NSNull null]];
+        location = NSMaxRange(close);
+    }
+    return segments;
+}
+
+#pragma mark - Binding
+
+static NSString *AWSOperationPlanStringValue(AWSOperationPlanMember *member, id value) {
+    switch (member->_type) {
+        case AWSOperationPlanMemberTypeInteger:
+        case AWSOperationPlanMemberTypeLong:
+        case AWSOperationPlanMemberTypeFloat:
+        case AWSOperationPlanMemberTypeDouble:
+            return [value isKindOfClass:[NSNumber class]] ? [value stringValue] : @"";
+        case AWSOperationPlanMemberTypeBoolean:
+            if ([value isKindOfClass:[NSNumber class]]) {
+                return [value boolValue] ? @"true" : @"false";
+            }
+            return @"";
+        case AWSOperationPlanMemberTypeString:
+            return [value isKindOfClass:[NSString class]] ? value : @"";
+        case AWSOperationPlanMemberTypeTimestamp:
+            if ([value isKindOfClass:[NSNumber class]]) {
+                if (member->_bindings & AWSOperationPlanBindingHeader) {
+                    return [[NSDate dateWithTimeIntervalSince1970:[value doubleValue]] aws_stringValue:AWSDateRFC822DateFormat1];
+                }
+                return [value stringValue];
+            }
+            // Timestamps given as strings are sent as they are.
+            return [value isKindOfClass:[NSString class]] ? value : @"";
+        default:
+            return @"";
+    }
+}
+
+static NSInputStream *AWSOperationPlanStreamOfValue(id value) {
+    if ([value isKindOfClass:[NSString class]]) {
+        value = [value dataUsingEncoding:NSUTF8StringEncoding];
+    }
+    if ([value isKindOfClass:[NSData class]]) {
+        return [NSInputStream inputStreamWithData:value];
+    }
+    return nil;
+}
+
+- (BOOL)bindParameters:(NSDictionary *)parameters
+             toRequest:(NSMutableURLRequest *)request
+                 error:(NSError *__autoreleasing *)error {
+    if (!_bindsInput) {
+        return YES;
+    }
+
+    // The string value of each URI and query string member, or the value itself for a list in the query string.
+    NSMapTable<AWSOperationPlanMember *, id> *values = nil;
+    for (AWSOperationPlanMember *member in _members) {
+        id value = nil;
+        if (member->_locationName) {
+            value = parameters[member->_locationName];
+        }
+        if (!value) {
+            value = parameters[member->_name];
+        }
+        if (!value || value == [NSNull null]) {
+            continue;
+        }
+
+        AWSOperationPlanBinding bindings = member->_bindings;
+        if (bindings & (AWSOperationPlanBindingHeader | AWSOperationPlanBindingURI | AWSOperationPlanBindingGreedyURI | AWSOperationPlanBindingQueryString)) {
+            NSString *valueStr = AWSOperationPlanStringValue(member, value);
+            if (bindings & AWSOperationPlanBindingHeader) {
+                [request addValue:valueStr forHTTPHeaderField:member->_locationName];
+            }
+            if (bindings & (AWSOperationPlanBindingURI | AWSOperationPlanBindingGreedyURI | AWSOperationPlanBindingQueryString)) {
+                if (!values) {
+                    values = [NSMapTable strongToStrongObjectsMapTable];
+                }
+                BOOL isQueryList = member->_type == AWSOperationPlanMemberTypeList && (bindings & AWSOperationPlanBindingQueryString);
+                [values setObject:isQueryList ? value : valueStr forKey:member];
+            }
+        }
+
+        if ((bindings & AWSOperationPlanBindingHeaderMap) && [value isKindOfClass:[NSDictionary class]]) {
+            for (NSString *key in value) {
+                [request addValue:value[key] forHTTPHeaderField:[member->_locationName stringByAppendingString:key]];
+            }
+        }
+
+        if (bindings & AWSOperationPlanBindingBody) {
+            if ([value isKindOfClass:[NSURL class]]) {
+                NSError *reachabilityError = nil;
+                if (![value checkResourceIsReachableAndReturnError:&reachabilityError]) {
+                    if (error) {
+                        *error = reachabilityError ?: [NSError errorWithDomain:AWSValidationErrorDomain
+                                                                          code:AWSValidationUnknownError
+                                                                      userInfo:@{NSLocalizedDescriptionKey : @"Unknown error happened while enumerating rules"}];
+                    }
+                    return NO;
+                }
+                request.HTTPBodyStream = [NSInputStream inputStreamWithURL:value];
+            } else {
+                NSInputStream *stream = AWSOperationPlanStreamOfValue(value);
+                if (stream) {
+                    request.HTTPBodyStream = stream;
+                }
+            }
+        }
+
+        if (bindings & AWSOperationPlanBindingBlobStream) {
+            AWSDDLogVerbose(@"value type = %@", [value class]);
+            NSInputStream *stream = [value isKindOfClass:[NSInputStream class]] ? value : AWSOperationPlanStreamOfValue(value);
+            if (stream) {
+                request.HTTPBodyStream = stream;
+            }
+        }
+    }
+
+    NSMutableString *rawURI = [NSMutableString new];
+    for (id segment in _uriSegments) {
+        if ([segment isKindOfClass:[NSString class]]) {
+            [rawURI appendString:segment];
+        } else if (segment != [NSNull null]) {
+            AWSOperationPlanMember *member = segment;
+            NSString *valueStr = [values objectForKey:member];
+            if (valueStr) {
+                [rawURI appendString:(member->_bindings & AWSOperationPlanBindingURI)
+                 ? [valueStr aws_stringWithURLEncoding]
+                 : [valueStr aws_stringWithURLEncodingPathWithoutPriorDecoding]];
+            }
+        }
+    }
+
+    BOOL hasQueryString = _uriSchemaContainsQuestionMark;
+    for (AWSOperationPlanMember *member in _queryMembers) {
+        id value = [values objectForKey:member];
+        if (!value) {
+            continue;
+        }
+        for (NSString *singleValue in ([value isKindOfClass:[NSArray class]] ? value : @[value])) {
+            [rawURI appendString:hasQueryString ? @"&" : @"?"];
+            [rawURI appendString:member->_encodedLocationName];
+            [rawURI appendString:@"="];
+            [rawURI appendString:[singleValue aws_stringWithURLEncoding]];
+            hasQueryString = YES;
+        }
+    }
+
+    if (_hostPrefix.length) {
+        NSURLComponents *urlComponents = [[NSURLComponents alloc] initWithURL:request.URL resolvingAgainstBaseURL:NO];
+        [urlComponents setHost:[_hostPrefix stringByAppendingString:request.URL.host]];
+        request.URL = urlComponents.URL;
+    }
+
+    if ([rawURI rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"{}"]].location != NSNotFound) {
+        if (error) {
+            *error = [NSError errorWithDomain:AWSValidationErrorDomain
+                                         code:AWSValidationURIIsInvalid
+                                     userInfo:@{NSLocalizedDescriptionKey : [NSString stringWithFormat:@"the constructed request queryString is invalid:%@", rawURI]}];
+        }
+        request.URL = [NSURL URLWithString:[NSString stringWithFormat:@"%@/", request.URL]];
+        return NO;
+    }
+
+    // @"?location" -> @"?location="
+    if ([rawURI rangeOfString:@"?"].location != NSNotFound && [rawURI rangeOfString:@"="].location == NSNotFound) {
+        [rawURI appendString:@"="];
+    }
+
+    NSString *finalURL = [NSString stringWithFormat:@"%@%@", request.URL, rawURI];
+    request.URL = [NSURL URLWithString:finalURL];
+    if (!request.URL) {
+        if (error) {
+            *error = [NSError errorWithDomain:AWSValidationErrorDomain
+                                         code:AWSValidationURIIsInvalid
+                                     userInfo:@{NSLocalizedDescriptionKey : [NSString stringWithFormat:@"unable the assigned URL to request, URL may be invalid:%@", finalURL]}];
+        }
+        return NO;
+    }
+    return YES;
+}
+
+#pragma mark - Responses
+
+static id AWSOperationPlanHeaderValue(AWSOperationPlanMember *member, NSString *value) {
+    switch (member->_type) {
+        case AWSOperationPlanMemberTypeInteger:
+            return @([value integerValue]);
+        case AWSOperationPlanMemberTypeLong:
+            return @([value longLongValue]);
+        case AWSOperationPlanMemberTypeFloat:
+            return @([value floatValue]);
+        case AWSOperationPlanMemberTypeDouble:
+            return @([value doubleValue]);
+        default:
+            // Strings, and timestamps, which the model converts.
+            return value;
+    }
+}
+
+- (void)setResponseMembersOfResponse:(NSHTTPURLResponse *)response inDictionary:(NSMutableDictionary *)dictionary {
+    if (dictionary == nil) {
+        return;
+    }
+
+    if ([_responseHeaderMembers count] > 0 || [_responseHeaderMapMembers count] > 0) {
+        NSDictionary *headers = [response allHeaderFields];
+        NSMutableDictionary<NSString *, NSMutableDictionary *> *maps = nil;
+        for (NSString *headerName in headers) {
+            id value = headers[headerName];
+            if ([_responseHeaderMembers count] > 0) {
+                for (AWSOperationPlanMember *member in _responseHeaderMembers[[headerName lowercaseString]]) {
+                    dictionary[member->_name] = AWSOperationPlanHeaderValue(member, value);
+                }
+            }
+            for (AWSOperationPlanMember *member in _responseHeaderMapMembers) {
+                NSString *prefix = member->_headerPrefix;
+                if ([prefix length] > 0 && [headerName rangeOfString:prefix options:NSAnchoredSearch | NSCaseInsensitiveSearch].location == NSNotFound) {
+                    continue;
+                }
+                NSString *key = [prefix length] > 0
+                ? [headerName stringByReplacingOccurrencesOfString:prefix withString:@"" options:NSCaseInsensitiveSearch range:NSMakeRange(0, [headerName length])]
+                : headerName;
+                if (maps == nil) {
+                    maps = [NSMutableDictionary new];
+                }
+                NSMutableDictionary *map = maps[member->_name];
+                if (map == nil) {
+                    map = [NSMutableDictionary new];
+                    maps[member->_name] = map;
+                }
+                map[key] = value;
+            }
+        }
+        [dictionary addEntriesFromDictionary:maps];
+    }
+
+    for (AWSOperationPlanMember *member in _statusCodeMembers) {
+        NSNumber *statusCode = @(response.statusCode);
+        dictionary[member->_name] = member->_type == AWSOperationPlanMemberTypeString ? [statusCode stringValue] : statusCode;
+    }
+}
+
+#pragma mark - Body writers
+
+- (NSData *)JSONBodyForParameters:(NSDictionary *)parameters
+                    payloadSHA256:(NSData *__autoreleasing *)payloadSHA256
+                            error:(NSError *__autoreleasing *)error {
+    AWSServiceOperationPlans *service = _service;
+    if (service == nil) {
+        return nil;
+    }
+    AWSJSONBodyWriter *writer = nil;
+    @synchronized(service) {
+        writer = [service->_JSONWriters lastObject];
+        [service->_JSONWriters removeLastObject];
+    }
+    if (writer == nil) {
+        writer = [[AWSJSONBodyWriter alloc] initWithUnretainedServiceDefinitionRule:service->_serviceDefinitionRule];
+    }
+    NSData *body = [writer bodyForParameters:parameters actionName:_actionName payloadSHA256:payloadSHA256 error:error];
+    @synchronized(service) {
+        if ([service->_JSONWriters count] < AWSOperationPlanMaximumIdleWriters) {
+            [service->_JSONWriters addObject:writer];
+        }
+    }
+    return body;
+}
+
+- (NSData *)formBodyForParameters:(NSDictionary *)parameters
+                     usesEC2Rules:(BOOL)usesEC2Rules
+                    payloadSHA256:(NSData *__autoreleasing *)payloadSHA256
+                            error:(NSError *__autoreleasing *)error {
+    AWSServiceOperationPlans *service = _service;
+    if (service == nil) {
+        return nil;
+    }
+    AWSQueryBodyWriter *writer = nil;
+    NSMutableArray<AWSQueryBodyWriter *> *writers = usesEC2Rules ? service->_EC2Writers : service->_queryWriters;
+    @synchronized(service) {
+        writer = [writers lastObject];
+        [writers removeLastObject];
+    }
+    if (writer == nil) {
+        writer = [[AWSQueryBodyWriter alloc] initWithUnretainedServiceDefinitionRule:service->_serviceDefinitionRule
+                                                                            protocol:usesEC2Rules ? AWSQueryBodyWriterProtocolEC2 : AWSQueryBodyWriterProtocolQuery];
+    }
+    NSData *body = [writer bodyForParameters:parameters actionName:_actionName payloadSHA256:payloadSHA256 error:error];
+    @synchronized(service) {
+        if ([writers count] < AWSOperationPlanMaximumIdleWriters) {
+            [writers addObject:writer];
+        }
+    }
+    return body;
+}
+
+@end
@@ -0,0 +1,62 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, AWSQueryBodyWriterProtocol) {
+    // Member names and lists follow AWSQueryParamBuilder.
+    AWSQueryBodyWriterProtocolQuery,
+    // Member names and lists follow AWSEC2ParamBuilder.
+    AWSQueryBodyWriterProtocolEC2,
+};
+
+/**
+ Writes the `application/x-www-form-urlencoded` body of a query or EC2 request straight from its parameters.
+
+ The param builders flatten the parameters into a dictionary of `Member.1.Key` strings, which
+ `AWSQueryStringRequestSerializer` then percent-encodes and joins. The writer percent-encodes every name and value
+ once, into a byte buffer, and writes the pairs sorted by name in byte order. The body is therefore also in SigV4
+ canonical query form, and is the same for the same parameters.
+ */
+@interface AWSQueryBodyWriter : NSObject
+
+- (instancetype)initWithServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                                     protocol:(AWSQueryBodyWriterProtocol)protocol;
+
+/**
+ Initializes a writer that does not retain `serviceDefinitionRule`, for callers that cache writers per definition and
+ must not keep the definition alive. Once the definition is deallocated, the writer returns `nil` for every body.
+ */
+- (instancetype)initWithUnretainedServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                                               protocol:(AWSQueryBodyWriterProtocol)protocol;
+
+/**
+ Returns the form body for `parameters` with the input rules of `actionName`, or `nil` if the body has to be built by
+ the param builder instead: for example when a value has a type the param builder would describe rather than
+ serialize, or the service definition has no shapes.
+
+ @param payloadSHA256 Set to the SHA-256 digest of the returned body.
+ @param error         Set if a value does not match its shape, in which case `nil` is returned. The param builder
+                      would fail with the same error.
+ */
+- (nullable NSData *)bodyForParameters:(NSDictionary *)parameters
+                            actionName:(NSString *)actionName
+                         payloadSHA256:(NSData * _Nullable __autoreleasing * _Nullable)payloadSHA256
+                                 error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,656 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import "AWSQueryBodyWriter.h"
+#import <CommonCrypto/CommonDigest.h>
+#import "AWSCategory.h"
+#import "AWSSerialization.h"
+#import "AWSTimestampSerialization.h"
+#import "aws_encoding.h"
+
+static const size_t AWSQueryBodyInitialCapacity = 4 * 1024;
+static const size_t AWSQueryBodyInitialPairCapacity = 64;
+
+typedef NS_ENUM(NSInteger, AWSQueryBodyShapeType) {
+    AWSQueryBodyShapeTypeScalar,
+    AWSQueryBodyShapeTypeStructure,
+    AWSQueryBodyShapeTypeList,
+    AWSQueryBodyShapeTypeMap,
+    AWSQueryBodyShapeTypeTimestamp,
+    AWSQueryBodyShapeTypeBlob,
+    AWSQueryBodyShapeTypeBoolean,
+};
+
+@class AWSQueryBodyShape;
+
+// A member of a structure, the member of a list, or the key or value of a map.
+@interface AWSQueryBodyMember : NSObject {
+@public
+    AWSJSONDictionary *_rules;
+    // The percent-encoded component the member adds to the parameter name.
+    NSData *_name;
+    AWSQueryBodyShape *_shape;
+}
+
+@end
+
+@implementation AWSQueryBodyMember
+
+@end
+
+@interface AWSQueryBodyShape : NSObject {
+@public
+    AWSQueryBodyShapeType _type;
+    NSDictionary *_memberRules;
+    NSMutableDictionary<NSString *, id> *_members;
+    // Lists: the component written before the index, such as `member`, or nil.
+    NSData *_entryName;
+    // Flattened query lists: the name that replaces the last component of the list name, or nil.
+    NSData *_flattenedName;
+    AWSQueryBodyMember *_member;
+    AWSQueryBodyMember *_key;
+    AWSQueryBodyMember *_value;
+    BOOL _unsupported;
+}
+
+@end
+
+@implementation AWSQueryBodyShape
+
+@end
+
+typedef struct {
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+} AWSQueryBodyBuffer;
+
+// A name and value, stored one after the other in the pair buffer.
+typedef struct {
+    size_t offset;
+    size_t nameLength;
+    size_t valueLength;
+    const uint8_t *bytes;
+} AWSQueryBodyPair;
+
+// Returns space for `length` more bytes, which the caller fills and then commits.
+static uint8_t *AWSQueryBodyBufferReserve(AWSQueryBodyBuffer *buffer, size_t length) {
+    if (buffer->capacity - buffer->length < length) {
+        size_t capacity = MAX(MAX(buffer->capacity * 2, buffer->length + length), AWSQueryBodyInitialCapacity);
+        uint8_t *bytes = realloc(buffer->bytes, capacity);
+        if (bytes == NULL) {
+            [NSException raise:NSMallocException format:@"Failed to grow a query body to %zu bytes", capacity];
+        }
+        buffer->bytes = bytes;
+        buffer->capacity = capacity;
+    }
+    return buffer->bytes + buffer->length;
+}
+
+static void AWSQueryBodyBufferAppend(AWSQueryBodyBuffer *buffer, const void *bytes, size_t length) {
+    memcpy(AWSQueryBodyBufferReserve(buffer, length), bytes, length);
+    buffer->length += length;
+}
+
+static void AWSQueryBodyBufferAppendByte(AWSQueryBodyBuffer *buffer, uint8_t byte) {
+    *AWSQueryBodyBufferReserve(buffer, 1) = byte;
+    buffer->length += 1;
+}
+
+static BOOL AWSQueryBodyIsUnreserved(uint8_t byte) {
+    return (byte >= 'A' && byte <= 'Z')
+        || (byte >= 'a' && byte <= 'z')
+        || (byte >= '0' && byte <= '9')
+        || byte == '-' || byte == '.' || byte == '_' || byte == '~';
+}
+
+// Percent-encodes every byte outside the RFC 3986 unreserved set, as -[NSString aws_stringWithURLEncoding] does.
+static void AWSQueryBodyBufferAppendEncoded(AWSQueryBodyBuffer *buffer, const uint8_t *bytes, size_t length) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    uint8_t *output = AWSQueryBodyBufferReserve(buffer, length * 3);
+    uint8_t *cursor = output;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = bytes[i];
+        if (AWSQueryBodyIsUnreserved(byte)) {
+            *cursor++ = byte;
+        } else {
+            cursor[0] = '%';
+            cursor[1] = hexDigits[byte >> 4];
+            cursor[2] = hexDigits[byte & 0xf];
+            cursor += 3;
+        }
+    }
+    buffer->length += (size_t)(cursor - output);
+}
+
+static void AWSQueryBodyBufferAppendEncodedString(AWSQueryBodyBuffer *buffer, NSString *string) {
+    size_t start = buffer->length;
+    BOOL decoded = NO;
+
+    // Strings are converted to UTF-8 in blocks, through a buffer on the stack.
+    uint8_t block[1024];
+    NSRange remainingRange = NSMakeRange(0, [string length]);
+    while (remainingRange.length > 0) {
+        NSUInteger usedLength = 0;
+        BOOL converted = [string getBytes:block
+                                maxLength:sizeof(block)
+                               usedLength:&usedLength
+                                 encoding:NSUTF8StringEncoding
+                                  options:0
+                                    range:remainingRange
+                           remainingRange:&remainingRange];
+        if (!converted || usedLength == 0) {
+            // An unpaired surrogate cannot be converted; the rest of the string is converted lossily instead.
+            NSData *data = [[string substringWithRange:remainingRange] dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:YES];
+            AWSQueryBodyBufferAppendEncoded(buffer, [data bytes], [data length]);
+            break;
+        }
+        if (!decoded && memchr(block, '%', usedLength) != NULL) {
+            // aws_stringWithURLEncoding removes any percent-encoding before it encodes, so the string starts over.
+            buffer->length = start;
+            string = [string aws_decodeURLEncoding];
+            remainingRange = NSMakeRange(0, [string length]);
+            decoded = YES;
+            continue;
+        }
+        AWSQueryBodyBufferAppendEncoded(buffer, block, usedLength);
+    }
+}
+
+// Writes the number as -[NSNumber stringValue] does.
+static void AWSQueryBodyBufferAppendNumber(AWSQueryBodyBuffer *buffer, NSNumber *number) {
+    char text[32];
+    int length = 0;
+    const char *type = [number objCType];
+    switch (type[0]) {
+        case 'f':
+        case 'd':
+            AWSQueryBodyBufferAppendEncodedString(buffer, [number stringValue]);
+            return;
+        case 'Q':
+            length = snprintf(text, sizeof(text), "%llu", [number unsignedLongLongValue]);
+            break;
+        default:
+            length = snprintf(text, sizeof(text), "%lld", [number longLongValue]);
+            break;
+    }
+    AWSQueryBodyBufferAppend(buffer, text, (size_t)MIN(MAX(length, 0), (int)sizeof(text) - 1));
+}
+
+static int AWSQueryBodyCompareBytes(const uint8_t *left, size_t leftLength, const uint8_t *right, size_t rightLength) {
+    int result = memcmp(left, right, MIN(leftLength, rightLength));
+    if (result != 0 || leftLength == rightLength) {
+        return result;
+    }
+    return leftLength < rightLength ? -1 : 1;
+}
+
+// Orders pairs by name, then by value, in byte order, as the SigV4 canonical query string does.
+static int AWSQueryBodyComparePairs(const void *lhs, const void *rhs) {
+    const AWSQueryBodyPair *left = lhs;
+    const AWSQueryBodyPair *right = rhs;
+    int result = AWSQueryBodyCompareBytes(left->bytes, left->nameLength, right->bytes, right->nameLength);
+    if (result != 0) {
+        return result;
+    }
+    return AWSQueryBodyCompareBytes(left->bytes + left->nameLength, left->valueLength,
+                                    right->bytes + right->nameLength, right->valueLength);
+}
+
+@implementation AWSQueryBodyWriter {
+    __weak NSDictionary *_serviceDefinitionRule;
+    // Set unless the writer was initialized with an unretained definition.
+    NSDictionary *_retainedServiceDefinitionRule;
+    AWSQueryBodyWriterProtocol _protocol;
+    NSMutableDictionary<NSString *, AWSQueryBodyShape *> *_shapes;
+    // The percent-encoded name of the member being written.
+    AWSQueryBodyBuffer _name;
+    // The pairs written so far, in the order they were written.
+    AWSQueryBodyBuffer _pairBytes;
+    AWSQueryBodyPair *_pairs;
+    size_t _pairCount;
+    size_t _pairCapacity;
+    AWSQueryBodyBuffer _scratch;
+    NSError *_error;
+    // Set for a value the param builder serializes in a way the writer does not reproduce.
+    BOOL _unsupported;
+}
+
+- (instancetype)initWithServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                                     protocol:(AWSQueryBodyWriterProtocol)protocol {
+    if (self = [self initWithUnretainedServiceDefinitionRule:serviceDefinitionRule protocol:protocol]) {
+        _retainedServiceDefinitionRule = serviceDefinitionRule;
+    }
+    return self;
+}
+
+- (instancetype)initWithUnretainedServiceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                                               protocol:(AWSQueryBodyWriterProtocol)protocol {
+    if (self = [super init]) {
+        _serviceDefinitionRule = serviceDefinitionRule;
+        _protocol = protocol;
+        _shapes = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_name.bytes);
+    free(_pairBytes.bytes);
+    free(_pairs);
+    free(_scratch.bytes);
+}
+
+- (NSData *)bodyForParameters:(NSDictionary *)parameters
+                   actionName:(NSString *)actionName
+                payloadSHA256:(NSData *__autoreleasing *)payloadSHA256
+                        error:(NSError *__autoreleasing *)error {
+    // Requests the param builder fails for are left to it, so that they fail the same way.
+    NSDictionary *serviceDefinitionRule = _serviceDefinitionRule;
+    if (actionName == nil || serviceDefinitionRule == nil) {
+        return nil;
+    }
+    AWSQueryBodyMember *root = nil;
+    if ([parameters count] > 0) {
+        NSDictionary *actionRule = [[[serviceDefinitionRule objectForKey:@"operations"] objectForKey:actionName] objectForKey:@"input"];
+        NSDictionary *definitionRules = [serviceDefinitionRule objectForKey:@"shapes"];
+        if (![actionRule isKindOfClass:[NSDictionary class]]
+            || [actionRule count] == 0
+            || ![definitionRules isKindOfClass:[NSDictionary class]]
+            || [definitionRules count] == 0) {
+            return nil;
+        }
+        root = [self memberWithRules:[[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules] name:nil];
+    }
+
+    _name.length = 0;
+    _pairBytes.length = 0;
+    _pairCount = 0;
+    _error = nil;
+    _unsupported = NO;
+
+    [self writeName:@"Action" string:actionName];
+    NSString *apiVersion = serviceDefinitionRule[@"metadata"][@"apiVersion"];
+    if ([apiVersion isKindOfClass:[NSString class]]) {
+        [self writeName:@"Version" string:apiVersion];
+    }
+    if (root) {
+        [self writeValue:parameters member:root];
+    }
+
+    if (_unsupported) {
+        return nil;
+    }
+    if (_error) {
+        if (error) {
+            *error = _error;
+        }
+        return nil;
+    }
+
+    NSData *body = [self sortedBody];
+    if (body && payloadSHA256) {
+        NSMutableData *digest = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+        CC_SHA256([body bytes], (CC_LONG)[body length], [digest mutableBytes]);
+        *payloadSHA256 = digest;
+    }
+    return body;
+}
+
+// Joins the pairs, sorted, into the body. Returns nil if two pairs have the same name, since the param builder keeps
+// only one of them.
+- (NSData *)sortedBody {
+    size_t length = 0;
+    for (size_t i = 0; i < _pairCount; i++) {
+        _pairs[i].bytes = _pairBytes.bytes + _pairs[i].offset;
+        // The name, `=`, the value and the `&` before the next pair.
+        length += _pairs[i].nameLength + _pairs[i].valueLength + 2;
+    }
+    if (_pairCount > 1) {
+        qsort(_pairs, _pairCount, sizeof(AWSQueryBodyPair), AWSQueryBodyComparePairs);
+    }
+
+    uint8_t *bytes = malloc(MAX(length, 1));
+    if (bytes == NULL) {
+        return nil;
+    }
+    uint8_t *cursor = bytes;
+    for (size_t i = 0; i < _pairCount; i++) {
+        const AWSQueryBodyPair *pair = &_pairs[i];
+        if (i > 0) {
+            const AWSQueryBodyPair *previous = &_pairs[i - 1];
+            if (previous->nameLength == pair->nameLength && memcmp(previous->bytes, pair->bytes, pair->nameLength) == 0) {
+                free(bytes);
+                return nil;
+            }
+            *cursor++ = '&';
+        }
+        memcpy(cursor, pair->bytes, pair->nameLength);
+        cursor += pair->nameLength;
+        *cursor++ = '=';
+        memcpy(cursor, pair->bytes + pair->nameLength, pair->valueLength);
+        cursor += pair->valueLength;
+    }
+    return [NSData dataWithBytesNoCopy:bytes length:(NSUInteger)(cursor - bytes) freeWhenDone:YES];
+}
+
+#pragma mark - Shapes
+
+- (AWSQueryBodyMember *)memberWithRules:(AWSJSONDictionary *)rules name:(NSString *)name {
+    AWSQueryBodyMember *member = [AWSQueryBodyMember new];
+    member->_rules = rules ?: (AWSJSONDictionary *)@{};
+    if (name) {
+        member->_name = [self encodedName:name];
+    }
+    return member;
+}
+
+- (NSData *)encodedName:(NSString *)name {
+    AWSQueryBodyBuffer buffer = {0};
+    AWSQueryBodyBufferAppendEncodedString(&buffer, name);
+    if (buffer.bytes == NULL) {
+        return [NSData data];
+    }
+    return [NSData dataWithBytesNoCopy:buffer.bytes length:buffer.length freeWhenDone:YES];
+}
+
+// The name of a member in the parameter name, as +[AWSQueryParamBuilder queryName:withDefaultName:] and
+// +[AWSEC2ParamBuilder queryName:withDefaultName:] choose it.
+- (NSString *)queryNameOfRules:(NSDictionary *)rules defaultName:(NSString *)defaultName {
+    if (_protocol == AWSQueryBodyWriterProtocolQuery) {
+        return rules[@"locationName"] ?: defaultName;
+    }
+    NSString *queryName = rules[@"queryName"];
+    NSString *locationName = rules[@"locationName"];
+    if (queryName == nil && [locationName length] > 0) {
+        queryName = [[[locationName substringToIndex:1] uppercaseString] stringByAppendingString:[locationName substringFromIndex:1]];
+    }
+    return queryName ?: defaultName;
+}
+
+- (AWSQueryBodyShape *)shapeOfMember:(AWSQueryBodyMember *)member {
+    if (member->_shape == nil) {
+        member->_shape = [self shapeForRules:member->_rules];
+    }
+    return member->_shape;
+}
+
+- (AWSQueryBodyShape *)shapeForRules:(AWSJSONDictionary *)rules {
+    NSString *shapeName = [rules objectForKey:@"shape"];
+    AWSQueryBodyShape *shape = shapeName ? _shapes[shapeName] : nil;
+    if (shape) {
+        return shape;
+    }
+
+    shape = [AWSQueryBodyShape new];
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"structure"]) {
+        shape->_type = AWSQueryBodyShapeTypeStructure;
+        shape->_memberRules = rules[@"members"];
+        shape->_members = [NSMutableDictionary new];
+    } else if ([type isEqualToString:@"list"]) {
+        shape->_type = AWSQueryBodyShapeTypeList;
+        shape->_member = [self memberWithRules:rules[@"member"] name:nil];
+        if (_protocol == AWSQueryBodyWriterProtocolQuery) {
+            if ([rules[@"flattened"] boolValue]) {
+                NSString *flattenedName = [self queryNameOfRules:rules[@"member"] defaultName:nil];
+                shape->_flattenedName = flattenedName ? [self encodedName:flattenedName] : nil;
+            } else {
+                shape->_entryName = [self encodedName:@"member"];
+            }
+        }
+    } else if ([type isEqualToString:@"map"]) {
+        shape->_type = AWSQueryBodyShapeTypeMap;
+        // AWSEC2ParamBuilder fails for maps.
+        shape->_unsupported = _protocol != AWSQueryBodyWriterProtocolQuery;
+        if (![rules[@"flattened"] boolValue]) {
+            shape->_entryName = [self encodedName:@"entry"];
+        }
+        shape->_key = [self memberWithRules:rules[@"key"] name:[self queryNameOfRules:rules[@"key"] defaultName:@"key"]];
+        shape->_value = [self memberWithRules:rules[@"value"] name:[self queryNameOfRules:rules[@"value"] defaultName:@"value"]];
+    } else if ([type isEqualToString:@"timestamp"]) {
+        shape->_type = AWSQueryBodyShapeTypeTimestamp;
+    } else if ([type isEqualToString:@"blob"]) {
+        shape->_type = AWSQueryBodyShapeTypeBlob;
+    } else if ([type isEqualToString:@"boolean"]) {
+        shape->_type = AWSQueryBodyShapeTypeBoolean;
+    }
+    if (shapeName) {
+        _shapes[shapeName] = shape;
+    }
+    return shape;
+}
+
+// Structure members are resolved on first use, so that only the members a request sets are visited.
+- (AWSQueryBodyMember *)member:(NSString *)name ofShape:(AWSQueryBodyShape *)shape {
+    id member = shape->_members[name];
+    if (member == nil) {
+        AWSJSONDictionary *rules = shape->_memberRules[name];
+        member = rules ? [self memberWithRules:rules name:[self queryNameOfRules:rules defaultName:name]] : [NSNull null];
+        shape->_members[name] = member;
+    }
+    return member == [NSNull null] ? nil : member;
+}
+
+#pragma mark - Writing
+
+- (void)failWithDescription:(NSString *)description {
+    if (_error == nil) {
+        BOOL isQuery = _protocol == AWSQueryBodyWriterProtocolQuery;
+        _error = [NSError errorWithDomain:isQuery ? AWSQueryParamBuilderErrorDomain : AWSEC2ParamBuilderErrorDomain
+                                     code:isQuery ? AWSQueryParamBuilderInvalidParameter : AWSEC2ParamBuilderInvalidParameter
+                                 userInfo:@{NSLocalizedDescriptionKey : description}];
+    }
+}
+
+// Appends a component to the name, after a `.` unless it is the first one.
+- (void)appendNameComponent:(const void *)bytes length:(size_t)length {
+    if (_name.length > 0) {
+        AWSQueryBodyBufferAppendByte(&_name, '.');
+    }
+    AWSQueryBodyBufferAppend(&_name, bytes, length);
+}
+
+- (void)appendNameIndex:(NSUInteger)index {
+    char text[24];
+    int length = snprintf(text, sizeof(text), "%lu", (unsigned long)index);
+    [self appendNameComponent:text length:(size_t)length];
+}
+
+// Starts a pair with the current name. The value is appended to the pair bytes, then the pair is ended.
+- (size_t)beginPair {
+    size_t offset = _pairBytes.length;
+    AWSQueryBodyBufferAppend(&_pairBytes, _name.bytes, _name.length);
+    return offset;
+}
+
+- (void)endPairAtOffset:(size_t)offset {
+    if (_pairCount == _pairCapacity) {
+        size_t capacity = MAX(_pairCapacity * 2, AWSQueryBodyInitialPairCapacity);
+        AWSQueryBodyPair *pairs = realloc(_pairs, capacity * sizeof(AWSQueryBodyPair));
+        if (pairs == NULL) {
+            [NSException raise:NSMallocException format:@"Failed to grow query pairs to %zu", capacity];
+        }
+        _pairs = pairs;
+        _pairCapacity = capacity;
+    }
+    _pairs[_pairCount++] = (AWSQueryBodyPair){
+        .offset = offset,
+        .nameLength = _name.length,
+        .valueLength = _pairBytes.length - offset - _name.length,
+    };
+}
+
+- (void)writeName:(NSString *)name string:(NSString *)string {
+    _name.length = 0;
+    AWSQueryBodyBufferAppendEncodedString(&_name, name);
+    size_t offset = [self beginPair];
+    AWSQueryBodyBufferAppendEncodedString(&_pairBytes, string);
+    [self endPairAtOffset:offset];
+    _name.length = 0;
+}
+
+// Writes `value` as the param builder flattens it, then AWSQueryStringRequestSerializer encodes it.
+- (void)writeValue:(id)value member:(AWSQueryBodyMember *)member {
+    if (_unsupported || _error) {
+        return;
+    }
+    AWSQueryBodyShape *shape = [self shapeOfMember:member];
+    if (shape->_unsupported) {
+        _unsupported = YES;
+        return;
+    }
+
+    switch (shape->_type) {
+        case AWSQueryBodyShapeTypeStructure: {
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                _unsupported = YES;
+                return;
+            }
+            size_t nameLength = _name.length;
+            for (NSString *name in value) {
+                AWSQueryBodyMember *structureMember = [self member:name ofShape:shape];
+                if (structureMember == nil) {
+                    continue;
+                }
+                [self appendNameComponent:[structureMember->_name bytes] length:[structureMember->_name length]];
+                [self writeValue:value[name] member:structureMember];
+                _name.length = nameLength;
+            }
+            return;
+        }
+        case AWSQueryBodyShapeTypeList: {
+            if (![value isKindOfClass:[NSArray class]]) {
+                _unsupported = YES;
+                return;
+            }
+            if (shape->_flattenedName) {
+                // The last component of the name is replaced; the caller restores the name it started with.
+                size_t lastComponent = _name.length;
+                while (lastComponent > 0 && _name.bytes[lastComponent - 1] != '.') {
+                    lastComponent--;
+                }
+                _name.length = lastComponent;
+                AWSQueryBodyBufferAppend(&_name, [shape->_flattenedName bytes], [shape->_flattenedName length]);
+            } else if (shape->_entryName) {
+                [self appendNameComponent:[shape->_entryName bytes] length:[shape->_entryName length]];
+            }
+            size_t nameLength = _name.length;
+            NSUInteger index = 0;
+            for (id memberValue in value) {
+                [self appendNameIndex:++index];
+                [self writeValue:memberValue member:shape->_member];
+                _name.length = nameLength;
+            }
+            return;
+        }
+        case AWSQueryBodyShapeTypeMap: {
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                _unsupported = YES;
+                return;
+            }
+            for (id key in value) {
+                if (![key isKindOfClass:[NSString class]]) {
+                    _unsupported = YES;
+                    return;
+                }
+            }
+            if (shape->_entryName) {
+                [self appendNameComponent:[shape->_entryName bytes] length:[shape->_entryName length]];
+            }
+            size_t nameLength = _name.length;
+            NSArray *keys = [[value allKeys] sortedArrayUsingSelector:@selector(localizedCaseInsensitiveCompare:)];
+            NSUInteger index = 0;
+            for (NSString *key in keys) {
+                [self appendNameIndex:++index];
+                size_t entryLength = _name.length;
+                [self appendNameComponent:[shape->_key->_name bytes] length:[shape->_key->_name length]];
+                [self writeValue:key member:shape->_key];
+                _name.length = entryLength;
+                [self appendNameComponent:[shape->_value->_name bytes] length:[shape->_value->_name length]];
+                [self writeValue:value[key] member:shape->_value];
+                _name.length = nameLength;
+            }
+            return;
+        }
+        case AWSQueryBodyShapeTypeTimestamp: {
+            NSError *error = nil;
+            NSString *timestampString = nil;
+            if (_protocol == AWSQueryBodyWriterProtocolQuery) {
+                timestampString = [AWSQueryTimestampSerialization serializeTimestamp:member->_rules value:value error:&error];
+            } else {
+                timestampString = [AWSEC2TimestampSerialization serializeTimestamp:member->_rules value:value error:&error];
+            }
+            if (error) {
+                _error = error;
+                return;
+            }
+            if (timestampString) {
+                [self writeString:timestampString];
+            }
+            return;
+        }
+        case AWSQueryBodyShapeTypeBlob: {
+            if ([value isKindOfClass:[NSString class]]) {
+                value = [value dataUsingEncoding:NSUTF8StringEncoding];
+            }
+            if (![value isKindOfClass:[NSData class]]) {
+                [self failWithDescription:@"'blob' value should be a NSData type."];
+                return;
+            }
+            size_t encodedLength = AWS_BASE64_ENCODED_LENGTH([value length]);
+            _scratch.length = 0;
+            aws_base64_encode([value bytes], [value length], (char *)AWSQueryBodyBufferReserve(&_scratch, encodedLength));
+            size_t offset = [self beginPair];
+            AWSQueryBodyBufferAppendEncoded(&_pairBytes, _scratch.bytes, encodedLength);
+            [self endPairAtOffset:offset];
+            return;
+        }
+        case AWSQueryBodyShapeTypeBoolean: {
+            if (![value isKindOfClass:[NSNumber class]] && ![value isKindOfClass:[NSString class]]) {
+                _unsupported = YES;
+                return;
+            }
+            size_t offset = [self beginPair];
+            if ([value boolValue]) {
+                AWSQueryBodyBufferAppend(&_pairBytes, "true", 4);
+            } else {
+                AWSQueryBodyBufferAppend(&_pairBytes, "false", 5);
+            }
+            [self endPairAtOffset:offset];
+            return;
+        }
+        case AWSQueryBodyShapeTypeScalar: {
+            if ([value isKindOfClass:[NSString class]]) {
+                [self writeString:value];
+            } else if ([value isKindOfClass:[NSNumber class]]) {
+                size_t offset = [self beginPair];
+                AWSQueryBodyBufferAppendNumber(&_pairBytes, value);
+                [self endPairAtOffset:offset];
+            } else {
+                // The serializer writes the description of other values, or flattens dictionaries into the body.
+                _unsupported = YES;
+            }
+            return;
+        }
+    }
+}
+
+- (void)writeString:(NSString *)string {
+    size_t offset = [self beginPair];
+    AWSQueryBodyBufferAppendEncodedString(&_pairBytes, string);
+    [self endPairAtOffset:offset];
+}
+
+@end
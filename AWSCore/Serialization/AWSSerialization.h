@@ -118,6 +118,15 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
 
 @end
 
+/**
+ Receives one member of a list of the decoded output while the response is still being decoded.
+
+ @param listName The name of the list member of the output structure, such as `Contents`.
+ @param member The decoded list member.
+ @return `YES` if the member was consumed and should be left out of the decoded output, `NO` to keep it.
+ */
+typedef BOOL (^AWSXMLParserListMemberBlock)(NSString *listName, id member);
+
 @interface AWSXMLParser : NSObject
 
 + (AWSXMLParser *)sharedInstance;
@@ -127,6 +136,19 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
                         serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
                                         error:(NSError *__autoreleasing *)error;
 
+/**
+ Decodes an XML response, handing the members of the top level lists of the output to `listMemberHandler` as soon as
+ each of them is decoded, so a large listing does not have to be held in memory at once.
+
+ Successful responses are decoded in a single pass over the parser events, straight into the shapes of the output.
+ Error responses are decoded as before and never reach `listMemberHandler`.
+ */
+- (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
+                                   actionName:(NSString *)actionName
+                        serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                            listMemberHandler:(AWSXMLParserListMemberBlock)listMemberHandler
+                                        error:(NSError *__autoreleasing *)error;
+
 @end
 
 @interface AWSQueryParamBuilder : NSObject
@@ -18,6 +18,7 @@
 #import "AWSCategory.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSXMLDictionary.h"
+#import "AWSXMLStreamingDecoder.h"
 
 NSString *const AWSXMLBuilderErrorDomain = @"com.amazonaws.AWSXMLBuilderErrorDomain";
 NSString *const AWSXMLParserErrorDomain = @"com.amazonaws.AWSXMLParserErrorDomain";
@@ -37,7 +38,8 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 - (instancetype)initWithDictionary:(NSDictionary *)otherDictionary JSONDefinitionRule:(NSDictionary *)rule {
     self = [super init];
     if (self) {
-        _embeddedDictionary = [[NSDictionary alloc] initWithDictionary:otherDictionary];
+        // Immutable dictionaries, including compiled service definitions, are retained instead of copied entry by entry.
+        _embeddedDictionary = [otherDictionary copy];
         _JSONDefinitionRule = [rule copy];
     }
     return self;
@@ -274,7 +276,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
             }
             if ([params isKindOfClass:[NSData class]]) {
                 if (isPayloadType == NO) {
-                    NSString *base64encodedStr = [params base64EncodedStringWithOptions:0];
+                    NSString *base64encodedStr = [params aws_base64EncodedString];
                     [xmlWriter writeStartElement:xmlElementName];
                     [xmlWriter writeCharacters:base64encodedStr];
                     [xmlWriter writeEndElement:xmlElementName];
@@ -333,6 +335,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 @interface AWSXMLParser ()
 
+// Holds the parser configuration. It is copied for each parse and never parses itself.
 @property (nonatomic, strong) AWSXMLDictionaryParser *xmlDictionaryParser;
 
 @end
@@ -407,6 +410,18 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
                                    actionName:(NSString *)actionName
                         serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
                                         error:(NSError *__autoreleasing *)error {
+    return [self dictionaryForXMLData:data
+                           actionName:actionName
+                serviceDefinitionRule:serviceDefinitionRule
+                    listMemberHandler:nil
+                                error:error];
+}
+
+- (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
+                                   actionName:(NSString *)actionName
+                        serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                            listMemberHandler:(AWSXMLParserListMemberBlock)listMemberHandler
+                                        error:(NSError *__autoreleasing *)error {
     if (!data) {
         return [NSMutableDictionary new];
     }
@@ -431,11 +446,29 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
+    // A response without a body, such as the response to a HEAD request, has no document to parse.
+    BOOL hasDocument = [data isKindOfClass:[NSData class]] && [data length] > 0;
     NSMutableDictionary *rootXmlDictionary = nil;
-    if ([data isKindOfClass:[NSData class]]) {
-        @synchronized (self) {
-            rootXmlDictionary = [[self.xmlDictionaryParser dictionaryWithData:data] mutableCopy]; //TODO: need error parameters for parsing
+    if (hasDocument) {
+        AWSXMLStreamingDecoder *decoder = [[AWSXMLStreamingDecoder alloc] initWithActionName:actionName
+                                                                       serviceDefinitionRule:serviceDefinitionRule];
+        decoder.listMemberHandler = listMemberHandler;
+        decoder.documentParser = self.xmlDictionaryParser;
+        NSMutableDictionary *decodedDictionary = [decoder decodeData:data error:error];
+        if (decodedDictionary) {
+            return decodedDictionary;
         }
+        // Error responses, and documents whose root element has no child elements, are built into a document
+        // dictionary while the decoder reads them.
+        rootXmlDictionary = [decoder.documentDictionary mutableCopy];
+    }
+
+    // Documents the decoder does not handle go through the dictionary parser.
+    if (rootXmlDictionary == nil && hasDocument) {
+        // The dictionary parser keeps its state while parsing, so each call parses with its own copy of the configured
+        // parser instead of serializing every XML response of the process on the shared one.
+        AWSXMLDictionaryParser *xmlDictionaryParser = [self.xmlDictionaryParser copy];
+        rootXmlDictionary = [[xmlDictionaryParser dictionaryWithData:data] mutableCopy]; //TODO: need error parameters for parsing
     }
 
     NSString *rootNodeName = [[rootXmlDictionary allKeys] firstObject];
@@ -768,7 +801,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
         //decode Base64Str to NSData
         if ([values isKindOfClass:[NSString class]]) {
-            NSData *decodedData = [[NSData alloc] initWithBase64EncodedString:values options:0];
+            NSData *decodedData = [NSData aws_dataWithBase64EncodedString:values];
             //return origin string value if can not be encoded.
             return decodedData?decodedData:values;
         } else {
@@ -954,7 +987,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
             value = [value dataUsingEncoding:NSUTF8StringEncoding];
         }
         if ([value isKindOfClass:[NSData class]]) {
-            NSString *base64encodedStr = [value base64EncodedStringWithOptions:0];
+            NSString *base64encodedStr = [value aws_base64EncodedString];
             formattedParams[prefix] = base64encodedStr?base64encodedStr:@"";
         } else {
             [self failWithCode:AWSQueryParamBuilderInvalidParameter description:@"'blob' value should be a NSData type." error:error];
@@ -1110,7 +1143,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
             value = [value dataUsingEncoding:NSUTF8StringEncoding];
         }
         if ([value isKindOfClass:[NSData class]]) {
-            NSString *base64encodedStr = [value base64EncodedStringWithOptions:0];
+            NSString *base64encodedStr = [value aws_base64EncodedString];
             formattedParams[prefix] = base64encodedStr?base64encodedStr:@"";
         } else {
             [self failWithCode:AWSEC2ParamBuilderInvalidParameter description:@"'blob' value should be a NSData type." error:error];
@@ -1332,7 +1365,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
                 //Do not base64 encoding if it is payload type
                 return value;
             } else {
-                NSString *base64encodedStr = [value base64EncodedStringWithOptions:0];
+                NSString *base64encodedStr = [value aws_base64EncodedString];
                 return base64encodedStr?base64encodedStr:@"";
             }
         } else {
@@ -1555,7 +1588,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         
         //decode Base64Str to NSData
         if ([value isKindOfClass:[NSString class]]) {
-            NSData *decodedData = [[NSData alloc] initWithBase64EncodedString:value options:0];
+            NSData *decodedData = [NSData aws_dataWithBase64EncodedString:value];
             //return origin string value if can not be encoded.
             return decodedData?decodedData:value;
         } else {
@@ -0,0 +1,84 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+FOUNDATION_EXPORT NSString *const AWSServiceDefinitionErrorDomain;
+
+typedef NS_ENUM(NSInteger, AWSServiceDefinitionErrorType) {
+    AWSServiceDefinitionErrorUnknown,
+    AWSServiceDefinitionErrorInvalidFormat,
+    AWSServiceDefinitionErrorUnsupportedVersion,
+    AWSServiceDefinitionErrorDigestMismatch,
+};
+
+/**
+ Loads service definitions compiled ahead of time by `Scripts/compile_service_definitions.py`.
+
+ A compiled definition is a single `.awsdef` file holding the service model as a binary tree with interned strings.
+ The file is memory-mapped, and the dictionaries and arrays returned by the loader decode their entries on access, so
+ only the shapes a request actually touches are ever paged in or turned into objects. The returned collections are
+ immutable and can be used anywhere the `NSJSONSerialization` result of the same model is expected, except that the
+ `documentation` entries are stripped.
+ */
+@interface AWSServiceDefinition : NSObject
+
+/**
+ Returns the compiled definition `name.awsdef` for a service, or `nil` if it is not bundled or does not match `digest`.
+
+ The file is searched for in the bundle of `bundleClass`, and in the `resourceBundleName.bundle` resource bundle
+ inside it or inside the main bundle, which covers frameworks, static libraries and CocoaPods.
+
+ @param name The service name, such as `AWSEC2`.
+ @param bundleClass A class of the service framework.
+ @param resourceBundleName The name of the resource bundle of the framework, such as `AWSEC2`.
+ @param digest The lowercase hex SHA-256 of the JSON definition the file was compiled from.
+ @return The root of the service definition, or `nil` if the caller should parse the JSON definition instead.
+ */
++ (nullable NSDictionary *)definitionNamed:(NSString *)name
+                               bundleClass:(Class)bundleClass
+                        resourceBundleName:(NSString *)resourceBundleName
+                                    digest:(NSString *)digest;
+
+/**
+ Returns the root of a compiled definition.
+
+ @param data The contents of an `.awsdef` file. It is retained for as long as any returned collection is alive.
+ @param digest The expected lowercase hex SHA-256 of the JSON definition, or `nil` to skip the check.
+ @param error On failure, an error in `AWSServiceDefinitionErrorDomain`.
+ */
++ (nullable NSDictionary *)definitionWithData:(NSData *)data
+                                       digest:(nullable NSString *)digest
+                                        error:(NSError **)error;
+
+/**
+ Returns a JSON service definition whose operations and shapes are parsed on first access.
+
+ The definition text is scanned once to locate each operation and shape, and each of them is parsed with
+ `NSJSONSerialization` the first time it is looked up, so a request only pays for its operation and the shapes it
+ references. The result is otherwise equal to parsing the whole definition with `NSJSONSerialization`.
+
+ @param JSONString The JSON service definition.
+ @param error On failure, the error reported by `NSJSONSerialization`, or an error in `AWSServiceDefinitionErrorDomain`.
+ @return The root of the service definition, or `nil` if it is not valid JSON.
+ */
++ (nullable NSDictionary *)definitionWithJSONString:(NSString *)JSONString
+                                              error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
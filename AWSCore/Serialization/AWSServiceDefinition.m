@@ -0,0 +1,822 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSServiceDefinition.h"
+#import "AWSCategory.h"
+#import "AWSCocoaLumberjack.h"
+#import <stdatomic.h>
+
+NSString *const AWSServiceDefinitionErrorDomain = @"com.amazonaws.AWSServiceDefinitionErrorDomain";
+
+static NSString *const AWSServiceDefinitionFileExtension = @"awsdef";
+static uint16_t const AWSServiceDefinitionVersion = 1;
+
+/*
+ * File layout, little endian, every section 4 byte aligned:
+ *
+ *   header
+ *   string table   string_count x {offset, length}, sorted by bytes; offsets are from the start of the file
+ *   string data    UTF-8, NUL terminated
+ *   number table   number_count x 8 bytes, an int64_t or a double depending on the value tag
+ *   nodes          objects: {count, count x {key string index, value}}, sorted by key string index
+ *                  arrays:  {count, count x value}
+ *
+ * A value is a uint32_t with the tag in the low 3 bits. Strings and numbers carry an index into their table,
+ * objects and arrays the offset of their node from the start of the node section, in 4 byte words.
+ */
+typedef struct __attribute__((packed)) AWSServiceDefinitionHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint8_t digest[32];
+    uint32_t stringCount;
+    uint32_t stringTableOffset;
+    uint32_t numberCount;
+    uint32_t numberTableOffset;
+    uint32_t nodeOffset;
+    uint32_t nodeLength;
+    uint32_t root;
+} AWSServiceDefinitionHeader;
+
+typedef NS_ENUM(uint32_t, AWSServiceDefinitionValueTag) {
+    AWSServiceDefinitionValueNull = 0,
+    AWSServiceDefinitionValueFalse = 1,
+    AWSServiceDefinitionValueTrue = 2,
+    AWSServiceDefinitionValueString = 3,
+    AWSServiceDefinitionValueInteger = 4,
+    AWSServiceDefinitionValueReal = 5,
+    AWSServiceDefinitionValueObject = 6,
+    AWSServiceDefinitionValueArray = 7,
+};
+
+static uint32_t const AWSServiceDefinitionTagBits = 3;
+static uint32_t const AWSServiceDefinitionTagMask = (1u << AWSServiceDefinitionTagBits) - 1;
+
+// The byte ranges of one member of a JSON object, relative to the start of the definition text.
+typedef struct AWSServiceDefinitionJSONMember {
+    uint32_t keyOffset;
+    uint32_t keyLength;
+    uint32_t valueOffset;
+    uint32_t valueLength;
+} AWSServiceDefinitionJSONMember;
+
+#define AWSServiceDefinitionKeyBufferSize 256
+
+// Returns the UTF-8 bytes of a dictionary key without allocating for short keys, or NULL if it is not a string.
+static const char *AWSServiceDefinitionKeyBytes(id key, char buffer[AWSServiceDefinitionKeyBufferSize], size_t *length) {
+    if (![key isKindOfClass:[NSString class]]) {
+        return NULL;
+    }
+    const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)key, kCFStringEncodingUTF8);
+    if (bytes == NULL) {
+        if (CFStringGetCString((__bridge CFStringRef)key, buffer, AWSServiceDefinitionKeyBufferSize, kCFStringEncodingUTF8)) {
+            bytes = buffer;
+        } else {
+            bytes = [key UTF8String];
+        }
+    }
+    if (bytes) {
+        *length = strlen(bytes);
+    }
+    return bytes;
+}
+
+static int AWSServiceDefinitionCompareBytes(const uint8_t *bytes1, size_t length1, const uint8_t *bytes2, size_t length2) {
+    int order = memcmp(bytes1, bytes2, MIN(length1, length2));
+    if (order == 0) {
+        order = (length1 < length2) ? -1 : (length1 > length2);
+    }
+    return order;
+}
+
+#pragma mark - AWSServiceDefinitionStorage
+
+// Owns the mapped file and the strings decoded from it. Every collection handed out retains its storage.
+@interface AWSServiceDefinitionStorage : NSObject {
+@public
+    NSData *_data;
+    const uint8_t *_bytes;
+    const uint32_t *_strings;
+    uint32_t _stringCount;
+    const uint8_t *_numbers;
+    uint32_t _numberCount;
+    const uint32_t *_nodes;
+    uint32_t _nodeWordCount;
+    // Lazily created NSStrings, one slot per string table entry, each holding a +1 reference.
+    _Atomic(void *) *_stringObjects;
+}
+
+- (id)objectForValue:(uint32_t)value;
+- (NSString *)stringAtIndex:(uint32_t)index;
+- (BOOL)findStringIndex:(uint32_t *)index forKey:(NSString *)key;
+
+@end
+
+@interface AWSServiceDefinitionDictionary : NSDictionary {
+    AWSServiceDefinitionStorage *_storage;
+    const uint32_t *_entries;
+    uint32_t _count;
+}
+
+- (instancetype)initWithStorage:(AWSServiceDefinitionStorage *)storage node:(uint32_t)node;
+
+@end
+
+@interface AWSServiceDefinitionArray : NSArray {
+    AWSServiceDefinitionStorage *_storage;
+    const uint32_t *_values;
+    uint32_t _count;
+}
+
+- (instancetype)initWithStorage:(AWSServiceDefinitionStorage *)storage node:(uint32_t)node;
+
+@end
+
+// A JSON object whose members are found by scanning the definition text once and decoded on first access. The
+// operations and shapes of a JSON definition are kept this way, so only what a request uses is ever parsed.
+@interface AWSServiceDefinitionJSONDictionary : NSDictionary {
+    NSData *_data;
+    AWSServiceDefinitionJSONMember *_members;
+    NSUInteger _count;
+    // Decoded values, one slot per member, each holding a +1 reference.
+    _Atomic(void *) *_values;
+}
+
+- (instancetype)initWithData:(NSData *)data members:(AWSServiceDefinitionJSONMember *)members count:(NSUInteger)count;
+
+@end
+
+@implementation AWSServiceDefinitionStorage
+
+- (void)dealloc {
+    if (_stringObjects) {
+        for (uint32_t i = 0; i < _stringCount; i++) {
+            void *string = atomic_load_explicit(&_stringObjects[i], memory_order_relaxed);
+            if (string) {
+                CFRelease(string);
+            }
+        }
+        free(_stringObjects);
+    }
+}
+
+- (NSString *)stringAtIndex:(uint32_t)index {
+    if (index >= _stringCount) {
+        return nil;
+    }
+    void *string = atomic_load_explicit(&_stringObjects[index], memory_order_acquire);
+    if (string) {
+        return (__bridge NSString *)string;
+    }
+
+    const uint32_t *entry = _strings + 2 * index;
+    CFStringRef created = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                                  _bytes + entry[0],
+                                                  entry[1],
+                                                  kCFStringEncodingUTF8,
+                                                  false);
+    if (created == NULL) {
+        return nil;
+    }
+    void *expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&_stringObjects[index], &expected, (void *)created,
+                                                 memory_order_acq_rel, memory_order_acquire)) {
+        // Another thread got there first; use its string so every lookup of the index returns the same object.
+        CFRelease(created);
+        return (__bridge NSString *)expected;
+    }
+    return (__bridge NSString *)created;
+}
+
+- (BOOL)findStringIndex:(uint32_t *)index forKey:(NSString *)key {
+    char buffer[AWSServiceDefinitionKeyBufferSize];
+    size_t keyLength;
+    const char *keyBytes = AWSServiceDefinitionKeyBytes(key, buffer, &keyLength);
+    if (keyBytes == NULL) {
+        return NO;
+    }
+
+    // The string table is sorted by bytes, so a key is found with a binary search and compared by index afterwards.
+    uint32_t low = 0;
+    uint32_t high = _stringCount;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        const uint32_t *entry = _strings + 2 * middle;
+        size_t length = entry[1];
+        int order = AWSServiceDefinitionCompareBytes(_bytes + entry[0], length, (const uint8_t *)keyBytes, keyLength);
+        if (order == 0) {
+            *index = middle;
+            return YES;
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return NO;
+}
+
+- (id)objectForValue:(uint32_t)value {
+    uint32_t payload = value >> AWSServiceDefinitionTagBits;
+    switch ((AWSServiceDefinitionValueTag)(value & AWSServiceDefinitionTagMask)) {
+        case AWSServiceDefinitionValueNull:
+            return [NSNull null];
+        case AWSServiceDefinitionValueFalse:
+            return @NO;
+        case AWSServiceDefinitionValueTrue:
+            return @YES;
+        case AWSServiceDefinitionValueString:
+            return [self stringAtIndex:payload];
+        case AWSServiceDefinitionValueInteger: {
+            if (payload >= _numberCount) {
+                return nil;
+            }
+            int64_t integer;
+            memcpy(&integer, _numbers + 8 * (size_t)payload, sizeof(integer));
+            return @(integer);
+        }
+        case AWSServiceDefinitionValueReal: {
+            if (payload >= _numberCount) {
+                return nil;
+            }
+            double real;
+            memcpy(&real, _numbers + 8 * (size_t)payload, sizeof(real));
+            return @(real);
+        }
+        case AWSServiceDefinitionValueObject:
+            return [[AWSServiceDefinitionDictionary alloc] initWithStorage:self node:payload];
+        case AWSServiceDefinitionValueArray:
+            return [[AWSServiceDefinitionArray alloc] initWithStorage:self node:payload];
+    }
+    return nil;
+}
+
+// Returns the node at `node` words into the node section if it holds `count` followed by `count * width` words.
+- (const uint32_t *)nodeAtOffset:(uint32_t)node width:(uint32_t)width count:(uint32_t *)count {
+    if (node >= _nodeWordCount) {
+        return NULL;
+    }
+    uint32_t nodeCount = _nodes[node];
+    if ((uint64_t)nodeCount * width > _nodeWordCount - node - 1) {
+        return NULL;
+    }
+    *count = nodeCount;
+    return _nodes + node + 1;
+}
+
+@end
+
+#pragma mark - AWSServiceDefinitionDictionary
+
+@implementation AWSServiceDefinitionDictionary
+
+- (instancetype)initWithStorage:(AWSServiceDefinitionStorage *)storage node:(uint32_t)node {
+    if (self = [super init]) {
+        _storage = storage;
+        _entries = [storage nodeAtOffset:node width:2 count:&_count];
+        if (_entries == NULL) {
+            AWSDDLogError(@"Invalid object node %u in the compiled service definition.", node);
+            _count = 0;
+        }
+    }
+    return self;
+}
+
+// -[NSDictionary init] funnels into this primitive, which the abstract class does not implement.
+- (instancetype)initWithObjects:(const id [])objects forKeys:(const id<NSCopying> [])keys count:(NSUInteger)count {
+    return self;
+}
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectForKey:(id)aKey {
+    uint32_t keyIndex;
+    if (_count == 0 || ![_storage findStringIndex:&keyIndex forKey:aKey]) {
+        return nil;
+    }
+
+    uint32_t low = 0;
+    uint32_t high = _count;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        uint32_t entryKey = _entries[2 * middle];
+        if (entryKey == keyIndex) {
+            return [_storage objectForValue:_entries[2 * middle + 1]];
+        }
+        if (entryKey < keyIndex) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return nil;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:_count];
+    for (uint32_t i = 0; i < _count; i++) {
+        NSString *key = [_storage stringAtIndex:_entries[2 * i]];
+        if (key) {
+            [keys addObject:key];
+        }
+    }
+    return [keys objectEnumerator];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
+
+#pragma mark - AWSServiceDefinitionArray
+
+@implementation AWSServiceDefinitionArray
+
+- (instancetype)initWithStorage:(AWSServiceDefinitionStorage *)storage node:(uint32_t)node {
+    if (self = [super init]) {
+        _storage = storage;
+        _values = [storage nodeAtOffset:node width:1 count:&_count];
+        if (_values == NULL) {
+            AWSDDLogError(@"Invalid array node %u in the compiled service definition.", node);
+            _count = 0;
+        }
+    }
+    return self;
+}
+
+// -[NSArray init] funnels into this primitive, which the abstract class does not implement.
+- (instancetype)initWithObjects:(const id [])objects count:(NSUInteger)count {
+    return self;
+}
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    if (index >= _count) {
+        @throw [NSException exceptionWithName:NSRangeException
+                                       reason:[NSString stringWithFormat:@"Index %lu beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_count]
+                                     userInfo:nil];
+    }
+    return [_storage objectForValue:_values[index]];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
+
+#pragma mark - AWSServiceDefinitionJSONDictionary
+
+static size_t AWSServiceDefinitionSkipWhitespace(const uint8_t *bytes, size_t position, size_t length) {
+    while (position < length && (bytes[position] == ' ' || bytes[position] == '\n' || bytes[position] == '\r' || bytes[position] == '\t')) {
+        position++;
+    }
+    return position;
+}
+
+// Moves `position` from an opening quote to just past the closing quote.
+static BOOL AWSServiceDefinitionSkipString(const uint8_t *bytes, size_t *position, size_t length, BOOL *escaped) {
+    for (size_t i = *position + 1; i < length; i++) {
+        if (bytes[i] == '\\') {
+            *escaped = YES;
+            i++;
+        } else if (bytes[i] == '"') {
+            *position = i + 1;
+            return YES;
+        }
+    }
+    return NO;
+}
+
+// Moves `position` from the first byte of a value to just past its last byte. Only the nesting is checked;
+// NSJSONSerialization validates the value when it is decoded.
+static BOOL AWSServiceDefinitionSkipValue(const uint8_t *bytes, size_t *position, size_t length) {
+    size_t i = *position;
+    if (i >= length) {
+        return NO;
+    }
+    BOOL escaped = NO;
+    if (bytes[i] == '"') {
+        return AWSServiceDefinitionSkipString(bytes, position, length, &escaped);
+    }
+    if (bytes[i] != '{' && bytes[i] != '[') {
+        size_t start = i;
+        while (i < length && bytes[i] != ',' && bytes[i] != '}' && bytes[i] != ']'
+               && bytes[i] != ' ' && bytes[i] != '\n' && bytes[i] != '\r' && bytes[i] != '\t') {
+            i++;
+        }
+        *position = i;
+        return i > start;
+    }
+
+    size_t depth = 0;
+    while (i < length) {
+        switch (bytes[i]) {
+            case '"':
+                if (!AWSServiceDefinitionSkipString(bytes, &i, length, &escaped)) {
+                    return NO;
+                }
+                continue;
+            case '{':
+            case '[':
+                depth++;
+                break;
+            case '}':
+            case ']':
+                if (--depth == 0) {
+                    *position = i + 1;
+                    return YES;
+                }
+                break;
+        }
+        i++;
+    }
+    return NO;
+}
+
+// Returns the members of the object starting at `position`, or NULL if it is malformed or has a key with escapes.
+static AWSServiceDefinitionJSONMember *AWSServiceDefinitionScanObject(const uint8_t *bytes, size_t position, size_t length, NSUInteger *count) {
+    if (position >= length || bytes[position] != '{') {
+        return NULL;
+    }
+    NSUInteger capacity = 64;
+    NSUInteger memberCount = 0;
+    AWSServiceDefinitionJSONMember *members = malloc(capacity * sizeof(AWSServiceDefinitionJSONMember));
+
+    position = AWSServiceDefinitionSkipWhitespace(bytes, position + 1, length);
+    if (position < length && bytes[position] == '}') {
+        *count = 0;
+        return members;
+    }
+    while (members && position < length && bytes[position] == '"') {
+        size_t keyStart = position + 1;
+        BOOL escaped = NO;
+        if (!AWSServiceDefinitionSkipString(bytes, &position, length, &escaped) || escaped) {
+            break;
+        }
+        size_t keyEnd = position - 1;
+
+        position = AWSServiceDefinitionSkipWhitespace(bytes, position, length);
+        if (position >= length || bytes[position] != ':') {
+            break;
+        }
+        size_t valueStart = AWSServiceDefinitionSkipWhitespace(bytes, position + 1, length);
+        position = valueStart;
+        if (!AWSServiceDefinitionSkipValue(bytes, &position, length)) {
+            break;
+        }
+
+        if (memberCount == capacity) {
+            capacity *= 2;
+            AWSServiceDefinitionJSONMember *grown = realloc(members, capacity * sizeof(AWSServiceDefinitionJSONMember));
+            if (grown == NULL) {
+                break;
+            }
+            members = grown;
+        }
+        members[memberCount++] = (AWSServiceDefinitionJSONMember){(uint32_t)keyStart, (uint32_t)(keyEnd - keyStart),
+                                                                  (uint32_t)valueStart, (uint32_t)(position - valueStart)};
+
+        position = AWSServiceDefinitionSkipWhitespace(bytes, position, length);
+        if (position < length && bytes[position] == '}') {
+            *count = memberCount;
+            return members;
+        }
+        if (position >= length || bytes[position] != ',') {
+            break;
+        }
+        position = AWSServiceDefinitionSkipWhitespace(bytes, position + 1, length);
+    }
+
+    free(members);
+    return NULL;
+}
+
+// Returns the UTF-8 text of a definition, borrowing the bytes of the string instead of copying them when it can.
+static NSData *AWSServiceDefinitionUTF8Data(NSString *string) {
+    const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+    if (bytes == NULL) {
+        return [string dataUsingEncoding:NSUTF8StringEncoding];
+    }
+    return [[NSData alloc] initWithBytesNoCopy:(void *)bytes
+                                        length:strlen(bytes)
+                                   deallocator:^(void *unused, NSUInteger unusedLength) {
+        // Keeps the string, and so the borrowed bytes, alive for as long as the data.
+        (void)string;
+    }];
+}
+
+static id AWSServiceDefinitionJSONObject(NSData *data, NSUInteger offset, NSUInteger length, NSError *__autoreleasing *error) {
+    NSData *value = [[NSData alloc] initWithBytesNoCopy:(void *)((const uint8_t *)[data bytes] + offset)
+                                                 length:length
+                                           freeWhenDone:NO];
+    return [NSJSONSerialization JSONObjectWithData:value options:NSJSONReadingAllowFragments error:error];
+}
+
+@implementation AWSServiceDefinitionJSONDictionary
+
+- (instancetype)initWithData:(NSData *)data members:(AWSServiceDefinitionJSONMember *)members count:(NSUInteger)count {
+    if (self = [super init]) {
+        _data = data;
+        const uint8_t *bytes = [data bytes];
+
+        // Sorted by key bytes for binary search. When a key repeats, the last one wins, as with NSJSONSerialization.
+        qsort_b(members, count, sizeof(AWSServiceDefinitionJSONMember), ^int(const void *left, const void *right) {
+            const AWSServiceDefinitionJSONMember *member1 = left;
+            const AWSServiceDefinitionJSONMember *member2 = right;
+            int order = AWSServiceDefinitionCompareBytes(bytes + member1->keyOffset, member1->keyLength,
+                                                         bytes + member2->keyOffset, member2->keyLength);
+            if (order == 0) {
+                order = (member1->valueOffset < member2->valueOffset) ? -1 : 1;
+            }
+            return order;
+        });
+        NSUInteger unique = 0;
+        for (NSUInteger i = 0; i < count; i++) {
+            if (unique > 0 && AWSServiceDefinitionCompareBytes(bytes + members[unique - 1].keyOffset, members[unique - 1].keyLength,
+                                                               bytes + members[i].keyOffset, members[i].keyLength) == 0) {
+                unique--;
+            }
+            members[unique++] = members[i];
+        }
+
+        _members = members;
+        _count = unique;
+        _values = calloc(MAX(unique, 1), sizeof(_Atomic(void *)));
+    }
+    return self;
+}
+
+// -[NSDictionary init] funnels into this primitive, which the abstract class does not implement.
+- (instancetype)initWithObjects:(const id [])objects forKeys:(const id<NSCopying> [])keys count:(NSUInteger)count {
+    return self;
+}
+
+- (void)dealloc {
+    if (_values) {
+        for (NSUInteger i = 0; i < _count; i++) {
+            void *value = atomic_load_explicit(&_values[i], memory_order_relaxed);
+            if (value) {
+                CFRelease(value);
+            }
+        }
+        free(_values);
+    }
+    free(_members);
+}
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectForKey:(id)aKey {
+    char buffer[AWSServiceDefinitionKeyBufferSize];
+    size_t keyLength;
+    const char *keyBytes = AWSServiceDefinitionKeyBytes(aKey, buffer, &keyLength);
+    if (keyBytes == NULL || _values == NULL) {
+        return nil;
+    }
+
+    const uint8_t *bytes = [_data bytes];
+    NSUInteger low = 0;
+    NSUInteger high = _count;
+    while (low < high) {
+        NSUInteger middle = low + (high - low) / 2;
+        const AWSServiceDefinitionJSONMember *member = &_members[middle];
+        int order = AWSServiceDefinitionCompareBytes(bytes + member->keyOffset, member->keyLength, (const uint8_t *)keyBytes, keyLength);
+        if (order == 0) {
+            return [self valueAtIndex:middle];
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return nil;
+}
+
+- (id)valueAtIndex:(NSUInteger)index {
+    void *value = atomic_load_explicit(&_values[index], memory_order_acquire);
+    if (value) {
+        return (__bridge id)value;
+    }
+
+    NSError *error = nil;
+    const AWSServiceDefinitionJSONMember *member = &_members[index];
+    id object = AWSServiceDefinitionJSONObject(_data, member->valueOffset, member->valueLength, &error);
+    if (object == nil) {
+        AWSDDLogError(@"Failed to parse JSON service definition: %@", error);
+        return nil;
+    }
+    void *expected = NULL;
+    void *created = (void *)CFBridgingRetain(object);
+    if (!atomic_compare_exchange_strong_explicit(&_values[index], &expected, created,
+                                                 memory_order_acq_rel, memory_order_acquire)) {
+        // Another thread decoded it first; use its object so every lookup of the key returns the same object.
+        CFRelease(created);
+        return (__bridge id)expected;
+    }
+    return object;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    const uint8_t *bytes = [_data bytes];
+    NSMutableArray *keys = [NSMutableArray arrayWithCapacity:_count];
+    for (NSUInteger i = 0; i < _count; i++) {
+        NSString *key = [[NSString alloc] initWithBytes:bytes + _members[i].keyOffset
+                                                 length:_members[i].keyLength
+                                               encoding:NSUTF8StringEncoding];
+        if (key) {
+            [keys addObject:key];
+        }
+    }
+    return [keys objectEnumerator];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
+
+#pragma mark - AWSServiceDefinition
+
+@implementation AWSServiceDefinition
+
++ (NSDictionary *)definitionNamed:(NSString *)name
+                      bundleClass:(Class)bundleClass
+               resourceBundleName:(NSString *)resourceBundleName
+                           digest:(NSString *)digest {
+    NSBundle *classBundle = [NSBundle bundleForClass:bundleClass];
+    NSMutableArray<NSBundle *> *bundles = [NSMutableArray arrayWithObject:classBundle];
+    for (NSBundle *bundle in @[classBundle, [NSBundle mainBundle]]) {
+        NSURL *resourceBundleURL = [bundle URLForResource:resourceBundleName withExtension:@"bundle"];
+        NSBundle *resourceBundle = resourceBundleURL ? [NSBundle bundleWithURL:resourceBundleURL] : nil;
+        if (resourceBundle) {
+            [bundles addObject:resourceBundle];
+        }
+    }
+
+    for (NSBundle *bundle in bundles) {
+        NSURL *URL = [bundle URLForResource:name withExtension:AWSServiceDefinitionFileExtension];
+        if (URL == nil) {
+            continue;
+        }
+
+        NSError *error = nil;
+        NSData *data = [NSData dataWithContentsOfURL:URL options:NSDataReadingMappedIfSafe error:&error];
+        NSDictionary *definition = data ? [self definitionWithData:data digest:digest error:&error] : nil;
+        if (definition == nil) {
+            AWSDDLogWarn(@"Ignoring the compiled service definition at %@: %@", URL, error);
+            return nil;
+        }
+        return definition;
+    }
+
+    return nil;
+}
+
++ (NSDictionary *)definitionWithData:(NSData *)data
+                              digest:(NSString *)digest
+                               error:(NSError *__autoreleasing *)error {
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+
+    AWSServiceDefinitionHeader header;
+    if (length < sizeof(header) || length > UINT32_MAX) {
+        return [self failWithCode:AWSServiceDefinitionErrorInvalidFormat description:@"The compiled service definition is truncated." error:error];
+    }
+    memcpy(&header, bytes, sizeof(header));
+    if (memcmp(header.magic, "AWSD", 4) != 0) {
+        return [self failWithCode:AWSServiceDefinitionErrorInvalidFormat description:@"The file is not a compiled service definition." error:error];
+    }
+    if (header.version != AWSServiceDefinitionVersion) {
+        return [self failWithCode:AWSServiceDefinitionErrorUnsupportedVersion
+                      description:[NSString stringWithFormat:@"Unsupported compiled service definition version %u.", header.version]
+                            error:error];
+    }
+    if (digest && ![[[NSData dataWithBytes:header.digest length:sizeof(header.digest)] aws_hexEncodedString] isEqualToString:digest]) {
+        return [self failWithCode:AWSServiceDefinitionErrorDigestMismatch
+                      description:@"The compiled service definition is out of date. Run Scripts/compile_service_definitions.py."
+                            error:error];
+    }
+
+    // Sections must be aligned and in bounds. Nodes are bounds checked again as they are decoded.
+    uint64_t stringTableEnd = (uint64_t)header.stringTableOffset + 8 * (uint64_t)header.stringCount;
+    uint64_t numberTableEnd = (uint64_t)header.numberTableOffset + 8 * (uint64_t)header.numberCount;
+    uint64_t nodeEnd = (uint64_t)header.nodeOffset + header.nodeLength;
+    if (header.stringTableOffset % 4 || header.numberTableOffset % 4 || header.nodeOffset % 4 || header.nodeLength % 4
+        || stringTableEnd > length || numberTableEnd > length || nodeEnd > length
+        || ((uintptr_t)bytes % 4) != 0) {
+        return [self failWithCode:AWSServiceDefinitionErrorInvalidFormat description:@"The compiled service definition has invalid sections." error:error];
+    }
+    const uint32_t *strings = (const uint32_t *)(bytes + header.stringTableOffset);
+    for (uint32_t i = 0; i < header.stringCount; i++) {
+        if ((uint64_t)strings[2 * i] + strings[2 * i + 1] > length) {
+            return [self failWithCode:AWSServiceDefinitionErrorInvalidFormat description:@"The compiled service definition has an invalid string table." error:error];
+        }
+    }
+    if ((header.root & AWSServiceDefinitionTagMask) != AWSServiceDefinitionValueObject) {
+        return [self failWithCode:AWSServiceDefinitionErrorInvalidFormat description:@"The root of the compiled service definition is not an object." error:error];
+    }
+
+    AWSServiceDefinitionStorage *storage = [AWSServiceDefinitionStorage new];
+    storage->_data = data;
+    storage->_bytes = bytes;
+    storage->_strings = strings;
+    storage->_stringCount = header.stringCount;
+    storage->_numbers = bytes + header.numberTableOffset;
+    storage->_numberCount = header.numberCount;
+    storage->_nodes = (const uint32_t *)(bytes + header.nodeOffset);
+    storage->_nodeWordCount = header.nodeLength / 4;
+    storage->_stringObjects = calloc(MAX(header.stringCount, 1), sizeof(_Atomic(void *)));
+    if (storage->_stringObjects == NULL) {
+        return [self failWithCode:AWSServiceDefinitionErrorUnknown description:@"Failed to allocate the string cache." error:error];
+    }
+
+    return [storage objectForValue:header.root];
+}
+
++ (NSDictionary *)definitionWithJSONString:(NSString *)JSONString error:(NSError *__autoreleasing *)error {
+    NSData *data = AWSServiceDefinitionUTF8Data(JSONString);
+    NSDictionary *definition = [self lazyDefinitionWithJSONData:data];
+    if (definition == nil) {
+        // Not laid out like a service definition; the JSON parser either handles it or explains why it is invalid.
+        definition = [NSJSONSerialization JSONObjectWithData:data options:kNilOptions error:error];
+        if (definition && ![definition isKindOfClass:[NSDictionary class]]) {
+            return [self failWithCode:AWSServiceDefinitionErrorInvalidFormat description:@"The root of the service definition is not an object." error:error];
+        }
+    }
+    return definition;
+}
+
++ (NSDictionary *)lazyDefinitionWithJSONData:(NSData *)data {
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+    if (length > UINT32_MAX) {
+        return nil;
+    }
+
+    NSUInteger count = 0;
+    size_t position = AWSServiceDefinitionSkipWhitespace(bytes, 0, length);
+    AWSServiceDefinitionJSONMember *members = AWSServiceDefinitionScanObject(bytes, position, length, &count);
+    if (members == NULL) {
+        return nil;
+    }
+
+    NSMutableDictionary *definition = [NSMutableDictionary dictionaryWithCapacity:count];
+    BOOL valid = YES;
+    for (NSUInteger i = 0; i < count && valid; i++) {
+        const AWSServiceDefinitionJSONMember *member = &members[i];
+        NSString *key = [[NSString alloc] initWithBytes:bytes + member->keyOffset length:member->keyLength encoding:NSUTF8StringEncoding];
+        id value = nil;
+        if ([key isEqualToString:@"operations"] || [key isEqualToString:@"shapes"]) {
+            NSUInteger memberCount = 0;
+            AWSServiceDefinitionJSONMember *valueMembers = AWSServiceDefinitionScanObject(bytes, member->valueOffset, length, &memberCount);
+            if (valueMembers) {
+                value = [[AWSServiceDefinitionJSONDictionary alloc] initWithData:data members:valueMembers count:memberCount];
+            }
+        } else {
+            // The version and metadata are small and read by every request.
+            value = AWSServiceDefinitionJSONObject(data, member->valueOffset, member->valueLength, nil);
+        }
+        valid = key && value;
+        if (valid) {
+            definition[key] = value;
+        }
+    }
+    free(members);
+
+    return valid ? [definition copy] : nil;
+}
+
++ (id)failWithCode:(AWSServiceDefinitionErrorType)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
+    if (error) {
+        *error = [NSError errorWithDomain:AWSServiceDefinitionErrorDomain
+                                     code:code
+                                 userInfo:@{NSLocalizedDescriptionKey: description}];
+    }
+    return nil;
+}
+
+@end
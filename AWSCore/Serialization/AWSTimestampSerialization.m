@@ -16,9 +16,20 @@
 #import <Foundation/Foundation.h>
 #import "AWSTimestampSerialization.h"
 #import "AWSCategory.h"
+#import "aws_date.h"
 
 NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimestampSerializationErrorDomain";
 
+// Formats seconds since 1970 as "%.lf" does.
+static NSString *AWSTimestampEpochString(NSTimeInterval seconds) {
+    char buffer[AWS_DATE_MAX_LENGTH];
+    size_t length = aws_date_format_epoch(seconds, buffer);
+    if (length == 0) {
+        return [NSString stringWithFormat:@"%.lf", seconds];
+    }
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
 @implementation AWSTimestampSerialization
 
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
@@ -34,6 +45,16 @@ NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimest
     NSDate *timeStampDate;
     //maybe a NSDate type or NSNumber type or NSString type
     if ([value isKindOfClass:[NSString class]]) {
+        //epoch seconds cannot be mistaken for a date string, so they are tried first
+        char buffer[AWS_DATE_MAX_LENGTH];
+        NSUInteger length = 0;
+        double seconds = 0;
+        if ([value getBytes:buffer maxLength:sizeof(buffer) usedLength:&length encoding:NSASCIIStringEncoding options:0 range:NSMakeRange(0, [value length]) remainingRange:NULL]
+            && length == [value length]
+            && aws_date_parse_epoch(buffer, length, &seconds) == AWS_DATE_OK) {
+            return [NSDate dateWithTimeIntervalSince1970:seconds];
+        }
+
         //try parse the string to NSDate first
         timeStampDate = [NSDate aws_dateFromString:value];
         
@@ -69,7 +90,7 @@ NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimest
             if ([rules[@"timestampFormat"] isEqualToString:@"iso8601"]) {
                 timestampStr = [timeStampDate aws_stringValue:AWSDateISO8601DateFormat1];
             } else if ([rules[@"timestampFormat"] isEqualToString:@"unixTimestamp"]) {
-                timestampStr = [NSString stringWithFormat:@"%.lf",[timeStampDate timeIntervalSince1970]];
+                timestampStr = AWSTimestampEpochString([timeStampDate timeIntervalSince1970]);
             } else if ([rules[@"timestampFormat"] isEqualToString:@"rfc822"]) {
                 timestampStr = [timeStampDate aws_stringValue: AWSDateRFC822DateFormat1];
             }
@@ -88,7 +109,7 @@ NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimest
     if (!timestampStr.length){
         // valid `timestampFormat` trait is not present, use protocol specific default.
         NSDate *timeStampDate = [self parseTimestamp:value];
-        timestampStr = [NSString stringWithFormat:@"%.lf",[timeStampDate timeIntervalSince1970]];
+        timestampStr = AWSTimestampEpochString([timeStampDate timeIntervalSince1970]);
     }
     return timestampStr;
 }
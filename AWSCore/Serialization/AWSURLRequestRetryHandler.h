@@ -24,3 +24,88 @@
 - (instancetype)initWithMaximumRetryCount:(uint32_t)maxRetryCount;
 
 @end
+
+/**
+ The retry quota of `AWSRetryModeStandard` and `AWSRetryModeAdaptive`. Every retry takes tokens from the quota, and
+ every successful request gives some back, so a client stops retrying when most of its requests fail.
+ */
+@interface AWSRetryQuota : NSObject
+
+/**
+ The number of tokens of a full quota. The default value is 500.
+ */
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+
+@property (nonatomic, assign, readonly) NSUInteger availableTokens;
+
+- (instancetype)init;
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/**
+ Takes the tokens for retrying a request that failed with `error`: 10 after a timeout, 5 otherwise.
+
+ @return The number of tokens taken, or 0 when the quota does not have enough tokens left and the request should not be retried.
+ */
+- (NSUInteger)acquireTokensForRetryAfterError:(NSError *)error;
+
+/**
+ Gives back the tokens taken for the last retry of a request that succeeded, or 1 token if it succeeded without a retry.
+ */
+- (void)releaseTokensAfterSuccessWithCost:(NSUInteger)cost;
+
+@end
+
+/**
+ The rate limiter of `AWSRetryModeAdaptive`. It lets requests through as they come until the service throttles one.
+ From then on, requests are sent in order at a rate that is cut on every throttling response and grows back along a
+ cubic curve, as in CUBIC congestion control, toward and past the rate at which the last throttling happened.
+ */
+@interface AWSClientSideRateLimiter : NSObject
+
+/**
+ Whether the limiter holds requests back. It is enabled by the first throttling response.
+ */
+@property (nonatomic, assign, readonly, getter=isEnabled) BOOL enabled;
+
+/**
+ The rate, in requests per second, at which requests are let through.
+ */
+@property (nonatomic, assign, readonly) double sendingRate;
+
+/**
+ The smoothed rate, in requests per second, at which responses were received.
+ */
+@property (nonatomic, assign, readonly) double measuredRate;
+
+/**
+ The number of requests waiting to be let through.
+ */
+@property (nonatomic, assign, readonly) NSUInteger waitingCount;
+
+- (instancetype)init;
+
+/**
+ Returns a limiter that reads the time from `clock`, in seconds, and runs `block` after `delay` seconds with
+ `scheduler`. `init` uses the system uptime and a private dispatch queue, and tests can pass a simulated clock.
+ */
+- (instancetype)initWithClock:(NSTimeInterval (^)(void))clock
+                    scheduler:(void (^)(NSTimeInterval delay, dispatch_block_t block))scheduler NS_DESIGNATED_INITIALIZER;
+
+/**
+ Runs `block` when the request can be sent: right away until the limiter is enabled, then in turn once a token is
+ available.
+ */
+- (void)acquireTokenWithBlock:(dispatch_block_t)block;
+
+/**
+ Returns a task that completes when the request can be sent.
+ */
+- (AWSTask *)acquireToken;
+
+/**
+ Adjusts the sending rate after a response was received.
+ */
+- (void)updateSendingRateWithThrottlingResponse:(BOOL)throttled;
+
+@end
@@ -16,6 +16,7 @@
 #import "AWSURLRequestRetryHandler.h"
 #import "AWSURLResponseSerialization.h"
 #import "AWSService.h"
+#import "AWSBolts.h"
 
 @interface AWSURLRequestRetryHandler ()
 
@@ -141,4 +142,283 @@
     return pow(2, currentRetryCount) * 100 / 1000;
 }
 
+- (BOOL)isThrottlingResponse:(NSHTTPURLResponse *)response
+                        data:(NSData *)data
+                       error:(NSError *)error {
+    if (response.statusCode == 429) {
+        return YES;
+    }
+
+    if ([error.domain isEqualToString:AWSServiceErrorDomain]) {
+        switch (error.code) {
+            case AWSServiceErrorThrottling:
+            case AWSServiceErrorThrottlingException:
+                return YES;
+
+            default:
+                break;
+        }
+    }
+
+    return NO;
+}
+
+@end
+
+#pragma mark - AWSRetryQuota
+
+static NSUInteger const AWSRetryQuotaDefaultCapacity = 500;
+static NSUInteger const AWSRetryQuotaRetryCost = 5;
+static NSUInteger const AWSRetryQuotaTimeoutRetryCost = 10;
+static NSUInteger const AWSRetryQuotaNoRetryIncrement = 1;
+
+@implementation AWSRetryQuota {
+    NSUInteger _availableTokens;
+}
+
+- (instancetype)init {
+    return [self initWithCapacity:AWSRetryQuotaDefaultCapacity];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    if (self = [super init]) {
+        _capacity = capacity;
+        _availableTokens = capacity;
+    }
+
+    return self;
+}
+
+- (NSUInteger)availableTokens {
+    @synchronized(self) {
+        return _availableTokens;
+    }
+}
+
+- (NSUInteger)acquireTokensForRetryAfterError:(NSError *)error {
+    NSUInteger cost = AWSRetryQuotaRetryCost;
+    if ([error.domain isEqualToString:NSURLErrorDomain] && error.code == NSURLErrorTimedOut) {
+        cost = AWSRetryQuotaTimeoutRetryCost;
+    }
+
+    @synchronized(self) {
+        if (_availableTokens < cost) {
+            return 0;
+        }
+        _availableTokens -= cost;
+    }
+    return cost;
+}
+
+- (void)releaseTokensAfterSuccessWithCost:(NSUInteger)cost {
+    @synchronized(self) {
+        _availableTokens = MIN(_capacity, _availableTokens + (cost > 0 ? cost : AWSRetryQuotaNoRetryIncrement));
+    }
+}
+
+@end
+
+#pragma mark - AWSClientSideRateLimiter
+
+static double const AWSClientSideRateLimiterSmoothing = 0.8;
+static double const AWSClientSideRateLimiterBeta = 0.7;
+static double const AWSClientSideRateLimiterScaleConstant = 0.4;
+static double const AWSClientSideRateLimiterMinimumFillRate = 0.5;
+static double const AWSClientSideRateLimiterMinimumCapacity = 1;
+// Waking up after the time it takes to refill a token can leave the capacity a rounding error short of it.
+static double const AWSClientSideRateLimiterTolerance = 1e-9;
+
+@interface AWSClientSideRateLimiter() {
+    BOOL _enabled;
+    double _fillRate;
+    double _maxCapacity;
+    double _currentCapacity;
+    NSTimeInterval _lastRefillTime;
+    double _measuredRate;
+    NSTimeInterval _lastRateBucket;
+    NSUInteger _requestCount;
+    double _lastMaxRate;
+    NSTimeInterval _lastThrottleTime;
+    NSUInteger _drainGeneration;
+}
+
+@property (nonatomic, copy) NSTimeInterval (^clock)(void);
+@property (nonatomic, copy) void (^scheduler)(NSTimeInterval delay, dispatch_block_t block);
+@property (nonatomic, strong) NSMutableArray<dispatch_block_t> *waitingBlocks;
+
+@end
+
+@implementation AWSClientSideRateLimiter
+
+- (instancetype)init {
+    dispatch_queue_t dispatchQueue = dispatch_queue_create("com.amazonaws.AWSClientSideRateLimiter", DISPATCH_QUEUE_SERIAL);
+    return [self initWithClock:^NSTimeInterval{
+        return [NSProcessInfo processInfo].systemUptime;
+    } scheduler:^(NSTimeInterval delay, dispatch_block_t block) {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatchQueue, block);
+    }];
+}
+
+- (instancetype)initWithClock:(NSTimeInterval (^)(void))clock
+                    scheduler:(void (^)(NSTimeInterval delay, dispatch_block_t block))scheduler {
+    if (self = [super init]) {
+        _clock = [clock copy];
+        _scheduler = [scheduler copy];
+        _waitingBlocks = [NSMutableArray new];
+        _lastRefillTime = NAN;
+        _lastRateBucket = NAN;
+    }
+
+    return self;
+}
+
+- (BOOL)isEnabled {
+    @synchronized(self) {
+        return _enabled;
+    }
+}
+
+- (double)sendingRate {
+    @synchronized(self) {
+        return _fillRate;
+    }
+}
+
+- (double)measuredRate {
+    @synchronized(self) {
+        return _measuredRate;
+    }
+}
+
+- (NSUInteger)waitingCount {
+    @synchronized(self) {
+        return self.waitingBlocks.count;
+    }
+}
+
+- (void)acquireTokenWithBlock:(dispatch_block_t)block {
+    NSArray<dispatch_block_t> *blocks = nil;
+    @synchronized(self) {
+        if (!_enabled) {
+            blocks = @[block];
+        } else {
+            [self.waitingBlocks addObject:block];
+            // Otherwise, a drain is already scheduled for the requests ahead of this one.
+            if (self.waitingBlocks.count == 1) {
+                blocks = [self dequeueBlocks];
+            }
+        }
+    }
+
+    for (dispatch_block_t block in blocks) {
+        block();
+    }
+}
+
+- (AWSTask *)acquireToken {
+    AWSTaskCompletionSource *taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+    [self acquireTokenWithBlock:^{
+        [taskCompletionSource setResult:nil];
+    }];
+    return taskCompletionSource.task;
+}
+
+- (void)updateSendingRateWithThrottlingResponse:(BOOL)throttled {
+    NSArray<dispatch_block_t> *blocks = nil;
+    @synchronized(self) {
+        NSTimeInterval timestamp = self.clock();
+        [self updateMeasuredRateAtTime:timestamp];
+
+        double calculatedRate = 0;
+        if (throttled) {
+            double rateToUse = _enabled ? MIN(_measuredRate, _fillRate) : _measuredRate;
+            _lastMaxRate = rateToUse;
+            _lastThrottleTime = timestamp;
+            calculatedRate = rateToUse * AWSClientSideRateLimiterBeta;
+            _enabled = YES;
+        } else {
+            // The rate climbs back to the last maximum in `timeWindow` seconds after a throttling response, then
+            // grows past it.
+            double timeWindow = cbrt(_lastMaxRate * (1 - AWSClientSideRateLimiterBeta) / AWSClientSideRateLimiterScaleConstant);
+            calculatedRate = AWSClientSideRateLimiterScaleConstant * pow(timestamp - _lastThrottleTime - timeWindow, 3) + _lastMaxRate;
+        }
+
+        [self setFillRate:MIN(calculatedRate, 2 * _measuredRate) atTime:timestamp];
+        if (self.waitingBlocks.count > 0) {
+            blocks = [self dequeueBlocks];
+        }
+    }
+
+    for (dispatch_block_t block in blocks) {
+        block();
+    }
+}
+
+#pragma mark - Token bucket
+
+// The methods below are called with the lock held.
+
+- (void)refillAtTime:(NSTimeInterval)timestamp {
+    if (!isnan(_lastRefillTime)) {
+        _currentCapacity = MIN(_maxCapacity, _currentCapacity + (timestamp - _lastRefillTime) * _fillRate);
+    }
+    _lastRefillTime = timestamp;
+}
+
+- (void)setFillRate:(double)rate atTime:(NSTimeInterval)timestamp {
+    [self refillAtTime:timestamp];
+    _fillRate = MAX(rate, AWSClientSideRateLimiterMinimumFillRate);
+    _maxCapacity = MAX(rate, AWSClientSideRateLimiterMinimumCapacity);
+    _currentCapacity = MIN(_currentCapacity, _maxCapacity);
+}
+
+- (void)updateMeasuredRateAtTime:(NSTimeInterval)timestamp {
+    NSTimeInterval timeBucket = floor(timestamp * 2) / 2;
+    _requestCount++;
+    if (isnan(_lastRateBucket)) {
+        _lastRateBucket = timeBucket;
+    } else if (timeBucket > _lastRateBucket) {
+        double currentRate = _requestCount / (timeBucket - _lastRateBucket);
+        _measuredRate = currentRate * AWSClientSideRateLimiterSmoothing + _measuredRate * (1 - AWSClientSideRateLimiterSmoothing);
+        _requestCount = 0;
+        _lastRateBucket = timeBucket;
+    }
+}
+
+// Takes the requests that can be sent now, in order, and schedules the next drain if requests are left waiting.
+- (NSArray<dispatch_block_t> *)dequeueBlocks {
+    [self refillAtTime:self.clock()];
+
+    NSMutableArray<dispatch_block_t> *blocks = [NSMutableArray new];
+    while (self.waitingBlocks.count > 0 && _currentCapacity >= 1 - AWSClientSideRateLimiterTolerance) {
+        _currentCapacity -= 1;
+        [blocks addObject:self.waitingBlocks.firstObject];
+        [self.waitingBlocks removeObjectAtIndex:0];
+    }
+
+    if (self.waitingBlocks.count > 0) {
+        NSUInteger generation = ++_drainGeneration;
+        self.scheduler((1 - _currentCapacity) / _fillRate, ^{
+            [self drainWithGeneration:generation];
+        });
+    }
+
+    return blocks;
+}
+
+- (void)drainWithGeneration:(NSUInteger)generation {
+    NSArray<dispatch_block_t> *blocks = nil;
+    @synchronized(self) {
+        // A later drain was scheduled since, e.g. because the rate changed.
+        if (generation != _drainGeneration) {
+            return;
+        }
+        blocks = [self dequeueBlocks];
+    }
+
+    for (dispatch_block_t block in blocks) {
+        block();
+    }
+}
+
 @end
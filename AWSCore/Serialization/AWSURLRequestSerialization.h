@@ -20,6 +20,12 @@
 
 @interface AWSJSONRequestSerializer : NSObject <AWSURLRequestSerializer>
 
+/**
+ The compression level of request bodies sent with `Content-Encoding: gzip`, from `0.0` (fastest) to `1.0` (smallest).
+ The default value is `-1.0`, which uses the zlib default level.
+ */
+@property (class, nonatomic, assign) float gzipCompressionLevel;
+
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName;
 
@@ -14,7 +14,9 @@
 //
 #import "AWSURLRequestSerialization.h"
 
+#import <CommonCrypto/CommonDigest.h>
 #import "AWSGZIP.h"
+#import "AWSGZIPStream.h"
 #import "AWSBolts.h"
 #import "AWSNetworking.h"
 #import "AWSValidation.h"
@@ -22,6 +24,8 @@
 #import "AWSCategory.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSClientContext.h"
+#import "AWSOperationPlan.h"
+#import "AWSSignature.h"
 
 @interface NSMutableURLRequest (AWSRequestSerializer)
 
@@ -53,8 +57,21 @@
 
 @end
 
+// gzip bodies of at least this length are compressed as they are sent, rather than into a second buffer.
+static NSUInteger const AWSJSONRequestStreamingGZIPThreshold = 256 * 1024;
+
+static float AWSJSONRequestGZIPCompressionLevel = -1.0f;
+
 @implementation AWSJSONRequestSerializer
 
++ (float)gzipCompressionLevel {
+    return AWSJSONRequestGZIPCompressionLevel;
+}
+
++ (void)setGzipCompressionLevel:(float)gzipCompressionLevel {
+    AWSJSONRequestGZIPCompressionLevel = gzipCompressionLevel;
+}
+
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName {
     if (self = [super init]) {
@@ -75,6 +92,14 @@
                    parameters:(NSDictionary *)parameters {
     request.cachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
 
+    NSError *validationError = nil;
+    if (![AWSValidation validateParameters:parameters
+                                actionName:self.actionName
+                     serviceDefinitionRule:self.serviceDefinitionJSON
+                                     error:&validationError]) {
+        return [AWSTask taskWithError:validationError];
+    }
+
     //If parameters contains clientContext key, move it to http header. This is a sepcial case
     if ([parameters objectForKey:@"clientContext"]) {
         [request setValue:[[[parameters objectForKey:@"clientContext"] dataUsingEncoding:NSUTF8StringEncoding] base64EncodedStringWithOptions:kNilOptions]
@@ -86,39 +111,39 @@
         parameters = mutableParameters;
     }
 
-    NSDictionary *actionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
-    NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[actionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
-
-    NSDictionary *actionHTTPRule = [actionRules objectForKey:@"http"];
-    NSString *ruleURIStr = [actionHTTPRule objectForKey:@"requestUri"];
+    AWSOperationPlan *plan = [AWSOperationPlan planForActionName:self.actionName
+                                           serviceDefinitionRule:self.serviceDefinitionJSON];
 
-    NSDictionary *actionEndpoint = [actionRules objectForKey:@"endpoint"];
-    NSString *endpointHostPrefix = [actionEndpoint objectForKey:@"hostPrefix"];
-    
     NSError *error = nil;
 
-    [AWSXMLRequestSerializer constructURIandHeadersAndBody:request
-                                                     rules:inputRules
-                                                parameters:parameters
-                                                 uriSchema:ruleURIStr
-                                                hostPrefix:endpointHostPrefix
-                                                     error:&error];
+    [plan bindParameters:parameters toRequest:request error:&error];
     if (error) {
         return [AWSTask taskWithError:error];
     }
 
     //construct HTTPBody only if HTTPBodyStream is nil
     if (!request.HTTPBodyStream) {
-        NSData *bodyData = [AWSJSONBuilder jsonDataForDictionary:parameters actionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        BOOL gzipsBody = headers[@"Content-Encoding"] && [headers[@"Content-Encoding"] rangeOfString:@"gzip"].location != NSNotFound;
+        NSData *payloadSHA256 = nil;
+        NSData *bodyData = nil;
+        if (!gzipsBody) {
+            // The signer reuses the digest computed while the body is written.
+            bodyData = [plan JSONBodyForParameters:parameters payloadSHA256:&payloadSHA256 error:&error];
+        }
+        if (!bodyData && !error) {
+            bodyData = [AWSJSONBuilder jsonDataForDictionary:parameters actionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        }
         if (!error) {
-            if (headers[@"Content-Encoding"] && [headers[@"Content-Encoding"] rangeOfString:@"gzip"].location != NSNotFound) {
+            if (gzipsBody) {
                 //gzip the body
-                request.HTTPBody = [bodyData awsgzip_gzippedData];
+                [self setGZIPBody:bodyData ofRequest:request];
             } else {
                 request.HTTPBody = bodyData;
             }
         }
+        if (!error && payloadSHA256) {
+            [AWSSignatureSignerUtility setPayloadHash:payloadSHA256 forHTTPBody:request.HTTPBody ofRequest:request];
+        }
     }
 
     [request aws_validateHTTPMethodAndBody];
@@ -139,11 +164,47 @@
     return [AWSTask taskWithError:error];
 }
 
+- (void)setGZIPBody:(NSData *)body ofRequest:(NSMutableURLRequest *)request {
+    float level = [AWSJSONRequestSerializer gzipCompressionLevel];
+    if ([body length] < AWSJSONRequestStreamingGZIPThreshold) {
+        request.HTTPBody = [body awsgzip_gzippedDataWithCompressionLevel:level];
+        return;
+    }
+
+    // The signature covers the compressed body, so the body is compressed once to compute its length and digest,
+    // and again while it is sent. Compression is deterministic, and neither pass holds the compressed body.
+    AWSGZIPInputStream *digestStream = [[AWSGZIPInputStream alloc] initWithData:body compressionLevel:level];
+    CC_SHA256_CTX context;
+    CC_SHA256_Init(&context);
+    uint8_t buffer[16384];
+    NSInteger bytesRead = 0;
+    [digestStream open];
+    while ((bytesRead = [digestStream read:buffer maxLength:sizeof(buffer)]) > 0) {
+        CC_SHA256_Update(&context, buffer, (CC_LONG)bytesRead);
+    }
+    [digestStream close];
+    if (bytesRead < 0) {
+        AWSDDLogError(@"Failed to compress the request body: %@", [digestStream streamError]);
+        request.HTTPBody = [body awsgzip_gzippedDataWithCompressionLevel:level];
+        return;
+    }
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256_Final(digest, &context);
+
+    request.HTTPBodyStream = [[AWSGZIPInputStream alloc] initWithData:body compressionLevel:level];
+    [request setValue:[NSString stringWithFormat:@"%llu", digestStream.totalBytesRead] forHTTPHeaderField:@"Content-Length"];
+    [AWSSignatureSignerUtility setPayloadHash:[NSData dataWithBytes:digest length:sizeof(digest)] forHTTPBodyStreamOfRequest:request];
+}
+
 - (AWSTask *)validateRequest:(NSURLRequest *)request {
     return [AWSTask taskWithResult:nil];
 
 }
 
+- (BOOL)isReadOnlyOperation {
+    return [AWSOperationPlan planForActionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON].isReadOnly;
+}
+
 @end
 
 @interface AWSXMLRequestSerializer()
@@ -176,30 +237,25 @@
                    parameters:(NSDictionary *)parameters {
     request.cachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
 
-    NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
+    NSError *validationError = nil;
+    if (![AWSValidation validateParameters:parameters
+                                actionName:self.actionName
+                     serviceDefinitionRule:self.serviceDefinitionJSON
+                                     error:&validationError]) {
+        return [AWSTask taskWithError:validationError];
+    }
+
+    AWSOperationPlan *plan = [AWSOperationPlan planForActionName:self.actionName
+                                           serviceDefinitionRule:self.serviceDefinitionJSON];
 
-    NSDictionary *actionHTTPRule = [anActionRules objectForKey:@"http"];
     //Construct HTTPMethod
-    NSString *ruleHTTPMethod = [actionHTTPRule objectForKey:@"method"];
-    if ([ruleHTTPMethod length] > 0) {
-        request.HTTPMethod = ruleHTTPMethod;
+    if ([plan.HTTPMethod length] > 0) {
+        request.HTTPMethod = plan.HTTPMethod;
     }
 
     //Construct URI and Headers and HTTPBodyStream
-    NSString *ruleURIStr = [actionHTTPRule objectForKey:@"requestUri"];
-    NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
-
-    NSDictionary *actionEndpoint = [anActionRules objectForKey:@"endpoint"];
-    NSString *endpointHostPrefix = [actionEndpoint objectForKey:@"hostPrefix"];
-    
     NSError *error = nil;
-    [AWSXMLRequestSerializer constructURIandHeadersAndBody:request
-                                                     rules:inputRules
-                                                parameters:parameters
-                                                 uriSchema:ruleURIStr
-                                                hostPrefix:endpointHostPrefix
-                                                     error:&error];
+    [plan bindParameters:parameters toRequest:request error:&error];
 
     if (!error) {
         //construct HTTPBody only if HTTPBodyStream is nil
@@ -240,228 +296,10 @@
                             uriSchema:(NSString *)uriSchema
                            hostPrefix:(NSString *)hostPrefix
                                 error:(NSError *__autoreleasing *)error {
-    //If no rule just return
-    if (rules == (id)[NSNull null] ||  [rules count] == 0) {
-        return YES;
-    }
-
-    NSMutableDictionary *queryStringDictionary = [NSMutableDictionary new];
-
-    rules = rules[@"members"] ? rules[@"members"] : @{};
-
-    __block NSString *rawURI = uriSchema?uriSchema:@"";
-    __block BOOL isValid = YES;
-    __block NSError *blockErr = nil;
-    [rules enumerateKeysAndObjectsUsingBlock:^(NSString *memberName, id memberRules, BOOL *stop) {
-
-        NSString *xmlElementName = memberRules[@"locationName"]?memberRules[@"locationName"]:memberName;
-        id value = nil;
-        if (memberRules[@"locationName"]) {
-            value = params[memberRules[@"locationName"]];
-        }
-        if (!value) {
-            value = params[memberName];
-        }
-
-        if (value && value != [NSNull null] && [memberRules isKindOfClass:[NSDictionary class]]) {
-
-            NSString *rulesType = memberRules[@"type"];
-            NSString *valueStr = @"";
-
-            if ([rulesType isEqualToString:@"integer"] || [rulesType isEqualToString:@"long"] || [rulesType isEqualToString:@"float"] || [rulesType isEqualToString:@"double"]) {
-                if ([value isKindOfClass:[NSNumber class]]) {
-                    valueStr = [value stringValue];
-                }
-
-            } else if ([rulesType isEqualToString:@"boolean"]) {
-                if ([value isKindOfClass:[NSNumber class]]) {
-                    valueStr = [value boolValue]?@"true":@"false";
-                }
-            } else if ([rulesType isEqualToString:@"string"]) {
-                if ([value isKindOfClass:[NSString class]]) {
-                    valueStr = value;
-                }
-            } else if ([rulesType isEqualToString:@"timestamp"]) {
-                if ([value isKindOfClass:[NSNumber class]]) {
-                    //if it is for header, we should convert to RFC822 format
-                    if ([memberRules[@"location"] isEqualToString:@"header"]) {
-                        NSDate *timeStampDate = [NSDate dateWithTimeIntervalSince1970:[value doubleValue]];
-                        valueStr = [timeStampDate aws_stringValue:AWSDateRFC822DateFormat1];
-                    } else {
-                        valueStr = [value stringValue];
-                    }
-
-                } else if ([value isKindOfClass:[NSString class]]) {
-                    valueStr = value; //timestamp will be treated as string here.
-                }
-            } else {
-                valueStr = @"";
-            }
-
-            //If it is headers type, add to headers
-            if ([memberRules[@"location"] isEqualToString:@"header"]) {
-
-                [request addValue:valueStr forHTTPHeaderField:memberRules[@"locationName"]];
-            }
-
-            //if it is a map type with headers tag, add to headers
-            if ([value isKindOfClass:[NSDictionary class]] && [rulesType isEqualToString:@"map"] && [memberRules[@"location"] isEqualToString:@"headers"]) {
-                for (NSString *key in value) {
-                    NSString *keyName = [memberRules[@"locationName"] stringByAppendingString:key];
-                    [request addValue:value[key] forHTTPHeaderField:keyName];
-                }
-            }
-
-            //If it is uri type, construct uri
-            if ([memberRules[@"location"] isEqualToString:@"uri"]) {
-                NSString *keyToFind = [NSString stringWithFormat:@"{%@}", xmlElementName];
-                NSString *greedyKeyToFind = [NSString stringWithFormat:@"{%@+}", xmlElementName];
-
-                if ([rawURI rangeOfString:keyToFind].location != NSNotFound) {
-                    rawURI = [rawURI stringByReplacingOccurrencesOfString:keyToFind
-                                                               withString:[valueStr aws_stringWithURLEncoding]];
-
-                } else if ([rawURI rangeOfString:greedyKeyToFind].location != NSNotFound) {
-                    rawURI = [rawURI stringByReplacingOccurrencesOfString:greedyKeyToFind
-                                                               withString:[valueStr aws_stringWithURLEncodingPathWithoutPriorDecoding]];
-                }
-
-
-            }
-
-            //if it is queryString type, construct queryString
-            if ([memberRules[@"location"] isEqualToString:@"querystring"] &&
-                [rulesType isEqualToString:@"list"]) {
-                [queryStringDictionary setObject:value forKey:memberRules[@"locationName"]];
-            } else if ([memberRules[@"location"] isEqualToString:@"querystring"]) {
-                [queryStringDictionary setObject:valueStr forKey:memberRules[@"locationName"]];
-            }
-
-            //If it is "Body" Type and streaming Type, contructBody
-            if (([xmlElementName isEqualToString:@"Body"] || [xmlElementName isEqualToString:@"body"]) && [memberRules[@"streaming"] boolValue]) {
-                if ([value isKindOfClass:[NSURL class]]) {
-                    if ([value checkResourceIsReachableAndReturnError:&blockErr]) {
-                        request.HTTPBodyStream = [NSInputStream inputStreamWithURL:value];
-                    } else {
-                        //URL is not reachable, stop enumeration
-                        isValid = NO;
-                        *stop = YES;
-                    }
-                } else {
-                    if ([value isKindOfClass:[NSString class]]) {
-                        value = [value dataUsingEncoding:NSUTF8StringEncoding];
-                    }
-                    if ([value isKindOfClass:[NSData class]]) {
-                        request.HTTPBodyStream = [NSInputStream inputStreamWithData:value];
-                    }
-                }
-            }
-            
-            //if the shape is a blob stream then set the request stream
-            if([memberRules[@"shape"] isEqualToString:@"BlobStream"]){
-                AWSDDLogVerbose(@"value type = %@", [value class]);
-                if([value isKindOfClass:[NSInputStream class]]){
-                    request.HTTPBodyStream = value;
-                }else{
-                    if ([value isKindOfClass:[NSString class]]) {
-                        value = [value dataUsingEncoding:NSUTF8StringEncoding];
-                    }
-                    if ([value isKindOfClass:[NSData class]]) {
-                        request.HTTPBodyStream = [NSInputStream inputStreamWithData:value];
-                    }
-                }
-            }
-        }
-    }];
-
-    if (!isValid) {
-        if (error) {
-            *error = blockErr;
-            if (*error == nil) {
-                *error = [NSError errorWithDomain:AWSValidationErrorDomain code:AWSValidationUnknownError userInfo:[NSDictionary dictionaryWithObject:@"Unknown error happened while enumerating rules" forKey:NSLocalizedDescriptionKey]];
-            }
-        }
-        return NO;
-    }
-
-    BOOL uriSchemaContainsQuestionMark = NO;
-    NSRange hasQuestionMark = [uriSchema rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"?"]];
-    if (hasQuestionMark.location != NSNotFound) {
-        uriSchemaContainsQuestionMark = YES;
-    }
-
-    if ([queryStringDictionary count]) {
-        NSArray *myKeys = [queryStringDictionary allKeys];
-        NSArray *sortedKeys = [myKeys sortedArrayUsingSelector:@selector(caseInsensitiveCompare:)];
-        NSString *queryString = @"";
-        NSMutableArray *keyValuesToAppend = [@[] mutableCopy];
-        for (NSString *key in sortedKeys) {
-            if ([queryStringDictionary[key] isKindOfClass:[NSArray class]]) {
-                NSArray *listOfValues = (NSArray*)queryStringDictionary[key];
-                for (NSString *singleValue in listOfValues) {
-                    NSString *keyVal = [NSString stringWithFormat:@"%@=%@", [key aws_stringWithURLEncoding], [singleValue aws_stringWithURLEncoding]];
-                    [keyValuesToAppend addObject:keyVal];
-                }
-            } else {
-                NSString *keyVal = [NSString stringWithFormat:@"%@=%@", [key aws_stringWithURLEncoding], [queryStringDictionary[key] aws_stringWithURLEncoding]];
-                [keyValuesToAppend addObject:keyVal];
-            }
-        }
-        
-        for (NSString *keyValue in keyValuesToAppend) {
-            if ([queryString length] == 0 && uriSchemaContainsQuestionMark == NO) {
-                queryString = [NSString stringWithFormat:@"?%@", keyValue];
-            } else {
-                NSString *appendString = [NSString stringWithFormat:@"&%@", keyValue];
-                queryString = [queryString stringByAppendingString:appendString];
-            }
-        }
-        
-        rawURI = [rawURI stringByAppendingString:queryString];
-    }
-
-    //removed unused query key
-    NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:@"\\{.*?\\}" options:NSRegularExpressionCaseInsensitive error:nil];
-    rawURI = [regex stringByReplacingMatchesInString:rawURI options:0 range:NSMakeRange(0, [rawURI length]) withTemplate:@""];
-
-    //prepend the hostPrefix
-    if (hostPrefix.length) {
-        NSURLComponents *urlComponents = [[NSURLComponents alloc] initWithURL:request.URL resolvingAgainstBaseURL:NO];
-        NSString* finalHost = [hostPrefix stringByAppendingString:request.URL.host];
-        [urlComponents setHost:finalHost];
-        request.URL = urlComponents.URL;
-    }
-    
-    //validate URL
-    NSRange r = [rawURI rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"{}"]];
-    if (r.location != NSNotFound) {
-        if (error) {
-            *error = [NSError errorWithDomain:AWSValidationErrorDomain code:AWSValidationURIIsInvalid userInfo:[NSDictionary dictionaryWithObject:[NSString stringWithFormat:@"the constructed request queryString is invalid:%@",rawURI] forKey:NSLocalizedDescriptionKey]];
-        }
-        request.URL = [NSURL URLWithString:[NSString stringWithFormat:@"%@/", request.URL]];
-
-        return NO;
-    } else {
-        // fix query string
-        // @"?location" -> @"?location="
-
-        NSRange hasQuestionMark = [rawURI rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"?"]];
-        NSRange hasEqualMark = [rawURI rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"="]];
-        if ((hasQuestionMark.location != NSNotFound) && (hasEqualMark.location == NSNotFound)) {
-            rawURI = [rawURI stringByAppendingString:@"="];
-        }
-
-        NSString *finalURL = [NSString stringWithFormat:@"%@%@", request.URL,rawURI];
-        request.URL = [NSURL URLWithString:finalURL];
-        if (!request.URL) {
-            if (error) {
-                *error = [NSError errorWithDomain:AWSValidationErrorDomain code:AWSValidationURIIsInvalid userInfo:[NSDictionary dictionaryWithObject:[NSString stringWithFormat:@"unable the assigned URL to request, URL may be invalid:%@",finalURL] forKey:NSLocalizedDescriptionKey]];
-            }
-            return NO;
-        }
-
-        return YES;
-    }
+    AWSOperationPlan *plan = [[AWSOperationPlan alloc] initWithInputRules:rules
+                                                                uriSchema:uriSchema
+                                                               hostPrefix:hostPrefix];
+    return [plan bindParameters:params toRequest:request error:error];
 }
 
 @end
@@ -472,6 +310,11 @@
 @property (nonatomic, strong) NSDictionary *serviceDefinitionJSON;
 @property (nonatomic, strong) NSString *actionName;
 
+- (BOOL)writeFormBodyOfRequest:(NSMutableURLRequest *)request
+                    parameters:(NSDictionary *)parameters
+                  usesEC2Rules:(BOOL)usesEC2Rules
+                         error:(NSError *__autoreleasing *)error;
+
 @end
 
 @implementation AWSQueryStringRequestSerializer
@@ -523,6 +366,24 @@
 
 }
 
+// Writes the body with AWSQueryBodyWriter, and records its digest for the signer. Returns NO, without an error, if the
+// param builder has to build the body instead.
+- (BOOL)writeFormBodyOfRequest:(NSMutableURLRequest *)request
+                    parameters:(NSDictionary *)parameters
+                  usesEC2Rules:(BOOL)usesEC2Rules
+                         error:(NSError *__autoreleasing *)error {
+    AWSOperationPlan *plan = [AWSOperationPlan planForActionName:self.actionName
+                                           serviceDefinitionRule:self.serviceDefinitionJSON];
+    NSData *payloadSHA256 = nil;
+    NSData *body = [plan formBodyForParameters:parameters usesEC2Rules:usesEC2Rules payloadSHA256:&payloadSHA256 error:error];
+    if (!body) {
+        return NO;
+    }
+    request.HTTPBody = body;
+    [AWSSignatureSignerUtility setPayloadHash:payloadSHA256 forHTTPBody:request.HTTPBody ofRequest:request];
+    return YES;
+}
+
 - (AWSTask *)serializeRequest:(NSMutableURLRequest *)request
                       headers:(NSDictionary *)headers
                    parameters:(NSDictionary *)parameters {
@@ -533,20 +394,34 @@
         [parameters setValue:obj forKey:key];
     }];
 
-    //Need to add version and actionName
-    NSError *error = nil;
-    NSDictionary *formattedParams = [AWSQueryParamBuilder buildFormattedParams:parameters
-                                                                    actionName:self.actionName
-                                                         serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
-    if (error) {
-        return [AWSTask taskWithError:error];
+    NSError *validationError = nil;
+    if (![AWSValidation validateParameters:parameters
+                                actionName:self.actionName
+                     serviceDefinitionRule:self.serviceDefinitionJSON
+                                     error:&validationError]) {
+        return [AWSTask taskWithError:validationError];
     }
 
-    NSMutableString *queryString = [NSMutableString new];
-    [self processParameters:formattedParams queryString:queryString];
+    NSError *error = nil;
+    if (![self writeFormBodyOfRequest:request parameters:parameters usesEC2Rules:NO error:&error]) {
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
+
+        //Need to add version and actionName
+        NSDictionary *formattedParams = [AWSQueryParamBuilder buildFormattedParams:parameters
+                                                                        actionName:self.actionName
+                                                             serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
+
+        NSMutableString *queryString = [NSMutableString new];
+        [self processParameters:formattedParams queryString:queryString];
 
-    if ([queryString length] > 0) {
-        request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        if ([queryString length] > 0) {
+            request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        }
     }
 
     //contruct additional headers
@@ -24,6 +24,13 @@
 @property (nonatomic, strong, readonly) NSString *actionName;
 @property (nonatomic, assign, readonly) Class outputClass;
 
+/**
+ When `YES`, the body of a successful response is decoded straight into an instance of `outputClass` in a single pass,
+ and the model is returned instead of a dictionary. Responses that cannot be decoded this way are returned as
+ dictionaries, as when `NO`. The default is `NO`.
+ */
+@property (nonatomic, assign) BOOL decodesModels;
+
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName
                            outputClass:(Class)outputClass;
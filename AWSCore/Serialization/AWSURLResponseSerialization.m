@@ -19,6 +19,8 @@
 #import "AWSService.h"
 #import "AWSValidation.h"
 #import "AWSSerialization.h"
+#import "AWSJSONModelDecoder.h"
+#import "AWSOperationPlan.h"
 
 #pragma mark - Service errors
 
@@ -91,6 +93,13 @@
         return nil;
     }
 
+    if (self.decodesModels && self.outputClass && response.statusCode/100 == 2 && [data isKindOfClass:[NSData class]]) {
+        id model = [self modelForData:data response:response];
+        if (model) {
+            return model;
+        }
+    }
+
     id result = nil;
 
     //parse JSON data
@@ -98,10 +107,9 @@
 
     //Parse AWSServiceError
     if ([result isKindOfClass:[NSDictionary class]]) {
-        NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:_actionName];
-        NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-        AWSJSONDictionary *outputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
-        result = [AWSXMLResponseSerializer parseResponse:response rules:outputRules bodyDictionary:[result mutableCopy] error:error];
+        result = [result mutableCopy];
+        [[AWSOperationPlan planForActionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON] setResponseMembersOfResponse:response
+                                                                                                                             inDictionary:result];
 
         NSNumber *errorCode = [[AWSService errorCodeDictionary] objectForKey:[[[result objectForKey:@"__type"] componentsSeparatedByString:@"#"] lastObject]];
         if (errorCode != nil) {
@@ -123,6 +131,23 @@
     return YES;
 }
 
+- (id)modelForData:(NSData *)data response:(NSHTTPURLResponse *)response {
+    id JSONObject = [NSJSONSerialization JSONObjectWithData:data options:kNilOptions error:nil];
+    if (![JSONObject isKindOfClass:[NSDictionary class]]) {
+        return nil;
+    }
+
+    NSMutableDictionary *headerValues = [NSMutableDictionary new];
+    [[AWSOperationPlan planForActionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON] setResponseMembersOfResponse:response
+                                                                                                                         inDictionary:headerValues];
+
+    AWSJSONModelDecoder *decoder = [[AWSJSONModelDecoder alloc] initWithServiceDefinitionRule:self.serviceDefinitionJSON];
+    return [decoder modelOfClass:self.outputClass
+                      JSONObject:JSONObject
+                      actionName:self.actionName
+                additionalValues:headerValues];
+}
+
 @end
 
 @interface AWSXMLResponseSerializer()
@@ -164,67 +189,8 @@
                                  rules:(AWSJSONDictionary *)rules
                         bodyDictionary:(NSMutableDictionary *)bodyDictionary
                                  error:(NSError *__autoreleasing *)error {
-    NSDictionary *responseHeaders = [response allHeaderFields];
-
-    //If no rule just return
-    if (rules == (id)[NSNull null] ||  [rules count] == 0) {
-        return bodyDictionary;
-    }
-
-    rules = rules[@"members"] ? rules[@"members"] : @{};
-
-    [rules enumerateKeysAndObjectsUsingBlock:^(NSString *memberName, id memberRules, BOOL *stop) {
-        if ([memberRules isKindOfClass:[NSDictionary class]] && [memberRules[@"location"] isEqualToString:@"header"]) {
-            NSString *locationName = memberRules[@"locationName"]?memberRules[@"locationName"]:memberName;
-            if (locationName && responseHeaders[locationName]) {
-                NSString *rulesType = memberRules[@"type"];
-                if ([rulesType isEqualToString:@"integer"]) {
-                    bodyDictionary[memberName] = @([responseHeaders[locationName] integerValue]);
-                } else if ([rulesType isEqualToString:@"long"]) {
-                    bodyDictionary[memberName] = @([responseHeaders[locationName] longLongValue]);
-                } else if ([rulesType isEqualToString:@"float"]) {
-                    bodyDictionary[memberName] = @([responseHeaders[locationName] floatValue]);
-                } else if ([rulesType isEqualToString:@"double"]) {
-                    bodyDictionary[memberName] = @([responseHeaders[locationName] doubleValue]);
-                }else if ([rulesType isEqualToString:@"string"]) {
-                    bodyDictionary[memberName] = responseHeaders[locationName];
-                } else if ([rulesType isEqualToString:@"timestamp"]) {
-                    bodyDictionary[memberName] = responseHeaders[locationName];
-                }
-            }
-        }
-
-        //if the location may contain multiple headers if it is a map type
-        if ([memberRules isKindOfClass:[NSDictionary class]] && [memberRules[@"location"] isEqualToString:@"headers"] && [memberRules[@"type"] isEqualToString:@"map"]) {
-            NSString *locationName = memberRules[@"locationName"]?memberRules[@"locationName"]:@""; //if no locationName specified, match all headers.
-            if (locationName) {
-                NSPredicate *metaDatapredicate = [NSPredicate predicateWithFormat:@"SELF like[c] %@",[locationName stringByAppendingString:@"*"]]; //[c] means case insensitive
-                NSArray *matchedArray = [[responseHeaders allKeys] filteredArrayUsingPredicate:metaDatapredicate];
-                NSMutableDictionary *mapDic = [NSMutableDictionary new];
-                for (NSString *fullHeaderName in matchedArray) {
-                    NSString *extractedHeaderName = [fullHeaderName stringByReplacingOccurrencesOfString:locationName withString:@"" options:NSCaseInsensitiveSearch range:NSMakeRange(0, [fullHeaderName length])];
-                    if (extractedHeaderName) {
-                        mapDic[extractedHeaderName] = responseHeaders[fullHeaderName];
-                    }
-                }
-                if ([mapDic count] > 0 && memberName) {
-                    bodyDictionary[memberName] = mapDic;
-                }
-            }
-        }
-
-        //may also need to pass the response statusCode if the memberRule ask for it
-        if (memberName && [memberRules isKindOfClass:[NSDictionary class]] && [memberRules[@"location"] isEqualToString:@"statusCode"]) {
-            NSString *rulesType = memberRules[@"type"];
-            NSNumber *statusCode = @(response.statusCode);
-            if ([rulesType isEqualToString:@"integer"] || [rulesType isEqualToString:@"long"] || [rulesType isEqualToString:@"float"] || [rulesType isEqualToString:@"double"]) {
-                bodyDictionary[memberName] = statusCode;
-            } else if ([rulesType isEqualToString:@"string"]) {
-                bodyDictionary[memberName] = [statusCode stringValue];
-            }
-        }
-    }];
-
+    AWSOperationPlan *plan = [[AWSOperationPlan alloc] initWithOutputRules:rules];
+    [plan setResponseMembersOfResponse:response inDictionary:bodyDictionary];
     return bodyDictionary;
 }
 
@@ -250,10 +216,6 @@
         return nil;
     }
 
-    NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
-    NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *outputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
-
     NSMutableDictionary *resultDic = [NSMutableDictionary new];
 
     // There is a small edge case where S3 returns a 200 response for an error.
@@ -277,7 +239,9 @@
     }
 
     //parse response header
-    resultDic = [AWSXMLResponseSerializer parseResponse:response rules:outputRules bodyDictionary:resultDic error:error];
+    AWSOperationPlan *plan = [AWSOperationPlan planForActionName:self.actionName
+                                           serviceDefinitionRule:self.serviceDefinitionJSON];
+    [plan setResponseMembersOfResponse:response inDictionary:resultDic];
 
     //Parse AWSServiceError
     NSDictionary *errorInfo = resultDic[@"Error"];
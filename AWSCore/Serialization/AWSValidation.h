@@ -37,3 +37,32 @@ typedef NS_ENUM(NSInteger, AWSValidationErrorType) {
     AWSValidationHeaderAPIActionIsInvalid,
     AWSValidationURIIsInvalid
 };
+
+/**
+ Checks request parameters against the `required`, `min`, `max` and `pattern` constraints of the input shapes in a
+ service definition, before the request is serialized.
+
+ The constraints of an operation are compiled the first time it is validated and kept for the lifetime of the service
+ definition: regular expressions are compiled once, and members without constraints anywhere below them are never
+ visited.
+ */
+@interface AWSValidation : NSObject
+
+/**
+ Whether the request serializers validate parameters. Defaults to `NO`, in which case validation is skipped entirely
+ and the service reports invalid parameters instead. Apps can turn it on, e.g. in their debug builds, to catch invalid
+ parameters before a request is sent.
+ */
+@property (class, nonatomic, assign, getter=isRequestValidationEnabled) BOOL requestValidationEnabled;
+
+/**
+ Returns `NO` and sets `error`, in `AWSValidationErrorDomain`, if `parameters` do not satisfy the constraints of the
+ input of `actionName`. Parameters without constraints, and operations or shapes missing from the definition, are not
+ checked.
+ */
++ (BOOL)validateParameters:(NSDictionary *)parameters
+                actionName:(NSString *)actionName
+     serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                     error:(NSError *__autoreleasing *)error;
+
+@end
@@ -17,3 +17,413 @@
 #import "AWSCategory.h"
 
 NSString *const AWSValidationErrorDomain = @"com.amazonaws.AWSValidationErrorDomain";
+
+typedef NS_ENUM(NSInteger, AWSValidationShapeType) {
+    AWSValidationShapeTypeOther,
+    AWSValidationShapeTypeString,
+    AWSValidationShapeTypeNumber,
+    AWSValidationShapeTypeBlob,
+    AWSValidationShapeTypeStructure,
+    AWSValidationShapeTypeList,
+    AWSValidationShapeTypeMap,
+};
+
+@class AWSValidationShape;
+
+@interface AWSValidationMember : NSObject {
+@public
+    NSString *_name;
+    AWSValidationShape *_shape;
+}
+
+@end
+
+@implementation AWSValidationMember
+
+@end
+
+// The compiled constraints of a shape.
+@interface AWSValidationShape : NSObject {
+@public
+    AWSValidationShapeType _type;
+    BOOL _hasMinimum;
+    BOOL _hasMaximum;
+    double _minimum;
+    double _maximum;
+    // The pattern of the service definition, and the expression that matches whole values against it.
+    NSString *_patternString;
+    NSRegularExpression *_pattern;
+    NSArray<NSString *> *_requiredMemberNames;
+    // Only the members with constraints, on themselves or below them.
+    NSArray<AWSValidationMember *> *_members;
+    AWSValidationShape *_member;
+    AWSValidationShape *_key;
+    AWSValidationShape *_value;
+    BOOL _hasConstraints;
+    BOOL _compiling;
+}
+
+@end
+
+@implementation AWSValidationShape
+
+@end
+
+// The compiled operations of one service definition.
+@interface AWSServiceValidator : NSObject {
+@public
+    __weak NSDictionary *_serviceDefinitionRule;
+    NSMutableDictionary<NSString *, id> *_operations;
+    NSMutableDictionary<NSString *, AWSValidationShape *> *_shapes;
+    NSMutableDictionary<NSString *, id> *_patterns;
+}
+
+@end
+
+@implementation AWSServiceValidator
+
+@end
+
+static BOOL AWSRequestValidationEnabled = NO;
+
+@implementation AWSValidation
+
++ (BOOL)isRequestValidationEnabled {
+    return AWSRequestValidationEnabled;
+}
+
++ (void)setRequestValidationEnabled:(BOOL)requestValidationEnabled {
+    AWSRequestValidationEnabled = requestValidationEnabled;
+}
+
++ (BOOL)validateParameters:(NSDictionary *)parameters
+                actionName:(NSString *)actionName
+     serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
+                     error:(NSError *__autoreleasing *)error {
+    if (!AWSRequestValidationEnabled || actionName == nil || serviceDefinitionRule == nil) {
+        return YES;
+    }
+    AWSValidationShape *input = [self inputShapeForActionName:actionName serviceDefinitionRule:serviceDefinitionRule];
+    if (input == nil) {
+        return YES;
+    }
+
+    NSMutableArray<NSString *> *path = nil;
+    NSError *failure = [self failureForValue:parameters shape:input path:&path];
+    if (failure == nil) {
+        return YES;
+    }
+    if (error) {
+        NSString *parameterName = [path componentsJoinedByString:@""];
+        if ([parameterName hasPrefix:@"."]) {
+            parameterName = [parameterName substringFromIndex:1];
+        }
+        NSString *description = [NSString stringWithFormat:@"Invalid parameter %@ of %@: %@", parameterName, actionName, failure.localizedDescription];
+        *error = [NSError errorWithDomain:AWSValidationErrorDomain
+                                     code:failure.code
+                                 userInfo:@{NSLocalizedDescriptionKey : description}];
+    }
+    return NO;
+}
+
+#pragma mark - Compiling
+
++ (AWSValidationShape *)inputShapeForActionName:(NSString *)actionName serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    static NSMapTable<NSDictionary *, AWSServiceValidator *> *validators = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        validators = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality
+                                           valueOptions:NSPointerFunctionsStrongMemory];
+    });
+
+    AWSServiceValidator *validator = nil;
+    @synchronized(validators) {
+        validator = [validators objectForKey:serviceDefinitionRule];
+        if (validator == nil) {
+            validator = [AWSServiceValidator new];
+            validator->_serviceDefinitionRule = serviceDefinitionRule;
+            validator->_operations = [NSMutableDictionary new];
+            validator->_shapes = [NSMutableDictionary new];
+            validator->_patterns = [NSMutableDictionary new];
+            [validators setObject:validator forKey:serviceDefinitionRule];
+        }
+    }
+
+    @synchronized(validator) {
+        id input = validator->_operations[actionName];
+        if (input == nil) {
+            NSDictionary *inputRule = serviceDefinitionRule[@"operations"][actionName][@"input"];
+            input = [inputRule isKindOfClass:[NSDictionary class]] ? [self shapeForMemberRule:inputRule validator:validator] : nil;
+            if (input == nil || !((AWSValidationShape *)input)->_hasConstraints) {
+                input = [NSNull null];
+            }
+            validator->_operations[actionName] = input;
+        }
+        return input == [NSNull null] ? nil : input;
+    }
+}
+
+static BOOL AWSValidationNumber(id number, double *value) {
+    if (![number isKindOfClass:[NSNumber class]]) {
+        return NO;
+    }
+    *value = [number doubleValue];
+    return YES;
+}
+
+// Member references may carry constraints of their own; those members get a shape of their own.
++ (AWSValidationShape *)shapeForMemberRule:(NSDictionary *)memberRule validator:(AWSServiceValidator *)validator {
+    NSString *shapeName = memberRule[@"shape"];
+    NSDictionary *shapeRule = [shapeName isKindOfClass:[NSString class]] ? validator->_serviceDefinitionRule[@"shapes"][shapeName] : nil;
+    if (![shapeRule isKindOfClass:[NSDictionary class]]) {
+        return nil;
+    }
+    BOOL memberHasConstraints = memberRule[@"min"] || memberRule[@"max"] || memberRule[@"pattern"];
+    if (!memberHasConstraints) {
+        AWSValidationShape *shape = validator->_shapes[shapeName];
+        if (shape == nil) {
+            shape = [AWSValidationShape new];
+            // Registered before it is compiled, so that recursive shapes find it.
+            validator->_shapes[shapeName] = shape;
+            [self compileShape:shape shapeRule:shapeRule memberRule:nil validator:validator];
+        }
+        return shape;
+    }
+    AWSValidationShape *shape = [AWSValidationShape new];
+    [self compileShape:shape shapeRule:shapeRule memberRule:memberRule validator:validator];
+    return shape;
+}
+
++ (void)compileShape:(AWSValidationShape *)shape
+           shapeRule:(NSDictionary *)shapeRule
+          memberRule:(NSDictionary *)memberRule
+           validator:(AWSServiceValidator *)validator {
+    shape->_compiling = YES;
+
+    NSString *type = shapeRule[@"type"];
+    if ([type isEqualToString:@"string"]) {
+        shape->_type = AWSValidationShapeTypeString;
+    } else if ([type isEqualToString:@"integer"]
+               || [type isEqualToString:@"long"]
+               || [type isEqualToString:@"float"]
+               || [type isEqualToString:@"double"]) {
+        shape->_type = AWSValidationShapeTypeNumber;
+    } else if ([type isEqualToString:@"blob"]) {
+        shape->_type = AWSValidationShapeTypeBlob;
+    } else if ([type isEqualToString:@"structure"]) {
+        shape->_type = AWSValidationShapeTypeStructure;
+    } else if ([type isEqualToString:@"list"]) {
+        shape->_type = AWSValidationShapeTypeList;
+    } else if ([type isEqualToString:@"map"]) {
+        shape->_type = AWSValidationShapeTypeMap;
+    }
+
+    if (shape->_type != AWSValidationShapeTypeStructure && shape->_type != AWSValidationShapeTypeOther) {
+        shape->_hasMinimum = AWSValidationNumber(memberRule[@"min"] ?: shapeRule[@"min"], &shape->_minimum);
+        shape->_hasMaximum = AWSValidationNumber(memberRule[@"max"] ?: shapeRule[@"max"], &shape->_maximum);
+    }
+    if (shape->_type == AWSValidationShapeTypeString) {
+        NSString *pattern = memberRule[@"pattern"] ?: shapeRule[@"pattern"];
+        if ([pattern isKindOfClass:[NSString class]]) {
+            shape->_patternString = pattern;
+            shape->_pattern = [self regularExpressionForPattern:pattern validator:validator];
+        }
+    }
+    BOOL hasConstraints = shape->_hasMinimum || shape->_hasMaximum || shape->_pattern;
+
+    switch (shape->_type) {
+        case AWSValidationShapeTypeStructure: {
+            NSArray *required = shapeRule[@"required"];
+            if ([required isKindOfClass:[NSArray class]] && [required count] > 0) {
+                shape->_requiredMemberNames = required;
+                hasConstraints = YES;
+            }
+            NSMutableArray<AWSValidationMember *> *members = [NSMutableArray new];
+            NSDictionary *memberRules = shapeRule[@"members"];
+            if ([memberRules isKindOfClass:[NSDictionary class]]) {
+                for (NSString *name in memberRules) {
+                    AWSValidationShape *memberShape = [self shapeForMemberRule:memberRules[name] validator:validator];
+                    if (memberShape && (memberShape->_hasConstraints || memberShape->_compiling)) {
+                        AWSValidationMember *member = [AWSValidationMember new];
+                        member->_name = name;
+                        member->_shape = memberShape;
+                        [members addObject:member];
+                    }
+                }
+            }
+            shape->_members = [members count] > 0 ? members : nil;
+            hasConstraints = hasConstraints || shape->_members;
+            break;
+        }
+        case AWSValidationShapeTypeList:
+            shape->_member = [self constrainedShapeForMemberRule:shapeRule[@"member"] validator:validator];
+            hasConstraints = hasConstraints || shape->_member;
+            break;
+        case AWSValidationShapeTypeMap:
+            shape->_key = [self constrainedShapeForMemberRule:shapeRule[@"key"] validator:validator];
+            shape->_value = [self constrainedShapeForMemberRule:shapeRule[@"value"] validator:validator];
+            hasConstraints = hasConstraints || shape->_key || shape->_value;
+            break;
+        default:
+            break;
+    }
+
+    shape->_hasConstraints = hasConstraints;
+    shape->_compiling = NO;
+}
+
+// Returns the shape of a list member or map entry, or nil if nothing in it needs to be checked.
++ (AWSValidationShape *)constrainedShapeForMemberRule:(NSDictionary *)memberRule validator:(AWSServiceValidator *)validator {
+    if (![memberRule isKindOfClass:[NSDictionary class]]) {
+        return nil;
+    }
+    AWSValidationShape *shape = [self shapeForMemberRule:memberRule validator:validator];
+    return (shape && (shape->_hasConstraints || shape->_compiling)) ? shape : nil;
+}
+
++ (NSRegularExpression *)regularExpressionForPattern:(NSString *)pattern validator:(AWSServiceValidator *)validator {
+    id regularExpression = validator->_patterns[pattern];
+    if (regularExpression == nil) {
+        // Service patterns are written for Java and constrain the whole value, as String.matches does. One ICU cannot
+        // compile is not checked.
+        NSString *wholeValuePattern = [NSString stringWithFormat:@"\\A(?:%@)\\z", pattern];
+        regularExpression = [NSRegularExpression regularExpressionWithPattern:wholeValuePattern options:0 error:nil] ?: [NSNull null];
+        validator->_patterns[pattern] = regularExpression;
+    }
+    return regularExpression == [NSNull null] ? nil : regularExpression;
+}
+
+#pragma mark - Validating
+
+// The failure of one constraint. The parameter name is added to the description once it is known.
+static NSError *AWSValidationFailure(AWSValidationErrorType code, NSString *description) {
+    return [NSError errorWithDomain:AWSValidationErrorDomain code:code userInfo:@{NSLocalizedDescriptionKey : description}];
+}
+
+// Returns nil if the size is within the bounds of the shape.
+static NSError *AWSValidationSizeFailure(AWSValidationShape *shape, double size, NSString *measure) {
+    if (shape->_hasMinimum && size < shape->_minimum) {
+        return AWSValidationFailure(AWSValidationOutOfRangeParameter, [NSString stringWithFormat:@"%@ %g is less than %g", measure, size, shape->_minimum]);
+    }
+    if (shape->_hasMaximum && size > shape->_maximum) {
+        return AWSValidationFailure(AWSValidationOutOfRangeParameter, [NSString stringWithFormat:@"%@ %g is greater than %g", measure, size, shape->_maximum]);
+    }
+    return nil;
+}
+
+// Returns the first constraint `value` does not satisfy, or nil. On failure, `path` is set to the components leading
+// to the value. Values of an unexpected type are left to the serializer.
++ (NSError *)failureForValue:(id)value shape:(AWSValidationShape *)shape path:(NSMutableArray<NSString *> **)path {
+    switch (shape->_type) {
+        case AWSValidationShapeTypeString: {
+            if (![value isKindOfClass:[NSString class]]) {
+                return nil;
+            }
+            NSString *string = value;
+            if (shape->_hasMinimum || shape->_hasMaximum) {
+                // Lengths count characters, not UTF-16 code units. Counting is only needed near the bounds.
+                NSUInteger units = [string length];
+                BOOL withinBounds = (!shape->_hasMaximum || units <= shape->_maximum)
+                && (!shape->_hasMinimum || (units + 1) / 2 >= shape->_minimum);
+                if (!withinBounds) {
+                    NSUInteger characters = [string lengthOfBytesUsingEncoding:NSUTF32StringEncoding] / 4;
+                    NSError *failure = AWSValidationSizeFailure(shape, characters, @"length");
+                    if (failure) {
+                        return failure;
+                    }
+                }
+            }
+            if (shape->_pattern
+                && [shape->_pattern rangeOfFirstMatchInString:string options:0 range:NSMakeRange(0, [string length])].location == NSNotFound) {
+                return AWSValidationFailure(AWSValidationInvalidStringParameter,
+                                            [NSString stringWithFormat:@"does not match the pattern %@", shape->_patternString]);
+            }
+            return nil;
+        }
+        case AWSValidationShapeTypeNumber:
+            if (![value isKindOfClass:[NSNumber class]]) {
+                return nil;
+            }
+            return AWSValidationSizeFailure(shape, [value doubleValue], @"value");
+        case AWSValidationShapeTypeBlob:
+            if (![value isKindOfClass:[NSData class]]) {
+                return nil;
+            }
+            return AWSValidationSizeFailure(shape, [value length], @"length");
+        case AWSValidationShapeTypeStructure: {
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                return nil;
+            }
+            NSDictionary *structure = value;
+            for (NSString *name in shape->_requiredMemberNames) {
+                id memberValue = structure[name];
+                if (memberValue == nil || memberValue == [NSNull null]) {
+                    *path = [NSMutableArray arrayWithObject:[NSString stringWithFormat:@".%@", name]];
+                    return AWSValidationFailure(AWSValidationMissingRequiredParameter, @"is required");
+                }
+            }
+            for (AWSValidationMember *member in shape->_members) {
+                id memberValue = structure[member->_name];
+                if (memberValue == nil) {
+                    continue;
+                }
+                NSError *failure = [self failureForValue:memberValue shape:member->_shape path:path];
+                if (failure) {
+                    [self prependComponent:[NSString stringWithFormat:@".%@", member->_name] path:path];
+                    return failure;
+                }
+            }
+            return nil;
+        }
+        case AWSValidationShapeTypeList: {
+            if (![value isKindOfClass:[NSArray class]]) {
+                return nil;
+            }
+            NSError *failure = AWSValidationSizeFailure(shape, [value count], @"count");
+            if (failure || shape->_member == nil) {
+                return failure;
+            }
+            NSUInteger index = 0;
+            for (id memberValue in value) {
+                failure = [self failureForValue:memberValue shape:shape->_member path:path];
+                if (failure) {
+                    [self prependComponent:[NSString stringWithFormat:@"[%lu]", (unsigned long)index] path:path];
+                    return failure;
+                }
+                index++;
+            }
+            return nil;
+        }
+        case AWSValidationShapeTypeMap: {
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                return nil;
+            }
+            NSError *failure = AWSValidationSizeFailure(shape, [value count], @"count");
+            if (failure || (shape->_key == nil && shape->_value == nil)) {
+                return failure;
+            }
+            for (id key in value) {
+                failure = shape->_key ? [self failureForValue:key shape:shape->_key path:path] : nil;
+                if (failure == nil && shape->_value) {
+                    failure = [self failureForValue:value[key] shape:shape->_value path:path];
+                }
+                if (failure) {
+                    [self prependComponent:[NSString stringWithFormat:@"[%@]", key] path:path];
+                    return failure;
+                }
+            }
+            return nil;
+        }
+        case AWSValidationShapeTypeOther:
+            return nil;
+    }
+}
+
++ (void)prependComponent:(NSString *)component path:(NSMutableArray<NSString *> **)path {
+    if (*path == nil) {
+        *path = [NSMutableArray new];
+    }
+    [*path insertObject:component atIndex:0];
+}
+
+@end
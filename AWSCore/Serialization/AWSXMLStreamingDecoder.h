@@ -0,0 +1,62 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSSerialization.h"
+
+@class AWSXMLDictionaryParser;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Decodes an XML response into the dictionary `AWSXMLParser` returns, straight from `NSXMLParser` events.
+
+ The shape rules of the output are followed as elements start, so values are converted and placed as soon as their
+ element ends, without first building a dictionary of the whole document and walking it again. Each decoder decodes
+ one response.
+ */
+@interface AWSXMLStreamingDecoder : NSObject <NSXMLParserDelegate>
+
+- (instancetype)initWithActionName:(NSString *)actionName
+             serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+@property (nonatomic, copy, nullable) AWSXMLParserListMemberBlock listMemberHandler;
+
+/**
+ The parser `AWSXMLParser` builds document dictionaries with. When set, the parser events of an error response, or of
+ a document whose root element has no child elements, are forwarded to a copy of it while the response is decoded, and
+ `documentDictionary` is set instead of the response having to be parsed again.
+ */
+@property (nonatomic, strong, nullable) AWSXMLDictionaryParser *documentParser;
+
+/**
+ The document dictionary built by `documentParser` for a response `decodeData:error:` returned `nil` for.
+ */
+@property (nonatomic, strong, readonly, nullable) NSDictionary *documentDictionary;
+
+/**
+ Returns the decoded response, or `nil` if it has to be decoded from the document dictionary instead: error responses,
+ documents whose root element has no child elements, documents that are not well formed and responses that decode to
+ nothing. When a value does not match its shape, `error` is set and the members decoded so far are returned, as
+ `AWSXMLParser` does.
+
+ If the output is a streaming payload and `documentParser` is set, only the root element and its first child are read
+ to tell an error response from the payload, which is returned as it is under the payload member.
+ */
+- (nullable NSMutableDictionary *)decodeData:(NSData *)data error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,610 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSXMLStreamingDecoder.h"
+#import "AWSCocoaLumberjack.h"
+#import "AWSXMLDictionary.h"
+
+@interface AWSXMLParser (AWSXMLStreamingDecoder)
+
++ (NSString *)findKeyNameByXMLName:(NSString *)xmlName rules:(NSDictionary *)rules;
++ (id)parseMember:(id)values rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error;
+
+@end
+
+typedef NS_ENUM(NSInteger, AWSXMLStreamingFrameKind) {
+    AWSXMLStreamingFrameSkip, // An element without a rule, and everything in it.
+    AWSXMLStreamingFrameStructure,
+    AWSXMLStreamingFrameList, // A list element holding its members.
+    AWSXMLStreamingFrameMap, // A map element holding its entries, or its own key and value.
+    AWSXMLStreamingFrameMapEntry,
+    AWSXMLStreamingFrameScalar,
+};
+
+// Where the value of a frame goes when its element ends.
+typedef NS_ENUM(NSInteger, AWSXMLStreamingAttachment) {
+    AWSXMLStreamingAttachNone,
+    AWSXMLStreamingAttachMember, // parent[name] = value
+    AWSXMLStreamingAttachFlattenedListMember, // [parent[name] addObject:value]
+    AWSXMLStreamingAttachFlattenedMapEntry, // parent[name][key] = value
+    AWSXMLStreamingAttachListMember,
+    AWSXMLStreamingAttachMapEntry,
+    AWSXMLStreamingAttachMapKey,
+    AWSXMLStreamingAttachMapValue,
+    AWSXMLStreamingAttachResultWrapper,
+};
+
+#pragma mark - AWSXMLStreamingShape
+
+// The rules of one member, resolved once per response and shared by every element decoded with them.
+@interface AWSXMLStreamingShape : NSObject {
+@public
+    AWSJSONDictionary *_rules;
+    NSString *_type;
+    NSDictionary *_members;
+    BOOL _flattened;
+    NSString *_memberXMLName;
+    NSString *_keyXMLName;
+    NSString *_valueXMLName;
+}
+
+- (instancetype)initWithRules:(AWSJSONDictionary *)rules;
+- (instancetype)initWithMembers:(NSDictionary *)members;
+
+@end
+
+// A structure member matched by its XML name.
+@interface AWSXMLStreamingMember : NSObject {
+@public
+    NSString *_name;
+    AWSXMLStreamingShape *_shape;
+}
+
+@end
+
+@implementation AWSXMLStreamingMember
+
+@end
+
+@implementation AWSXMLStreamingShape {
+    NSMutableDictionary<NSString *, id> *_membersByXMLName;
+    AWSXMLStreamingShape *_memberShape;
+    AWSXMLStreamingShape *_keyShape;
+    AWSXMLStreamingShape *_valueShape;
+}
+
+- (instancetype)initWithRules:(AWSJSONDictionary *)rules {
+    if (self = [super init]) {
+        _rules = rules;
+        _type = rules[@"type"];
+        if ([_type isEqualToString:@"structure"]) {
+            _members = rules[@"members"] ?: @{};
+        } else if ([_type isEqualToString:@"list"]) {
+            _flattened = [rules[@"flattened"] boolValue];
+            _memberXMLName = rules[@"member"][@"locationName"] ?: @"member";
+        } else if ([_type isEqualToString:@"map"]) {
+            _flattened = [rules[@"flattened"] boolValue];
+            _keyXMLName = rules[@"key"][@"locationName"] ?: @"key";
+            _valueXMLName = rules[@"value"][@"locationName"] ?: @"value";
+        }
+    }
+    return self;
+}
+
+- (instancetype)initWithMembers:(NSDictionary *)members {
+    if (self = [super init]) {
+        _type = @"structure";
+        _members = members ?: @{};
+    }
+    return self;
+}
+
+- (AWSXMLStreamingMember *)memberForXMLName:(NSString *)xmlName {
+    id member = _membersByXMLName[xmlName];
+    if (member == nil) {
+        NSString *keyName = [AWSXMLParser findKeyNameByXMLName:xmlName rules:_members];
+        if (keyName) {
+            AWSJSONDictionary *rule = _members[keyName];
+            AWSXMLStreamingMember *structureMember = [AWSXMLStreamingMember new];
+            structureMember->_name = rule[@"name"] ?: keyName;
+            structureMember->_shape = [[AWSXMLStreamingShape alloc] initWithRules:rule];
+            member = structureMember;
+        } else {
+            member = [NSNull null];
+        }
+        if (_membersByXMLName == nil) {
+            _membersByXMLName = [NSMutableDictionary new];
+        }
+        _membersByXMLName[xmlName] = member;
+    }
+    return member == [NSNull null] ? nil : member;
+}
+
+// Created on first use, since shapes can be recursive.
+- (AWSXMLStreamingShape *)memberShape {
+    if (_memberShape == nil) {
+        _memberShape = [[AWSXMLStreamingShape alloc] initWithRules:_rules[@"member"] ?: @{}];
+    }
+    return _memberShape;
+}
+
+- (AWSXMLStreamingShape *)keyShape {
+    if (_keyShape == nil) {
+        _keyShape = [[AWSXMLStreamingShape alloc] initWithRules:_rules[@"key"] ?: @{}];
+    }
+    return _keyShape;
+}
+
+- (AWSXMLStreamingShape *)valueShape {
+    if (_valueShape == nil) {
+        _valueShape = [[AWSXMLStreamingShape alloc] initWithRules:_rules[@"value"] ?: @{}];
+    }
+    return _valueShape;
+}
+
+@end
+
+#pragma mark - AWSXMLStreamingFrame
+
+// An open element.
+@interface AWSXMLStreamingFrame : NSObject {
+@public
+    AWSXMLStreamingFrameKind _kind;
+    AWSXMLStreamingAttachment _attachment;
+    AWSXMLStreamingShape *_shape;
+    NSString *_name;
+    id _value;
+    NSMutableString *_text;
+    id _entryKey;
+    id _entryValue;
+    // Lists directly in this structure, or this list, hold members of the decoded output.
+    BOOL _output;
+    BOOL _hasChildElements;
+}
+
+@end
+
+@implementation AWSXMLStreamingFrame
+
+@end
+
+#pragma mark - AWSXMLStreamingDecoder
+
+@implementation AWSXMLStreamingDecoder {
+    NSString *_actionName;
+    NSDictionary *_serviceDefinitionRule;
+    AWSXMLStreamingShape *_outputShape;
+    NSString *_payloadName;
+    NSString *_resultWrapper;
+    NSString *_defaultResultWrapper;
+    NSMutableArray<AWSXMLStreamingFrame *> *_stack;
+    NSMutableDictionary *_rootValue;
+    NSMutableDictionary<NSString *, id> *_resultWrapperValues;
+    NSUInteger _handledMemberCount;
+    BOOL _fallBack;
+    NSError *_error;
+    // Set for a streaming payload, where only an error response is decoded.
+    BOOL _streamingPayload;
+    // The root element and its text up to its first child, replayed to the document parser.
+    NSString *_rootElementName;
+    NSDictionary<NSString *, NSString *> *_rootAttributes;
+    NSMutableString *_rootText;
+    // The copy of the document parser that events are forwarded to.
+    AWSXMLDictionaryParser *_forwardingParser;
+}
+
+- (instancetype)initWithActionName:(NSString *)actionName
+             serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    if (self = [super init]) {
+        _actionName = actionName;
+        _serviceDefinitionRule = serviceDefinitionRule;
+    }
+    return self;
+}
+
+- (NSMutableDictionary *)decodeData:(NSData *)data error:(NSError *__autoreleasing *)error {
+    NSDictionary *actionRule = [[[_serviceDefinitionRule objectForKey:@"operations"] objectForKey:_actionName] objectForKey:@"output"];
+    if (actionRule == (id)[NSNull null] || actionRule == nil) {
+        actionRule = @{};
+    }
+    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule
+                                                          JSONDefinitionRule:[_serviceDefinitionRule objectForKey:@"shapes"]];
+    NSDictionary *members = rules[@"members"] ?: @{};
+    _payloadName = rules[@"payload"];
+    if (_payloadName) {
+        AWSJSONDictionary *payloadRules = members[_payloadName];
+        if (payloadRules[@"streaming"] && self.documentParser) {
+            _streamingPayload = YES;
+            members = @{};
+        } else if (payloadRules[@"streaming"] || payloadRules[@"members"] == nil) {
+            return nil;
+        } else {
+            members = payloadRules[@"members"];
+        }
+    }
+    _outputShape = [[AWSXMLStreamingShape alloc] initWithMembers:members];
+
+    NSDictionary *metadata = _serviceDefinitionRule[@"metadata"];
+    NSString *protocol = metadata[@"type"] ?: metadata[@"protocol"];
+    NSNumber *resultWrapped = metadata[@"resultWrapped"];
+    if ([protocol isEqualToString:@"query"] && !(resultWrapped && ![resultWrapped boolValue])) {
+        _resultWrapper = rules[@"resultWrapper"];
+        _defaultResultWrapper = [_actionName stringByAppendingString:@"Result"];
+        _resultWrapperValues = [NSMutableDictionary new];
+    }
+
+    _stack = [NSMutableArray new];
+    _rootValue = [NSMutableDictionary new];
+    NSXMLParser *parser = [[NSXMLParser alloc] initWithData:data];
+    parser.delegate = self;
+    BOOL parsed = [parser parse];
+    if (_forwardingParser) {
+        _documentDictionary = [_forwardingParser dictionaryWithForwardedEvents];
+        _forwardingParser = nil;
+        return nil;
+    }
+    if (_streamingPayload) {
+        return [NSMutableDictionary dictionaryWithObject:data forKey:_payloadName];
+    }
+    if (_fallBack || (!parsed && _error == nil)) {
+        return nil;
+    }
+
+    // The same choice AWSXMLParser makes when it unwraps query results.
+    NSMutableDictionary *result = _rootValue;
+    if (_resultWrapper && _resultWrapperValues[_resultWrapper]) {
+        result = _resultWrapperValues[_resultWrapper];
+    } else if (_defaultResultWrapper && _resultWrapperValues[_defaultResultWrapper]) {
+        result = _resultWrapperValues[_defaultResultWrapper];
+    }
+    if (_payloadName) {
+        result = [NSMutableDictionary dictionaryWithObject:result forKey:_payloadName];
+    }
+
+    if (_error) {
+        if (error) {
+            *error = _error;
+        }
+    } else if ([result count] == 0 && _handledMemberCount == 0) {
+        return nil;
+    }
+    return result;
+}
+
+- (void)fallBackWithParser:(NSXMLParser *)parser {
+    _fallBack = YES;
+    [parser abortParsing];
+}
+
+// Sends the document parser the events of the root element seen so far. Returns NO if there is no document parser.
+- (BOOL)forwardRootElementWithParser:(NSXMLParser *)parser {
+    if (self.documentParser == nil) {
+        return NO;
+    }
+    _forwardingParser = [self.documentParser copy];
+    [_forwardingParser parser:parser didStartElement:_rootElementName namespaceURI:nil qualifiedName:nil attributes:_rootAttributes];
+    if (_rootText) {
+        [_forwardingParser parser:parser foundCharacters:_rootText];
+    }
+    return YES;
+}
+
+#pragma mark - NSXMLParserDelegate
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName attributes:(NSDictionary<NSString *, NSString *> *)attributeDict {
+    if (_forwardingParser) {
+        [_forwardingParser parser:parser didStartElement:elementName namespaceURI:namespaceURI qualifiedName:qName attributes:attributeDict];
+        return;
+    }
+    if (_fallBack || _error) {
+        return;
+    }
+
+    AWSXMLStreamingFrame *parent = [_stack lastObject];
+    if (parent == nil) {
+        _rootElementName = elementName;
+        _rootAttributes = attributeDict;
+        if ([elementName isEqualToString:@"Error"]) {
+            // An S3 error response.
+            if ([self forwardRootElementWithParser:parser]) {
+                return;
+            }
+            [self fallBackWithParser:parser];
+            return;
+        }
+        AWSXMLStreamingFrame *root = [AWSXMLStreamingFrame new];
+        root->_kind = AWSXMLStreamingFrameStructure;
+        root->_shape = _outputShape;
+        root->_value = _rootValue;
+        root->_output = YES;
+        [_stack addObject:root];
+        return;
+    }
+    BOOL isFirstChild = !parent->_hasChildElements;
+    parent->_hasChildElements = YES;
+
+    if ([_stack count] == 1) {
+        if ([elementName isEqualToString:@"Errors"] || [elementName isEqualToString:@"Error"]) {
+            // Error responses of the query and EC2 protocols. Members decoded before the error element can not be
+            // replayed, so such documents are parsed again.
+            if (isFirstChild && [self forwardRootElementWithParser:parser]) {
+                [_forwardingParser parser:parser didStartElement:elementName namespaceURI:namespaceURI qualifiedName:qName attributes:attributeDict];
+                return;
+            }
+            [self fallBackWithParser:parser];
+            return;
+        }
+        if (_streamingPayload) {
+            // The root element is not an error response, so the data is the payload.
+            [parser abortParsing];
+            return;
+        }
+        if ([elementName isEqualToString:_resultWrapper] || [elementName isEqualToString:_defaultResultWrapper]) {
+            AWSXMLStreamingFrame *frame = [AWSXMLStreamingFrame new];
+            frame->_kind = AWSXMLStreamingFrameStructure;
+            frame->_attachment = AWSXMLStreamingAttachResultWrapper;
+            frame->_shape = _outputShape;
+            frame->_name = elementName;
+            frame->_value = [NSMutableDictionary new];
+            frame->_output = YES;
+            [_stack addObject:frame];
+            return;
+        }
+    }
+
+    [_stack addObject:[self frameForElement:elementName parent:parent]];
+}
+
+- (AWSXMLStreamingFrame *)frameForElement:(NSString *)elementName parent:(AWSXMLStreamingFrame *)parent {
+    switch (parent->_kind) {
+        case AWSXMLStreamingFrameStructure: {
+            AWSXMLStreamingMember *member = [parent->_shape memberForXMLName:elementName];
+            if (member == nil) {
+                if (![elementName isEqualToString:@"requestId"]
+                    && ![elementName isEqualToString:@"ResponseMetadata"]) {
+                    AWSDDLogWarn(@"Response element ignored: no rule for %@", elementName);
+                }
+                return [self skipFrame];
+            }
+
+            AWSXMLStreamingShape *shape = member->_shape;
+            AWSXMLStreamingFrame *frame = nil;
+            if (shape->_flattened && [shape->_type isEqualToString:@"list"]) {
+                // Every occurrence of the element is a member of the list.
+                frame = [self frameForShape:[shape memberShape] attachment:AWSXMLStreamingAttachFlattenedListMember];
+            } else if (shape->_flattened && [shape->_type isEqualToString:@"map"]) {
+                // Every occurrence of the element is an entry of the map.
+                frame = [self frameForShape:shape attachment:AWSXMLStreamingAttachFlattenedMapEntry];
+                frame->_kind = AWSXMLStreamingFrameMapEntry;
+                frame->_value = nil;
+            } else {
+                frame = [self frameForShape:shape attachment:AWSXMLStreamingAttachMember];
+            }
+            frame->_name = member->_name;
+            frame->_output = parent->_output && frame->_kind == AWSXMLStreamingFrameList;
+            return frame;
+        }
+        case AWSXMLStreamingFrameList:
+            if ([elementName isEqualToString:parent->_shape->_memberXMLName]) {
+                return [self frameForShape:[parent->_shape memberShape] attachment:AWSXMLStreamingAttachListMember];
+            }
+            return [self skipFrame];
+        case AWSXMLStreamingFrameMap:
+        case AWSXMLStreamingFrameMapEntry:
+            if (parent->_kind == AWSXMLStreamingFrameMap && [elementName isEqualToString:@"entry"]) {
+                AWSXMLStreamingFrame *frame = [self frameForShape:parent->_shape attachment:AWSXMLStreamingAttachMapEntry];
+                frame->_kind = AWSXMLStreamingFrameMapEntry;
+                frame->_value = nil;
+                return frame;
+            }
+            if ([elementName isEqualToString:parent->_shape->_keyXMLName]) {
+                return [self frameForShape:[parent->_shape keyShape] attachment:AWSXMLStreamingAttachMapKey];
+            }
+            if ([elementName isEqualToString:parent->_shape->_valueXMLName]) {
+                return [self frameForShape:[parent->_shape valueShape] attachment:AWSXMLStreamingAttachMapValue];
+            }
+            return [self skipFrame];
+        case AWSXMLStreamingFrameSkip:
+        case AWSXMLStreamingFrameScalar:
+            return [self skipFrame];
+    }
+    return [self skipFrame];
+}
+
+- (AWSXMLStreamingFrame *)frameForShape:(AWSXMLStreamingShape *)shape attachment:(AWSXMLStreamingAttachment)attachment {
+    AWSXMLStreamingFrame *frame = [AWSXMLStreamingFrame new];
+    frame->_shape = shape;
+    frame->_attachment = attachment;
+    if ([shape->_type isEqualToString:@"structure"]) {
+        frame->_kind = AWSXMLStreamingFrameStructure;
+        frame->_value = [NSMutableDictionary new];
+    } else if ([shape->_type isEqualToString:@"list"]) {
+        frame->_kind = AWSXMLStreamingFrameList;
+        frame->_value = [NSMutableArray new];
+    } else if ([shape->_type isEqualToString:@"map"]) {
+        frame->_kind = AWSXMLStreamingFrameMap;
+        frame->_value = [NSMutableDictionary new];
+    } else {
+        frame->_kind = AWSXMLStreamingFrameScalar;
+    }
+    return frame;
+}
+
+- (AWSXMLStreamingFrame *)skipFrame {
+    AWSXMLStreamingFrame *frame = [AWSXMLStreamingFrame new];
+    frame->_kind = AWSXMLStreamingFrameSkip;
+    return frame;
+}
+
+- (void)parser:(NSXMLParser *)parser foundCharacters:(NSString *)string {
+    if (_forwardingParser) {
+        [_forwardingParser parser:parser foundCharacters:string];
+        return;
+    }
+    AWSXMLStreamingFrame *frame = [_stack lastObject];
+    if (self.documentParser && [_stack count] == 1 && !frame->_hasChildElements) {
+        if (_rootText) {
+            [_rootText appendString:string];
+        } else {
+            _rootText = [NSMutableString stringWithString:string];
+        }
+        return;
+    }
+    if (frame && frame->_kind == AWSXMLStreamingFrameScalar) {
+        if (frame->_text) {
+            [frame->_text appendString:string];
+        } else {
+            frame->_text = [NSMutableString stringWithString:string];
+        }
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser foundCDATA:(NSData *)CDATABlock {
+    if (_forwardingParser) {
+        [_forwardingParser parser:parser foundCDATA:CDATABlock];
+        return;
+    }
+    NSString *string = [[NSString alloc] initWithData:CDATABlock encoding:NSUTF8StringEncoding];
+    if (string) {
+        [self parser:parser foundCharacters:string];
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser didEndElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName {
+    if (_forwardingParser) {
+        [_forwardingParser parser:parser didEndElement:elementName namespaceURI:namespaceURI qualifiedName:qName];
+        return;
+    }
+    if (_fallBack || _error) {
+        return;
+    }
+
+    AWSXMLStreamingFrame *frame = [_stack lastObject];
+    [_stack removeLastObject];
+    AWSXMLStreamingFrame *parent = [_stack lastObject];
+    if (parent == nil) {
+        // An empty root element, or one holding only text, is itself a member of the output, which AWSXMLParser
+        // decodes from the document dictionary.
+        if (!frame->_hasChildElements && !_streamingPayload) {
+            if ([self forwardRootElementWithParser:parser]) {
+                [_forwardingParser parser:parser didEndElement:elementName namespaceURI:namespaceURI qualifiedName:qName];
+                return;
+            }
+            [self fallBackWithParser:parser];
+        }
+        return;
+    }
+
+    NSError *error = nil;
+    id value = [self valueOfFrame:frame error:&error];
+    if (error) {
+        _error = error;
+        [parser abortParsing];
+        return;
+    }
+    [self attachValue:value ofFrame:frame toParent:parent];
+}
+
+- (id)valueOfFrame:(AWSXMLStreamingFrame *)frame error:(NSError *__autoreleasing *)error {
+    switch (frame->_kind) {
+        case AWSXMLStreamingFrameSkip:
+            return nil;
+        case AWSXMLStreamingFrameScalar:
+            if (frame->_attachment == AWSXMLStreamingAttachMapKey) {
+                // Map keys are used as they appear in the document.
+                return frame->_text ?: @"";
+            }
+            // An empty element is an empty dictionary in the document dictionary; the conversion rejects it the same way.
+            return [AWSXMLParser parseMember:frame->_text ?: [NSMutableDictionary new] rules:frame->_shape->_rules error:error];
+        case AWSXMLStreamingFrameMap:
+            if (frame->_entryKey) {
+                frame->_value[frame->_entryKey] = [self entryValueOfFrame:frame error:error];
+            }
+            return frame->_value;
+        case AWSXMLStreamingFrameMapEntry:
+            return frame->_entryKey ? [self entryValueOfFrame:frame error:error] : nil;
+        case AWSXMLStreamingFrameStructure:
+        case AWSXMLStreamingFrameList:
+            return frame->_value;
+    }
+    return nil;
+}
+
+- (id)entryValueOfFrame:(AWSXMLStreamingFrame *)frame error:(NSError *__autoreleasing *)error {
+    return frame->_entryValue ?: [AWSXMLParser parseMember:nil rules:[frame->_shape valueShape]->_rules error:error];
+}
+
+- (void)attachValue:(id)value ofFrame:(AWSXMLStreamingFrame *)frame toParent:(AWSXMLStreamingFrame *)parent {
+    if (value == nil) {
+        return;
+    }
+
+    switch (frame->_attachment) {
+        case AWSXMLStreamingAttachNone:
+            break;
+        case AWSXMLStreamingAttachMember:
+            parent->_value[frame->_name] = value;
+            break;
+        case AWSXMLStreamingAttachResultWrapper:
+            _resultWrapperValues[frame->_name] = value;
+            break;
+        case AWSXMLStreamingAttachFlattenedListMember: {
+            if (parent->_output && [self handleListMember:value name:frame->_name]) {
+                break;
+            }
+            NSMutableArray *list = parent->_value[frame->_name];
+            if (list == nil) {
+                list = [NSMutableArray new];
+                parent->_value[frame->_name] = list;
+            }
+            [list addObject:value];
+            break;
+        }
+        case AWSXMLStreamingAttachListMember:
+            if (parent->_output && [self handleListMember:value name:parent->_name]) {
+                break;
+            }
+            [parent->_value addObject:value];
+            break;
+        case AWSXMLStreamingAttachFlattenedMapEntry: {
+            NSMutableDictionary *map = parent->_value[frame->_name];
+            if (map == nil) {
+                map = [NSMutableDictionary new];
+                parent->_value[frame->_name] = map;
+            }
+            map[frame->_entryKey] = value;
+            break;
+        }
+        case AWSXMLStreamingAttachMapEntry:
+            parent->_value[frame->_entryKey] = value;
+            break;
+        case AWSXMLStreamingAttachMapKey:
+            parent->_entryKey = value;
+            break;
+        case AWSXMLStreamingAttachMapValue:
+            parent->_entryValue = value;
+            break;
+    }
+}
+
+- (BOOL)handleListMember:(id)member name:(NSString *)name {
+    if (self.listMemberHandler == nil) {
+        return NO;
+    }
+    _handledMemberCount++;
+    return self.listMemberHandler(name, member);
+}
+
+@end
@@ -0,0 +1,153 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSNetworking.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+FOUNDATION_EXPORT NSString *const AWSPaginatorErrorDomain;
+
+typedef NS_ENUM(NSInteger, AWSPaginatorErrorType) {
+    AWSPaginatorErrorUnknown,
+    AWSPaginatorErrorCancelled,
+    AWSPaginatorErrorRepeatedToken,
+    AWSPaginatorErrorMissingToken,
+};
+
+/**
+ Iterates over the pages of a paginated operation, such as `ListObjectsV2`, `Scan` or `DescribeInstances`, and fetches
+ the next pages while the caller is still processing the current one.
+
+ A paginator copies the request once, and loads every page with that copy: the token returned by a page is set on the
+ copy before the next page is requested, so page requests are always sent one at a time and in order. The number of
+ pages fetched ahead of the caller is bounded by `lookaheadDepth` and, optionally, by `maximumBufferedCost`.
+
+     AWSPaginator<AWSS3ListObjectsV2Request *, AWSS3ListObjectsV2Output *> *paginator =
+         [[AWSPaginator alloc] initWithRequest:request
+                                 responseClass:[AWSS3ListObjectsV2Output class]
+                                    pageLoader:^AWSTask *(AWSS3ListObjectsV2Request *pageRequest) {
+                                        return [s3 listObjectsV2:pageRequest];
+                                    }];
+     [paginator enumeratePagesUsingBlock:^(AWSS3ListObjectsV2Output *page, BOOL *stop) {
+         ...
+     }];
+ */
+@interface AWSPaginator<RequestType : AWSRequest *, ResponseType : AWSModel *> : NSObject
+
+/**
+ The property of the request that carries the pagination token, such as `nextToken` or `exclusiveStartKey`.
+ */
+@property (nonatomic, copy, readonly) NSString *inputTokenKey;
+
+/**
+ The property of the response that carries the token of the next page, such as `nextToken` or `lastEvaluatedKey`.
+ */
+@property (nonatomic, copy, readonly) NSString *outputTokenKey;
+
+/**
+ The property of the request that limits the number of items in a page, such as `maxResults` or `limit`. It is set to
+ `pageSize` when `pageSize` is not `nil`.
+ */
+@property (nonatomic, copy, nullable) NSString *limitKey;
+
+/**
+ The number of items to request per page. Defaults to `nil`, which leaves the limit of the request unchanged.
+ */
+@property (nonatomic, strong, nullable) NSNumber *pageSize;
+
+/**
+ A boolean property of the response that is `NO` on the last page, such as `isTruncated`. When `nil`, the last page is
+ the one without an output token. When it is `YES` and the page has no output token, the key of the last object in
+ `contents` is used, as S3 `ListObjects` expects, and the paginator fails with `AWSPaginatorErrorMissingToken` if the
+ page has no objects.
+ */
+@property (nonatomic, copy, nullable) NSString *moreResultsKey;
+
+/**
+ The number of pages fetched ahead of the caller. Defaults to `1`, which requests page `n + 1` as soon as page `n` is
+ returned. `0` disables prefetching.
+ */
+@property (nonatomic, assign) NSUInteger lookaheadDepth;
+
+/**
+ The total cost of the pages buffered ahead of the caller above which no more pages are prefetched. Defaults to `0`,
+ which leaves the buffer bounded by `lookaheadDepth` only. Pages the caller is waiting for are always fetched.
+ */
+@property (nonatomic, assign) NSUInteger maximumBufferedCost;
+
+/**
+ Returns the cost of a buffered page, for example the number of items or an estimate of its size in bytes. Defaults
+ to `nil`, which counts every page as `1`.
+ */
+@property (nonatomic, copy, nullable) NSUInteger (^pageCost)(ResponseType page);
+
+/**
+ Whether the last page has been returned, or the paginator failed or was cancelled.
+ */
+@property (nonatomic, assign, readonly, getter=isFinished) BOOL finished;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns a paginator that uses the given token properties.
+
+ @param request    The request of the first page. It is copied, and is not modified.
+ @param inputTokenKey  The property of the request that carries the pagination token.
+ @param outputTokenKey The property of the response that carries the token of the next page.
+ @param pageLoader A block that sends a page request, typically by calling the matching method of the service client.
+ */
+- (instancetype)initWithRequest:(RequestType)request
+                  inputTokenKey:(NSString *)inputTokenKey
+                 outputTokenKey:(NSString *)outputTokenKey
+                     pageLoader:(AWSTask<ResponseType> * (^)(RequestType pageRequest))pageLoader NS_DESIGNATED_INITIALIZER;
+
+/**
+ Returns a paginator for an operation whose token, limit and truncation members follow the naming used by the
+ service models: `NextToken`, `Marker`/`NextMarker`, `ContinuationToken`/`NextContinuationToken`,
+ `ExclusiveStartKey`/`LastEvaluatedKey` or `PaginationToken` for the tokens, `MaxResults`, `Limit`, `MaxKeys` or
+ `MaxItems` for the limit, and `IsTruncated`.
+
+ @return A paginator, or `nil` if the request and response classes have no matching pair of token members.
+ */
+- (nullable instancetype)initWithRequest:(RequestType)request
+                           responseClass:(Class)responseClass
+                              pageLoader:(AWSTask<ResponseType> * (^)(RequestType pageRequest))pageLoader;
+
+/**
+ Returns the next page. The result of the task is `nil` after the last page has been returned.
+
+ Pages are returned in order, and at most once, even when this method is called again before the previous task has
+ completed. If a page request fails, the task of that page and of every later call fails with the same error.
+ */
+- (AWSTask<ResponseType> *)nextPage;
+
+/**
+ Calls `block` with every remaining page, in order. The block is called for page `n` while page `n + 1` is being
+ fetched; setting `*stop` to `YES` stops the enumeration and cancels the pages fetched ahead.
+
+ @return A task that completes with `nil` after the last page, or fails with the error of the first failed page.
+ */
+- (AWSTask *)enumeratePagesUsingBlock:(void (^)(ResponseType page, BOOL *stop))block;
+
+/**
+ Cancels the page request in flight, drops the buffered pages, and fails pending and later `nextPage` tasks with
+ `AWSPaginatorErrorCancelled`.
+ */
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,335 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSPaginator.h"
+#import "AWSBolts.h"
+#import "AWSMTLClassDescriptor.h"
+
+NSString *const AWSPaginatorErrorDomain = @"com.amazonaws.AWSPaginatorErrorDomain";
+
+// Request and response member names of the pagination tokens used by the service models, in the order they are tried.
+static NSArray<NSArray<NSString *> *> *AWSPaginatorTokenMembers(void) {
+    return @[@[@"ContinuationToken", @"NextContinuationToken"],
+             @[@"ExclusiveStartKey", @"LastEvaluatedKey"],
+             @[@"NextToken", @"NextToken"],
+             @[@"nextToken", @"nextToken"],
+             @[@"Marker", @"NextMarker"],
+             @[@"marker", @"nextMarker"],
+             @[@"PaginationToken", @"PaginationToken"]];
+}
+
+static NSString *AWSPaginatorPropertyKey(Class modelClass, NSArray<NSString *> *memberNames) {
+    NSDictionary<NSString *, AWSMTLPropertyDescriptor *> *properties = [AWSMTLClassDescriptor descriptorForClass:modelClass].propertiesByJSONKeyPath;
+    for (NSString *memberName in memberNames) {
+        AWSMTLPropertyDescriptor *property = properties[memberName];
+        if (property) {
+            return property.key;
+        }
+    }
+    return nil;
+}
+
+static BOOL AWSPaginatorTokenIsEmpty(id token) {
+    if (token == nil || token == [NSNull null]) {
+        return YES;
+    }
+    if ([token respondsToSelector:@selector(count)]) {
+        return [token count] == 0;
+    }
+    if ([token respondsToSelector:@selector(length)]) {
+        return [token length] == 0;
+    }
+    return NO;
+}
+
+// Returns the key of the last object of an S3 listing, which is the marker of the next page when the page has no
+// `NextMarker`.
+static id AWSPaginatorLastKey(id page) {
+    NSString *contentsKey = AWSPaginatorPropertyKey([page class], @[@"Contents"]);
+    id lastObject = contentsKey ? [[page valueForKey:contentsKey] lastObject] : nil;
+    if (![[lastObject class] respondsToSelector:@selector(JSONKeyPathsByPropertyKey)]) {
+        return nil;
+    }
+    NSString *keyKey = AWSPaginatorPropertyKey([lastObject class], @[@"Key"]);
+    return keyKey ? [lastObject valueForKey:keyKey] : nil;
+}
+
+@interface AWSPaginator()
+
+@property (nonatomic, strong) AWSRequest *pageRequest;
+@property (nonatomic, copy) AWSTask *(^pageLoader)(AWSRequest *pageRequest);
+
+@end
+
+@implementation AWSPaginator {
+    NSMutableArray *_bufferedPages;
+    NSMutableArray<NSNumber *> *_bufferedPageCosts;
+    NSUInteger _bufferedCost;
+    NSMutableArray<AWSTaskCompletionSource *> *_waitingPages;
+    id _lastToken;
+    BOOL _started;
+    BOOL _loading;
+    BOOL _exhausted;
+    NSError *_error;
+}
+
+- (instancetype)initWithRequest:(AWSRequest *)request
+                  inputTokenKey:(NSString *)inputTokenKey
+                 outputTokenKey:(NSString *)outputTokenKey
+                     pageLoader:(AWSTask *(^)(AWSRequest *pageRequest))pageLoader {
+    if (self = [super init]) {
+        _inputTokenKey = [inputTokenKey copy];
+        _outputTokenKey = [outputTokenKey copy];
+        _pageLoader = [pageLoader copy];
+        _lookaheadDepth = 1;
+
+        // The copy has its own networking request, so cancelling the paginator does not cancel the caller's request.
+        _pageRequest = [request copy];
+        _lastToken = [_pageRequest valueForKey:inputTokenKey];
+
+        _bufferedPages = [NSMutableArray new];
+        _bufferedPageCosts = [NSMutableArray new];
+        _waitingPages = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (instancetype)initWithRequest:(AWSRequest *)request
+                  responseClass:(Class)responseClass
+                     pageLoader:(AWSTask *(^)(AWSRequest *pageRequest))pageLoader {
+    NSString *inputTokenKey = nil;
+    NSString *outputTokenKey = nil;
+    for (NSArray<NSString *> *members in AWSPaginatorTokenMembers()) {
+        inputTokenKey = AWSPaginatorPropertyKey([request class], @[members[0]]);
+        outputTokenKey = AWSPaginatorPropertyKey(responseClass, @[members[1]]);
+        if (inputTokenKey && outputTokenKey) {
+            break;
+        }
+    }
+    if (!inputTokenKey || !outputTokenKey) {
+        return nil;
+    }
+
+    if (self = [self initWithRequest:request
+                       inputTokenKey:inputTokenKey
+                      outputTokenKey:outputTokenKey
+                          pageLoader:pageLoader]) {
+        _limitKey = AWSPaginatorPropertyKey([request class], @[@"MaxResults", @"maxResults", @"Limit", @"limit",
+                                                               @"MaxKeys", @"MaxItems", @"maxItems", @"MaxRecords"]);
+        _moreResultsKey = AWSPaginatorPropertyKey(responseClass, @[@"IsTruncated"]);
+    }
+    return self;
+}
+
+- (BOOL)isFinished {
+    @synchronized(self) {
+        return _exhausted && [_bufferedPages count] == 0;
+    }
+}
+
+- (AWSTask *)nextPage {
+    AWSTask *task = nil;
+    @synchronized(self) {
+        if (!_started) {
+            _started = YES;
+            if (self.pageSize && self.limitKey) {
+                [self.pageRequest setValue:self.pageSize forKey:self.limitKey];
+            }
+        }
+
+        if ([_bufferedPages count] > 0) {
+            task = [AWSTask taskWithResult:_bufferedPages[0]];
+            _bufferedCost -= [_bufferedPageCosts[0] unsignedIntegerValue];
+            [_bufferedPages removeObjectAtIndex:0];
+            [_bufferedPageCosts removeObjectAtIndex:0];
+        } else if (_error) {
+            task = [AWSTask taskWithError:_error];
+        } else if (_exhausted) {
+            task = [AWSTask taskWithResult:nil];
+        } else {
+            AWSTaskCompletionSource *waitingPage = [AWSTaskCompletionSource taskCompletionSource];
+            [_waitingPages addObject:waitingPage];
+            task = waitingPage.task;
+        }
+    }
+
+    [self loadPageIfNeeded];
+    return task;
+}
+
+- (AWSTask *)enumeratePagesUsingBlock:(void (^)(id page, BOOL *stop))block {
+    return [[self nextPage] continueWithSuccessBlock:^id(AWSTask *task) {
+        if (task.result == nil) {
+            return nil;
+        }
+        BOOL stop = NO;
+        block(task.result, &stop);
+        if (stop) {
+            [self cancel];
+            return nil;
+        }
+        return [self enumeratePagesUsingBlock:block];
+    }];
+}
+
+- (void)cancel {
+    NSArray<AWSTaskCompletionSource *> *waitingPages = nil;
+    NSError *error = nil;
+    BOOL loading = NO;
+    @synchronized(self) {
+        if (_exhausted) {
+            [_bufferedPages removeAllObjects];
+            [_bufferedPageCosts removeAllObjects];
+            _bufferedCost = 0;
+            return;
+        }
+        error = [NSError errorWithDomain:AWSPaginatorErrorDomain
+                                    code:AWSPaginatorErrorCancelled
+                                userInfo:@{NSLocalizedDescriptionKey: @"The paginator was cancelled."}];
+        _error = error;
+        _exhausted = YES;
+        loading = _loading;
+        waitingPages = [_waitingPages copy];
+        [_waitingPages removeAllObjects];
+        [_bufferedPages removeAllObjects];
+        [_bufferedPageCosts removeAllObjects];
+        _bufferedCost = 0;
+    }
+
+    if (loading) {
+        [self.pageRequest cancel];
+    }
+    for (AWSTaskCompletionSource *waitingPage in waitingPages) {
+        [waitingPage trySetError:error];
+    }
+}
+
+#pragma mark - Loading
+
+- (BOOL)shouldLoadPage {
+    if (_loading || _exhausted) {
+        return NO;
+    }
+    if ([_waitingPages count] > 0) {
+        return YES;
+    }
+    if (!_started || [_bufferedPages count] >= self.lookaheadDepth) {
+        return NO;
+    }
+    return self.maximumBufferedCost == 0 || _bufferedCost < self.maximumBufferedCost;
+}
+
+- (void)loadPageIfNeeded {
+    @synchronized(self) {
+        if (![self shouldLoadPage]) {
+            return;
+        }
+        _loading = YES;
+    }
+
+    // Only one page is loaded at a time, so the page request is not modified while it is being sent.
+    AWSTask *task = self.pageLoader(self.pageRequest);
+    [task continueWithBlock:^id(AWSTask *task) {
+        [self didLoadPage:task.result error:task.error];
+        return nil;
+    }];
+}
+
+- (void)didLoadPage:(id)page error:(NSError *)error {
+    NSUInteger cost = (page && self.pageCost) ? self.pageCost(page) : 1;
+    AWSTaskCompletionSource *waitingPage = nil;
+    NSArray<AWSTaskCompletionSource *> *failedPages = nil;
+    NSError *failure = nil;
+
+    @synchronized(self) {
+        _loading = NO;
+        if (_exhausted && _error) {
+            // Cancelled while the page was loading.
+            return;
+        }
+
+        if (!page && !error) {
+            error = [NSError errorWithDomain:AWSPaginatorErrorDomain
+                                        code:AWSPaginatorErrorUnknown
+                                    userInfo:@{NSLocalizedDescriptionKey: @"The page loader returned no page."}];
+        }
+        if (error) {
+            _error = error;
+            _exhausted = YES;
+        } else {
+            [self advancePastPage:page];
+            if ([_waitingPages count] > 0) {
+                waitingPage = _waitingPages[0];
+                [_waitingPages removeObjectAtIndex:0];
+            } else {
+                [_bufferedPages addObject:page];
+                [_bufferedPageCosts addObject:@(cost)];
+                _bufferedCost += cost;
+            }
+        }
+        if (_error) {
+            failure = _error;
+            failedPages = [_waitingPages copy];
+            [_waitingPages removeAllObjects];
+        }
+    }
+
+    [waitingPage trySetResult:page];
+    for (AWSTaskCompletionSource *failedPage in failedPages) {
+        [failedPage trySetError:failure];
+    }
+    [self loadPageIfNeeded];
+}
+
+// Sets the token of the page after `page` on the page request, or marks the paginator exhausted. Must be called while
+// synchronized on `self`.
+- (void)advancePastPage:(id)page {
+    id token = [page valueForKey:self.outputTokenKey];
+    NSNumber *moreResults = self.moreResultsKey ? [page valueForKey:self.moreResultsKey] : nil;
+    if (moreResults && ![moreResults boolValue]) {
+        _exhausted = YES;
+        return;
+    }
+
+    if (AWSPaginatorTokenIsEmpty(token) && [moreResults boolValue]) {
+        // S3 ListObjects only returns a NextMarker for listings with a delimiter.
+        token = AWSPaginatorLastKey(page);
+        if (AWSPaginatorTokenIsEmpty(token)) {
+            _exhausted = YES;
+            _error = [NSError errorWithDomain:AWSPaginatorErrorDomain
+                                         code:AWSPaginatorErrorMissingToken
+                                     userInfo:@{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"The page has more results, but no %@.", self.outputTokenKey]}];
+            return;
+        }
+    }
+
+    if (AWSPaginatorTokenIsEmpty(token)) {
+        _exhausted = YES;
+        return;
+    }
+    if ([token isEqual:_lastToken]) {
+        // The service returned the token of the page it was asked for, and would return the same page forever.
+        _exhausted = YES;
+        _error = [NSError errorWithDomain:AWSPaginatorErrorDomain
+                                     code:AWSPaginatorErrorRepeatedToken
+                                 userInfo:@{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"The page returned the same %@ as the previous page.", self.outputTokenKey]}];
+        return;
+    }
+
+    _lastToken = token;
+    [self.pageRequest setValue:token forKey:self.inputTokenKey];
+}
+
+@end
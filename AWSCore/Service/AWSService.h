@@ -95,6 +95,19 @@ typedef NS_ENUM(NSInteger, AWSServiceErrorType) {
 @property (nonatomic, readonly) NSString *userAgent;
 @property (nonatomic, readonly) BOOL localTestingEnabled;
 
+/**
+ The size of the data in each chunk of an Amazon S3 streaming upload, clamped to `AWSS3ChunkedEncodingMinimumChunkSize`
+ and `AWSS3ChunkedEncodingMaximumChunkSize`. The default value is 0, which sizes the chunks to fit the buffer the
+ request body is read into. Larger chunks, e.g. 1 MiB, mean fewer chunk signatures for large uploads.
+ */
+@property (nonatomic, assign) NSUInteger chunkedEncodingChunkSize;
+
+/**
+ How the payload of Amazon S3 requests is signed. The default value is `AWSS3PayloadSigningModeSigned`. The other modes
+ skip hashing the payload and signing every chunk of streamed uploads, and only apply to HTTPS requests.
+ */
+@property (nonatomic, assign) AWSS3PayloadSigningMode payloadSigningMode;
+
 + (NSString *)baseUserAgent;
 
 + (void)addGlobalUserAgentProductToken:(NSString *)productToken;
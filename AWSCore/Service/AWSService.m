@@ -236,6 +236,8 @@ static NSMutableArray *_globalUserAgentPrefixes = nil;
     configuration.userAgentProductTokens = self.userAgentProductTokens;
     configuration.endpoint = self.endpoint;
     configuration.localTestingEnabled = self.localTestingEnabled;
+    configuration.chunkedEncodingChunkSize = self.chunkedEncodingChunkSize;
+    configuration.payloadSigningMode = self.payloadSigningMode;
     return configuration;
 }
 
@@ -48,6 +48,31 @@ FOUNDATION_EXPORT NSString *const AWSDateShortDateFormat2;
 
 @end
 
+@interface NSData (AWS)
+
+/**
+ Returns the bytes of the receiver as a lowercase hex string.
+ */
+- (NSString *)aws_hexEncodedString;
+
+/**
+ Returns the receiver as a padded base64 string. Equivalent to `base64EncodedStringWithOptions:0`, but faster.
+ */
+- (NSString *)aws_base64EncodedString;
+
+/**
+ Returns the data represented by a hex string in either case, or `nil` if the string is not valid hex.
+ */
++ (instancetype)aws_dataWithHexEncodedString:(NSString *)string;
+
+/**
+ Returns the data represented by a base64 string, or `nil` if the string is not valid base64. Padding is optional;
+ whitespace is not accepted, as with `initWithBase64EncodedString:options:0`.
+ */
++ (instancetype)aws_dataWithBase64EncodedString:(NSString *)string;
+
+@end
+
 @interface NSDictionary (AWS)
 
 - (NSDictionary *)aws_removeNullValues;
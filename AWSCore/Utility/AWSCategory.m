@@ -19,6 +19,8 @@
 #import "AWSCocoaLumberjack.h"
 #import "AWSGZIP.h"
 #import "AWSMantle.h"
+#import "aws_date.h"
+#import "aws_encoding.h"
 
 NSString *const AWSDateRFC822DateFormat1 = @"EEE, dd MMM yyyy HH:mm:ss z";
 NSString *const AWSDateISO8601DateFormat1 = @"yyyy-MM-dd'T'HH:mm:ss'Z'";
@@ -54,16 +56,74 @@ static NSTimeInterval _clockskew = 0.0;
     return [[NSDate date] dateByAddingTimeInterval:-1 * _clockskew];
 }
 
+// Dates are parsed and formatted by aws_date for the formats the SDK defines, without a formatter.
+static BOOL AWSDateFormatFromString(NSString *dateFormat, aws_date_format *format) {
+    if (dateFormat == AWSDateISO8601DateFormat2 || [dateFormat isEqualToString:AWSDateISO8601DateFormat2]) {
+        *format = AWS_DATE_FORMAT_ISO8601_BASIC;
+    } else if (dateFormat == AWSDateShortDateFormat1 || [dateFormat isEqualToString:AWSDateShortDateFormat1]) {
+        *format = AWS_DATE_FORMAT_SHORT_BASIC;
+    } else if ([dateFormat isEqualToString:AWSDateISO8601DateFormat1]) {
+        *format = AWS_DATE_FORMAT_ISO8601;
+    } else if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
+        *format = AWS_DATE_FORMAT_RFC822;
+    } else if ([dateFormat isEqualToString:AWSDateISO8601DateFormat3]) {
+        *format = AWS_DATE_FORMAT_ISO8601_FRACTIONAL;
+    } else if ([dateFormat isEqualToString:AWSDateShortDateFormat2]) {
+        *format = AWS_DATE_FORMAT_SHORT;
+    } else {
+        return NO;
+    }
+    return YES;
+}
+
+// Copies an ASCII date into `buffer`. Dates are never longer than AWS_DATE_MAX_LENGTH, so longer strings are rejected.
+static BOOL AWSDateCopyASCIIString(NSString *string, char buffer[AWS_DATE_MAX_LENGTH], NSUInteger *length) {
+    if (![string isKindOfClass:[NSString class]] || [string length] > AWS_DATE_MAX_LENGTH) {
+        return NO;
+    }
+    return [string getBytes:buffer
+                  maxLength:AWS_DATE_MAX_LENGTH
+                 usedLength:length
+                   encoding:NSASCIIStringEncoding
+                    options:0
+                      range:NSMakeRange(0, [string length])
+             remainingRange:NULL] && *length == [string length];
+}
+
 + (NSDate *)aws_dateFromString:(NSString *)string {
+    static const aws_date_format formats[] = {
+        AWS_DATE_FORMAT_RFC822,
+        AWS_DATE_FORMAT_ISO8601,
+        AWS_DATE_FORMAT_ISO8601_BASIC,
+        AWS_DATE_FORMAT_ISO8601_FRACTIONAL
+    };
+
+    char buffer[AWS_DATE_MAX_LENGTH];
+    NSUInteger length = 0;
+    if (AWSDateCopyASCIIString(string, buffer, &length)) {
+        for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+            double seconds = 0;
+            if (aws_date_parse(buffer, length, formats[i], &seconds) == AWS_DATE_OK) {
+                return [NSDate dateWithTimeIntervalSince1970:seconds];
+            }
+        }
+    }
+
+    // Each of the formats has letters in it, so strings without any, such as epoch seconds, cannot match them.
+    if ([string rangeOfCharacterFromSet:[NSCharacterSet letterCharacterSet]].location == NSNotFound) {
+        return nil;
+    }
+
+    // The formatters are more lenient, for example with time zone names.
     NSDate *parsedDate = nil;
-    NSArray *arrayOfDateFormat = @[AWSDateRFC822DateFormat1,
-                                   AWSDateISO8601DateFormat1,
-                                   AWSDateISO8601DateFormat2,
-                                   AWSDateISO8601DateFormat3];
+    NSArray *arrayOfDateFormat = @[[NSDate aws_RFC822Date1Formatter],
+                                   [NSDate aws_ISO8601Date1Formatter],
+                                   [NSDate aws_ISO8601Date2Formatter],
+                                   [NSDate aws_ISO8601Date3Formatter]];
 
-    for (NSString *dateFormat in arrayOfDateFormat) {
+    for (NSDateFormatter *dateFormatter in arrayOfDateFormat) {
         if (!parsedDate) {
-            parsedDate = [NSDate aws_dateFromString:string format:dateFormat];
+            parsedDate = [dateFormatter dateFromString:string];
         } else {
             break;
         }
@@ -73,59 +133,71 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 + (NSDate *)aws_dateFromString:(NSString *)string format:(NSString *)dateFormat {
-    if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
-        return [[NSDate aws_RFC822Date1Formatter] dateFromString:string];
-    }
-    if ([dateFormat isEqualToString:AWSDateISO8601DateFormat1]) {
-        return [[NSDate aws_ISO8601Date1Formatter] dateFromString:string];
-    }
-    if ([dateFormat isEqualToString:AWSDateISO8601DateFormat2]) {
-        return [[NSDate aws_ISO8601Date2Formatter] dateFromString:string];
-    }
-    if ([dateFormat isEqualToString:AWSDateISO8601DateFormat3]) {
-        return [[NSDate aws_ISO8601Date3Formatter] dateFromString:string];
-    }
-    if ([dateFormat isEqualToString:AWSDateShortDateFormat1]) {
-        return [[NSDate aws_ShortDateFormat1Formatter] dateFromString:string];
-    }
-    if ([dateFormat isEqualToString:AWSDateShortDateFormat2]) {
-        return [[NSDate aws_ShortDateFormat2Formatter] dateFromString:string];
+    aws_date_format format;
+    if (AWSDateFormatFromString(dateFormat, &format)) {
+        char buffer[AWS_DATE_MAX_LENGTH];
+        NSUInteger length = 0;
+        double seconds = 0;
+        if (AWSDateCopyASCIIString(string, buffer, &length)
+            && aws_date_parse(buffer, length, format, &seconds) == AWS_DATE_OK) {
+            return [NSDate dateWithTimeIntervalSince1970:seconds];
+        }
     }
 
-    NSDateFormatter *dateFormatter = [NSDateFormatter new];
-    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
-    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
-    dateFormatter.dateFormat = dateFormat;
-
-    return [dateFormatter dateFromString:string];
+    return [[NSDate aws_dateFormatterWithFormat:dateFormat] dateFromString:string];
 }
 
 - (NSString *)aws_stringValue:(NSString *)dateFormat {
+    aws_date_format format;
+    if (AWSDateFormatFromString(dateFormat, &format)) {
+        char buffer[AWS_DATE_MAX_LENGTH];
+        size_t length = aws_date_format_write([self timeIntervalSince1970], format, buffer);
+        if (length > 0) {
+            return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+        }
+    }
+
+    return [[NSDate aws_dateFormatterWithFormat:dateFormat] stringFromDate:self];
+}
+
++ (NSDateFormatter *)aws_dateFormatterWithFormat:(NSString *)dateFormat {
     if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
-        return [[NSDate aws_RFC822Date1Formatter] stringFromDate:self];
+        return [NSDate aws_RFC822Date1Formatter];
     }
     if ([dateFormat isEqualToString:AWSDateISO8601DateFormat1]) {
-        return [[NSDate aws_ISO8601Date1Formatter] stringFromDate:self];
+        return [NSDate aws_ISO8601Date1Formatter];
     }
     if ([dateFormat isEqualToString:AWSDateISO8601DateFormat2]) {
-        return [[NSDate aws_ISO8601Date2Formatter] stringFromDate:self];
+        return [NSDate aws_ISO8601Date2Formatter];
     }
     if ([dateFormat isEqualToString:AWSDateISO8601DateFormat3]) {
-        return [[NSDate aws_ISO8601Date3Formatter] stringFromDate:self];
+        return [NSDate aws_ISO8601Date3Formatter];
     }
     if ([dateFormat isEqualToString:AWSDateShortDateFormat1]) {
-        return [[NSDate aws_ShortDateFormat1Formatter] stringFromDate:self];
+        return [NSDate aws_ShortDateFormat1Formatter];
     }
     if ([dateFormat isEqualToString:AWSDateShortDateFormat2]) {
-        return [[NSDate aws_ShortDateFormat2Formatter] stringFromDate:self];
+        return [NSDate aws_ShortDateFormat2Formatter];
     }
 
-    NSDateFormatter *dateFormatter = [NSDateFormatter new];
-    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
-    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
-    dateFormatter.dateFormat = dateFormat;
+    // Formatters for other formats are kept, as creating one is expensive. NSCache is thread-safe, and so are
+    // NSDateFormatter instances that are not modified after they are created.
+    static NSCache<NSString *, NSDateFormatter *> *_dateFormatters = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _dateFormatters = [NSCache new];
+        _dateFormatters.countLimit = 16;
+    });
 
-    return [dateFormatter stringFromDate:self];
+    NSDateFormatter *dateFormatter = [_dateFormatters objectForKey:dateFormat];
+    if (dateFormatter == nil) {
+        dateFormatter = [NSDateFormatter new];
+        dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
+        dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+        dateFormatter.dateFormat = dateFormat;
+        [_dateFormatters setObject:dateFormatter forKey:[dateFormat copy]];
+    }
+    return dateFormatter;
 }
 
 + (NSDateFormatter *)aws_RFC822Date1Formatter {
@@ -226,6 +298,100 @@ static NSTimeInterval _clockskew = 0.0;
 
 @end
 
+@implementation NSData (AWS)
+
+// Encoded digests, signatures and checksums fit on the stack; larger payloads are encoded into a heap buffer that is
+// handed over to the string.
+static NSUInteger const AWSEncodingStackBufferLength = 256;
+
+static NSString *AWSEncodedString(NSUInteger encodedLength, void (^encode)(char *output)) {
+    if (encodedLength == 0) {
+        return @"";
+    }
+    if (encodedLength <= AWSEncodingStackBufferLength) {
+        char output[AWSEncodingStackBufferLength];
+        encode(output);
+        return [[NSString alloc] initWithBytes:output length:encodedLength encoding:NSASCIIStringEncoding];
+    }
+
+    char *output = malloc(encodedLength);
+    if (output == NULL) {
+        return nil;
+    }
+    encode(output);
+    return [[NSString alloc] initWithBytesNoCopy:output
+                                          length:encodedLength
+                                        encoding:NSASCIIStringEncoding
+                                    freeWhenDone:YES];
+}
+
+// Passes the ASCII bytes of `string` to `decode`, without copying them when the string stores them contiguously.
+static id AWSDecodeASCIIString(NSString *string, id (^decode)(const char *characters, size_t length)) {
+    const char *characters = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingASCII);
+    if (characters) {
+        return decode(characters, (size_t)CFStringGetLength((__bridge CFStringRef)string));
+    }
+
+    NSData *ascii = [string dataUsingEncoding:NSASCIIStringEncoding allowLossyConversion:NO];
+    if (ascii == nil) {
+        return nil;
+    }
+    return decode([ascii bytes], [ascii length]);
+}
+
+- (NSString *)aws_hexEncodedString {
+    const uint8_t *bytes = [self bytes];
+    NSUInteger length = [self length];
+    return AWSEncodedString(AWS_HEX_ENCODED_LENGTH(length), ^(char *output) {
+        aws_hex_encode(bytes, length, output);
+    });
+}
+
+- (NSString *)aws_base64EncodedString {
+    const uint8_t *bytes = [self bytes];
+    NSUInteger length = [self length];
+    return AWSEncodedString(AWS_BASE64_ENCODED_LENGTH(length), ^(char *output) {
+        aws_base64_encode(bytes, length, output);
+    });
+}
+
++ (instancetype)aws_dataWithHexEncodedString:(NSString *)string {
+    if (string == nil) {
+        return nil;
+    }
+    return AWSDecodeASCIIString(string, ^id(const char *characters, size_t length) {
+        uint8_t *bytes = malloc(MAX(length / 2, 1));
+        if (bytes == NULL) {
+            return nil;
+        }
+        if (aws_hex_decode(characters, length, bytes) != AWS_ENCODING_OK) {
+            free(bytes);
+            return nil;
+        }
+        return [self dataWithBytesNoCopy:bytes length:length / 2 freeWhenDone:YES];
+    });
+}
+
++ (instancetype)aws_dataWithBase64EncodedString:(NSString *)string {
+    if (string == nil) {
+        return nil;
+    }
+    return AWSDecodeASCIIString(string, ^id(const char *characters, size_t length) {
+        uint8_t *bytes = malloc(MAX(AWS_BASE64_DECODED_MAX_LENGTH(length), 1));
+        if (bytes == NULL) {
+            return nil;
+        }
+        size_t decodedLength = 0;
+        if (aws_base64_decode(characters, length, bytes, &decodedLength) != AWS_ENCODING_OK) {
+            free(bytes);
+            return nil;
+        }
+        return [self dataWithBytesNoCopy:bytes length:decodedLength freeWhenDone:YES];
+    });
+}
+
+@end
+
 @implementation NSDictionary (AWS)
 
 - (NSDictionary *)aws_removeNullValues {
@@ -373,8 +539,8 @@ static NSTimeInterval _clockskew = 0.0;
     
     CC_MD5(cStr, (uint32_t)[data length], result);
     
-    NSData *md5 = [[NSData alloc] initWithBytes:result length:CC_MD5_DIGEST_LENGTH];
-    return [md5 base64EncodedStringWithOptions:kNilOptions];
+    NSData *md5 = [[NSData alloc] initWithBytesNoCopy:result length:CC_MD5_DIGEST_LENGTH freeWhenDone:NO];
+    return [md5 aws_base64EncodedString];
 }
 
 - (BOOL)aws_isBase64Data {
@@ -14,6 +14,7 @@
 //
 
 #import "AWSModel.h"
+#import "AWSMTLClassDescriptor.h"
 
 @implementation AWSModel
 
@@ -27,14 +28,16 @@
 }
 
 - (NSDictionary *)dictionaryValue {
-    NSDictionary *dictionaryValue = [super dictionaryValue];
-    NSMutableDictionary *mutableDictionaryValue = [dictionaryValue mutableCopy];
-
-    [dictionaryValue enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
-        if ([self valueForKey:key] == nil) {
-            [mutableDictionaryValue removeObjectForKey:key];
+    NSArray *properties = [AWSMTLClassDescriptor descriptorForClass:self.class].properties;
+    NSMutableDictionary *mutableDictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:properties.count];
+
+    // Properties that are nil are left out.
+    for (AWSMTLPropertyDescriptor *property in properties) {
+        id value = [property valueForModel:self];
+        if (value != nil) {
+            mutableDictionaryValue[property.key] = value;
         }
-    }];
+    }
 
     return mutableDictionaryValue;
 }
@@ -0,0 +1,489 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#include "aws_date.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const int64_t aws_seconds_per_day = 86400;
+
+/* Days from 1970-01-01 to 0000-01-01 and to 10000-01-01. */
+static const int64_t aws_first_day = -719528;
+static const int64_t aws_last_day = 2932897;
+
+static const char aws_day_names[7][3] = {
+    {'S', 'u', 'n'}, {'M', 'o', 'n'}, {'T', 'u', 'e'}, {'W', 'e', 'd'}, {'T', 'h', 'u'}, {'F', 'r', 'i'}, {'S', 'a', 't'}
+};
+
+static const char aws_month_names[12][3] = {
+    {'J', 'a', 'n'}, {'F', 'e', 'b'}, {'M', 'a', 'r'}, {'A', 'p', 'r'}, {'M', 'a', 'y'}, {'J', 'u', 'n'},
+    {'J', 'u', 'l'}, {'A', 'u', 'g'}, {'S', 'e', 'p'}, {'O', 'c', 't'}, {'N', 'o', 'v'}, {'D', 'e', 'c'}
+};
+
+/* Exact powers of ten, for the fast path of aws_date_parse_epoch. */
+static const double aws_powers_of_ten[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ * Days since 1970-01-01 of a date on the proleptic Gregorian calendar, from
+ * Howard Hinnant's "chrono-Compatible Low-Level Date Algorithms".
+ */
+static int64_t aws_days_from_civil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned year_of_era = (unsigned)(year - era * 400);
+    unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + (int64_t)day_of_era - 719468;
+}
+
+static void aws_civil_from_days(int64_t days, int64_t *year, unsigned *month, unsigned *day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned day_of_era = (unsigned)(days - era * 146097);
+    unsigned year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    unsigned day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    unsigned shifted_month = (5 * day_of_year + 2) / 153;
+    *day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+    *month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+    *year = (int64_t)year_of_era + era * 400 + (*month <= 2);
+}
+
+static unsigned aws_days_in_month(int64_t year, unsigned month) {
+    static const unsigned days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+/* Reads exactly `count` digits at *cursor. */
+static int aws_read_digits(const char **cursor, const char *end, int count, unsigned *value) {
+    if (end - *cursor < count) {
+        return 0;
+    }
+    unsigned result = 0;
+    for (int i = 0; i < count; i++) {
+        unsigned digit = (unsigned)((*cursor)[i] - '0');
+        if (digit > 9) {
+            return 0;
+        }
+        result = result * 10 + digit;
+    }
+    *cursor += count;
+    *value = result;
+    return 1;
+}
+
+static int aws_read_byte(const char **cursor, const char *end, char byte) {
+    if (*cursor == end || **cursor != byte) {
+        return 0;
+    }
+    *cursor += 1;
+    return 1;
+}
+
+static int aws_equal_ignoring_case(const char *text, const char name[3]) {
+    for (int i = 0; i < 3; i++) {
+        if ((text[i] | 0x20) != (name[i] | 0x20)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Reads a three letter day or month name, returning its index, or -1. */
+static int aws_read_name(const char **cursor, const char *end, const char (*names)[3], int count) {
+    if (end - *cursor < 3) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (aws_equal_ignoring_case(*cursor, names[i])) {
+            *cursor += 3;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int aws_read_date(const char **cursor, const char *end, int separated, int64_t *days) {
+    unsigned year, month, day;
+    if (!aws_read_digits(cursor, end, 4, &year)
+        || (separated && !aws_read_byte(cursor, end, '-'))
+        || !aws_read_digits(cursor, end, 2, &month)
+        || (separated && !aws_read_byte(cursor, end, '-'))
+        || !aws_read_digits(cursor, end, 2, &day)) {
+        return 0;
+    }
+    if (month < 1 || month > 12 || day < 1 || day > aws_days_in_month(year, month)) {
+        return 0;
+    }
+    *days = aws_days_from_civil(year, month, day);
+    return 1;
+}
+
+static int aws_read_time(const char **cursor, const char *end, int separated, int64_t *seconds) {
+    unsigned hour, minute, second;
+    if (!aws_read_digits(cursor, end, 2, &hour)
+        || (separated && !aws_read_byte(cursor, end, ':'))
+        || !aws_read_digits(cursor, end, 2, &minute)
+        || (separated && !aws_read_byte(cursor, end, ':'))
+        || !aws_read_digits(cursor, end, 2, &second)) {
+        return 0;
+    }
+    if (hour > 23 || minute > 59 || second > 59) {
+        return 0;
+    }
+    *seconds = hour * 3600 + minute * 60 + second;
+    return 1;
+}
+
+/* Reads the zone of an RFC 822 date as its offset from UTC, in seconds. */
+static int aws_read_zone(const char **cursor, const char *end, int64_t *offset) {
+    size_t length = (size_t)(end - *cursor);
+    const char *zone = *cursor;
+    if ((length == 3 && (memcmp(zone, "GMT", 3) == 0 || memcmp(zone, "UTC", 3) == 0))
+        || (length == 2 && memcmp(zone, "UT", 2) == 0)
+        || (length == 1 && zone[0] == 'Z')) {
+        *cursor = end;
+        *offset = 0;
+        return 1;
+    }
+
+    unsigned hours, minutes;
+    if (length == 5 && (zone[0] == '+' || zone[0] == '-')) {
+        const char *digits = zone + 1;
+        if (!aws_read_digits(&digits, end, 2, &hours) || !aws_read_digits(&digits, end, 2, &minutes) || minutes > 59) {
+            return 0;
+        }
+        *offset = (zone[0] == '-' ? -1 : 1) * (int64_t)(hours * 3600 + minutes * 60);
+        *cursor = end;
+        return 1;
+    }
+    return 0;
+}
+
+static int aws_parse_rfc822(const char *cursor, const char *end, double *seconds) {
+    if (aws_read_name(&cursor, end, aws_day_names, 7) < 0
+        || !aws_read_byte(&cursor, end, ',')
+        || !aws_read_byte(&cursor, end, ' ')) {
+        return 0;
+    }
+
+    unsigned day;
+    if (!aws_read_digits(&cursor, end, 2, &day) && !aws_read_digits(&cursor, end, 1, &day)) {
+        return 0;
+    }
+    if (!aws_read_byte(&cursor, end, ' ')) {
+        return 0;
+    }
+    int month = aws_read_name(&cursor, end, aws_month_names, 12);
+    unsigned year;
+    if (month < 0 || !aws_read_byte(&cursor, end, ' ') || !aws_read_digits(&cursor, end, 4, &year)) {
+        return 0;
+    }
+    if (day < 1 || day > aws_days_in_month(year, (unsigned)month + 1)) {
+        return 0;
+    }
+
+    int64_t time, offset;
+    if (!aws_read_byte(&cursor, end, ' ')
+        || !aws_read_time(&cursor, end, 1, &time)
+        || !aws_read_byte(&cursor, end, ' ')
+        || !aws_read_zone(&cursor, end, &offset)) {
+        return 0;
+    }
+
+    *seconds = (double)(aws_days_from_civil(year, (unsigned)month + 1, day) * aws_seconds_per_day + time - offset);
+    return 1;
+}
+
+static int aws_parse_iso8601(const char *cursor, const char *end, int separated, int fractional, double *seconds) {
+    int64_t days, time;
+    if (!aws_read_date(&cursor, end, separated, &days)
+        || !aws_read_byte(&cursor, end, 'T')
+        || !aws_read_time(&cursor, end, separated, &time)) {
+        return 0;
+    }
+
+    double fraction = 0;
+    if (fractional) {
+        if (!aws_read_byte(&cursor, end, '.')) {
+            return 0;
+        }
+        unsigned value = 0;
+        int count = 0;
+        while (cursor < end && (unsigned)(*cursor - '0') <= 9) {
+            if (++count > 9) {
+                return 0;
+            }
+            value = value * 10 + (unsigned)(*cursor - '0');
+            cursor++;
+        }
+        if (count == 0) {
+            return 0;
+        }
+        fraction = value / aws_powers_of_ten[count];
+    }
+
+    if (!aws_read_byte(&cursor, end, 'Z') || cursor != end) {
+        return 0;
+    }
+    *seconds = (double)(days * aws_seconds_per_day + time) + fraction;
+    return 1;
+}
+
+int aws_date_parse(const char *input, size_t length, aws_date_format format, double *seconds) {
+    const char *end = input + length;
+    int64_t days;
+    int parsed = 0;
+    switch (format) {
+        case AWS_DATE_FORMAT_RFC822:
+            parsed = aws_parse_rfc822(input, end, seconds);
+            break;
+        case AWS_DATE_FORMAT_ISO8601:
+            parsed = aws_parse_iso8601(input, end, 1, 0, seconds);
+            break;
+        case AWS_DATE_FORMAT_ISO8601_BASIC:
+            parsed = aws_parse_iso8601(input, end, 0, 0, seconds);
+            break;
+        case AWS_DATE_FORMAT_ISO8601_FRACTIONAL:
+            parsed = aws_parse_iso8601(input, end, 1, 1, seconds);
+            break;
+        case AWS_DATE_FORMAT_SHORT_BASIC:
+        case AWS_DATE_FORMAT_SHORT: {
+            const char *cursor = input;
+            parsed = aws_read_date(&cursor, end, format == AWS_DATE_FORMAT_SHORT, &days) && cursor == end;
+            if (parsed) {
+                *seconds = (double)(days * aws_seconds_per_day);
+            }
+            break;
+        }
+    }
+    return parsed ? AWS_DATE_OK : AWS_DATE_ERROR_INVALID_INPUT;
+}
+
+static char *aws_write_digits(char *output, unsigned value, int count) {
+    for (int i = count - 1; i >= 0; i--) {
+        output[i] = (char)('0' + value % 10);
+        value /= 10;
+    }
+    return output + count;
+}
+
+size_t aws_date_format_write(double seconds, aws_date_format format, char *output) {
+    if (!isfinite(seconds)) {
+        return 0;
+    }
+    /*
+     * Truncates to the unit of the format. Values just below a whole unit,
+     * such as 1.594 * 1000, are rounded instead, as they are the nearest
+     * double to that unit: within a microsecond, or a few units in the last
+     * place for dates far from 1970.
+     */
+    double unscaled = format == AWS_DATE_FORMAT_ISO8601_FRACTIONAL ? seconds * 1000 : seconds;
+    double nearest = round(unscaled);
+    double tolerance = fmax(format == AWS_DATE_FORMAT_ISO8601_FRACTIONAL ? 1e-3 : 1e-6, fabs(unscaled) * 8 * DBL_EPSILON);
+    double scaled = fabs(unscaled - nearest) < tolerance ? nearest : floor(unscaled);
+    double first = (double)aws_first_day * aws_seconds_per_day;
+    double last = (double)aws_last_day * aws_seconds_per_day;
+    if (format == AWS_DATE_FORMAT_ISO8601_FRACTIONAL) {
+        first *= 1000;
+        last *= 1000;
+    }
+    if (scaled < first || scaled >= last) {
+        return 0;
+    }
+
+    int64_t total = (int64_t)scaled;
+    unsigned milliseconds = 0;
+    if (format == AWS_DATE_FORMAT_ISO8601_FRACTIONAL) {
+        int64_t remainder = total % 1000;
+        if (remainder < 0) {
+            remainder += 1000;
+        }
+        milliseconds = (unsigned)remainder;
+        total = (total - remainder) / 1000;
+    }
+
+    int64_t days = total / aws_seconds_per_day;
+    int64_t time = total % aws_seconds_per_day;
+    if (time < 0) {
+        time += aws_seconds_per_day;
+        days -= 1;
+    }
+    int64_t year;
+    unsigned month, day;
+    aws_civil_from_days(days, &year, &month, &day);
+    unsigned hour = (unsigned)(time / 3600);
+    unsigned minute = (unsigned)(time / 60 % 60);
+    unsigned second = (unsigned)(time % 60);
+
+    char *cursor = output;
+    switch (format) {
+        case AWS_DATE_FORMAT_RFC822: {
+            int weekday = (int)((days % 7 + 11) % 7);
+            memcpy(cursor, aws_day_names[weekday], 3);
+            cursor += 3;
+            *cursor++ = ',';
+            *cursor++ = ' ';
+            cursor = aws_write_digits(cursor, day, 2);
+            *cursor++ = ' ';
+            memcpy(cursor, aws_month_names[month - 1], 3);
+            cursor += 3;
+            *cursor++ = ' ';
+            cursor = aws_write_digits(cursor, (unsigned)year, 4);
+            *cursor++ = ' ';
+            cursor = aws_write_digits(cursor, hour, 2);
+            *cursor++ = ':';
+            cursor = aws_write_digits(cursor, minute, 2);
+            *cursor++ = ':';
+            cursor = aws_write_digits(cursor, second, 2);
+            memcpy(cursor, " GMT", 4);
+            cursor += 4;
+            break;
+        }
+        case AWS_DATE_FORMAT_ISO8601:
+        case AWS_DATE_FORMAT_ISO8601_BASIC:
+        case AWS_DATE_FORMAT_ISO8601_FRACTIONAL:
+        case AWS_DATE_FORMAT_SHORT_BASIC:
+        case AWS_DATE_FORMAT_SHORT: {
+            int separated = format != AWS_DATE_FORMAT_ISO8601_BASIC && format != AWS_DATE_FORMAT_SHORT_BASIC;
+            cursor = aws_write_digits(cursor, (unsigned)year, 4);
+            if (separated) {
+                *cursor++ = '-';
+            }
+            cursor = aws_write_digits(cursor, month, 2);
+            if (separated) {
+                *cursor++ = '-';
+            }
+            cursor = aws_write_digits(cursor, day, 2);
+            if (format == AWS_DATE_FORMAT_SHORT_BASIC || format == AWS_DATE_FORMAT_SHORT) {
+                break;
+            }
+            *cursor++ = 'T';
+            cursor = aws_write_digits(cursor, hour, 2);
+            if (separated) {
+                *cursor++ = ':';
+            }
+            cursor = aws_write_digits(cursor, minute, 2);
+            if (separated) {
+                *cursor++ = ':';
+            }
+            cursor = aws_write_digits(cursor, second, 2);
+            if (format == AWS_DATE_FORMAT_ISO8601_FRACTIONAL) {
+                *cursor++ = '.';
+                cursor = aws_write_digits(cursor, milliseconds, 3);
+            }
+            *cursor++ = 'Z';
+            break;
+        }
+    }
+    return (size_t)(cursor - output);
+}
+
+int aws_date_parse_epoch(const char *input, size_t length, double *seconds) {
+    const char *cursor = input;
+    const char *end = input + length;
+    int negative = 0;
+    if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+        negative = *cursor == '-';
+        cursor++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int significant = 0;
+    int exponent = 0;
+    for (; cursor < end && (unsigned)(*cursor - '0') <= 9; cursor++, digits++) {
+        if (significant < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+            significant += mantissa != 0;
+        } else {
+            exponent++;
+        }
+    }
+    if (cursor < end && *cursor == '.') {
+        cursor++;
+        for (; cursor < end && (unsigned)(*cursor - '0') <= 9; cursor++, digits++) {
+            if (significant < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+                significant += mantissa != 0;
+                exponent--;
+            }
+        }
+    }
+    if (digits == 0) {
+        return AWS_DATE_ERROR_INVALID_INPUT;
+    }
+    if (cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+        cursor++;
+        int exponent_negative = 0;
+        if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+            exponent_negative = *cursor == '-';
+            cursor++;
+        }
+        int explicit_exponent = 0;
+        int exponent_digits = 0;
+        for (; cursor < end && (unsigned)(*cursor - '0') <= 9; cursor++, exponent_digits++) {
+            if (explicit_exponent < 100000) {
+                explicit_exponent = explicit_exponent * 10 + (*cursor - '0');
+            }
+        }
+        if (exponent_digits == 0) {
+            return AWS_DATE_ERROR_INVALID_INPUT;
+        }
+        exponent += exponent_negative ? -explicit_exponent : explicit_exponent;
+    }
+    if (cursor != end) {
+        return AWS_DATE_ERROR_INVALID_INPUT;
+    }
+
+    /* Clinger's fast path: a mantissa and power of ten that are both exact give a correctly rounded quotient. */
+    double value;
+    if (mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        value = exponent < 0 ? (double)mantissa / aws_powers_of_ten[-exponent] : (double)mantissa * aws_powers_of_ten[exponent];
+    } else {
+        char text[64];
+        if (length >= sizeof(text)) {
+            return AWS_DATE_ERROR_INVALID_INPUT;
+        }
+        memcpy(text, input, length);
+        text[length] = '\0';
+        value = fabs(strtod(text, NULL));
+    }
+    *seconds = negative ? -value : value;
+    return AWS_DATE_OK;
+}
+
+size_t aws_date_format_epoch(double seconds, char *output) {
+    /* Beyond this, "%.0f" could need more than AWS_DATE_MAX_LENGTH characters. */
+    if (!isfinite(seconds) || fabs(seconds) >= 1e20) {
+        return 0;
+    }
+    char text[AWS_DATE_MAX_LENGTH + 1];
+    int length = snprintf(text, sizeof(text), "%.0f", seconds);
+    if (length <= 0 || length > AWS_DATE_MAX_LENGTH) {
+        return 0;
+    }
+    memcpy(output, text, (size_t)length);
+    return (size_t)length;
+}
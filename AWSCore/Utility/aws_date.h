@@ -0,0 +1,87 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#ifndef AWS_DATE_H
+#define AWS_DATE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Allocation free parsers and formatters for the timestamp formats used by
+ * AWS protocols, as seconds since 1970-01-01T00:00:00Z.
+ *
+ * All dates are in UTC on the proleptic Gregorian calendar. The functions
+ * keep no state and can be called from any thread. Formatters write to a
+ * buffer of AWS_DATE_MAX_LENGTH bytes supplied by the caller, which is not
+ * NUL terminated, and return the number of bytes written.
+ */
+
+#define AWS_DATE_OK 0
+#define AWS_DATE_ERROR_INVALID_INPUT -1
+
+#define AWS_DATE_MAX_LENGTH 32
+
+typedef enum {
+    /* Wed, 24 May 2013 00:00:00 GMT */
+    AWS_DATE_FORMAT_RFC822,
+    /* 2013-05-24T00:00:00Z */
+    AWS_DATE_FORMAT_ISO8601,
+    /* 20130524T000000Z */
+    AWS_DATE_FORMAT_ISO8601_BASIC,
+    /* 2013-05-24T00:00:00.000Z */
+    AWS_DATE_FORMAT_ISO8601_FRACTIONAL,
+    /* 20130524 */
+    AWS_DATE_FORMAT_SHORT_BASIC,
+    /* 2013-05-24 */
+    AWS_DATE_FORMAT_SHORT,
+} aws_date_format;
+
+/*
+ * Parses `input` in `format`. RFC 822 dates are read with a one or two digit
+ * day and a GMT, UTC, UT or Z zone, or a numeric zone such as -0800; the day
+ * of the week is not checked against the date. Fractional ISO 8601 dates
+ * accept one to nine digits of fraction. Returns AWS_DATE_ERROR_INVALID_INPUT
+ * for anything else, including fields out of range and years that do not
+ * have four digits.
+ */
+int aws_date_parse(const char *input, size_t length, aws_date_format format, double *seconds);
+
+/*
+ * Formats `seconds` in `format`, truncating to whole seconds, or to whole
+ * milliseconds for AWS_DATE_FORMAT_ISO8601_FRACTIONAL. Returns 0 for dates
+ * outside the years 0 to 9999, which cannot be written with four digits.
+ */
+size_t aws_date_format_write(double seconds, aws_date_format format, char *output);
+
+/*
+ * Parses a decimal number of seconds, such as 1369353600 or -1.5, with an
+ * optional sign, fraction and exponent. Returns AWS_DATE_ERROR_INVALID_INPUT
+ * if `input` is not entirely such a number.
+ */
+int aws_date_parse_epoch(const char *input, size_t length, double *seconds);
+
+/*
+ * Writes `seconds` rounded to a whole number, as "%.0f" does.
+ */
+size_t aws_date_format_epoch(double seconds, char *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_DATE_H */
@@ -0,0 +1,278 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#include "aws_encoding.h"
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define AWS_ENCODING_NEON 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define AWS_ENCODING_SSSE3 1
+#endif
+
+static const char aws_hex_digits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+static const char aws_base64_alphabet[64] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+/* Nibble value of every byte, 0xFF for bytes that are not hex digits. */
+static const uint8_t aws_hex_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/* Sextet value of every byte, 0xFF for bytes outside the base64 alphabet. */
+static const uint8_t aws_base64_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/* --- Hex --- */
+
+void aws_hex_encode(const uint8_t *bytes, size_t length, char *output) {
+    size_t i = 0;
+
+#if defined(AWS_ENCODING_NEON)
+    const uint8x16_t digits = vld1q_u8((const uint8_t *)aws_hex_digits);
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t input = vld1q_u8(bytes + i);
+        uint8x16x2_t hex;
+        hex.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(input, 4));
+        hex.val[1] = vqtbl1q_u8(digits, vandq_u8(input, vdupq_n_u8(0x0F)));
+        vst2q_u8((uint8_t *)output + 2 * i, hex);
+    }
+#elif defined(AWS_ENCODING_SSSE3)
+    const __m128i digits = _mm_loadu_si128((const __m128i *)aws_hex_digits);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    for (; i + 16 <= length; i += 16) {
+        __m128i input = _mm_loadu_si128((const __m128i *)(bytes + i));
+        __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+        __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(input, mask));
+        _mm_storeu_si128((__m128i *)(output + 2 * i), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i *)(output + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+    }
+#endif
+
+    for (; i < length; i++) {
+        output[2 * i] = aws_hex_digits[bytes[i] >> 4];
+        output[2 * i + 1] = aws_hex_digits[bytes[i] & 0x0F];
+    }
+}
+
+int aws_hex_decode(const char *input, size_t length, uint8_t *output) {
+    if (length % 2 != 0) {
+        return AWS_ENCODING_ERROR_INVALID_INPUT;
+    }
+
+    const uint8_t *characters = (const uint8_t *)input;
+    uint8_t invalid = 0;
+    for (size_t i = 0; i < length / 2; i++) {
+        uint8_t high = aws_hex_values[characters[2 * i]];
+        uint8_t low = aws_hex_values[characters[2 * i + 1]];
+        /* Invalid digits have the high bit set; check once at the end instead of branching per byte. */
+        invalid |= high | low;
+        output[i] = (uint8_t)((high << 4) | (low & 0x0F));
+    }
+
+    return (invalid & 0x80) ? AWS_ENCODING_ERROR_INVALID_INPUT : AWS_ENCODING_OK;
+}
+
+/* --- Base64 --- */
+
+void aws_base64_encode(const uint8_t *bytes, size_t length, char *output) {
+    size_t i = 0;
+    char *out = output;
+
+#if defined(AWS_ENCODING_NEON)
+    /* 48 input bytes, deinterleaved into three vectors, become 64 characters. */
+    const uint8x16x4_t alphabet = vld1q_u8_x4((const uint8_t *)aws_base64_alphabet);
+    const uint8x16_t sextet = vdupq_n_u8(0x3F);
+    for (; i + 48 <= length; i += 48) {
+        uint8x16x3_t input = vld3q_u8(bytes + i);
+        uint8x16x4_t indices;
+        indices.val[0] = vshrq_n_u8(input.val[0], 2);
+        indices.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(input.val[0], 4), vshrq_n_u8(input.val[1], 4)), sextet);
+        indices.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(input.val[1], 2), vshrq_n_u8(input.val[2], 6)), sextet);
+        indices.val[3] = vandq_u8(input.val[2], sextet);
+
+        uint8x16x4_t characters;
+        characters.val[0] = vqtbl4q_u8(alphabet, indices.val[0]);
+        characters.val[1] = vqtbl4q_u8(alphabet, indices.val[1]);
+        characters.val[2] = vqtbl4q_u8(alphabet, indices.val[2]);
+        characters.val[3] = vqtbl4q_u8(alphabet, indices.val[3]);
+        vst4q_u8((uint8_t *)out, characters);
+        out += 64;
+    }
+#elif defined(AWS_ENCODING_SSSE3)
+    /*
+     * 12 input bytes become 16 characters. The sextets are moved into place
+     * with two multiplies, then mapped to ASCII by adding a per-range offset
+     * looked up with pshufb. Each iteration loads 16 bytes, so the loop stops
+     * while at least 4 bytes of slack remain.
+     */
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A', 0, 0);
+    for (; i + 16 <= length; i += 12) {
+        __m128i input = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)), shuffle);
+        __m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        __m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(high, low);
+
+        /* 0-25 -> 13, 26-51 -> 0, 52-61 -> 1-10, 62 -> 11, 63 -> 12 */
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        range = _mm_or_si128(range, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+        _mm_storeu_si128((__m128i *)out, _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range)));
+        out += 16;
+    }
+#endif
+
+    for (; i + 3 <= length; i += 3) {
+        uint32_t triple = ((uint32_t)bytes[i] << 16) | ((uint32_t)bytes[i + 1] << 8) | bytes[i + 2];
+        out[0] = aws_base64_alphabet[(triple >> 18) & 0x3F];
+        out[1] = aws_base64_alphabet[(triple >> 12) & 0x3F];
+        out[2] = aws_base64_alphabet[(triple >> 6) & 0x3F];
+        out[3] = aws_base64_alphabet[triple & 0x3F];
+        out += 4;
+    }
+
+    if (i < length) {
+        uint32_t triple = (uint32_t)bytes[i] << 16;
+        if (i + 1 < length) {
+            triple |= (uint32_t)bytes[i + 1] << 8;
+        }
+        out[0] = aws_base64_alphabet[(triple >> 18) & 0x3F];
+        out[1] = aws_base64_alphabet[(triple >> 12) & 0x3F];
+        out[2] = (i + 1 < length) ? aws_base64_alphabet[(triple >> 6) & 0x3F] : '=';
+        out[3] = '=';
+    }
+}
+
+int aws_base64_decode(const char *input, size_t length, uint8_t *output, size_t *output_length) {
+    const uint8_t *characters = (const uint8_t *)input;
+
+    /* Up to two padding characters are allowed, and only to complete the last quantum. */
+    size_t padding = 0;
+    while (padding < 2 && length > padding && characters[length - padding - 1] == '=') {
+        padding++;
+    }
+    if (padding > 0 && length % 4 != 0) {
+        return AWS_ENCODING_ERROR_INVALID_INPUT;
+    }
+    size_t remaining = length - padding;
+    if (remaining % 4 == 1) {
+        return AWS_ENCODING_ERROR_INVALID_INPUT;
+    }
+
+    size_t full = remaining - remaining % 4;
+    size_t i = 0;
+    uint8_t *out = output;
+
+#if defined(AWS_ENCODING_NEON)
+    /* 64 characters, deinterleaved into four vectors, become 48 bytes. */
+    const uint8x16x4_t low = vld1q_u8_x4(aws_base64_values);
+    const uint8x16x4_t high = vld1q_u8_x4(aws_base64_values + 64);
+    for (; i + 64 <= full; i += 64) {
+        uint8x16x4_t chunk = vld4q_u8(characters + i);
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int lane = 0; lane < 4; lane++) {
+            uint8x16_t c = chunk.val[lane];
+            /* Out of range indices read as 0 from vqtbl4q and leave the value alone in vqtbx4q. */
+            uint8x16_t value = vqtbx4q_u8(vqtbl4q_u8(low, c), high, vsubq_u8(c, vdupq_n_u8(64)));
+            invalid = vorrq_u8(invalid, vorrq_u8(value, c));
+            chunk.val[lane] = value;
+        }
+        if (vmaxvq_u8(invalid) & 0x80) {
+            return AWS_ENCODING_ERROR_INVALID_INPUT;
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(chunk.val[0], 2), vshrq_n_u8(chunk.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(chunk.val[1], 4), vshrq_n_u8(chunk.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(chunk.val[2], 6), chunk.val[3]);
+        vst3q_u8(out, bytes);
+        out += 48;
+    }
+#endif
+
+    for (; i < full; i += 4) {
+        uint8_t a = aws_base64_values[characters[i]];
+        uint8_t b = aws_base64_values[characters[i + 1]];
+        uint8_t c = aws_base64_values[characters[i + 2]];
+        uint8_t d = aws_base64_values[characters[i + 3]];
+        if ((a | b | c | d) & 0x80) {
+            return AWS_ENCODING_ERROR_INVALID_INPUT;
+        }
+        uint32_t triple = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+        out[0] = (uint8_t)(triple >> 16);
+        out[1] = (uint8_t)(triple >> 8);
+        out[2] = (uint8_t)triple;
+        out += 3;
+    }
+
+    if (i < remaining) {
+        uint8_t a = aws_base64_values[characters[i]];
+        uint8_t b = aws_base64_values[characters[i + 1]];
+        uint8_t c = (i + 2 < remaining) ? aws_base64_values[characters[i + 2]] : 0;
+        if ((a | b | c) & 0x80) {
+            return AWS_ENCODING_ERROR_INVALID_INPUT;
+        }
+        uint32_t triple = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6);
+        *out++ = (uint8_t)(triple >> 16);
+        if (i + 2 < remaining) {
+            *out++ = (uint8_t)(triple >> 8);
+        }
+    }
+
+    *output_length = (size_t)(out - output);
+    return AWS_ENCODING_OK;
+}
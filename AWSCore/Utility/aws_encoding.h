@@ -0,0 +1,68 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#ifndef AWS_ENCODING_H
+#define AWS_ENCODING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Byte oriented hex and base64 kernels.
+ *
+ * The encoders use NEON on ARM64 and SSSE3 on x86-64 when the target has
+ * them, and 256-entry lookup tables otherwise. Output buffers are sized by the
+ * caller with the length macros below and are not NUL terminated. Base64 uses
+ * the standard alphabet with '=' padding, as RFC 4648 section 4 describes.
+ */
+
+#define AWS_ENCODING_OK 0
+#define AWS_ENCODING_ERROR_INVALID_INPUT -1
+
+#define AWS_HEX_ENCODED_LENGTH(length) ((length) * 2)
+#define AWS_BASE64_ENCODED_LENGTH(length) ((((length) + 2) / 3) * 4)
+/* An upper bound; the exact length is returned by aws_base64_decode. */
+#define AWS_BASE64_DECODED_MAX_LENGTH(length) ((((length) + 3) / 4) * 3)
+
+/* Writes 2 * length lowercase hex characters to output. */
+void aws_hex_encode(const uint8_t *bytes, size_t length, char *output);
+
+/*
+ * Decodes length hex characters, in either case, into length / 2 bytes.
+ * Returns AWS_ENCODING_OK, or AWS_ENCODING_ERROR_INVALID_INPUT for an odd
+ * length or a character that is not a hex digit.
+ */
+int aws_hex_decode(const char *input, size_t length, uint8_t *output);
+
+/* Writes AWS_BASE64_ENCODED_LENGTH(length) characters to output. */
+void aws_base64_encode(const uint8_t *bytes, size_t length, char *output);
+
+/*
+ * Decodes base64 into output, which must hold AWS_BASE64_DECODED_MAX_LENGTH
+ * bytes, and stores the decoded length in output_length. Padding is optional.
+ * Returns AWS_ENCODING_OK, or AWS_ENCODING_ERROR_INVALID_INPUT for characters
+ * outside the alphabet, whitespace, misplaced padding or a truncated quantum.
+ */
+int aws_base64_decode(const char *input, size_t length, uint8_t *output, size_t *output_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AWS_ENCODING_H */
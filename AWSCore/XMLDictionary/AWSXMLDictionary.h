@@ -58,7 +58,7 @@ static NSString *const AWSXMLDictionaryNodeNameKey     = @"__name";
 static NSString *const AWSXMLDictionaryAttributePrefix = @"_";
 
 
-@interface AWSXMLDictionaryParser : NSObject <NSCopying>
+@interface AWSXMLDictionaryParser : NSObject <NSCopying, NSXMLParserDelegate>
 
 + (AWSXMLDictionaryParser *)sharedInstance;
 
@@ -77,6 +77,10 @@ static NSString *const AWSXMLDictionaryAttributePrefix = @"_";
 - (NSDictionary *)dictionaryWithString:(NSString *)string;
 - (NSDictionary *)dictionaryWithFile:(NSString *)path;
 
+// Returns the dictionary built from the parser events another parser delegate forwarded to the receiver, and resets
+// the receiver for the next document.
+- (NSDictionary *)dictionaryWithForwardedEvents;
+
 @end
 
 
@@ -98,6 +98,11 @@
 {
     [parser setDelegate:self];
     [parser parse];
+    return [self dictionaryWithForwardedEvents];
+}
+
+- (NSDictionary *)dictionaryWithForwardedEvents
+{
     id result = _root;
     _root = nil;
     _stack = nil;
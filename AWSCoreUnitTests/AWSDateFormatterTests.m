@@ -15,6 +15,9 @@
 
 #import <XCTest/XCTest.h>
 #import <AWSCore/AWSCore.h>
+#import "AWSTimestampSerialization.h"
+
+static NSUInteger const AWSDateFormatterBenchmarkIterations = 100000;
 
 @interface AWSDateFormatterTests : XCTestCase
 
@@ -158,4 +161,105 @@
     XCTAssertEqual([components second], 01);
 }
 
+#pragma mark - Formatter equivalence
+
+- (NSArray<NSString *> *)dateFormats {
+    return @[AWSDateRFC822DateFormat1,
+             AWSDateISO8601DateFormat1,
+             AWSDateISO8601DateFormat2,
+             AWSDateISO8601DateFormat3,
+             AWSDateShortDateFormat1,
+             AWSDateShortDateFormat2];
+}
+
+- (NSDateFormatter *)formatterWithFormat:(NSString *)dateFormat {
+    NSDateFormatter *dateFormatter = [NSDateFormatter new];
+    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
+    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    dateFormatter.dateFormat = dateFormat;
+    return dateFormatter;
+}
+
+- (void)test_aws_stringValue_matchesFormatter {
+    for (NSString *dateFormat in [self dateFormats]) {
+        NSDateFormatter *dateFormatter = [self formatterWithFormat:dateFormat];
+        for (NSUInteger i = 0; i < 2000; i++) {
+            // Whole milliseconds from 1600, after NSDateFormatter switches from the Julian calendar, to about 9000.
+            int64_t milliseconds = (int64_t)arc4random_uniform(UINT32_MAX) * 59000 + arc4random_uniform(1000) - 11676096000000;
+            NSDate *date = [NSDate dateWithTimeIntervalSince1970:milliseconds / 1000.0];
+            XCTAssertEqualObjects([dateFormatter stringFromDate:date], [date aws_stringValue:dateFormat]);
+        }
+        for (NSNumber *seconds in @[@0, @(-1), @(-0.001), @951782400, @951868799.999, @4107542399]) {
+            NSDate *date = [NSDate dateWithTimeIntervalSince1970:[seconds doubleValue]];
+            XCTAssertEqualObjects([dateFormatter stringFromDate:date], [date aws_stringValue:dateFormat]);
+        }
+    }
+}
+
+- (void)test_aws_dateFromString_matchesFormatter {
+    for (NSString *dateFormat in [self dateFormats]) {
+        NSDateFormatter *dateFormatter = [self formatterWithFormat:dateFormat];
+        for (NSUInteger i = 0; i < 2000; i++) {
+            NSDate *date = [NSDate dateWithTimeIntervalSince1970:(int64_t)arc4random_uniform(UINT32_MAX) * 7 - 2208988800];
+            NSString *string = [dateFormatter stringFromDate:date];
+            XCTAssertEqualObjects([dateFormatter dateFromString:string], [NSDate aws_dateFromString:string format:dateFormat]);
+            if (dateFormat != AWSDateShortDateFormat1 && dateFormat != AWSDateShortDateFormat2) {
+                XCTAssertEqualObjects([dateFormatter dateFromString:string], [NSDate aws_dateFromString:string]);
+            }
+        }
+    }
+}
+
+- (void)test_aws_dateFromString_rejectsInvalidDates {
+    XCTAssertNil([NSDate aws_dateFromString:@"2019-02-29T00:00:00Z" format:AWSDateISO8601DateFormat1]);
+    XCTAssertNil([NSDate aws_dateFromString:@"2019-13-01T00:00:00Z" format:AWSDateISO8601DateFormat1]);
+    XCTAssertNil([NSDate aws_dateFromString:@"20190102T034506" format:AWSDateISO8601DateFormat2]);
+    XCTAssertNil([NSDate aws_dateFromString:@"1548354061"]);
+    XCTAssertNil([NSDate aws_dateFromString:@"not a date"]);
+}
+
+- (void)test_aws_dateFromString_handlesNumericZones {
+    NSDate *date = [NSDate aws_dateFromString:@"Wed, 02 Jan 2019 03:45:06 -0800"];
+    XCTAssertEqualObjects([NSDate aws_dateFromString:@"2019-01-02T11:45:06Z"], date);
+}
+
+- (void)testTimestampSerializationParsesEpochSeconds {
+    XCTAssertEqualObjects([NSDate dateWithTimeIntervalSince1970:1548354061.605], [AWSTimestampSerialization parseTimestamp:@"1548354061.605"]);
+    XCTAssertEqualObjects([NSDate dateWithTimeIntervalSince1970:-1.5], [AWSTimestampSerialization parseTimestamp:@"-1.5"]);
+    XCTAssertEqualObjects([NSDate dateWithTimeIntervalSince1970:1548354061], [AWSTimestampSerialization parseTimestamp:@"2019-01-24T18:21:01Z"]);
+
+    NSString *timestamp = [AWSJSONTimestampSerialization serializeTimestamp:@{@"type" : @"timestamp"}
+                                                                      value:[NSDate dateWithTimeIntervalSince1970:1548354061.5]
+                                                                      error:nil];
+    XCTAssertEqualObjects([NSString stringWithFormat:@"%.lf", 1548354061.5], timestamp);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceFormatterRoundTrip {
+    NSDateFormatter *ISO8601Formatter = [self formatterWithFormat:AWSDateISO8601DateFormat2];
+    NSDateFormatter *RFC822Formatter = [self formatterWithFormat:AWSDateRFC822DateFormat1];
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1548354061];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSDateFormatterBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [ISO8601Formatter dateFromString:[ISO8601Formatter stringFromDate:date]];
+                [RFC822Formatter dateFromString:[RFC822Formatter stringFromDate:date]];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceRoundTrip {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1548354061];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSDateFormatterBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [NSDate aws_dateFromString:[date aws_stringValue:AWSDateISO8601DateFormat2] format:AWSDateISO8601DateFormat2];
+                [NSDate aws_dateFromString:[date aws_stringValue:AWSDateRFC822DateFormat1]];
+            }
+        }
+    }];
+}
+
 @end
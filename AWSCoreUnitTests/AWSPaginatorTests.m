@@ -0,0 +1,429 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+
+static NSUInteger const AWSPaginatorBenchmarkPages = 10;
+static useconds_t const AWSPaginatorBenchmarkLatency = 20000;
+
+@interface AWSPaginatorTestListRequest : AWSRequest
+
+@property (nonatomic, strong) NSNumber *maxResults;
+@property (nonatomic, strong) NSString *nextToken;
+
+@end
+
+@implementation AWSPaginatorTestListRequest
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"maxResults" : @"MaxResults",
+             @"nextToken" : @"NextToken",
+             };
+}
+
+@end
+
+@interface AWSPaginatorTestListOutput : AWSModel
+
+@property (nonatomic, strong) NSArray<NSString *> *items;
+@property (nonatomic, strong) NSString *nextToken;
+
+@end
+
+@implementation AWSPaginatorTestListOutput
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"items" : @"Items",
+             @"nextToken" : @"NextToken",
+             };
+}
+
+@end
+
+@interface AWSPaginatorTestScanRequest : AWSRequest
+
+@property (nonatomic, strong) NSDictionary *exclusiveStartKey;
+@property (nonatomic, strong) NSNumber *limit;
+
+@end
+
+@implementation AWSPaginatorTestScanRequest
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"exclusiveStartKey" : @"ExclusiveStartKey",
+             @"limit" : @"Limit",
+             };
+}
+
+@end
+
+@interface AWSPaginatorTestScanOutput : AWSModel
+
+@property (nonatomic, strong) NSDictionary *lastEvaluatedKey;
+
+@end
+
+@implementation AWSPaginatorTestScanOutput
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"lastEvaluatedKey" : @"LastEvaluatedKey",
+             };
+}
+
+@end
+
+@interface AWSPaginatorTestObject : AWSModel
+
+@property (nonatomic, strong) NSString *key;
+
+@end
+
+@implementation AWSPaginatorTestObject
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"key" : @"Key",
+             };
+}
+
+@end
+
+// An S3 ListObjects request and output.
+@interface AWSPaginatorTestObjectsRequest : AWSRequest
+
+@property (nonatomic, strong) NSString *marker;
+@property (nonatomic, strong) NSNumber *maxKeys;
+
+@end
+
+@implementation AWSPaginatorTestObjectsRequest
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"marker" : @"Marker",
+             @"maxKeys" : @"MaxKeys",
+             };
+}
+
+@end
+
+@interface AWSPaginatorTestObjectsOutput : AWSModel
+
+@property (nonatomic, strong) NSArray<AWSPaginatorTestObject *> *contents;
+@property (nonatomic, strong) NSNumber *isTruncated;
+@property (nonatomic, strong) NSString *nextMarker;
+
+@end
+
+@implementation AWSPaginatorTestObjectsOutput
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"contents" : @"Contents",
+             @"isTruncated" : @"IsTruncated",
+             @"nextMarker" : @"NextMarker",
+             };
+}
+
+@end
+
+@interface AWSPaginatorTests : XCTestCase
+
+@property (nonatomic, strong) NSMutableArray *requestedTokens;
+
+@end
+
+@implementation AWSPaginatorTests
+
+- (void)setUp {
+    [super setUp];
+    self.requestedTokens = [NSMutableArray new];
+}
+
+- (AWSPaginatorTestListOutput *)pageWithItemCount:(NSUInteger)itemCount nextToken:(NSString *)nextToken {
+    AWSPaginatorTestListOutput *page = [AWSPaginatorTestListOutput new];
+    NSMutableArray *items = [NSMutableArray new];
+    for (NSUInteger i = 0; i < itemCount; i++) {
+        [items addObject:[NSString stringWithFormat:@"item%lu", (unsigned long)i]];
+    }
+    page.items = items;
+    page.nextToken = nextToken;
+    return page;
+}
+
+// A loader for `pageCount` pages of two items, whose tokens are "1", "2", ... Pages are returned synchronously, or
+// after `latency` on another queue.
+- (AWSTask *(^)(AWSPaginatorTestListRequest *))loaderWithPageCount:(NSUInteger)pageCount latency:(useconds_t)latency {
+    NSMutableArray *requestedTokens = self.requestedTokens;
+    return ^AWSTask *(AWSPaginatorTestListRequest *request) {
+        @synchronized(requestedTokens) {
+            [requestedTokens addObject:request.nextToken ?: [NSNull null]];
+        }
+        NSUInteger index = [request.nextToken integerValue];
+        NSString *nextToken = index + 1 < pageCount ? [NSString stringWithFormat:@"%lu", (unsigned long)(index + 1)] : nil;
+        AWSPaginatorTestListOutput *page = [self pageWithItemCount:2 nextToken:nextToken];
+        if (latency == 0) {
+            return [AWSTask taskWithResult:page];
+        }
+        AWSTaskCompletionSource *taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, latency * NSEC_PER_USEC), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            [taskCompletionSource trySetResult:page];
+        });
+        return taskCompletionSource.task;
+    };
+}
+
+- (NSUInteger)requestCount {
+    @synchronized(self.requestedTokens) {
+        return [self.requestedTokens count];
+    }
+}
+
+- (void)testInfersKeysFromModelMappings {
+    AWSPaginator *listPaginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                          responseClass:[AWSPaginatorTestListOutput class]
+                                                             pageLoader:[self loaderWithPageCount:1 latency:0]];
+    XCTAssertEqualObjects(@"nextToken", listPaginator.inputTokenKey);
+    XCTAssertEqualObjects(@"nextToken", listPaginator.outputTokenKey);
+    XCTAssertEqualObjects(@"maxResults", listPaginator.limitKey);
+    XCTAssertNil(listPaginator.moreResultsKey);
+
+    AWSPaginator *scanPaginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestScanRequest new]
+                                                          responseClass:[AWSPaginatorTestScanOutput class]
+                                                             pageLoader:^AWSTask *(AWSRequest *request) {
+                                                                 return [AWSTask taskWithResult:nil];
+                                                             }];
+    XCTAssertEqualObjects(@"exclusiveStartKey", scanPaginator.inputTokenKey);
+    XCTAssertEqualObjects(@"lastEvaluatedKey", scanPaginator.outputTokenKey);
+    XCTAssertEqualObjects(@"limit", scanPaginator.limitKey);
+
+    XCTAssertNil([[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                         responseClass:[AWSPaginatorTestScanOutput class]
+                                            pageLoader:[self loaderWithPageCount:1 latency:0]]);
+}
+
+- (void)testReturnsPagesInOrder {
+    AWSPaginatorTestListRequest *request = [AWSPaginatorTestListRequest new];
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:request
+                                                      responseClass:[AWSPaginatorTestListOutput class]
+                                                         pageLoader:^AWSTask *(AWSPaginatorTestListRequest *pageRequest) {
+                                                             XCTAssertEqualObjects(@25, pageRequest.maxResults);
+                                                             return [self loaderWithPageCount:3 latency:0](pageRequest);
+                                                         }];
+    paginator.pageSize = @25;
+
+    NSMutableArray *tokens = [NSMutableArray new];
+    AWSTask *task = [paginator enumeratePagesUsingBlock:^(AWSPaginatorTestListOutput *page, BOOL *stop) {
+        [tokens addObject:page.nextToken ?: [NSNull null]];
+    }];
+    [task waitUntilFinished];
+
+    XCTAssertNil(task.error);
+    XCTAssertEqualObjects((@[@"1", @"2", [NSNull null]]), tokens);
+    XCTAssertEqualObjects((@[[NSNull null], @"1", @"2"]), self.requestedTokens);
+    XCTAssertTrue(paginator.isFinished);
+    XCTAssertNil([paginator nextPage].result);
+
+    // The caller's request is not modified.
+    XCTAssertNil(request.nextToken);
+    XCTAssertNil(request.maxResults);
+}
+
+- (void)testPrefetchesUpToLookaheadDepth {
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                      responseClass:[AWSPaginatorTestListOutput class]
+                                                         pageLoader:[self loaderWithPageCount:10 latency:0]];
+    XCTAssertEqual(0, [self requestCount]);
+
+    [[paginator nextPage] waitUntilFinished];
+    XCTAssertEqual(2, [self requestCount]);
+
+    paginator.lookaheadDepth = 3;
+    [[paginator nextPage] waitUntilFinished];
+    XCTAssertEqual(5, [self requestCount]);
+
+    paginator.lookaheadDepth = 0;
+    for (NSUInteger i = 0; i < 4; i++) {
+        [[paginator nextPage] waitUntilFinished];
+    }
+    XCTAssertEqual(6, [self requestCount]);
+}
+
+- (void)testBoundsBufferedCost {
+    AWSPaginator<AWSPaginatorTestListRequest *, AWSPaginatorTestListOutput *> *paginator =
+        [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                responseClass:[AWSPaginatorTestListOutput class]
+                                   pageLoader:[self loaderWithPageCount:10 latency:0]];
+    paginator.lookaheadDepth = 5;
+    paginator.maximumBufferedCost = 3;
+    paginator.pageCost = ^NSUInteger(AWSPaginatorTestListOutput *page) {
+        return [page.items count];
+    };
+
+    // The first page is returned, and pages are prefetched until the two buffered pages cost 4.
+    [[paginator nextPage] waitUntilFinished];
+    XCTAssertEqual(3, [self requestCount]);
+
+    [[paginator nextPage] waitUntilFinished];
+    XCTAssertEqual(4, [self requestCount]);
+}
+
+- (void)testStopsOnRepeatedToken {
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                      inputTokenKey:@"nextToken"
+                                                     outputTokenKey:@"nextToken"
+                                                         pageLoader:^AWSTask *(AWSRequest *request) {
+                                                             return [AWSTask taskWithResult:[self pageWithItemCount:1 nextToken:@"same"]];
+                                                         }];
+
+    AWSTask *first = [paginator nextPage];
+    AWSTask *second = [paginator nextPage];
+    AWSTask *third = [paginator nextPage];
+    XCTAssertNotNil(first.result);
+    XCTAssertNotNil(second.result);
+    XCTAssertEqualObjects(AWSPaginatorErrorDomain, third.error.domain);
+    XCTAssertEqual(AWSPaginatorErrorRepeatedToken, third.error.code);
+    XCTAssertTrue(paginator.isFinished);
+}
+
+- (AWSPaginatorTestObjectsOutput *)objectsPageWithKeys:(NSArray<NSString *> *)keys truncated:(BOOL)truncated {
+    AWSPaginatorTestObjectsOutput *page = [AWSPaginatorTestObjectsOutput new];
+    NSMutableArray *contents = [NSMutableArray new];
+    for (NSString *key in keys) {
+        AWSPaginatorTestObject *object = [AWSPaginatorTestObject new];
+        object.key = key;
+        [contents addObject:object];
+    }
+    page.contents = contents;
+    page.isTruncated = @(truncated);
+    return page;
+}
+
+- (void)testTruncatedPageWithoutNextMarkerContinuesFromLastKey {
+    NSMutableArray *markers = [NSMutableArray new];
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestObjectsRequest new]
+                                                      responseClass:[AWSPaginatorTestObjectsOutput class]
+                                                         pageLoader:^AWSTask *(AWSPaginatorTestObjectsRequest *request) {
+                                                             [markers addObject:request.marker ?: [NSNull null]];
+                                                             if (!request.marker) {
+                                                                 return [AWSTask taskWithResult:[self objectsPageWithKeys:@[@"a", @"b"] truncated:YES]];
+                                                             }
+                                                             return [AWSTask taskWithResult:[self objectsPageWithKeys:@[@"c"] truncated:NO]];
+                                                         }];
+    XCTAssertEqualObjects(@"isTruncated", paginator.moreResultsKey);
+
+    __block NSUInteger pageCount = 0;
+    AWSTask *task = [paginator enumeratePagesUsingBlock:^(id page, BOOL *stop) {
+        pageCount++;
+    }];
+    [task waitUntilFinished];
+
+    XCTAssertNil(task.error);
+    XCTAssertEqual(2, pageCount);
+    XCTAssertEqualObjects((@[[NSNull null], @"b"]), markers);
+}
+
+- (void)testTruncatedPageWithoutAnyTokenFails {
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestObjectsRequest new]
+                                                      responseClass:[AWSPaginatorTestObjectsOutput class]
+                                                         pageLoader:^AWSTask *(AWSRequest *request) {
+                                                             return [AWSTask taskWithResult:[self objectsPageWithKeys:@[] truncated:YES]];
+                                                         }];
+
+    XCTAssertNotNil([paginator nextPage].result);
+    AWSTask *next = [paginator nextPage];
+    XCTAssertEqualObjects(AWSPaginatorErrorDomain, next.error.domain);
+    XCTAssertEqual(AWSPaginatorErrorMissingToken, next.error.code);
+}
+
+- (void)testPropagatesPageErrors {
+    NSError *error = [NSError errorWithDomain:AWSServiceErrorDomain code:AWSServiceErrorThrottling userInfo:nil];
+    __block NSUInteger requestCount = 0;
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                      responseClass:[AWSPaginatorTestListOutput class]
+                                                         pageLoader:^AWSTask *(AWSRequest *request) {
+                                                             if (requestCount++ == 0) {
+                                                                 return [AWSTask taskWithResult:[self pageWithItemCount:1 nextToken:@"1"]];
+                                                             }
+                                                             return [AWSTask taskWithError:error];
+                                                         }];
+
+    // The first page is returned even though the prefetched second page failed.
+    XCTAssertNotNil([paginator nextPage].result);
+    XCTAssertEqualObjects(error, [paginator nextPage].error);
+    XCTAssertEqualObjects(error, [paginator nextPage].error);
+    XCTAssertEqual(2, requestCount);
+}
+
+- (void)testCancel {
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                      responseClass:[AWSPaginatorTestListOutput class]
+                                                         pageLoader:[self loaderWithPageCount:10 latency:AWSPaginatorBenchmarkLatency]];
+    AWSTask *page = [paginator nextPage];
+    [paginator cancel];
+    [page waitUntilFinished];
+
+    XCTAssertEqual(AWSPaginatorErrorCancelled, page.error.code);
+    XCTAssertEqual(AWSPaginatorErrorCancelled, [paginator nextPage].error.code);
+    XCTAssertEqual(1, [self requestCount]);
+}
+
+- (void)testEnumerationStops {
+    AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                      responseClass:[AWSPaginatorTestListOutput class]
+                                                         pageLoader:[self loaderWithPageCount:10 latency:0]];
+    __block NSUInteger pageCount = 0;
+    AWSTask *task = [paginator enumeratePagesUsingBlock:^(id page, BOOL *stop) {
+        *stop = ++pageCount == 2;
+    }];
+    [task waitUntilFinished];
+
+    XCTAssertNil(task.error);
+    XCTAssertEqual(2, pageCount);
+    XCTAssertEqual(3, [self requestCount]);
+    XCTAssertTrue(paginator.isFinished);
+}
+
+#pragma mark - Benchmarks
+
+// Every page takes AWSPaginatorBenchmarkLatency to load and as long to process.
+- (void)measurePagesWithLookaheadDepth:(NSUInteger)lookaheadDepth {
+    [self measureBlock:^{
+        AWSPaginator *paginator = [[AWSPaginator alloc] initWithRequest:[AWSPaginatorTestListRequest new]
+                                                          responseClass:[AWSPaginatorTestListOutput class]
+                                                             pageLoader:[self loaderWithPageCount:AWSPaginatorBenchmarkPages latency:AWSPaginatorBenchmarkLatency]];
+        paginator.lookaheadDepth = lookaheadDepth;
+        AWSTask *task = [paginator enumeratePagesUsingBlock:^(id page, BOOL *stop) {
+            usleep(AWSPaginatorBenchmarkLatency);
+        }];
+        [task waitUntilFinished];
+        XCTAssertNil(task.error);
+    }];
+}
+
+- (void)testPerformanceSequentialPages {
+    [self measurePagesWithLookaheadDepth:0];
+}
+
+- (void)testPerformancePrefetchedPages {
+    [self measurePagesWithLookaheadDepth:1];
+}
+
+@end
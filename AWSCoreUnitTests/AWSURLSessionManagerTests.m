@@ -16,6 +16,10 @@
 #import <XCTest/XCTest.h>
 #import "AWSCore.h"
 #import "AWSTestUtility.h"
+#import "AWSLocalHTTPServer.h"
+
+static NSUInteger const AWSURLSessionManagerBenchmarkRequestCount = 512;
+static NSTimeInterval const AWSURLSessionManagerBenchmarkLatency = 0.005;
 
 @interface AWSCognitoIdentity()
 
@@ -31,10 +35,116 @@
 
 @interface AWSURLSessionManager()
 
+@property (nonatomic, strong) NSURLSession *session;
+@property (nonatomic, strong) AWSRetryQuota *retryQuota;
+@property (nonatomic, strong) AWSClientSideRateLimiter *rateLimiter;
+
 - (void)invalidate;
 
 @end
 
+// Serializes every request into the same POST body.
+@interface AWSURLSessionManagerTestSerializer : NSObject <AWSURLRequestSerializer>
+
+@property (nonatomic, assign) BOOL readOnlyOperation;
+
+@end
+
+@implementation AWSURLSessionManagerTestSerializer
+
+- (AWSTask *)serializeRequest:(NSMutableURLRequest *)request headers:(NSDictionary *)headers parameters:(NSDictionary *)parameters {
+    request.HTTPBody = [@"{\"TableName\":\"Music\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    return [AWSTask taskWithResult:nil];
+}
+
+- (AWSTask *)validateRequest:(NSURLRequest *)request {
+    return [AWSTask taskWithResult:nil];
+}
+
+- (BOOL)isReadOnlyOperation {
+    return self.readOnlyOperation;
+}
+
+@end
+
+// Records the responses it is given.
+@interface AWSURLSessionManagerTestCacheStorage : NSObject <AWSURLResponseCacheStorage>
+
+@property (nonatomic, assign) NSUInteger maximumDataLength;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSCachedURLResponse *> *cachedResponses;
+
+@end
+
+@implementation AWSURLSessionManagerTestCacheStorage
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _cachedResponses = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (AWSCachedURLResponse *)cachedResponseForKey:(NSString *)key {
+    return self.cachedResponses[key];
+}
+
+- (void)storeCachedResponse:(AWSCachedURLResponse *)cachedResponse forKey:(NSString *)key {
+    self.cachedResponses[key] = cachedResponse;
+}
+
+- (void)removeCachedResponseForKey:(NSString *)key {
+    [self.cachedResponses removeObjectForKey:key];
+}
+
+- (void)removeAllCachedResponses {
+    [self.cachedResponses removeAllObjects];
+}
+
+@end
+
+// Fails 429 responses with a throttling error, and returns the body of the others.
+@interface AWSURLSessionManagerTestResponseSerializer : NSObject <AWSHTTPURLResponseSerializer>
+
+@end
+
+@implementation AWSURLSessionManagerTestResponseSerializer
+
+- (BOOL)validateResponse:(NSHTTPURLResponse *)response
+             fromRequest:(NSURLRequest *)request
+                    data:(id)data
+                   error:(NSError *__autoreleasing *)error {
+    return YES;
+}
+
+- (id)responseObjectForResponse:(NSHTTPURLResponse *)response
+                originalRequest:(NSURLRequest *)originalRequest
+                 currentRequest:(NSURLRequest *)currentRequest
+                           data:(id)data
+                          error:(NSError *__autoreleasing *)error {
+    if (response.statusCode == 429 && error) {
+        *error = [NSError errorWithDomain:AWSServiceErrorDomain code:AWSServiceErrorThrottling userInfo:nil];
+    }
+    return data;
+}
+
+@end
+
+// Retries without waiting between attempts.
+@interface AWSURLSessionManagerTestRetryHandler : AWSURLRequestRetryHandler
+
+@end
+
+@implementation AWSURLSessionManagerTestRetryHandler
+
+- (NSTimeInterval)timeIntervalForRetry:(uint32_t)currentRetryCount
+                              response:(NSHTTPURLResponse *)response
+                                  data:(NSData *)data
+                                 error:(NSError *)error {
+    return 0;
+}
+
+@end
+
 @interface AWSURLSessionManagerTests : XCTestCase
 
 @end
@@ -113,4 +223,1041 @@
     }] waitUntilFinished];
 }
 
+#pragma mark - Connections
+
+- (AWSLocalHTTPServer *)startServerWithLatency:(NSTimeInterval)latency {
+    AWSLocalHTTPServer *server = [[AWSLocalHTTPServer alloc] initWithHandler:^AWSLocalHTTPServerResponse *(AWSLocalHTTPServerRequest *request) {
+        AWSLocalHTTPServerResponse *response = [AWSLocalHTTPServerResponse responseWithStatusCode:200
+                                                                                          headers:@{@"Content-Type" : @"application/json"}
+                                                                                             body:[@"{\"Item\":{}}" dataUsingEncoding:NSUTF8StringEncoding]];
+        response.delay = latency;
+        return response;
+    }];
+    NSError *error = nil;
+    XCTAssertTrue([server start:&error], @"%@", error);
+    return server;
+}
+
+- (AWSNetworkingConfiguration *)configurationForServer:(AWSLocalHTTPServer *)server {
+    AWSNetworkingConfiguration *configuration = [AWSNetworkingConfiguration new];
+    configuration.baseURL = server.URL;
+    return configuration;
+}
+
+- (AWSTask *)sendRequestToSessionManager:(AWSURLSessionManager *)sessionManager index:(NSUInteger)index {
+    AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+    request.URLString = [NSString stringWithFormat:@"/items/%lu", (unsigned long)index];
+    request.HTTPMethod = AWSHTTPMethodGET;
+    return [sessionManager dataTaskWithRequest:request];
+}
+
+- (AWSTask *)sendRequestCount:(NSUInteger)count toSessionManager:(AWSURLSessionManager *)sessionManager {
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+    for (NSUInteger i = 0; i < count; i++) {
+        [tasks addObject:[self sendRequestToSessionManager:sessionManager index:i]];
+    }
+    return [AWSTask taskForCompletionOfAllTasks:tasks];
+}
+
+// Sends `count` requests, with at most `concurrency` of them in flight, and returns how long they took.
+- (NSTimeInterval)timeToSendRequestCount:(NSUInteger)count
+                             concurrency:(NSUInteger)concurrency
+                        toSessionManager:(AWSURLSessionManager *)sessionManager {
+    dispatch_semaphore_t slots = dispatch_semaphore_create((long)concurrency);
+    dispatch_group_t group = dispatch_group_create();
+    __block NSUInteger failureCount = 0;
+    NSDate *start = [NSDate date];
+    for (NSUInteger i = 0; i < count; i++) {
+        dispatch_semaphore_wait(slots, DISPATCH_TIME_FOREVER);
+        dispatch_group_enter(group);
+        [[self sendRequestToSessionManager:sessionManager index:i] continueWithBlock:^id(AWSTask *task) {
+            if (task.error) {
+                @synchronized(self) {
+                    failureCount++;
+                }
+            }
+            dispatch_semaphore_signal(slots);
+            dispatch_group_leave(group);
+            return nil;
+        }];
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    XCTAssertEqual(failureCount, 0);
+    return -[start timeIntervalSinceNow];
+}
+
+- (void)testConfigurationCopiesConnectionSettings {
+    AWSNetworkingConfiguration *configuration = [AWSNetworkingConfiguration new];
+    configuration.HTTPMaximumConnectionsPerHost = 32;
+    configuration.HTTPShouldUsePipelining = YES;
+    configuration.waitsForConnectivity = YES;
+    configuration.sharesURLSession = YES;
+    configuration.responseCache = [AWSURLResponseCache new];
+    configuration.retryMode = AWSRetryModeAdaptive;
+    configuration.hedgesReadRequests = YES;
+    configuration.hedgingDelayPercentile = 0.9;
+    configuration.maximumHedgedRequestRatio = 0.1;
+
+    AWSNetworkingConfiguration *copy = [configuration copy];
+    XCTAssertEqual(copy.HTTPMaximumConnectionsPerHost, 32);
+    XCTAssertTrue(copy.HTTPShouldUsePipelining);
+    XCTAssertTrue(copy.waitsForConnectivity);
+    XCTAssertTrue(copy.sharesURLSession);
+    XCTAssertEqual(copy.responseCache, configuration.responseCache);
+    XCTAssertEqual(copy.retryMode, AWSRetryModeAdaptive);
+    XCTAssertTrue(copy.hedgesReadRequests);
+    XCTAssertEqual(copy.hedgingDelayPercentile, 0.9);
+    XCTAssertEqual(copy.maximumHedgedRequestRatio, 0.1);
+}
+
+/**
+ - Given: A configuration with connection settings
+ - When: A session manager is created with the configuration
+ - Then: Its session uses the settings
+ */
+- (void)testSessionUsesConnectionSettings {
+    AWSNetworkingConfiguration *configuration = [AWSNetworkingConfiguration new];
+    configuration.baseURL = [NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"];
+    configuration.HTTPMaximumConnectionsPerHost = 32;
+    configuration.HTTPShouldUsePipelining = YES;
+    configuration.waitsForConnectivity = YES;
+    configuration.timeoutIntervalForRequest = 5;
+
+    AWSURLSessionManager *sessionManager = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+    NSURLSessionConfiguration *sessionConfiguration = sessionManager.session.configuration;
+    XCTAssertEqual(sessionConfiguration.HTTPMaximumConnectionsPerHost, 32);
+    XCTAssertTrue(sessionConfiguration.HTTPShouldUsePipelining);
+    XCTAssertTrue(sessionConfiguration.waitsForConnectivity);
+    XCTAssertEqual(sessionConfiguration.timeoutIntervalForRequest, 5);
+    [sessionManager invalidate];
+}
+
+/**
+ - Given: Configurations of clients that share sessions
+ - When: Session managers are created with the configurations
+ - Then: Clients of the same endpoint with the same settings share a session, and the others do not
+ */
+- (void)testClientsOfAnEndpointShareSession {
+    AWSNetworkingConfiguration *configuration = [AWSNetworkingConfiguration new];
+    configuration.baseURL = [NSURL URLWithString:@"https://s3.us-east-1.amazonaws.com"];
+    configuration.sharesURLSession = YES;
+
+    AWSNetworkingConfiguration *otherEndpoint = [configuration copy];
+    otherEndpoint.baseURL = [NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"];
+    AWSNetworkingConfiguration *otherSettings = [configuration copy];
+    otherSettings.HTTPMaximumConnectionsPerHost = 16;
+    AWSNetworkingConfiguration *notShared = [configuration copy];
+    notShared.sharesURLSession = NO;
+
+    AWSURLSessionManager *first = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+    AWSURLSessionManager *second = [[AWSURLSessionManager alloc] initWithConfiguration:[configuration copy]];
+    NSArray<AWSURLSessionManager *> *others = @[[[AWSURLSessionManager alloc] initWithConfiguration:otherEndpoint],
+                                                [[AWSURLSessionManager alloc] initWithConfiguration:otherSettings],
+                                                [[AWSURLSessionManager alloc] initWithConfiguration:notShared]];
+
+    XCTAssertEqual(first.session, second.session);
+    for (AWSURLSessionManager *other in others) {
+        XCTAssertNotEqual(first.session, other.session);
+        [other invalidate];
+    }
+    [first invalidate];
+    [second invalidate];
+}
+
+/**
+ - Given: Two session managers that share a session
+ - When: One of them is invalidated
+ - Then: The other still sends requests through the session
+ */
+- (void)testSharedSessionOutlivesInvalidatedClient {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0];
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.sharesURLSession = YES;
+
+    AWSURLSessionManager *first = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+    AWSURLSessionManager *second = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+    AWSTask *inFlight = [self sendRequestToSessionManager:first index:0];
+    [first invalidate];
+
+    AWSTask *task = [self sendRequestCount:8 toSessionManager:second];
+    [task waitUntilFinished];
+    [inFlight waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertNil(inFlight.error);
+    XCTAssertEqual(server.requestCount, 9);
+
+    AWSTask *rejected = [self sendRequestToSessionManager:first index:0];
+    [rejected waitUntilFinished];
+    XCTAssertEqual(rejected.error.code, AWSNetworkingErrorSessionInvalid);
+
+    [second invalidate];
+    [server stop];
+}
+
+/**
+ - Given: A session manager limited to 2 connections per host
+ - When: 16 requests are sent at once
+ - Then: At most 2 requests are in flight at the server
+ */
+- (void)testConnectionLimitBoundsConcurrentRequests {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0.05];
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.HTTPMaximumConnectionsPerHost = 2;
+
+    AWSURLSessionManager *sessionManager = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+    AWSTask *task = [self sendRequestCount:16 toSessionManager:sessionManager];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual(server.requestCount, 16);
+    XCTAssertLessThanOrEqual(server.maximumConcurrentRequestCount, 2);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+#pragma mark - Coalescing
+
+- (AWSURLSessionManager *)sessionManagerForServer:(AWSLocalHTTPServer *)server coalescing:(BOOL)coalescing {
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.coalescesIdenticalRequests = coalescing;
+    return [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+}
+
+- (NSArray<AWSTask *> *)sendIdenticalRequestCount:(NSUInteger)count
+                                 toSessionManager:(AWSURLSessionManager *)sessionManager
+                                       HTTPMethod:(AWSHTTPMethod)HTTPMethod
+                                       serializer:(id<AWSURLRequestSerializer>)serializer {
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+    for (NSUInteger i = 0; i < count; i++) {
+        AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+        request.URLString = @"/items/1";
+        request.HTTPMethod = HTTPMethod;
+        request.requestSerializer = serializer;
+        [tasks addObject:[sessionManager dataTaskWithRequest:request]];
+    }
+    [[AWSTask taskForCompletionOfAllTasks:tasks] waitUntilFinished];
+    return tasks;
+}
+
+/**
+ - Given: A session manager that coalesces identical requests
+ - When: Identical GET requests are sent at the same time
+ - Then: One request reaches the server, and every caller gets its response
+ */
+- (void)testIdenticalRequestsAreCoalesced {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0.1];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:YES];
+
+    NSArray<AWSTask *> *tasks = [self sendIdenticalRequestCount:8 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodGET serializer:nil];
+    XCTAssertEqual(server.requestCount, 1);
+    for (AWSTask *task in tasks) {
+        XCTAssertNil(task.error);
+        XCTAssertEqual(task.result, tasks.firstObject.result);
+    }
+    XCTAssertEqualObjects(tasks.firstObject.result, [@"{\"Item\":{}}" dataUsingEncoding:NSUTF8StringEncoding]);
+
+    // Requests sent after the response arrived are sent again.
+    [self sendIdenticalRequestCount:1 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodGET serializer:nil];
+    XCTAssertEqual(server.requestCount, 2);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testRequestsAreNotCoalescedByDefault {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0.1];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:NO];
+    [self sendIdenticalRequestCount:4 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodGET serializer:nil];
+    XCTAssertEqual(server.requestCount, 4);
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testDifferentRequestsAreNotCoalesced {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0.1];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:YES];
+    [[self sendRequestCount:4 toSessionManager:sessionManager] waitUntilFinished];
+    XCTAssertEqual(server.requestCount, 4);
+    [sessionManager invalidate];
+    [server stop];
+}
+
+/**
+ - Given: A session manager that coalesces identical requests
+ - When: Identical POST requests are sent at the same time
+ - Then: They are only coalesced if their operation is read-only
+ */
+- (void)testPostRequestsAreCoalescedOnlyForReadOnlyOperations {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0.1];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:YES];
+    AWSURLSessionManagerTestSerializer *serializer = [AWSURLSessionManagerTestSerializer new];
+
+    [self sendIdenticalRequestCount:4 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodPOST serializer:serializer];
+    XCTAssertEqual(server.requestCount, 4);
+
+    serializer.readOnlyOperation = YES;
+    [self sendIdenticalRequestCount:4 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodPOST serializer:serializer];
+    XCTAssertEqual(server.requestCount, 5);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+/**
+ - Given: Identical requests waiting for the one that was sent
+ - When: The request that was sent is cancelled
+ - Then: The waiting requests are sent and succeed
+ */
+- (void)testCancellingSentRequestSendsWaitingRequests {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:0.2];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:YES];
+
+    AWSNetworkingRequest *sentRequest = [AWSNetworkingRequest new];
+    sentRequest.URLString = @"/items/1";
+    sentRequest.HTTPMethod = AWSHTTPMethodGET;
+    AWSTask *sentTask = [sessionManager dataTaskWithRequest:sentRequest];
+    AWSTask *waitingTask = [self sendRequestToSessionManager:sessionManager index:1];
+    [sentRequest cancel];
+
+    [waitingTask waitUntilFinished];
+    [sentTask waitUntilFinished];
+    XCTAssertNotNil(sentTask.error);
+    XCTAssertNil(waitingTask.error);
+    XCTAssertNotNil(waitingTask.result);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+#pragma mark - Response cache
+
+- (NSURL *)temporaryDirectoryURL {
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    return [NSURL fileURLWithPath:path isDirectory:YES];
+}
+
+- (NSData *)bodyOfLength:(NSUInteger)length {
+    NSMutableData *body = [NSMutableData dataWithLength:length];
+    uint8_t *bytes = body.mutableBytes;
+    for (NSUInteger i = 0; i < length; i++) {
+        bytes[i] = (uint8_t)(i % 251);
+    }
+    return body;
+}
+
+- (AWSCachedURLResponse *)cachedResponseWithBody:(NSData *)body entityTag:(NSString *)entityTag {
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://example.com/items/1"]
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"ETag" : entityTag}];
+    return [[AWSCachedURLResponse alloc] initWithResponse:response data:body];
+}
+
+// Answers with `body` and the `"v1"` entity tag, or with 304 Not Modified when the request carries the tag.
+- (AWSLocalHTTPServer *)startServerWithBody:(NSData *)body latency:(NSTimeInterval)latency {
+    AWSLocalHTTPServer *server = [[AWSLocalHTTPServer alloc] initWithHandler:^AWSLocalHTTPServerResponse *(AWSLocalHTTPServerRequest *request) {
+        AWSLocalHTTPServerResponse *response = nil;
+        if ([request.headers[@"if-none-match"] isEqualToString:@"\"v1\""]) {
+            response = [AWSLocalHTTPServerResponse responseWithStatusCode:304 headers:@{@"ETag" : @"\"v1\""} body:nil];
+        } else {
+            response = [AWSLocalHTTPServerResponse responseWithStatusCode:200
+                                                                  headers:@{@"ETag" : @"\"v1\"",
+                                                                            @"Content-Type" : @"application/octet-stream"}
+                                                                     body:body];
+        }
+        response.delay = latency;
+        return response;
+    }];
+    NSError *error = nil;
+    XCTAssertTrue([server start:&error], @"%@", error);
+    return server;
+}
+
+- (AWSURLSessionManager *)sessionManagerForServer:(AWSLocalHTTPServer *)server responseCache:(AWSURLResponseCache *)responseCache {
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.responseCache = responseCache;
+    return [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+}
+
+- (AWSTask *)sendRequestForItem:(NSUInteger)index toSessionManager:(AWSURLSessionManager *)sessionManager {
+    AWSTask *task = [self sendRequestToSessionManager:sessionManager index:index];
+    [task waitUntilFinished];
+    return task;
+}
+
+/**
+ - Given: A session manager with a response cache
+ - When: A resource is read again and has not changed
+ - Then: The server answers 304 Not Modified, and the caller gets the cached body
+ */
+- (void)testRevalidatedResponsesAreServedFromCache {
+    NSData *body = [self bodyOfLength:64 * 1024];
+    AWSLocalHTTPServer *server = [self startServerWithBody:body latency:0];
+    NSURL *directoryURL = [self temporaryDirectoryURL];
+    AWSURLResponseCache *responseCache = [[AWSURLResponseCache alloc] initWithMemoryCapacity:1024 * 1024
+                                                                                 diskCapacity:1024 * 1024
+                                                                                 directoryURL:directoryURL];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server responseCache:responseCache];
+
+    AWSTask *firstTask = [self sendRequestForItem:1 toSessionManager:sessionManager];
+    XCTAssertNil(firstTask.error);
+    XCTAssertEqualObjects(firstTask.result, body);
+    XCTAssertEqual(responseCache.hitCount, 0);
+
+    AWSTask *secondTask = [self sendRequestForItem:1 toSessionManager:sessionManager];
+    XCTAssertNil(secondTask.error);
+    XCTAssertEqualObjects(secondTask.result, body);
+    XCTAssertEqual(server.requestCount, 2);
+    XCTAssertEqual(responseCache.lookupCount, 2);
+    XCTAssertEqual(responseCache.hitCount, 1);
+    XCTAssertEqual(responseCache.bytesSaved, body.length);
+    XCTAssertEqualWithAccuracy(responseCache.hitRate, 0.5, 0.001);
+
+    // Another item is not answered from the cache.
+    AWSTask *otherTask = [self sendRequestForItem:2 toSessionManager:sessionManager];
+    XCTAssertEqualObjects(otherTask.result, body);
+    XCTAssertEqual(responseCache.hitCount, 1);
+
+    [responseCache resetStatistics];
+    XCTAssertEqual(responseCache.lookupCount, 0);
+    XCTAssertEqual(responseCache.bytesSaved, 0);
+
+    [sessionManager invalidate];
+    [server stop];
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
+/**
+ - Given: A cached response
+ - When: The resource changes
+ - Then: The new response is returned and replaces the cached one
+ */
+- (void)testChangedResponsesReplaceCachedResponses {
+    __block NSString *entityTag = @"\"v1\"";
+    AWSLocalHTTPServer *server = [[AWSLocalHTTPServer alloc] initWithHandler:^AWSLocalHTTPServerResponse *(AWSLocalHTTPServerRequest *request) {
+        NSString *currentEntityTag = nil;
+        @synchronized(self) {
+            currentEntityTag = entityTag;
+        }
+        if ([request.headers[@"if-none-match"] isEqualToString:currentEntityTag]) {
+            return [AWSLocalHTTPServerResponse responseWithStatusCode:304 headers:@{@"ETag" : currentEntityTag} body:nil];
+        }
+        return [AWSLocalHTTPServerResponse responseWithStatusCode:200
+                                                          headers:@{@"ETag" : currentEntityTag}
+                                                             body:[currentEntityTag dataUsingEncoding:NSUTF8StringEncoding]];
+    }];
+    NSError *error = nil;
+    XCTAssertTrue([server start:&error], @"%@", error);
+    NSURL *directoryURL = [self temporaryDirectoryURL];
+    AWSURLResponseCache *responseCache = [[AWSURLResponseCache alloc] initWithMemoryCapacity:1024 * 1024
+                                                                                 diskCapacity:1024 * 1024
+                                                                                 directoryURL:directoryURL];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server responseCache:responseCache];
+
+    [self sendRequestForItem:1 toSessionManager:sessionManager];
+    @synchronized(self) {
+        entityTag = @"\"v2\"";
+    }
+    AWSTask *changedTask = [self sendRequestForItem:1 toSessionManager:sessionManager];
+    XCTAssertEqualObjects(changedTask.result, [@"\"v2\"" dataUsingEncoding:NSUTF8StringEncoding]);
+    XCTAssertEqual(responseCache.hitCount, 0);
+
+    AWSTask *revalidatedTask = [self sendRequestForItem:1 toSessionManager:sessionManager];
+    XCTAssertEqualObjects(revalidatedTask.result, [@"\"v2\"" dataUsingEncoding:NSUTF8StringEncoding]);
+    XCTAssertEqual(responseCache.hitCount, 1);
+
+    [sessionManager invalidate];
+    [server stop];
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
+/**
+ - Given: A response cache whose storage keeps bodies of up to 1 KB
+ - When: A larger response replaces a cached one
+ - Then: The response is not handed to the storage, and the stale cached response is removed
+ */
+- (void)testResponsesLargerThanStorageAreNotStored {
+    AWSURLSessionManagerTestCacheStorage *storage = [AWSURLSessionManagerTestCacheStorage new];
+    storage.maximumDataLength = 1024;
+    AWSURLResponseCache *responseCache = [[AWSURLResponseCache alloc] initWithStorage:storage];
+    NSURLRequest *request = [NSURLRequest requestWithURL:[NSURL URLWithString:@"https://example.com/items/1"]];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:request.URL
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"ETag" : @"\"v1\""}];
+
+    NSData *data = [self bodyOfLength:1024];
+    [responseCache responseForResponse:response request:request cachedResponse:nil data:&data];
+    XCTAssertEqual(storage.cachedResponses.count, 1);
+
+    data = [self bodyOfLength:1025];
+    [responseCache responseForResponse:response request:request cachedResponse:nil data:&data];
+    XCTAssertEqual(storage.cachedResponses.count, 0);
+}
+
+- (void)testStorageEvictsLeastRecentlyUsedResponsesFromMemory {
+    AWSURLResponseCacheDefaultStorage *storage = [[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:300
+                                                                                                      diskCapacity:0
+                                                                                                      directoryURL:[self temporaryDirectoryURL]];
+    NSData *body = [self bodyOfLength:100];
+    for (NSString *key in @[@"a", @"b", @"c"]) {
+        [storage storeCachedResponse:[self cachedResponseWithBody:body entityTag:key] forKey:key];
+    }
+    XCTAssertNotNil([storage cachedResponseForKey:@"a"]);
+    [storage storeCachedResponse:[self cachedResponseWithBody:body entityTag:@"d"] forKey:@"d"];
+
+    XCTAssertNil([storage cachedResponseForKey:@"b"]);
+    for (NSString *key in @[@"a", @"c", @"d"]) {
+        XCTAssertEqualObjects([storage cachedResponseForKey:key].entityTag, key);
+    }
+    XCTAssertEqual(storage.currentMemoryUsage, 300);
+
+    // Responses larger than the capacity are not kept.
+    [storage storeCachedResponse:[self cachedResponseWithBody:[self bodyOfLength:301] entityTag:@"e"] forKey:@"e"];
+    XCTAssertNil([storage cachedResponseForKey:@"e"]);
+    XCTAssertNotNil([storage cachedResponseForKey:@"d"]);
+}
+
+- (void)testStorageEvictsLeastRecentlyUsedResponsesFromDisk {
+    NSURL *directoryURL = [self temporaryDirectoryURL];
+    AWSURLResponseCacheDefaultStorage *storage = [[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:0
+                                                                                                      diskCapacity:8 * 1024
+                                                                                                      directoryURL:directoryURL];
+    NSData *body = [self bodyOfLength:1024];
+    for (NSUInteger i = 0; i < 16; i++) {
+        NSString *key = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+        [storage storeCachedResponse:[self cachedResponseWithBody:body entityTag:key] forKey:key];
+    }
+
+    XCTAssertNil([storage cachedResponseForKey:@"0"]);
+    XCTAssertEqualObjects([storage cachedResponseForKey:@"15"].data, body);
+    XCTAssertGreaterThan(storage.currentDiskUsage, 0);
+    XCTAssertLessThanOrEqual(storage.currentDiskUsage, 8 * 1024);
+
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
+- (void)testStoragePersistsResponsesOnDisk {
+    NSURL *directoryURL = [self temporaryDirectoryURL];
+    AWSURLResponseCacheDefaultStorage *storage = [[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:1024 * 1024
+                                                                                                      diskCapacity:1024 * 1024
+                                                                                                      directoryURL:directoryURL];
+    NSData *body = [self bodyOfLength:1024];
+    [storage storeCachedResponse:[self cachedResponseWithBody:body entityTag:@"\"v1\""] forKey:@"key"];
+    // Waits for the write to finish.
+    XCTAssertNotNil([storage cachedResponseForKey:@"key"]);
+
+    AWSURLResponseCacheDefaultStorage *reopenedStorage = [[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:1024 * 1024
+                                                                                                              diskCapacity:1024 * 1024
+                                                                                                              directoryURL:directoryURL];
+    AWSCachedURLResponse *cachedResponse = [reopenedStorage cachedResponseForKey:@"key"];
+    XCTAssertEqual(cachedResponse.statusCode, 200);
+    XCTAssertEqualObjects(cachedResponse.entityTag, @"\"v1\"");
+    XCTAssertEqualObjects(cachedResponse.data, body);
+    XCTAssertEqual(reopenedStorage.currentDiskUsage, storage.currentDiskUsage);
+
+    [reopenedStorage removeAllCachedResponses];
+    XCTAssertNil([reopenedStorage cachedResponseForKey:@"key"]);
+    XCTAssertEqual(reopenedStorage.currentDiskUsage, 0);
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:directoryURL.path]);
+}
+
+- (void)testDefaultStoragesUseSeparateDirectories {
+    NSURL *directoryURL = nil;
+    @autoreleasepool {
+        AWSURLResponseCacheDefaultStorage *storage = [[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:0
+                                                                                                          diskCapacity:1024 * 1024
+                                                                                                          directoryURL:nil];
+        AWSURLResponseCacheDefaultStorage *otherStorage = [[AWSURLResponseCacheDefaultStorage alloc] initWithMemoryCapacity:0
+                                                                                                               diskCapacity:1024 * 1024
+                                                                                                               directoryURL:nil];
+        XCTAssertNotEqualObjects(storage.directoryURL, otherStorage.directoryURL);
+
+        NSData *body = [self bodyOfLength:1024];
+        [storage storeCachedResponse:[self cachedResponseWithBody:body entityTag:@"\"v1\""] forKey:@"key"];
+        [otherStorage storeCachedResponse:[self cachedResponseWithBody:body entityTag:@"\"v2\""] forKey:@"key"];
+        [otherStorage removeAllCachedResponses];
+
+        XCTAssertEqualObjects([storage cachedResponseForKey:@"key"].entityTag, @"\"v1\"");
+        XCTAssertNil([otherStorage cachedResponseForKey:@"key"]);
+        directoryURL = storage.directoryURL;
+        XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:directoryURL.path]);
+    }
+
+    // A storage removes the directory it created when it is deallocated.
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:directoryURL.path]);
+}
+
+#pragma mark - Hedging
+
+// Answers each request after the latency returned for it, given the number of requests received before it.
+- (AWSLocalHTTPServer *)startServerWithLatencies:(NSTimeInterval (^)(AWSLocalHTTPServerRequest *request, NSUInteger receivedCount))latencyForRequest {
+    NSObject *lock = [NSObject new];
+    __block NSUInteger receivedCount = 0;
+    AWSLocalHTTPServer *server = [[AWSLocalHTTPServer alloc] initWithHandler:^AWSLocalHTTPServerResponse *(AWSLocalHTTPServerRequest *request) {
+        NSTimeInterval latency = 0;
+        @synchronized(lock) {
+            latency = latencyForRequest(request, receivedCount++);
+        }
+        AWSLocalHTTPServerResponse *response = [AWSLocalHTTPServerResponse responseWithStatusCode:200
+                                                                                          headers:@{@"Content-Type" : @"application/json"}
+                                                                                             body:[@"{\"Item\":{}}" dataUsingEncoding:NSUTF8StringEncoding]];
+        response.delay = latency;
+        return response;
+    }];
+    NSError *error = nil;
+    XCTAssertTrue([server start:&error], @"%@", error);
+    return server;
+}
+
+// Answers the request for item `i` in 5 to 14 ms, depending on `i`, except the first request for every `interval`th
+// item, which takes `slowLatency`. A hedged request for a slow item is answered as fast as the others.
+- (AWSLocalHTTPServer *)startServerWithSlowRequestEvery:(NSUInteger)interval latency:(NSTimeInterval)slowLatency {
+    NSMutableSet<NSString *> *receivedPaths = [NSMutableSet new];
+    return [self startServerWithLatencies:^NSTimeInterval(AWSLocalHTTPServerRequest *request, NSUInteger receivedCount) {
+        NSUInteger index = (NSUInteger)[request.path.lastPathComponent integerValue];
+        BOOL firstRequest = ![receivedPaths containsObject:request.path];
+        [receivedPaths addObject:request.path];
+        return firstRequest && (index + 1) % interval == 0 ? slowLatency : 0.005 + (index % 10) / 1000.0;
+    }];
+}
+
+- (AWSURLSessionManager *)sessionManagerForServer:(AWSLocalHTTPServer *)server
+                                hedgingWithBudget:(double)maximumHedgedRequestRatio {
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.HTTPMaximumConnectionsPerHost = 16;
+    configuration.hedgesReadRequests = maximumHedgedRequestRatio > 0;
+    configuration.maximumHedgedRequestRatio = maximumHedgedRequestRatio;
+    return [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+}
+
+// Sends `count` reads, with at most `concurrency` of them in flight, and returns their latencies in ascending order.
+- (NSArray<NSNumber *> *)latenciesOfReadCount:(NSUInteger)count
+                                  concurrency:(NSUInteger)concurrency
+                             toSessionManager:(AWSURLSessionManager *)sessionManager {
+    dispatch_semaphore_t slots = dispatch_semaphore_create((long)concurrency);
+    dispatch_group_t group = dispatch_group_create();
+    NSMutableArray<NSNumber *> *latencies = [NSMutableArray new];
+    __block NSUInteger failureCount = 0;
+    for (NSUInteger i = 0; i < count; i++) {
+        dispatch_semaphore_wait(slots, DISPATCH_TIME_FOREVER);
+        dispatch_group_enter(group);
+        NSTimeInterval start = [NSProcessInfo processInfo].systemUptime;
+        [[self sendRequestToSessionManager:sessionManager index:i] continueWithBlock:^id(AWSTask *task) {
+            @synchronized(latencies) {
+                [latencies addObject:@([NSProcessInfo processInfo].systemUptime - start)];
+                if (task.error) {
+                    failureCount++;
+                }
+            }
+            dispatch_semaphore_signal(slots);
+            dispatch_group_leave(group);
+            return nil;
+        }];
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    XCTAssertEqual(failureCount, 0);
+    return [latencies sortedArrayUsingSelector:@selector(compare:)];
+}
+
+- (NSTimeInterval)latencyAtPercentile:(double)percentile ofLatencies:(NSArray<NSNumber *> *)latencies {
+    return [latencies[MIN(latencies.count - 1, (NSUInteger)(percentile * latencies.count))] doubleValue];
+}
+
+/**
+ - Given: A session manager that hedges reads, and has seen enough reads to know their usual latency
+ - When: A read is much slower than usual
+ - Then: It is sent again, and completes with the response of the second request
+ */
+- (void)testSlowReadsAreHedged {
+    __block BOOL slowRequestReceived = NO;
+    AWSLocalHTTPServer *server = [self startServerWithLatencies:^NSTimeInterval(AWSLocalHTTPServerRequest *request, NSUInteger receivedCount) {
+        if ([request.path isEqualToString:@"/items/24"] && !slowRequestReceived) {
+            slowRequestReceived = YES;
+            return 2;
+        }
+        return 0.005;
+    }];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:1];
+
+    NSArray<NSNumber *> *latencies = [self latenciesOfReadCount:25 concurrency:1 toSessionManager:sessionManager];
+    XCTAssertTrue(slowRequestReceived);
+    XCTAssertLessThan([latencies.lastObject doubleValue], 1);
+    XCTAssertGreaterThan(server.requestCount, 25);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+/**
+ - Given: A slow read that was hedged
+ - When: The first request fails without a response while the hedged request is in flight
+ - Then: The read completes with the response of the hedged request
+ */
+- (void)testReadFailingWithoutResponseIsAnsweredByHedgedRequest {
+    NSObject *lock = [NSObject new];
+    __block AWSNetworkingRequest *slowRequest = nil;
+    __block NSUInteger slowRequestCount = 0;
+    AWSLocalHTTPServer *server = [self startServerWithLatencies:^NSTimeInterval(AWSLocalHTTPServerRequest *request, NSUInteger receivedCount) {
+        if (![request.path isEqualToString:@"/items/24"]) {
+            return 0.005;
+        }
+        slowRequestCount++;
+        if (slowRequestCount == 1) {
+            return 2;
+        }
+        // The hedged request is in flight: the connection of the first one fails.
+        @synchronized(lock) {
+            [slowRequest.task cancel];
+        }
+        return 0.2;
+    }];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:1];
+    [self latenciesOfReadCount:24 concurrency:1 toSessionManager:sessionManager];
+
+    AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+    request.URLString = @"/items/24";
+    request.HTTPMethod = AWSHTTPMethodGET;
+    @synchronized(lock) {
+        slowRequest = request;
+    }
+    AWSTask *task = [sessionManager dataTaskWithRequest:request];
+    [task waitUntilFinished];
+    XCTAssertEqual(slowRequestCount, 2);
+    XCTAssertNil(task.error);
+    XCTAssertNotNil(task.result);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+/**
+ - Given: A session manager that hedges reads
+ - When: A request that is not a read is much slower than usual
+ - Then: It is not sent again
+ */
+- (void)testWritesAreNotHedged {
+    __block NSUInteger writeCount = 0;
+    AWSLocalHTTPServer *server = [self startServerWithLatencies:^NSTimeInterval(AWSLocalHTTPServerRequest *request, NSUInteger receivedCount) {
+        if ([request.HTTPMethod isEqualToString:@"POST"]) {
+            writeCount++;
+            return 0.5;
+        }
+        return 0.005;
+    }];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:1];
+    [self latenciesOfReadCount:24 concurrency:1 toSessionManager:sessionManager];
+
+    NSArray<AWSTask *> *tasks = [self sendIdenticalRequestCount:1
+                                               toSessionManager:sessionManager
+                                                     HTTPMethod:AWSHTTPMethodPOST
+                                                     serializer:[AWSURLSessionManagerTestSerializer new]];
+    XCTAssertNil(tasks.firstObject.error);
+    XCTAssertEqual(writeCount, 1);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+/**
+ - Given: A service whose latency has a slow tail
+ - When: Reads are sent with hedging
+ - Then: Slow reads are hedged, and no more than the budgeted fraction of the reads
+ */
+- (void)testHedgingStaysWithinBudget {
+    NSUInteger readCount = 300;
+    AWSLocalHTTPServer *server = [self startServerWithSlowRequestEvery:50 latency:0.3];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:0.1];
+    [self latenciesOfReadCount:readCount concurrency:4 toSessionManager:sessionManager];
+    NSUInteger hedgedRequestCount = server.requestCount - readCount;
+    XCTAssertGreaterThan(hedgedRequestCount, 0);
+    XCTAssertLessThanOrEqual(hedgedRequestCount, readCount / 10);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+#pragma mark - Retry modes
+
+// Answers 429 Too Many Requests while `throttling` returns YES, and 200 OK otherwise.
+- (AWSLocalHTTPServer *)startServerThrottlingWhile:(BOOL (^)(void))throttling {
+    AWSLocalHTTPServer *server = [[AWSLocalHTTPServer alloc] initWithHandler:^AWSLocalHTTPServerResponse *(AWSLocalHTTPServerRequest *request) {
+        if (throttling()) {
+            return [AWSLocalHTTPServerResponse responseWithStatusCode:429
+                                                              headers:@{@"Content-Type" : @"application/json"}
+                                                                 body:[@"{\"__type\":\"ThrottlingException\"}" dataUsingEncoding:NSUTF8StringEncoding]];
+        }
+        return [AWSLocalHTTPServerResponse responseWithStatusCode:200
+                                                          headers:@{@"Content-Type" : @"application/json"}
+                                                             body:[@"{\"Item\":{}}" dataUsingEncoding:NSUTF8StringEncoding]];
+    }];
+    NSError *error = nil;
+    XCTAssertTrue([server start:&error], @"%@", error);
+    return server;
+}
+
+- (AWSURLSessionManager *)sessionManagerForServer:(AWSLocalHTTPServer *)server retryMode:(AWSRetryMode)retryMode {
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.retryMode = retryMode;
+    return [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+}
+
+- (AWSTask *)sendRetriedRequestToSessionManager:(AWSURLSessionManager *)sessionManager index:(NSUInteger)index {
+    AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+    request.URLString = [NSString stringWithFormat:@"/items/%lu", (unsigned long)index];
+    request.HTTPMethod = AWSHTTPMethodGET;
+    request.responseSerializer = [AWSURLSessionManagerTestResponseSerializer new];
+    request.retryHandler = [[AWSURLSessionManagerTestRetryHandler alloc] initWithMaximumRetryCount:3];
+    return [sessionManager dataTaskWithRequest:request];
+}
+
+/**
+ - Given: A session manager in standard retry mode, with a retry quota for two retries
+ - When: The service throttles every request
+ - Then: Requests are retried until the quota is drained and are then sent only once, and a success gives a token back
+ */
+- (void)testStandardRetryModeStopsRetryingWhenQuotaIsDrained {
+    __block BOOL throttling = YES;
+    NSObject *lock = [NSObject new];
+    AWSLocalHTTPServer *server = [self startServerThrottlingWhile:^BOOL{
+        @synchronized(lock) {
+            return throttling;
+        }
+    }];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server retryMode:AWSRetryModeStandard];
+    sessionManager.retryQuota = [[AWSRetryQuota alloc] initWithCapacity:10];
+
+    // The first request is sent three times: the third attempt finds the quota empty.
+    AWSTask *firstTask = [self sendRetriedRequestToSessionManager:sessionManager index:0];
+    [firstTask waitUntilFinished];
+    XCTAssertEqualObjects(firstTask.error.domain, AWSServiceErrorDomain);
+    XCTAssertEqual(firstTask.error.code, AWSServiceErrorThrottling);
+    XCTAssertEqual(server.requestCount, 3);
+    XCTAssertEqual(sessionManager.retryQuota.availableTokens, 0);
+
+    // Without a quota, each of these would be sent four times.
+    for (NSUInteger i = 1; i <= 2; i++) {
+        AWSTask *task = [self sendRetriedRequestToSessionManager:sessionManager index:i];
+        [task waitUntilFinished];
+        XCTAssertEqual(task.error.code, AWSServiceErrorThrottling);
+    }
+    XCTAssertEqual(server.requestCount, 5);
+
+    @synchronized(lock) {
+        throttling = NO;
+    }
+    AWSTask *successfulTask = [self sendRetriedRequestToSessionManager:sessionManager index:3];
+    [successfulTask waitUntilFinished];
+    XCTAssertNil(successfulTask.error);
+    XCTAssertEqual(server.requestCount, 6);
+    XCTAssertEqual(sessionManager.retryQuota.availableTokens, 1);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+/**
+ - Given: A session manager in adaptive retry mode
+ - When: The service throttles a request
+ - Then: The next request waits in the rate limiter until a token is available, and is sent then
+ */
+- (void)testAdaptiveRetryModeHoldsRequestsBackAfterThrottling {
+    __block NSUInteger throttledCount = 1;
+    NSObject *lock = [NSObject new];
+    AWSLocalHTTPServer *server = [self startServerThrottlingWhile:^BOOL{
+        @synchronized(lock) {
+            if (throttledCount == 0) {
+                return NO;
+            }
+            throttledCount--;
+            return YES;
+        }
+    }];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server retryMode:AWSRetryModeAdaptive];
+
+    // The limiter runs on a clock and a scheduler driven by the test, so that nothing is let through behind its back.
+    __block NSTimeInterval now = 0;
+    NSMutableArray<dispatch_block_t> *scheduledBlocks = [NSMutableArray new];
+    sessionManager.rateLimiter = [[AWSClientSideRateLimiter alloc] initWithClock:^NSTimeInterval{
+        @synchronized(lock) {
+            return now;
+        }
+    } scheduler:^(NSTimeInterval delay, dispatch_block_t block) {
+        @synchronized(lock) {
+            [scheduledBlocks addObject:block];
+        }
+    }];
+
+    // Before any throttling, requests are let through as they come.
+    AWSTask *throttledTask = [self sendRequestToSessionManager:sessionManager index:0];
+    [throttledTask waitUntilFinished];
+    XCTAssertEqual(server.requestCount, 1);
+    XCTAssertTrue(sessionManager.rateLimiter.isEnabled);
+
+    AWSTask *heldTask = [self sendRequestToSessionManager:sessionManager index:1];
+    for (NSUInteger i = 0; i < 200 && sessionManager.rateLimiter.waitingCount == 0; i++) {
+        [NSThread sleepForTimeInterval:0.01];
+    }
+    XCTAssertEqual(sessionManager.rateLimiter.waitingCount, 1);
+    XCTAssertFalse(heldTask.isCompleted);
+    XCTAssertEqual(server.requestCount, 1);
+
+    NSTimeInterval tokenInterval = 1 / sessionManager.rateLimiter.sendingRate;
+    NSArray<dispatch_block_t> *blocks = nil;
+    @synchronized(lock) {
+        now += tokenInterval;
+        blocks = [scheduledBlocks copy];
+        [scheduledBlocks removeAllObjects];
+    }
+    XCTAssertEqual(blocks.count, 1);
+    for (dispatch_block_t block in blocks) {
+        block();
+    }
+    [heldTask waitUntilFinished];
+    XCTAssertNil(heldTask.error);
+    XCTAssertEqual(sessionManager.rateLimiter.waitingCount, 0);
+    XCTAssertEqual(server.requestCount, 2);
+
+    [sessionManager invalidate];
+    [server stop];
+}
+
+#pragma mark - Benchmarks
+
+// Logs the throughput at 1 to 256 concurrent requests, with the default connection limit and with raised limits.
+- (void)testThroughputAcrossConcurrencyLevels {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:AWSURLSessionManagerBenchmarkLatency];
+    for (NSNumber *connectionLimit in @[@0, @16, @64, @256]) {
+        AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+        configuration.HTTPMaximumConnectionsPerHost = [connectionLimit integerValue];
+        AWSURLSessionManager *sessionManager = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+        for (NSUInteger concurrency = 1; concurrency <= 256; concurrency *= 4) {
+            NSTimeInterval time = [self timeToSendRequestCount:AWSURLSessionManagerBenchmarkRequestCount
+                                                   concurrency:concurrency
+                                              toSessionManager:sessionManager];
+            NSLog(@"%3lu connections per host, %3lu concurrent requests: %6.0f requests/s",
+                  (unsigned long)sessionManager.session.configuration.HTTPMaximumConnectionsPerHost,
+                  (unsigned long)concurrency,
+                  AWSURLSessionManagerBenchmarkRequestCount / time);
+        }
+        [sessionManager invalidate];
+    }
+    [server stop];
+}
+
+// Logs the median and tail latency of reads from a service with a slow tail, without and with hedging.
+- (void)testTailLatencyWithAndWithoutHedging {
+    NSUInteger readCount = 300;
+    for (NSNumber *budget in @[@0, @0.1]) {
+        AWSLocalHTTPServer *server = [self startServerWithSlowRequestEvery:50 latency:0.3];
+        AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:[budget doubleValue]];
+        NSArray<NSNumber *> *latencies = [self latenciesOfReadCount:readCount concurrency:4 toSessionManager:sessionManager];
+        NSLog(@"Hedging budget %.0f%%: p50 %.1f ms, p99 %.1f ms, %lu hedged requests",
+              [budget doubleValue] * 100,
+              [self latencyAtPercentile:0.5 ofLatencies:latencies] * 1000,
+              [self latencyAtPercentile:0.99 ofLatencies:latencies] * 1000,
+              (unsigned long)(server.requestCount - readCount));
+        [sessionManager invalidate];
+        [server stop];
+    }
+}
+
+- (void)testPerformanceConcurrentRequestsWithDefaultConnectionLimit {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:AWSURLSessionManagerBenchmarkLatency];
+    AWSURLSessionManager *sessionManager = [[AWSURLSessionManager alloc] initWithConfiguration:[self configurationForServer:server]];
+    [self measureBlock:^{
+        [self timeToSendRequestCount:AWSURLSessionManagerBenchmarkRequestCount
+                         concurrency:256
+                    toSessionManager:sessionManager];
+    }];
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testPerformanceConcurrentRequestsWithRaisedConnectionLimit {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:AWSURLSessionManagerBenchmarkLatency];
+    AWSNetworkingConfiguration *configuration = [self configurationForServer:server];
+    configuration.HTTPMaximumConnectionsPerHost = 64;
+    AWSURLSessionManager *sessionManager = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+    [self measureBlock:^{
+        [self timeToSendRequestCount:AWSURLSessionManagerBenchmarkRequestCount
+                         concurrency:256
+                    toSessionManager:sessionManager];
+    }];
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testPerformanceIdenticalRequestsWithoutCoalescing {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:AWSURLSessionManagerBenchmarkLatency];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:NO];
+    [self measureBlock:^{
+        [self sendIdenticalRequestCount:64 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodGET serializer:nil];
+    }];
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testPerformanceIdenticalRequestsWithCoalescing {
+    AWSLocalHTTPServer *server = [self startServerWithLatency:AWSURLSessionManagerBenchmarkLatency];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server coalescing:YES];
+    [self measureBlock:^{
+        [self sendIdenticalRequestCount:64 toSessionManager:sessionManager HTTPMethod:AWSHTTPMethodGET serializer:nil];
+    }];
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testPerformanceReadsWithSlowTailWithoutHedging {
+    // Every run starts a server of its own, so that the same items are slow in every run.
+    [self measureBlock:^{
+        AWSLocalHTTPServer *server = [self startServerWithSlowRequestEvery:50 latency:0.3];
+        AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:0];
+        [self latenciesOfReadCount:128 concurrency:4 toSessionManager:sessionManager];
+        [sessionManager invalidate];
+        [server stop];
+    }];
+}
+
+- (void)testPerformanceReadsWithSlowTailWithHedging {
+    // Every run starts a server of its own, so that the same items are slow in every run.
+    [self measureBlock:^{
+        AWSLocalHTTPServer *server = [self startServerWithSlowRequestEvery:50 latency:0.3];
+        AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server hedgingWithBudget:0.1];
+        [self latenciesOfReadCount:128 concurrency:4 toSessionManager:sessionManager];
+        [sessionManager invalidate];
+        [server stop];
+    }];
+}
+
+- (void)testPerformanceRepeatedReadsWithoutResponseCache {
+    AWSLocalHTTPServer *server = [self startServerWithBody:[self bodyOfLength:256 * 1024] latency:AWSURLSessionManagerBenchmarkLatency];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server responseCache:nil];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 32; i++) {
+            [self sendRequestForItem:i % 4 toSessionManager:sessionManager];
+        }
+    }];
+    [sessionManager invalidate];
+    [server stop];
+}
+
+- (void)testPerformanceRepeatedReadsWithResponseCache {
+    AWSLocalHTTPServer *server = [self startServerWithBody:[self bodyOfLength:256 * 1024] latency:AWSURLSessionManagerBenchmarkLatency];
+    NSURL *directoryURL = [self temporaryDirectoryURL];
+    AWSURLResponseCache *responseCache = [[AWSURLResponseCache alloc] initWithMemoryCapacity:4 * 1024 * 1024
+                                                                                 diskCapacity:4 * 1024 * 1024
+                                                                                 directoryURL:directoryURL];
+    AWSURLSessionManager *sessionManager = [self sessionManagerForServer:server responseCache:responseCache];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 32; i++) {
+            [self sendRequestForItem:i % 4 toSessionManager:sessionManager];
+        }
+    }];
+    NSLog(@"Response cache hit rate: %.2f, bytes saved: %llu", responseCache.hitRate, responseCache.bytesSaved);
+    [sessionManager invalidate];
+    [server stop];
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
 @end
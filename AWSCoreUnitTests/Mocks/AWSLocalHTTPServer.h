@@ -0,0 +1,98 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface AWSLocalHTTPServerRequest : NSObject
+
+@property (nonatomic, readonly) NSString *HTTPMethod;
+/**
+ The request target, including the query string.
+ */
+@property (nonatomic, readonly) NSString *path;
+/**
+ The request headers, keyed by their lowercased names.
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSString *> *headers;
+@property (nonatomic, readonly) NSData *body;
+
+@end
+
+@interface AWSLocalHTTPServerResponse : NSObject
+
+@property (nonatomic, assign) NSInteger statusCode;
+@property (nonatomic, copy, nullable) NSDictionary<NSString *, NSString *> *headers;
+@property (nonatomic, copy, nullable) NSData *body;
+
+/**
+ How long the server waits before it writes the response, e.g. to stand in for the latency of a service.
+ */
+@property (nonatomic, assign) NSTimeInterval delay;
+
++ (instancetype)responseWithStatusCode:(NSInteger)statusCode
+                               headers:(nullable NSDictionary<NSString *, NSString *> *)headers
+                                  body:(nullable NSData *)body;
+
+@end
+
+/**
+ Returns the response to a request. It is called on the queue of the request's connection, so it may be called for
+ several connections at once.
+ */
+typedef AWSLocalHTTPServerResponse *_Nonnull (^AWSLocalHTTPServerHandler)(AWSLocalHTTPServerRequest *request);
+
+/**
+ A minimal HTTP/1.1 server on the loopback interface, which stands in for a service endpoint in tests and benchmarks.
+ Connections are kept alive, and the requests of a connection are answered in order. Request bodies must be sent with
+ a `Content-Length` header.
+ */
+@interface AWSLocalHTTPServer : NSObject
+
+/**
+ The URL of the server, e.g. `http://127.0.0.1:49152`, once it is started.
+ */
+@property (nonatomic, readonly, nullable) NSURL *URL;
+
+/**
+ The number of connections the server accepted.
+ */
+@property (readonly) NSUInteger connectionCount;
+
+/**
+ The number of requests the server received.
+ */
+@property (readonly) NSUInteger requestCount;
+
+/**
+ The largest number of requests that were received and not yet answered at the same time.
+ */
+@property (readonly) NSUInteger maximumConcurrentRequestCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+- (instancetype)initWithHandler:(AWSLocalHTTPServerHandler)handler;
+
+- (BOOL)start:(NSError *__autoreleasing *)error;
+
+/**
+ Stops accepting connections and closes the open ones.
+ */
+- (void)stop;
+
+@end
+
+NS_ASSUME_NONNULL_END
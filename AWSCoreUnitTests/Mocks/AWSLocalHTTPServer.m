@@ -0,0 +1,406 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSLocalHTTPServer.h"
+
+#import <arpa/inet.h>
+#import <fcntl.h>
+#import <netinet/in.h>
+#import <netinet/tcp.h>
+#import <sys/socket.h>
+#import <unistd.h>
+
+@class AWSLocalHTTPServerConnection;
+
+#pragma mark - AWSLocalHTTPServerRequest
+
+@interface AWSLocalHTTPServerRequest()
+
+@property (nonatomic, strong) NSString *HTTPMethod;
+@property (nonatomic, strong) NSString *path;
+@property (nonatomic, strong) NSDictionary<NSString *, NSString *> *headers;
+@property (nonatomic, strong) NSData *body;
+
+@end
+
+@implementation AWSLocalHTTPServerRequest
+
+@end
+
+#pragma mark - AWSLocalHTTPServerResponse
+
+@interface AWSLocalHTTPServerResponse()
+
+- (NSData *)dataForRequest:(AWSLocalHTTPServerRequest *)request;
+
+@end
+
+@implementation AWSLocalHTTPServerResponse
+
++ (instancetype)responseWithStatusCode:(NSInteger)statusCode
+                               headers:(NSDictionary<NSString *, NSString *> *)headers
+                                  body:(NSData *)body {
+    AWSLocalHTTPServerResponse *response = [self new];
+    response.statusCode = statusCode;
+    response.headers = headers;
+    response.body = body;
+    return response;
+}
+
+- (NSString *)reasonPhrase {
+    switch (self.statusCode) {
+        case 200: return @"OK";
+        case 204: return @"No Content";
+        case 304: return @"Not Modified";
+        case 400: return @"Bad Request";
+        case 404: return @"Not Found";
+        case 429: return @"Too Many Requests";
+        case 500: return @"Internal Server Error";
+        case 503: return @"Service Unavailable";
+        default: return @"Status";
+    }
+}
+
+- (NSData *)dataForRequest:(AWSLocalHTTPServerRequest *)request {
+    NSData *body = self.body ?: [NSData data];
+    BOOL hasBody = ![request.HTTPMethod isEqualToString:@"HEAD"] && self.statusCode != 204 && self.statusCode != 304;
+
+    NSMutableString *head = [NSMutableString stringWithFormat:@"HTTP/1.1 %ld %@\r\n", (long)self.statusCode, [self reasonPhrase]];
+    [self.headers enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *value, BOOL *stop) {
+        [head appendFormat:@"%@: %@\r\n", name, value];
+    }];
+    if (hasBody && !self.headers[@"Content-Length"]) {
+        [head appendFormat:@"Content-Length: %lu\r\n", (unsigned long)body.length];
+    }
+    [head appendString:@"\r\n"];
+
+    NSMutableData *data = [[head dataUsingEncoding:NSUTF8StringEncoding] mutableCopy];
+    if (hasBody) {
+        [data appendData:body];
+    }
+    return data;
+}
+
+@end
+
+#pragma mark - AWSLocalHTTPServer
+
+@interface AWSLocalHTTPServer()
+
+@property (nonatomic, copy) AWSLocalHTTPServerHandler handler;
+@property (nonatomic, strong) NSURL *URL;
+
+- (AWSLocalHTTPServerResponse *)responseForRequest:(AWSLocalHTTPServerRequest *)request;
+- (void)requestDidComplete;
+- (void)connectionDidClose:(AWSLocalHTTPServerConnection *)connection;
+
+@end
+
+#pragma mark - AWSLocalHTTPServerConnection
+
+@interface AWSLocalHTTPServerConnection : NSObject
+
+- (instancetype)initWithSocket:(int)socket server:(AWSLocalHTTPServer *)server;
+- (void)close;
+
+@end
+
+@implementation AWSLocalHTTPServerConnection {
+    int _socket;
+    __weak AWSLocalHTTPServer *_server;
+    dispatch_queue_t _queue;
+    dispatch_source_t _readSource;
+    NSMutableData *_buffer;
+    BOOL _responding;
+    BOOL _closed;
+}
+
+- (instancetype)initWithSocket:(int)socket server:(AWSLocalHTTPServer *)server {
+    if (self = [super init]) {
+        _socket = socket;
+        _server = server;
+        _buffer = [NSMutableData new];
+        _queue = dispatch_queue_create("com.amazonaws.AWSLocalHTTPServerConnection", DISPATCH_QUEUE_SERIAL);
+        _readSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ, socket, 0, _queue);
+
+        __weak AWSLocalHTTPServerConnection *weakSelf = self;
+        dispatch_source_set_event_handler(_readSource, ^{
+            [weakSelf readAvailableData];
+        });
+        // The socket is closed once the source no longer watches it, so its descriptor can not be reused under it.
+        dispatch_source_set_cancel_handler(_readSource, ^{
+            close(socket);
+        });
+        dispatch_resume(_readSource);
+    }
+    return self;
+}
+
+- (void)close {
+    dispatch_async(_queue, ^{
+        [self closeOnQueue];
+    });
+}
+
+- (void)closeOnQueue {
+    if (_closed) {
+        return;
+    }
+    _closed = YES;
+    dispatch_source_cancel(_readSource);
+    [_server connectionDidClose:self];
+}
+
+- (void)readAvailableData {
+    if (_closed) {
+        return;
+    }
+    uint8_t bytes[65536];
+    ssize_t count = read(_socket, bytes, sizeof(bytes));
+    if (count <= 0) {
+        [self closeOnQueue];
+        return;
+    }
+    [_buffer appendBytes:bytes length:(NSUInteger)count];
+    [self respondToBufferedRequest];
+}
+
+- (void)respondToBufferedRequest {
+    if (_responding || _closed) {
+        return;
+    }
+    AWSLocalHTTPServerRequest *request = [self dequeueRequest];
+    AWSLocalHTTPServer *server = _server;
+    if (!request || !server) {
+        return;
+    }
+
+    _responding = YES;
+    AWSLocalHTTPServerResponse *response = [server responseForRequest:request];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(response.delay * NSEC_PER_SEC)), _queue, ^{
+        // The client may have closed the connection while the response was delayed, e.g. to cancel the request.
+        if (!self->_closed && ![self writeData:[response dataForRequest:request]]) {
+            [self closeOnQueue];
+        }
+        [server requestDidComplete];
+        self->_responding = NO;
+        [self respondToBufferedRequest];
+    });
+}
+
+- (AWSLocalHTTPServerRequest *)dequeueRequest {
+    NSData *separator = [@"\r\n\r\n" dataUsingEncoding:NSASCIIStringEncoding];
+    NSRange headEnd = [_buffer rangeOfData:separator options:0 range:NSMakeRange(0, _buffer.length)];
+    if (headEnd.location == NSNotFound) {
+        return nil;
+    }
+
+    NSString *head = [[NSString alloc] initWithData:[_buffer subdataWithRange:NSMakeRange(0, headEnd.location)]
+                                           encoding:NSUTF8StringEncoding];
+    NSArray<NSString *> *lines = [head componentsSeparatedByString:@"\r\n"];
+    NSArray<NSString *> *requestLine = [lines.firstObject componentsSeparatedByString:@" "];
+    if ([requestLine count] < 3) {
+        [self closeOnQueue];
+        return nil;
+    }
+
+    NSMutableDictionary<NSString *, NSString *> *headers = [NSMutableDictionary new];
+    for (NSString *line in [lines subarrayWithRange:NSMakeRange(1, [lines count] - 1)]) {
+        NSRange colon = [line rangeOfString:@":"];
+        if (colon.location == NSNotFound) {
+            continue;
+        }
+        NSString *name = [[line substringToIndex:colon.location] lowercaseString];
+        headers[name] = [[line substringFromIndex:NSMaxRange(colon)] stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+    }
+
+    NSUInteger bodyLocation = NSMaxRange(headEnd);
+    NSUInteger bodyLength = (NSUInteger)MAX([headers[@"content-length"] longLongValue], 0);
+    if (_buffer.length < bodyLocation + bodyLength) {
+        return nil;
+    }
+
+    AWSLocalHTTPServerRequest *request = [AWSLocalHTTPServerRequest new];
+    request.HTTPMethod = requestLine[0];
+    request.path = requestLine[1];
+    request.headers = headers;
+    request.body = [_buffer subdataWithRange:NSMakeRange(bodyLocation, bodyLength)];
+    [_buffer replaceBytesInRange:NSMakeRange(0, bodyLocation + bodyLength) withBytes:NULL length:0];
+    return request;
+}
+
+- (BOOL)writeData:(NSData *)data {
+    const uint8_t *bytes = data.bytes;
+    NSUInteger remaining = data.length;
+    while (remaining > 0) {
+        ssize_t written = write(_socket, bytes, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return NO;
+        }
+        bytes += written;
+        remaining -= (NSUInteger)written;
+    }
+    return YES;
+}
+
+@end
+
+@implementation AWSLocalHTTPServer {
+    dispatch_queue_t _queue;
+    dispatch_source_t _acceptSource;
+    NSMutableSet<AWSLocalHTTPServerConnection *> *_connections;
+    NSUInteger _connectionCount;
+    NSUInteger _requestCount;
+    NSUInteger _concurrentRequestCount;
+    NSUInteger _maximumConcurrentRequestCount;
+}
+
+- (instancetype)initWithHandler:(AWSLocalHTTPServerHandler)handler {
+    if (self = [super init]) {
+        _handler = [handler copy];
+        _queue = dispatch_queue_create("com.amazonaws.AWSLocalHTTPServer", DISPATCH_QUEUE_SERIAL);
+        _connections = [NSMutableSet new];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self stop];
+}
+
+- (BOOL)start:(NSError *__autoreleasing *)error {
+    int listeningSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (listeningSocket < 0) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+        }
+        return NO;
+    }
+
+    int on = 1;
+    setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_len = sizeof(address);
+    address.sin_family = AF_INET;
+    address.sin_port = 0;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addressLength = sizeof(address);
+    if (bind(listeningSocket, (struct sockaddr *)&address, sizeof(address)) != 0
+        || listen(listeningSocket, SOMAXCONN) != 0
+        || getsockname(listeningSocket, (struct sockaddr *)&address, &addressLength) != 0) {
+        int code = errno;
+        close(listeningSocket);
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:nil];
+        }
+        return NO;
+    }
+    fcntl(listeningSocket, F_SETFL, fcntl(listeningSocket, F_GETFL) | O_NONBLOCK);
+
+    self.URL = [NSURL URLWithString:[NSString stringWithFormat:@"http://127.0.0.1:%d", ntohs(address.sin_port)]];
+
+    _acceptSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ, listeningSocket, 0, _queue);
+    __weak AWSLocalHTTPServer *weakSelf = self;
+    dispatch_source_set_event_handler(_acceptSource, ^{
+        [weakSelf acceptConnectionsOfSocket:listeningSocket];
+    });
+    dispatch_source_set_cancel_handler(_acceptSource, ^{
+        close(listeningSocket);
+    });
+    dispatch_resume(_acceptSource);
+    return YES;
+}
+
+- (void)acceptConnectionsOfSocket:(int)listeningSocket {
+    while (YES) {
+        int connectionSocket = accept(listeningSocket, NULL, NULL);
+        if (connectionSocket < 0) {
+            return;
+        }
+        // Accepted sockets inherit O_NONBLOCK. Reads only happen when data is available, and writes may block.
+        fcntl(connectionSocket, F_SETFL, fcntl(connectionSocket, F_GETFL) & ~O_NONBLOCK);
+        int on = 1;
+        setsockopt(connectionSocket, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+        setsockopt(connectionSocket, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+        AWSLocalHTTPServerConnection *connection = [[AWSLocalHTTPServerConnection alloc] initWithSocket:connectionSocket
+                                                                                                 server:self];
+        @synchronized(self) {
+            _connectionCount++;
+            [_connections addObject:connection];
+        }
+    }
+}
+
+- (void)stop {
+    if (_acceptSource) {
+        dispatch_source_cancel(_acceptSource);
+        _acceptSource = nil;
+    }
+    NSSet<AWSLocalHTTPServerConnection *> *connections = nil;
+    @synchronized(self) {
+        connections = [_connections copy];
+        [_connections removeAllObjects];
+    }
+    for (AWSLocalHTTPServerConnection *connection in connections) {
+        [connection close];
+    }
+}
+
+- (AWSLocalHTTPServerResponse *)responseForRequest:(AWSLocalHTTPServerRequest *)request {
+    @synchronized(self) {
+        _requestCount++;
+        _concurrentRequestCount++;
+        _maximumConcurrentRequestCount = MAX(_maximumConcurrentRequestCount, _concurrentRequestCount);
+    }
+    return self.handler(request);
+}
+
+- (void)requestDidComplete {
+    @synchronized(self) {
+        _concurrentRequestCount--;
+    }
+}
+
+- (void)connectionDidClose:(AWSLocalHTTPServerConnection *)connection {
+    @synchronized(self) {
+        [_connections removeObject:connection];
+    }
+}
+
+- (NSUInteger)connectionCount {
+    @synchronized(self) {
+        return _connectionCount;
+    }
+}
+
+- (NSUInteger)requestCount {
+    @synchronized(self) {
+        return _requestCount;
+    }
+}
+
+- (NSUInteger)maximumConcurrentRequestCount {
+    @synchronized(self) {
+        return _maximumConcurrentRequestCount;
+    }
+}
+
+@end
@@ -0,0 +1,258 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <XCTest/XCTest.h>
+
+#import "AWSJSONBodyWriter.h"
+#import "AWSSerialization.h"
+#import "AWSSignature.h"
+
+static NSUInteger const AWSJSONBodyBenchmarkRecordCount = 500;
+static NSUInteger const AWSJSONBodyBenchmarkRecordLength = 1024;
+static NSUInteger const AWSJSONBodyBenchmarkIterations = 50;
+
+@interface AWSJSONBodyWriterTests : XCTestCase
+
+@end
+
+@implementation AWSJSONBodyWriterTests
+
+// A trimmed down Amazon Kinesis definition, with a few members of other shapes added to PutRecords.
+- (NSDictionary *)serviceDefinition {
+    return @{
+             @"metadata" : @{@"protocol" : @"json"},
+             @"operations" : @{
+                     @"PutRecords" : @{@"input" : @{@"shape" : @"PutRecordsInput"}},
+                     @"PutBlob" : @{@"input" : @{@"shape" : @"PutBlobInput"}},
+                     },
+             @"shapes" : @{
+                     @"PutRecordsInput" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Records" : @{@"shape" : @"PutRecordsRequestEntryList"},
+                                     @"StreamName" : @{@"shape" : @"String"},
+                                     @"Tags" : @{@"shape" : @"TagMap"},
+                                     @"Since" : @{@"shape" : @"Timestamp"},
+                                     @"Until" : @{@"shape" : @"Timestamp", @"timestampFormat" : @"iso8601"},
+                                     @"Limit" : @{@"shape" : @"Integer"},
+                                     @"Ratio" : @{@"shape" : @"Double"},
+                                     @"Enabled" : @{@"shape" : @"Boolean"},
+                                     @"RequestId" : @{@"shape" : @"String", @"location" : @"header", @"locationName" : @"x-amz-request-id"},
+                                     @"Alias" : @{@"shape" : @"String", @"locationName" : @"alias"},
+                                     @"Checkpoints" : @{@"shape" : @"TimestampList"},
+                                     @"Expirations" : @{@"shape" : @"TimestampMap"},
+                                     },
+                             },
+                     @"PutRecordsRequestEntryList" : @{@"type" : @"list", @"member" : @{@"shape" : @"PutRecordsRequestEntry"}},
+                     @"PutRecordsRequestEntry" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Data" : @{@"shape" : @"Data"},
+                                     @"ExplicitHashKey" : @{@"shape" : @"String"},
+                                     @"PartitionKey" : @{@"shape" : @"String"},
+                                     },
+                             },
+                     @"TagMap" : @{@"type" : @"map", @"key" : @{@"shape" : @"String"}, @"value" : @{@"shape" : @"String"}},
+                     @"TimestampList" : @{@"type" : @"list", @"member" : @{@"shape" : @"Timestamp", @"timestampFormat" : @"iso8601"}},
+                     @"TimestampMap" : @{
+                             @"type" : @"map",
+                             @"key" : @{@"shape" : @"String"},
+                             @"value" : @{@"shape" : @"Timestamp", @"timestampFormat" : @"rfc822"},
+                             },
+                     @"PutBlobInput" : @{
+                             @"type" : @"structure",
+                             @"members" : @{@"Body" : @{@"shape" : @"Data"}},
+                             @"payload" : @"Body",
+                             },
+                     @"Data" : @{@"type" : @"blob"},
+                     @"String" : @{@"type" : @"string"},
+                     @"Integer" : @{@"type" : @"integer"},
+                     @"Double" : @{@"type" : @"double"},
+                     @"Boolean" : @{@"type" : @"boolean"},
+                     @"Timestamp" : @{@"type" : @"timestamp"},
+                     },
+             };
+}
+
+- (NSDictionary *)putRecordsParametersWithCount:(NSUInteger)count length:(NSUInteger)length {
+    NSMutableArray *records = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        NSMutableData *data = [NSMutableData dataWithLength:length + i % 3];
+        arc4random_buf([data mutableBytes], [data length]);
+        [records addObject:@{@"Data" : data,
+                             @"PartitionKey" : [NSString stringWithFormat:@"partition-%lu", (unsigned long)i]}];
+    }
+    return @{@"StreamName" : @"stream", @"Records" : records};
+}
+
+- (NSData *)writerBodyForParameters:(NSDictionary *)parameters
+                         actionName:(NSString *)actionName
+                      payloadSHA256:(NSData **)payloadSHA256
+                              error:(NSError **)error {
+    AWSJSONBodyWriter *writer = [[AWSJSONBodyWriter alloc] initWithServiceDefinitionRule:[self serviceDefinition]];
+    return [writer bodyForParameters:parameters actionName:actionName payloadSHA256:payloadSHA256 error:error];
+}
+
+- (void)assertBodyMatchesBuilderForParameters:(NSDictionary *)parameters {
+    NSError *builderError = nil;
+    NSData *expected = [AWSJSONBuilder jsonDataForDictionary:parameters
+                                                  actionName:@"PutRecords"
+                                       serviceDefinitionRule:[self serviceDefinition]
+                                                       error:&builderError];
+    XCTAssertNil(builderError);
+
+    NSError *error = nil;
+    NSData *payloadSHA256 = nil;
+    NSData *body = [self writerBodyForParameters:parameters actionName:@"PutRecords" payloadSHA256:&payloadSHA256 error:&error];
+    XCTAssertNil(error);
+    XCTAssertNotNil(body);
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:body], payloadSHA256);
+
+    // Key order is not defined, so the bodies are compared once parsed.
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:expected options:0 error:nil],
+                          [NSJSONSerialization JSONObjectWithData:body options:0 error:nil]);
+}
+
+- (void)testBodyMatchesBuilder {
+    [self assertBodyMatchesBuilderForParameters:[self putRecordsParametersWithCount:20 length:100]];
+
+    [self assertBodyMatchesBuilderForParameters:@{
+        @"StreamName" : @"quotes \" backslashes \\ slashes / controls \n\t\r\b\f\x01 and unicode é 日本 😀",
+        @"Tags" : @{@"key" : @"value", @"\"quoted\"" : @""},
+        @"Since" : [NSDate dateWithTimeIntervalSince1970:1369353600],
+        @"Until" : [NSDate dateWithTimeIntervalSince1970:1369353600],
+        @"Limit" : @(-42),
+        @"Ratio" : @(0.1),
+        @"Enabled" : @YES,
+        @"RequestId" : @"left out of the body",
+        @"Alias" : @"written as alias",
+        @"Unknown" : @"left out of the body",
+        @"Records" : [NSNull null],
+    }];
+
+    // Longer than the block strings are converted in and the run bytes are hashed in.
+    NSMutableString *longString = [NSMutableString new];
+    while ([longString length] < 40000) {
+        [longString appendString:@"0123456789é\n"];
+    }
+    [self assertBodyMatchesBuilderForParameters:@{@"StreamName" : longString}];
+}
+
+- (void)testLocationNameAndLocatedMembers {
+    NSData *body = [self writerBodyForParameters:@{@"Alias" : @"a", @"RequestId" : @"b"}
+                                      actionName:@"PutRecords"
+                                   payloadSHA256:NULL
+                                           error:nil];
+    XCTAssertEqualObjects(@"{\"alias\":\"a\"}", [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding]);
+}
+
+- (void)testTimestampsInListsAndMapsUseTheirFormat {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1369353600];
+    NSDictionary *parameters = @{@"Checkpoints" : @[date], @"Expirations" : @{@"stream" : date}};
+    [self assertBodyMatchesBuilderForParameters:parameters];
+
+    NSData *body = [self writerBodyForParameters:parameters actionName:@"PutRecords" payloadSHA256:NULL error:nil];
+    NSDictionary *JSONObject = [NSJSONSerialization JSONObjectWithData:body options:0 error:nil];
+    XCTAssertTrue([JSONObject[@"Checkpoints"][0] isKindOfClass:[NSString class]]);
+    XCTAssertTrue([JSONObject[@"Expirations"][@"stream"] isKindOfClass:[NSString class]]);
+}
+
+- (void)testInvalidValueFailsAsBuilderDoes {
+    NSDictionary *parameters = @{@"Records" : @"not a list"};
+    NSError *builderError = nil;
+    [AWSJSONBuilder jsonDataForDictionary:parameters actionName:@"PutRecords" serviceDefinitionRule:[self serviceDefinition] error:&builderError];
+
+    NSError *error = nil;
+    XCTAssertNil([self writerBodyForParameters:parameters actionName:@"PutRecords" payloadSHA256:NULL error:&error]);
+    XCTAssertEqualObjects(builderError.domain, error.domain);
+    XCTAssertEqual(builderError.code, error.code);
+
+    error = nil;
+    XCTAssertNil([self writerBodyForParameters:@{@"Ratio" : @(NAN)} actionName:@"PutRecords" payloadSHA256:NULL error:&error]);
+    XCTAssertEqualObjects(AWSJSONBuilderErrorDomain, error.domain);
+}
+
+- (void)testUnsupportedInputsFallBack {
+    NSError *error = nil;
+    XCTAssertNil([self writerBodyForParameters:@{@"Body" : [NSData data]} actionName:@"PutBlob" payloadSHA256:NULL error:&error]);
+    XCTAssertNil([self writerBodyForParameters:@{} actionName:@"PutRecords" payloadSHA256:NULL error:&error]);
+    XCTAssertNil([self writerBodyForParameters:@{@"StreamName" : @"stream"} actionName:@"Unknown" payloadSHA256:NULL error:&error]);
+    XCTAssertNil(error);
+}
+
+- (void)testSignerUsesRecordedPayloadHash {
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://kinesis.us-east-1.amazonaws.com"]];
+    NSData *payloadSHA256 = nil;
+    request.HTTPBody = [self writerBodyForParameters:@{@"StreamName" : @"stream"} actionName:@"PutRecords" payloadSHA256:&payloadSHA256 error:nil];
+    [AWSSignatureSignerUtility setPayloadHash:payloadSHA256 forHTTPBody:request.HTTPBody ofRequest:request];
+    XCTAssertEqualObjects(payloadSHA256, [AWSSignatureSignerUtility payloadHashOfRequest:request]);
+
+    // The digest is carried by copies of the request.
+    XCTAssertEqualObjects(payloadSHA256, [AWSSignatureSignerUtility payloadHashOfRequest:[request copy]]);
+
+    // A replaced body is hashed again, even when it has the same length.
+    NSMutableData *sameLength = [request.HTTPBody mutableCopy];
+    ((uint8_t *)sameLength.mutableBytes)[sameLength.length - 2] ^= 1;
+    request.HTTPBody = sameLength;
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:sameLength], [AWSSignatureSignerUtility payloadHashOfRequest:request]);
+    request.HTTPBody = [@"{}" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:request.HTTPBody], [AWSSignatureSignerUtility payloadHashOfRequest:request]);
+}
+
+- (void)testSerializerRecordsPayloadHash {
+    AWSJSONRequestSerializer *serializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[self serviceDefinition]
+                                                                                         actionName:@"PutRecords"];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://kinesis.us-east-1.amazonaws.com"]];
+    request.HTTPMethod = @"POST";
+    [[serializer serializeRequest:request headers:@{} parameters:[self putRecordsParametersWithCount:3 length:10]] waitUntilFinished];
+
+    XCTAssertNotNil(request.HTTPBody);
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:request.HTTPBody], [AWSSignatureSignerUtility payloadHashOfRequest:request]);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceBuilderPutRecords {
+    NSDictionary *parameters = [self putRecordsParametersWithCount:AWSJSONBodyBenchmarkRecordCount length:AWSJSONBodyBenchmarkRecordLength];
+    NSDictionary *serviceDefinition = [self serviceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSJSONBodyBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSData *body = [AWSJSONBuilder jsonDataForDictionary:parameters
+                                                          actionName:@"PutRecords"
+                                               serviceDefinitionRule:serviceDefinition
+                                                               error:nil];
+                [AWSSignatureSignerUtility hashData:body];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceWriterPutRecords {
+    NSDictionary *parameters = [self putRecordsParametersWithCount:AWSJSONBodyBenchmarkRecordCount length:AWSJSONBodyBenchmarkRecordLength];
+    NSDictionary *serviceDefinition = [self serviceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSJSONBodyBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSData *payloadSHA256 = nil;
+                [[[AWSJSONBodyWriter alloc] initWithServiceDefinitionRule:serviceDefinition] bodyForParameters:parameters
+                                                                                                   actionName:@"PutRecords"
+                                                                                                payloadSHA256:&payloadSHA256
+                                                                                                        error:nil];
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,567 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSCategory.h"
+#import "AWSOperationPlan.h"
+#import "AWSSerialization.h"
+#import "AWSURLRequestSerialization.h"
+#import "AWSURLResponseSerialization.h"
+#import "AWSValidation.h"
+
+static NSUInteger const AWSOperationPlanBenchmarkIterations = 100000;
+
+@interface AWSOperationPlanTests : XCTestCase
+
+@end
+
+@implementation AWSOperationPlanTests
+
+// A trimmed down Amazon S3 definition.
+- (NSDictionary *)XMLServiceDefinition {
+    return @{
+             @"metadata" : @{@"protocol" : @"rest-xml", @"apiVersion" : @"2006-03-01"},
+             @"operations" : @{
+                     @"PutObject" : @{@"http" : @{@"method" : @"PUT", @"requestUri" : @"/{Bucket}/{Key+}"},
+                                      @"input" : @{@"shape" : @"PutObjectRequest"}},
+                     @"ListObjectsV2" : @{@"http" : @{@"method" : @"GET", @"requestUri" : @"/{Bucket}?list-type=2"},
+                                          @"input" : @{@"shape" : @"ListObjectsV2Request"}},
+                     @"GetBucketLocation" : @{@"http" : @{@"method" : @"GET", @"requestUri" : @"/{Bucket}?location"},
+                                              @"input" : @{@"shape" : @"GetBucketLocationRequest"}},
+                     @"GetAccessPoint" : @{@"http" : @{@"method" : @"GET", @"requestUri" : @"/v20180820/accesspoint/{Name}"},
+                                           @"input" : @{@"shape" : @"GetAccessPointRequest"},
+                                           @"endpoint" : @{@"hostPrefix" : @"123456789012."}},
+                     @"ListBuckets" : @{@"http" : @{@"method" : @"GET", @"requestUri" : @"/"}},
+                     @"HeadObject" : @{@"http" : @{@"method" : @"HEAD", @"requestUri" : @"/{Bucket}/{Key+}"},
+                                       @"output" : @{@"shape" : @"HeadObjectOutput"}},
+                     },
+             @"shapes" : @{
+                     @"PutObjectRequest" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Bucket" : @{@"shape" : @"BucketName", @"location" : @"uri", @"locationName" : @"Bucket"},
+                                     @"Key" : @{@"shape" : @"ObjectKey", @"location" : @"uri", @"locationName" : @"Key"},
+                                     @"ACL" : @{@"shape" : @"ObjectCannedACL", @"location" : @"header", @"locationName" : @"x-amz-acl"},
+                                     @"Body" : @{@"shape" : @"Body", @"streaming" : @YES},
+                                     @"ContentLength" : @{@"shape" : @"ContentLength", @"location" : @"header", @"locationName" : @"Content-Length"},
+                                     @"Expires" : @{@"shape" : @"Expires", @"location" : @"header", @"locationName" : @"Expires"},
+                                     @"BucketKeyEnabled" : @{@"shape" : @"BucketKeyEnabled", @"location" : @"header", @"locationName" : @"x-amz-server-side-encryption-bucket-key-enabled"},
+                                     @"Metadata" : @{@"shape" : @"Metadata", @"location" : @"headers", @"locationName" : @"x-amz-meta-"},
+                                     @"StorageClass" : @{@"shape" : @"StorageClass", @"location" : @"header", @"locationName" : @"x-amz-storage-class"},
+                                     },
+                             @"payload" : @"Body",
+                             },
+                     @"ListObjectsV2Request" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Bucket" : @{@"shape" : @"BucketName", @"location" : @"uri", @"locationName" : @"Bucket"},
+                                     @"Prefix" : @{@"shape" : @"Prefix", @"location" : @"querystring", @"locationName" : @"prefix"},
+                                     @"MaxKeys" : @{@"shape" : @"MaxKeys", @"location" : @"querystring", @"locationName" : @"max-keys"},
+                                     @"OptionalAttributes" : @{@"shape" : @"OptionalAttributes", @"location" : @"querystring", @"locationName" : @"Attribute"},
+                                     },
+                             },
+                     @"GetBucketLocationRequest" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Bucket" : @{@"shape" : @"BucketName", @"location" : @"uri", @"locationName" : @"Bucket"},
+                                     },
+                             },
+                     @"GetAccessPointRequest" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Name" : @{@"shape" : @"AccessPointName", @"location" : @"uri", @"locationName" : @"Name"},
+                                     },
+                             },
+                     @"HeadObjectOutput" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"ContentLength" : @{@"shape" : @"ContentLength", @"location" : @"header", @"locationName" : @"Content-Length"},
+                                     @"ETag" : @{@"shape" : @"ETag", @"location" : @"header", @"locationName" : @"ETag"},
+                                     @"LastModified" : @{@"shape" : @"LastModified", @"location" : @"header", @"locationName" : @"Last-Modified"},
+                                     @"PartsCount" : @{@"shape" : @"PartsCount", @"location" : @"header", @"locationName" : @"x-amz-mp-parts-count"},
+                                     @"Metadata" : @{@"shape" : @"Metadata", @"location" : @"headers", @"locationName" : @"x-amz-meta-"},
+                                     @"StatusCode" : @{@"shape" : @"StatusCode", @"location" : @"statusCode"},
+                                     @"StorageClass" : @{@"shape" : @"StorageClass", @"location" : @"header", @"locationName" : @"x-amz-storage-class"},
+                                     },
+                             },
+                     @"BucketName" : @{@"type" : @"string"},
+                     @"ObjectKey" : @{@"type" : @"string"},
+                     @"ObjectCannedACL" : @{@"type" : @"string"},
+                     @"AccessPointName" : @{@"type" : @"string"},
+                     @"Body" : @{@"type" : @"blob", @"streaming" : @YES},
+                     @"ContentLength" : @{@"type" : @"long"},
+                     @"ETag" : @{@"type" : @"string"},
+                     @"LastModified" : @{@"type" : @"timestamp"},
+                     @"PartsCount" : @{@"type" : @"integer"},
+                     @"StatusCode" : @{@"type" : @"integer"},
+                     @"Expires" : @{@"type" : @"timestamp"},
+                     @"BucketKeyEnabled" : @{@"type" : @"boolean"},
+                     @"Metadata" : @{@"type" : @"map", @"key" : @{@"shape" : @"MetadataKey"}, @"value" : @{@"shape" : @"MetadataValue"}},
+                     @"MetadataKey" : @{@"type" : @"string"},
+                     @"MetadataValue" : @{@"type" : @"string"},
+                     @"StorageClass" : @{@"type" : @"string"},
+                     @"Prefix" : @{@"type" : @"string"},
+                     @"MaxKeys" : @{@"type" : @"integer"},
+                     @"OptionalAttributes" : @{@"type" : @"list", @"member" : @{@"shape" : @"OptionalAttribute"}},
+                     @"OptionalAttribute" : @{@"type" : @"string"},
+                     },
+             };
+}
+
+// A trimmed down Amazon DynamoDB definition.
+- (NSDictionary *)JSONServiceDefinition {
+    return @{
+             @"metadata" : @{@"protocol" : @"json", @"apiVersion" : @"2012-08-10", @"jsonVersion" : @"1.0", @"targetPrefix" : @"DynamoDB_20120810"},
+             @"operations" : @{
+                     @"GetItem" : @{@"http" : @{@"method" : @"POST", @"requestUri" : @"/"},
+                                    @"input" : @{@"shape" : @"GetItemInput"},
+                                    @"readonly" : @YES},
+                     @"PutItem" : @{@"http" : @{@"method" : @"POST", @"requestUri" : @"/"},
+                                    @"input" : @{@"shape" : @"GetItemInput"}},
+                     },
+             @"shapes" : @{
+                     @"GetItemInput" : @{
+                             @"type" : @"structure",
+                             @"required" : @[@"TableName", @"Key"],
+                             @"members" : @{
+                                     @"TableName" : @{@"shape" : @"TableName"},
+                                     @"Key" : @{@"shape" : @"Key"},
+                                     @"ConsistentRead" : @{@"shape" : @"ConsistentRead"},
+                                     @"ProjectionExpression" : @{@"shape" : @"ProjectionExpression"},
+                                     },
+                             },
+                     @"TableName" : @{@"type" : @"string", @"min" : @3, @"max" : @255},
+                     @"Key" : @{@"type" : @"map", @"key" : @{@"shape" : @"AttributeName"}, @"value" : @{@"shape" : @"AttributeValue"}},
+                     @"AttributeName" : @{@"type" : @"string"},
+                     @"AttributeValue" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"S" : @{@"shape" : @"StringAttributeValue"},
+                                     @"N" : @{@"shape" : @"NumberAttributeValue"},
+                                     },
+                             },
+                     @"StringAttributeValue" : @{@"type" : @"string"},
+                     @"NumberAttributeValue" : @{@"type" : @"string"},
+                     @"ConsistentRead" : @{@"type" : @"boolean"},
+                     @"ProjectionExpression" : @{@"type" : @"string"},
+                     },
+             };
+}
+
+- (NSDictionary *)putObjectParameters {
+    return @{@"Bucket" : @"examplebucket",
+             @"Key" : @"photos/2013/05/photo one.jpg",
+             @"ACL" : @"bucket-owner-full-control",
+             @"Body" : [@"Welcome to Amazon S3." dataUsingEncoding:NSUTF8StringEncoding],
+             @"ContentLength" : @21,
+             @"Expires" : @1369353600,
+             @"BucketKeyEnabled" : @YES,
+             @"Metadata" : @{@"Album" : @"2013", @"Camera" : @"phone"},
+             @"StorageClass" : @"REDUCED_REDUNDANCY"};
+}
+
+- (NSDictionary *)getItemParameters {
+    return @{@"TableName" : @"Music",
+             @"Key" : @{@"Artist" : @{@"S" : @"No One You Know"}, @"SongTitle" : @{@"S" : @"Call Me Today"}},
+             @"ConsistentRead" : @YES,
+             @"ProjectionExpression" : @"AlbumTitle, Year"};
+}
+
+- (NSHTTPURLResponse *)headObjectResponse {
+    NSMutableDictionary *headerFields = [@{@"Content-Length" : @"3191",
+                                           @"Content-Type" : @"image/jpeg",
+                                           @"Date" : @"Wed, 28 Oct 2009 22:32:00 GMT",
+                                           @"ETag" : @"\"fba9dede5f27731c9771645a39863328\"",
+                                           @"Last-Modified" : @"Sun, 1 Jan 2006 12:00:00 GMT",
+                                           @"Server" : @"AmazonS3",
+                                           @"x-amz-id-2" : @"ef8yU9AS1ed4OpIszj7UDNEHGran",
+                                           @"x-amz-request-id" : @"318BC8BC143432E5",
+                                           @"x-amz-mp-parts-count" : @"4",
+                                           @"x-amz-version-id" : @"3HL4kqtJlcpXroDTDmjVBH40Nrjfkd"} mutableCopy];
+    for (NSUInteger i = 0; i < 8; i++) {
+        headerFields[[NSString stringWithFormat:@"x-amz-meta-attribute%lu", (unsigned long)i]] = [NSString stringWithFormat:@"value %lu", (unsigned long)i];
+    }
+    return [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://examplebucket.s3.amazonaws.com/photo.jpg"]
+                                       statusCode:200
+                                      HTTPVersion:@"HTTP/1.1"
+                                     headerFields:headerFields];
+}
+
+- (AWSJSONDictionary *)headObjectOutputRules {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    return [[AWSJSONDictionary alloc] initWithDictionary:serviceDefinition[@"operations"][@"HeadObject"][@"output"]
+                                      JSONDefinitionRule:serviceDefinition[@"shapes"]];
+}
+
+- (NSMutableURLRequest *)requestForActionName:(NSString *)actionName
+                            serviceDefinition:(NSDictionary *)serviceDefinition
+                                   parameters:(NSDictionary *)parameters
+                                        error:(NSError **)error {
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://s3.us-east-1.amazonaws.com"]];
+    AWSXMLRequestSerializer *serializer = [[AWSXMLRequestSerializer alloc] initWithJSONDefinition:serviceDefinition actionName:actionName];
+    AWSTask *task = [serializer serializeRequest:request headers:nil parameters:parameters];
+    if (error) {
+        *error = task.error;
+    }
+    return request;
+}
+
+#pragma mark - Caching
+
+- (void)testPlansAreSharedPerOperation {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    AWSOperationPlan *plan = [AWSOperationPlan planForActionName:@"PutObject" serviceDefinitionRule:serviceDefinition];
+    XCTAssertNotNil(plan);
+    XCTAssertEqual(plan, [AWSOperationPlan planForActionName:@"PutObject" serviceDefinitionRule:serviceDefinition]);
+    XCTAssertNotEqual(plan, [AWSOperationPlan planForActionName:@"ListObjectsV2" serviceDefinitionRule:serviceDefinition]);
+    // Plans are kept per definition instance, not per equal definition.
+    XCTAssertNotEqual(plan, [AWSOperationPlan planForActionName:@"PutObject" serviceDefinitionRule:[self XMLServiceDefinition]]);
+
+    XCTAssertEqualObjects(plan.HTTPMethod, @"PUT");
+    XCTAssertEqualObjects(plan.uriSchema, @"/{Bucket}/{Key+}");
+    XCTAssertNil(plan.hostPrefix);
+}
+
+- (void)testPlansAreSharedAcrossThreads {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    NSMutableSet *plans = [NSMutableSet new];
+    dispatch_apply(64, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t iteration) {
+        AWSOperationPlan *plan = [AWSOperationPlan planForActionName:@"PutObject" serviceDefinitionRule:serviceDefinition];
+        @synchronized(plans) {
+            [plans addObject:[NSValue valueWithNonretainedObject:plan]];
+        }
+    });
+    XCTAssertEqual([plans count], 1);
+}
+
+- (void)testPlansDoNotRetainServiceDefinition {
+    __weak NSDictionary *weakServiceDefinition = nil;
+    @autoreleasepool {
+        // A copy, so that the definition is not a literal the compiler may have made immortal.
+        NSDictionary *serviceDefinition = [[self JSONServiceDefinition] mutableCopy];
+        weakServiceDefinition = serviceDefinition;
+        NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]];
+        request.HTTPMethod = @"POST";
+        AWSJSONRequestSerializer *serializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:serviceDefinition actionName:@"GetItem"];
+        AWSTask *task = [serializer serializeRequest:request headers:@{} parameters:[self getItemParameters]];
+        XCTAssertNil(task.error);
+        XCTAssertNotNil(request.HTTPBody);
+    }
+    // Neither the cached plan nor its idle body writer keeps the definition alive.
+    XCTAssertNil(weakServiceDefinition);
+}
+
+- (void)testReadOnlyOperationsAreFlagged {
+    NSDictionary *serviceDefinition = [self JSONServiceDefinition];
+    XCTAssertTrue([AWSOperationPlan planForActionName:@"GetItem" serviceDefinitionRule:serviceDefinition].isReadOnly);
+    XCTAssertFalse([AWSOperationPlan planForActionName:@"PutItem" serviceDefinitionRule:serviceDefinition].isReadOnly);
+    XCTAssertTrue([[[AWSJSONRequestSerializer alloc] initWithJSONDefinition:serviceDefinition actionName:@"GetItem"] isReadOnlyOperation]);
+    XCTAssertFalse([[[AWSJSONRequestSerializer alloc] initWithJSONDefinition:serviceDefinition actionName:@"PutItem"] isReadOnlyOperation]);
+}
+
+#pragma mark - Binding
+
+- (void)testBindsURIHeadersAndBodyStream {
+    NSError *error = nil;
+    NSMutableURLRequest *request = [self requestForActionName:@"PutObject"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:[self putObjectParameters]
+                                                        error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(request.HTTPMethod, @"PUT");
+    // The greedy key keeps its slashes.
+    XCTAssertEqualObjects(request.URL.absoluteString, @"https://s3.us-east-1.amazonaws.com/examplebucket/photos/2013/05/photo%20one.jpg");
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"x-amz-acl"], @"bucket-owner-full-control");
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"Content-Length"], @"21");
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"Expires"],
+                          [[NSDate dateWithTimeIntervalSince1970:1369353600] aws_stringValue:AWSDateRFC822DateFormat1]);
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"x-amz-server-side-encryption-bucket-key-enabled"], @"true");
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"x-amz-meta-Album"], @"2013");
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"x-amz-meta-Camera"], @"phone");
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"x-amz-storage-class"], @"REDUCED_REDUNDANCY");
+    XCTAssertNotNil(request.HTTPBodyStream);
+    XCTAssertNil(request.HTTPBody);
+}
+
+- (void)testMatchesRulesBasedConstruction {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    NSDictionary *parameters = [self putObjectParameters];
+
+    NSMutableURLRequest *request = [self requestForActionName:@"PutObject" serviceDefinition:serviceDefinition parameters:parameters error:nil];
+
+    NSMutableURLRequest *expected = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://s3.us-east-1.amazonaws.com"]];
+    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:serviceDefinition[@"operations"][@"PutObject"][@"input"]
+                                                               JSONDefinitionRule:serviceDefinition[@"shapes"]];
+    XCTAssertTrue([AWSXMLRequestSerializer constructURIandHeadersAndBody:expected
+                                                                   rules:inputRules
+                                                              parameters:parameters
+                                                               uriSchema:@"/{Bucket}/{Key+}"
+                                                              hostPrefix:nil
+                                                                   error:nil]);
+    XCTAssertEqualObjects(request.URL, expected.URL);
+    XCTAssertEqualObjects(request.allHTTPHeaderFields, expected.allHTTPHeaderFields);
+}
+
+- (void)testWritesSortedQueryString {
+    NSError *error = nil;
+    NSMutableURLRequest *request = [self requestForActionName:@"ListObjectsV2"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:@{@"Bucket" : @"examplebucket",
+                                                                @"Prefix" : @"photos/2013 05",
+                                                                @"MaxKeys" : @100,
+                                                                @"OptionalAttributes" : @[@"RestoreStatus", @"Owner"]}
+                                                        error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(request.URL.absoluteString,
+                          @"https://s3.us-east-1.amazonaws.com/examplebucket?list-type=2&Attribute=RestoreStatus&Attribute=Owner&max-keys=100&prefix=photos%2F2013%2005");
+}
+
+- (void)testCompletesSubresourceQueryString {
+    NSMutableURLRequest *request = [self requestForActionName:@"GetBucketLocation"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:@{@"Bucket" : @"examplebucket"}
+                                                        error:nil];
+    XCTAssertEqualObjects(request.URL.absoluteString, @"https://s3.us-east-1.amazonaws.com/examplebucket?location=");
+}
+
+- (void)testRemovesUnfilledPlaceholders {
+    NSError *error = nil;
+    NSMutableURLRequest *request = [self requestForActionName:@"PutObject"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:@{@"Bucket" : @"examplebucket"}
+                                                        error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(request.URL.absoluteString, @"https://s3.us-east-1.amazonaws.com/examplebucket/");
+}
+
+- (void)testRejectsUnterminatedPlaceholder {
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://s3.us-east-1.amazonaws.com"]];
+    AWSOperationPlan *plan = [[AWSOperationPlan alloc] initWithInputRules:@{@"members" : @{@"Bucket" : @{@"type" : @"string", @"location" : @"uri", @"locationName" : @"Bucket"}}}
+                                                                uriSchema:@"/{Bucket}/{Key"
+                                                               hostPrefix:nil];
+    NSError *error = nil;
+    XCTAssertFalse([plan bindParameters:@{@"Bucket" : @"examplebucket"} toRequest:request error:&error]);
+    XCTAssertEqualObjects(error.domain, AWSValidationErrorDomain);
+    XCTAssertEqual(error.code, AWSValidationURIIsInvalid);
+}
+
+- (void)testPrependsHostPrefix {
+    NSMutableURLRequest *request = [self requestForActionName:@"GetAccessPoint"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:@{@"Name" : @"finance"}
+                                                        error:nil];
+    XCTAssertEqualObjects(request.URL.absoluteString, @"https://123456789012.s3.us-east-1.amazonaws.com/v20180820/accesspoint/finance");
+}
+
+- (void)testLeavesURLOfOperationWithoutInput {
+    NSMutableURLRequest *request = [self requestForActionName:@"ListBuckets"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:@{}
+                                                        error:nil];
+    XCTAssertEqualObjects(request.HTTPMethod, @"GET");
+    XCTAssertEqualObjects(request.URL.absoluteString, @"https://s3.us-east-1.amazonaws.com");
+}
+
+- (void)testFailsForUnreachableBodyURL {
+    NSMutableDictionary *parameters = [[self putObjectParameters] mutableCopy];
+    parameters[@"Body"] = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    NSError *error = nil;
+    NSMutableURLRequest *request = [self requestForActionName:@"PutObject"
+                                            serviceDefinition:[self XMLServiceDefinition]
+                                                   parameters:parameters
+                                                        error:&error];
+    XCTAssertNotNil(error);
+    XCTAssertNil(request.HTTPBodyStream);
+}
+
+- (void)testJSONBodiesReuseWriters {
+    NSDictionary *serviceDefinition = [self JSONServiceDefinition];
+    NSDictionary *parameters = [self getItemParameters];
+    NSData *expected = [AWSJSONBuilder jsonDataForDictionary:parameters
+                                                  actionName:@"GetItem"
+                                       serviceDefinitionRule:serviceDefinition
+                                                       error:nil];
+    id expectedObject = [NSJSONSerialization JSONObjectWithData:expected options:0 error:nil];
+
+    for (NSUInteger i = 0; i < 3; i++) {
+        NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]];
+        request.HTTPMethod = @"POST";
+        AWSJSONRequestSerializer *serializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:serviceDefinition actionName:@"GetItem"];
+        AWSTask *task = [serializer serializeRequest:request headers:@{@"X-Amz-Target" : @"DynamoDB_20120810.GetItem"} parameters:parameters];
+        XCTAssertNil(task.error);
+        XCTAssertEqualObjects(request.URL.absoluteString, @"https://dynamodb.us-east-1.amazonaws.com/");
+        XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:request.HTTPBody options:0 error:nil], expectedObject);
+    }
+}
+
+#pragma mark - Responses
+
+- (void)testSetsHeaderAndStatusCodeMembers {
+    NSMutableDictionary *result = [NSMutableDictionary new];
+    [[AWSOperationPlan planForActionName:@"HeadObject" serviceDefinitionRule:[self XMLServiceDefinition]] setResponseMembersOfResponse:[self headObjectResponse]
+                                                                                                                          inDictionary:result];
+    XCTAssertEqualObjects(result[@"ContentLength"], @3191LL);
+    XCTAssertEqualObjects(result[@"ETag"], @"\"fba9dede5f27731c9771645a39863328\"");
+    XCTAssertEqualObjects(result[@"LastModified"], @"Sun, 1 Jan 2006 12:00:00 GMT");
+    XCTAssertEqualObjects(result[@"PartsCount"], @4);
+    XCTAssertEqualObjects(result[@"StatusCode"], @200);
+    XCTAssertEqual([result[@"Metadata"] count], 8);
+    XCTAssertEqualObjects(result[@"Metadata"][@"attribute3"], @"value 3");
+    // Members without a header in the response are left out, and so is a header map that matches no header.
+    XCTAssertNil(result[@"StorageClass"]);
+}
+
+- (void)testMatchesHeadersWithoutRegardToCase {
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://examplebucket.s3.amazonaws.com/photo.jpg"]
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"content-length" : @"21",
+                                                                           @"X-AMZ-STORAGE-CLASS" : @"GLACIER",
+                                                                           @"X-Amz-Meta-Album" : @"2013"}];
+    NSMutableDictionary *result = [NSMutableDictionary new];
+    [[AWSOperationPlan planForActionName:@"HeadObject" serviceDefinitionRule:[self XMLServiceDefinition]] setResponseMembersOfResponse:response
+                                                                                                                          inDictionary:result];
+    XCTAssertEqualObjects(result[@"ContentLength"], @21LL);
+    XCTAssertEqualObjects(result[@"StorageClass"], @"GLACIER");
+    XCTAssertEqualObjects(result[@"Metadata"], @{@"Album" : @"2013"});
+}
+
+- (void)testCachedPlanMatchesOutputRules {
+    NSMutableDictionary *expected = [NSMutableDictionary new];
+    [AWSXMLResponseSerializer parseResponse:[self headObjectResponse] rules:[self headObjectOutputRules] bodyDictionary:expected error:nil];
+    NSMutableDictionary *actual = [NSMutableDictionary new];
+    [[AWSOperationPlan planForActionName:@"HeadObject" serviceDefinitionRule:[self XMLServiceDefinition]] setResponseMembersOfResponse:[self headObjectResponse]
+                                                                                                                          inDictionary:actual];
+    XCTAssertEqualObjects(expected, actual);
+}
+
+#pragma mark - Benchmarks
+
+// Serializes a request the way the serializers did before plans: the input rules, URI template and body writer are
+// resolved again for every request.
+- (void)serializeWithoutPlan:(NSMutableURLRequest *)request
+                  actionName:(NSString *)actionName
+           serviceDefinition:(NSDictionary *)serviceDefinition
+                  parameters:(NSDictionary *)parameters {
+    NSDictionary *actionRules = serviceDefinition[@"operations"][actionName];
+    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:actionRules[@"input"]
+                                                               JSONDefinitionRule:serviceDefinition[@"shapes"]];
+    request.HTTPMethod = actionRules[@"http"][@"method"];
+    [AWSXMLRequestSerializer constructURIandHeadersAndBody:request
+                                                     rules:inputRules
+                                                parameters:parameters
+                                                 uriSchema:actionRules[@"http"][@"requestUri"]
+                                                hostPrefix:actionRules[@"endpoint"][@"hostPrefix"]
+                                                     error:nil];
+    if (!request.HTTPBodyStream) {
+        request.HTTPBody = [AWSJSONBuilder jsonDataForDictionary:parameters
+                                                      actionName:actionName
+                                           serviceDefinitionRule:serviceDefinition
+                                                           error:nil];
+    }
+}
+
+- (void)testPerformanceGetItemWithoutPlan {
+    NSDictionary *serviceDefinition = [self JSONServiceDefinition];
+    NSDictionary *parameters = [self getItemParameters];
+    NSURL *URL = [NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSOperationPlanBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [self serializeWithoutPlan:[NSMutableURLRequest requestWithURL:URL]
+                                actionName:@"GetItem"
+                         serviceDefinition:serviceDefinition
+                                parameters:parameters];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceGetItemWithPlan {
+    NSDictionary *serviceDefinition = [self JSONServiceDefinition];
+    NSDictionary *parameters = [self getItemParameters];
+    NSURL *URL = [NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSOperationPlanBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:URL];
+                AWSOperationPlan *plan = [AWSOperationPlan planForActionName:@"GetItem" serviceDefinitionRule:serviceDefinition];
+                request.HTTPMethod = plan.HTTPMethod;
+                [plan bindParameters:parameters toRequest:request error:nil];
+                request.HTTPBody = [plan JSONBodyForParameters:parameters payloadSHA256:nil error:nil];
+            }
+        }
+    }];
+}
+
+- (void)testPerformancePutObjectWithoutPlan {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    NSDictionary *parameters = [self putObjectParameters];
+    NSURL *URL = [NSURL URLWithString:@"https://s3.us-east-1.amazonaws.com"];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSOperationPlanBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [self serializeWithoutPlan:[NSMutableURLRequest requestWithURL:URL]
+                                actionName:@"PutObject"
+                         serviceDefinition:serviceDefinition
+                                parameters:parameters];
+            }
+        }
+    }];
+}
+
+- (void)testPerformancePutObjectWithPlan {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    NSDictionary *parameters = [self putObjectParameters];
+    NSURL *URL = [NSURL URLWithString:@"https://s3.us-east-1.amazonaws.com"];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSOperationPlanBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:URL];
+                AWSOperationPlan *plan = [AWSOperationPlan planForActionName:@"PutObject" serviceDefinitionRule:serviceDefinition];
+                request.HTTPMethod = plan.HTTPMethod;
+                [plan bindParameters:parameters toRequest:request error:nil];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceHeadObjectResponseWithoutPlan {
+    AWSJSONDictionary *outputRules = [self headObjectOutputRules];
+    NSHTTPURLResponse *response = [self headObjectResponse];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSOperationPlanBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [AWSXMLResponseSerializer parseResponse:response rules:outputRules bodyDictionary:[NSMutableDictionary new] error:nil];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceHeadObjectResponseWithPlan {
+    NSDictionary *serviceDefinition = [self XMLServiceDefinition];
+    NSHTTPURLResponse *response = [self headObjectResponse];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSOperationPlanBenchmarkIterations; i++) {
+            @autoreleasepool {
+                AWSOperationPlan *plan = [AWSOperationPlan planForActionName:@"HeadObject" serviceDefinitionRule:serviceDefinition];
+                [plan setResponseMembersOfResponse:response inDictionary:[NSMutableDictionary new]];
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,400 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <XCTest/XCTest.h>
+
+#import "AWSCategory.h"
+#import "AWSQueryBodyWriter.h"
+#import "AWSSerialization.h"
+#import "AWSSignature.h"
+#import "AWSURLRequestSerialization.h"
+
+static NSUInteger const AWSQueryBodyBenchmarkEntryCount = 10;
+static NSUInteger const AWSQueryBodyBenchmarkFilterCount = 50;
+static NSUInteger const AWSQueryBodyBenchmarkIterations = 1000;
+
+@interface AWSQueryBodyWriterTests : XCTestCase
+
+@end
+
+@implementation AWSQueryBodyWriterTests
+
+// A trimmed down Amazon SQS definition, with a few members of other shapes added to SendMessageBatch.
+- (NSDictionary *)queryServiceDefinition {
+    return @{
+             @"metadata" : @{@"protocol" : @"query", @"apiVersion" : @"2012-11-05"},
+             @"operations" : @{
+                     @"SendMessageBatch" : @{@"input" : @{@"shape" : @"SendMessageBatchRequest"}},
+                     },
+             @"shapes" : @{
+                     @"SendMessageBatchRequest" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"QueueUrl" : @{@"shape" : @"String"},
+                                     @"Entries" : @{@"shape" : @"SendMessageBatchRequestEntryList"},
+                                     @"Labels" : @{@"shape" : @"StringList"},
+                                     @"Tags" : @{@"shape" : @"TagMap"},
+                                     @"Since" : @{@"shape" : @"Timestamp"},
+                                     @"Enabled" : @{@"shape" : @"Boolean"},
+                                     @"Ratio" : @{@"shape" : @"Double"},
+                                     },
+                             },
+                     @"SendMessageBatchRequestEntryList" : @{
+                             @"type" : @"list",
+                             @"member" : @{@"shape" : @"SendMessageBatchRequestEntry", @"locationName" : @"SendMessageBatchRequestEntry"},
+                             @"flattened" : @YES,
+                             },
+                     @"SendMessageBatchRequestEntry" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Id" : @{@"shape" : @"String"},
+                                     @"MessageBody" : @{@"shape" : @"String"},
+                                     @"DelaySeconds" : @{@"shape" : @"Integer"},
+                                     @"MessageAttributes" : @{@"shape" : @"MessageBodyAttributeMap", @"locationName" : @"MessageAttribute"},
+                                     },
+                             },
+                     @"MessageBodyAttributeMap" : @{
+                             @"type" : @"map",
+                             @"key" : @{@"shape" : @"String", @"locationName" : @"Name"},
+                             @"value" : @{@"shape" : @"MessageAttributeValue", @"locationName" : @"Value"},
+                             @"flattened" : @YES,
+                             },
+                     @"MessageAttributeValue" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"StringValue" : @{@"shape" : @"String"},
+                                     @"BinaryValue" : @{@"shape" : @"Binary"},
+                                     @"StringListValues" : @{@"shape" : @"StringListValueList", @"locationName" : @"StringListValue"},
+                                     @"DataType" : @{@"shape" : @"String"},
+                                     },
+                             },
+                     @"StringListValueList" : @{
+                             @"type" : @"list",
+                             @"member" : @{@"shape" : @"String", @"locationName" : @"StringListValue"},
+                             @"flattened" : @YES,
+                             },
+                     @"StringList" : @{@"type" : @"list", @"member" : @{@"shape" : @"String"}},
+                     @"TagMap" : @{@"type" : @"map", @"key" : @{@"shape" : @"String"}, @"value" : @{@"shape" : @"String"}},
+                     @"Binary" : @{@"type" : @"blob"},
+                     @"String" : @{@"type" : @"string"},
+                     @"Integer" : @{@"type" : @"integer"},
+                     @"Double" : @{@"type" : @"double"},
+                     @"Boolean" : @{@"type" : @"boolean"},
+                     @"Timestamp" : @{@"type" : @"timestamp"},
+                     },
+             };
+}
+
+// A trimmed down Amazon EC2 definition of DescribeInstances.
+- (NSDictionary *)EC2ServiceDefinition {
+    return @{
+             @"metadata" : @{@"protocol" : @"ec2", @"apiVersion" : @"2016-11-15"},
+             @"operations" : @{
+                     @"DescribeInstances" : @{@"input" : @{@"shape" : @"DescribeInstancesRequest"}},
+                     },
+             @"shapes" : @{
+                     @"DescribeInstancesRequest" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Filters" : @{@"shape" : @"FilterList", @"locationName" : @"Filter"},
+                                     @"InstanceIds" : @{@"shape" : @"InstanceIdStringList", @"locationName" : @"InstanceId"},
+                                     @"DryRun" : @{@"shape" : @"Boolean", @"locationName" : @"dryRun"},
+                                     @"MaxResults" : @{@"shape" : @"Integer", @"locationName" : @"maxResults"},
+                                     @"NextToken" : @{@"shape" : @"String", @"locationName" : @"nextToken", @"queryName" : @"Token"},
+                                     @"Since" : @{@"shape" : @"Timestamp"},
+                                     @"Tags" : @{@"shape" : @"TagMap"},
+                                     },
+                             },
+                     @"FilterList" : @{@"type" : @"list", @"member" : @{@"shape" : @"Filter", @"locationName" : @"Filter"}},
+                     @"Filter" : @{
+                             @"type" : @"structure",
+                             @"members" : @{
+                                     @"Name" : @{@"shape" : @"String"},
+                                     @"Values" : @{@"shape" : @"ValueStringList", @"locationName" : @"Value"},
+                                     },
+                             },
+                     @"ValueStringList" : @{@"type" : @"list", @"member" : @{@"shape" : @"String", @"locationName" : @"item"}},
+                     @"InstanceIdStringList" : @{@"type" : @"list", @"member" : @{@"shape" : @"String", @"locationName" : @"InstanceId"}},
+                     @"TagMap" : @{@"type" : @"map", @"key" : @{@"shape" : @"String"}, @"value" : @{@"shape" : @"String"}},
+                     @"String" : @{@"type" : @"string"},
+                     @"Integer" : @{@"type" : @"integer"},
+                     @"Boolean" : @{@"type" : @"boolean"},
+                     @"Timestamp" : @{@"type" : @"timestamp"},
+                     },
+             };
+}
+
+- (NSDictionary *)sendMessageBatchParametersWithCount:(NSUInteger)count {
+    NSMutableArray *entries = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        NSMutableDictionary *attributes = [NSMutableDictionary new];
+        for (NSUInteger j = 0; j < 10; j++) {
+            attributes[[NSString stringWithFormat:@"attribute-%lu", (unsigned long)j]] = @{@"DataType" : @"String",
+                                                                                           @"StringValue" : [NSString stringWithFormat:@"value %lu/%lu", (unsigned long)i, (unsigned long)j]};
+        }
+        attributes[@"binary"] = @{@"DataType" : @"Binary", @"BinaryValue" : [@"binary+value/==" dataUsingEncoding:NSUTF8StringEncoding]};
+        attributes[@"list"] = @{@"DataType" : @"String", @"StringListValues" : @[@"a", @"b c", @"d&e"]};
+        [entries addObject:@{@"Id" : [NSString stringWithFormat:@"message-%lu", (unsigned long)i],
+                             @"MessageBody" : [NSString stringWithFormat:@"{\"order\": %lu, \"note\": \"café & crème\"}", (unsigned long)i],
+                             @"DelaySeconds" : @(i),
+                             @"MessageAttributes" : attributes}];
+    }
+    return @{@"QueueUrl" : @"https://sqs.us-east-1.amazonaws.com/123456789012/queue", @"Entries" : entries};
+}
+
+- (NSDictionary *)describeInstancesParametersWithCount:(NSUInteger)count {
+    NSMutableArray *filters = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        NSMutableArray *values = [NSMutableArray new];
+        for (NSUInteger j = 0; j < 20; j++) {
+            [values addObject:[NSString stringWithFormat:@"value-%lu-%lu", (unsigned long)i, (unsigned long)j]];
+        }
+        [filters addObject:@{@"Name" : [NSString stringWithFormat:@"tag:Name %lu", (unsigned long)i], @"Values" : values}];
+    }
+    return @{@"Filters" : filters, @"InstanceIds" : @[@"i-1234567890abcdef0", @"i-0598c7d356eba48d7"], @"DryRun" : @NO, @"MaxResults" : @1000};
+}
+
+// The body AWSQueryStringRequestSerializer built before the writer: the param builder's dictionary, encoded and joined.
+- (NSString *)legacyBodyForParameters:(NSDictionary *)parameters
+                           actionName:(NSString *)actionName
+                    serviceDefinition:(NSDictionary *)serviceDefinition
+                                  EC2:(BOOL)EC2
+                                error:(NSError **)error {
+    NSDictionary *formattedParams = nil;
+    if (EC2) {
+        formattedParams = [AWSEC2ParamBuilder buildFormattedParams:parameters actionName:actionName serviceDefinitionRule:serviceDefinition error:error];
+    } else {
+        formattedParams = [AWSQueryParamBuilder buildFormattedParams:parameters actionName:actionName serviceDefinitionRule:serviceDefinition error:error];
+    }
+    NSMutableArray *pairs = [NSMutableArray arrayWithCapacity:[formattedParams count]];
+    for (NSString *key in formattedParams) {
+        id value = formattedParams[key];
+        NSString *string = [value isKindOfClass:[NSNumber class]] ? [value stringValue] : value;
+        [pairs addObject:[NSString stringWithFormat:@"%@=%@", [key aws_stringWithURLEncoding], [string aws_stringWithURLEncoding]]];
+    }
+    return [pairs componentsJoinedByString:@"&"];
+}
+
+// Sorts the pairs of a body by name, in byte order.
+- (NSString *)sortedBody:(NSString *)body {
+    NSArray *pairs = [[body componentsSeparatedByString:@"&"] sortedArrayUsingComparator:^NSComparisonResult(NSString *left, NSString *right) {
+        NSString *leftName = [left componentsSeparatedByString:@"="][0];
+        NSString *rightName = [right componentsSeparatedByString:@"="][0];
+        return [leftName compare:rightName options:NSLiteralSearch];
+    }];
+    return [pairs componentsJoinedByString:@"&"];
+}
+
+- (NSData *)writerBodyForParameters:(NSDictionary *)parameters
+                         actionName:(NSString *)actionName
+                                EC2:(BOOL)EC2
+                      payloadSHA256:(NSData **)payloadSHA256
+                              error:(NSError **)error {
+    AWSQueryBodyWriter *writer = [[AWSQueryBodyWriter alloc] initWithServiceDefinitionRule:EC2 ? [self EC2ServiceDefinition] : [self queryServiceDefinition]
+                                                                                  protocol:EC2 ? AWSQueryBodyWriterProtocolEC2 : AWSQueryBodyWriterProtocolQuery];
+    return [writer bodyForParameters:parameters actionName:actionName payloadSHA256:payloadSHA256 error:error];
+}
+
+- (void)assertBodyMatchesParamBuilderForParameters:(NSDictionary *)parameters actionName:(NSString *)actionName EC2:(BOOL)EC2 {
+    NSError *builderError = nil;
+    NSString *expected = [self legacyBodyForParameters:parameters
+                                            actionName:actionName
+                                     serviceDefinition:EC2 ? [self EC2ServiceDefinition] : [self queryServiceDefinition]
+                                                   EC2:EC2
+                                                 error:&builderError];
+    XCTAssertNil(builderError);
+
+    NSError *error = nil;
+    NSData *payloadSHA256 = nil;
+    NSData *body = [self writerBodyForParameters:parameters actionName:actionName EC2:EC2 payloadSHA256:&payloadSHA256 error:&error];
+    XCTAssertNil(error);
+    XCTAssertNotNil(body);
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:body], payloadSHA256);
+
+    // The writer sorts the pairs; the param builder leaves them in dictionary order.
+    NSString *bodyString = [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding];
+    XCTAssertEqualObjects([self sortedBody:expected], bodyString);
+}
+
+- (void)testBodyMatchesParamBuilder {
+    [self assertBodyMatchesParamBuilderForParameters:[self sendMessageBatchParametersWithCount:10] actionName:@"SendMessageBatch" EC2:NO];
+
+    [self assertBodyMatchesParamBuilderForParameters:@{
+        @"QueueUrl" : @"reserved !*'();:@&=+$,/?#[] unreserved -._~ unicode é 日本 😀",
+        @"Labels" : @[@"first", @"100%25 decoded before it is encoded", @"50% left as it is"],
+        @"Tags" : @{@"b" : @"2", @"A" : @"1", @"c" : @"3"},
+        @"Since" : [NSDate dateWithTimeIntervalSince1970:1369353600],
+        @"Enabled" : @YES,
+        @"Ratio" : @(0.1),
+        @"Unknown" : @"left out of the body",
+    } actionName:@"SendMessageBatch" EC2:NO];
+
+    // Longer than the block strings are converted in.
+    NSMutableString *longString = [NSMutableString new];
+    while ([longString length] < 5000) {
+        [longString appendString:@"0123456789é "];
+    }
+    [self assertBodyMatchesParamBuilderForParameters:@{@"QueueUrl" : longString} actionName:@"SendMessageBatch" EC2:NO];
+    [self assertBodyMatchesParamBuilderForParameters:@{} actionName:@"SendMessageBatch" EC2:NO];
+}
+
+- (void)testEC2BodyMatchesParamBuilder {
+    [self assertBodyMatchesParamBuilderForParameters:[self describeInstancesParametersWithCount:12] actionName:@"DescribeInstances" EC2:YES];
+    [self assertBodyMatchesParamBuilderForParameters:@{@"NextToken" : @"token==",
+                                                       @"Since" : [NSDate dateWithTimeIntervalSince1970:1369353600],
+                                                       @"DryRun" : @"true"}
+                                          actionName:@"DescribeInstances"
+                                                 EC2:YES];
+}
+
+- (void)testMemberNames {
+    NSData *body = [self writerBodyForParameters:@{@"Entries" : @[@{@"Id" : @"1", @"MessageAttributes" : @{@"k" : @{@"StringListValues" : @[@"v"]}}}],
+                                                   @"Labels" : @[@"l"],
+                                                   @"Tags" : @{@"t" : @"u"}}
+                                      actionName:@"SendMessageBatch"
+                                             EC2:NO
+                                   payloadSHA256:NULL
+                                           error:nil];
+    XCTAssertEqualObjects(@"Action=SendMessageBatch"
+                          @"&Labels.member.1=l"
+                          @"&SendMessageBatchRequestEntry.1.Id=1"
+                          @"&SendMessageBatchRequestEntry.1.MessageAttribute.1.Name=k"
+                          @"&SendMessageBatchRequestEntry.1.MessageAttribute.1.Value.StringListValue.1=v"
+                          @"&Tags.entry.1.key=t"
+                          @"&Tags.entry.1.value=u"
+                          @"&Version=2012-11-05",
+                          [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding]);
+
+    body = [self writerBodyForParameters:@{@"Filters" : @[@{@"Name" : @"n", @"Values" : @[@"v"]}], @"NextToken" : @"t", @"DryRun" : @YES}
+                              actionName:@"DescribeInstances"
+                                     EC2:YES
+                           payloadSHA256:NULL
+                                   error:nil];
+    XCTAssertEqualObjects(@"Action=DescribeInstances&DryRun=true&Filter.1.Name=n&Filter.1.Value.1=v&Token=t&Version=2016-11-15",
+                          [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding]);
+}
+
+- (void)testBodyIsCanonicalQuery {
+    NSData *body = [self writerBodyForParameters:[self sendMessageBatchParametersWithCount:3] actionName:@"SendMessageBatch" EC2:NO payloadSHA256:NULL error:nil];
+    NSString *bodyString = [[NSString alloc] initWithData:body encoding:NSUTF8StringEncoding];
+    NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:@"GET"
+                                                                          path:@"/"
+                                                                         query:bodyString
+                                                                       headers:@{@"Host" : @"sqs.us-east-1.amazonaws.com"}
+                                                                 contentSha256:@"UNSIGNED-PAYLOAD"];
+    XCTAssertEqualObjects(bodyString, [canonicalRequest componentsSeparatedByString:@"\n"][2]);
+    XCTAssertEqualObjects([AWSSignatureV4Signer getCanonicalizedRequestHash:@"GET"
+                                                                       path:@"/"
+                                                                      query:bodyString
+                                                                    headers:@{@"Host" : @"sqs.us-east-1.amazonaws.com"}
+                                                              contentSha256:@"UNSIGNED-PAYLOAD"],
+                          [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]);
+}
+
+- (void)testInvalidValueFailsAsParamBuilderDoes {
+    NSDictionary *parameters = @{@"Entries" : @[@{@"MessageAttributes" : @{@"k" : @{@"BinaryValue" : @42}}}]};
+    NSError *builderError = nil;
+    [AWSQueryParamBuilder buildFormattedParams:parameters actionName:@"SendMessageBatch" serviceDefinitionRule:[self queryServiceDefinition] error:&builderError];
+
+    NSError *error = nil;
+    XCTAssertNil([self writerBodyForParameters:parameters actionName:@"SendMessageBatch" EC2:NO payloadSHA256:NULL error:&error]);
+    XCTAssertNotNil(builderError);
+    XCTAssertEqualObjects(builderError.domain, error.domain);
+    XCTAssertEqual(builderError.code, error.code);
+}
+
+- (void)testUnsupportedInputsFallBack {
+    NSError *error = nil;
+    // The serializer writes the description of these values.
+    XCTAssertNil([self writerBodyForParameters:@{@"QueueUrl" : [NSNull null]} actionName:@"SendMessageBatch" EC2:NO payloadSHA256:NULL error:&error]);
+    XCTAssertNil([self writerBodyForParameters:@{@"QueueUrl" : @[@"a"]} actionName:@"SendMessageBatch" EC2:NO payloadSHA256:NULL error:&error]);
+    // AWSEC2ParamBuilder fails for maps.
+    XCTAssertNil([self writerBodyForParameters:@{@"Tags" : @{@"a" : @"b"}} actionName:@"DescribeInstances" EC2:YES payloadSHA256:NULL error:&error]);
+    XCTAssertNil([self writerBodyForParameters:@{@"QueueUrl" : @"a"} actionName:@"Unknown" EC2:NO payloadSHA256:NULL error:&error]);
+    XCTAssertNil(error);
+}
+
+- (void)testSerializerRecordsPayloadHash {
+    AWSQueryStringRequestSerializer *serializer = [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[self queryServiceDefinition]
+                                                                                                        actionName:@"SendMessageBatch"];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://sqs.us-east-1.amazonaws.com"]];
+    request.HTTPMethod = @"POST";
+    [[serializer serializeRequest:request headers:@{} parameters:[self sendMessageBatchParametersWithCount:2]] waitUntilFinished];
+
+    XCTAssertNotNil(request.HTTPBody);
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:request.HTTPBody], [AWSSignatureSignerUtility payloadHashOfRequest:request]);
+    XCTAssertEqualObjects(@"application/x-www-form-urlencoded; charset=utf-8", request.allHTTPHeaderFields[@"Content-Type"]);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceParamBuilderSendMessageBatch {
+    NSDictionary *parameters = [self sendMessageBatchParametersWithCount:AWSQueryBodyBenchmarkEntryCount];
+    NSDictionary *serviceDefinition = [self queryServiceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSQueryBodyBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSString *body = [self legacyBodyForParameters:parameters actionName:@"SendMessageBatch" serviceDefinition:serviceDefinition EC2:NO error:nil];
+                [AWSSignatureSignerUtility hashData:[body dataUsingEncoding:NSUTF8StringEncoding]];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceWriterSendMessageBatch {
+    NSDictionary *parameters = [self sendMessageBatchParametersWithCount:AWSQueryBodyBenchmarkEntryCount];
+    NSDictionary *serviceDefinition = [self queryServiceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSQueryBodyBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSData *payloadSHA256 = nil;
+                [[[AWSQueryBodyWriter alloc] initWithServiceDefinitionRule:serviceDefinition protocol:AWSQueryBodyWriterProtocolQuery] bodyForParameters:parameters
+                                                                                                                                             actionName:@"SendMessageBatch"
+                                                                                                                                          payloadSHA256:&payloadSHA256
+                                                                                                                                                  error:nil];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceParamBuilderDescribeInstances {
+    NSDictionary *parameters = [self describeInstancesParametersWithCount:AWSQueryBodyBenchmarkFilterCount];
+    NSDictionary *serviceDefinition = [self EC2ServiceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSQueryBodyBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSString *body = [self legacyBodyForParameters:parameters actionName:@"DescribeInstances" serviceDefinition:serviceDefinition EC2:YES error:nil];
+                [AWSSignatureSignerUtility hashData:[body dataUsingEncoding:NSUTF8StringEncoding]];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceWriterDescribeInstances {
+    NSDictionary *parameters = [self describeInstancesParametersWithCount:AWSQueryBodyBenchmarkFilterCount];
+    NSDictionary *serviceDefinition = [self EC2ServiceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSQueryBodyBenchmarkIterations; i++) {
+            @autoreleasepool {
+                NSData *payloadSHA256 = nil;
+                [[[AWSQueryBodyWriter alloc] initWithServiceDefinitionRule:serviceDefinition protocol:AWSQueryBodyWriterProtocolEC2] bodyForParameters:parameters
+                                                                                                                                           actionName:@"DescribeInstances"
+                                                                                                                                        payloadSHA256:&payloadSHA256
+                                                                                                                                                error:nil];
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,169 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSCategory.h"
+#import "AWSServiceDefinition.h"
+#import "AWSSerialization.h"
+
+// The JSON definition below, compiled by Scripts/compile_service_definitions.py.
+static NSString *const AWSServiceDefinitionTestsJSON = @"{\"version\":\"2.0\",\"metadata\":{\"apiVersion\":\"2015-01-01\",\"protocol\":\"json\"},\"operations\":{\"Describe\":{\"name\":\"Describe\",\"http\":{\"method\":\"POST\",\"requestUri\":\"/\"},\"input\":{\"shape\":\"Request\"}}},\"shapes\":{\"Request\":{\"type\":\"structure\",\"required\":[\"Name\"],\"members\":{\"Name\":{\"shape\":\"String\"},\"Limit\":{\"shape\":\"Integer\",\"box\":true}}},\"String\":{\"type\":\"string\",\"documentation\":\"<p>text</p>\"},\"Integer\":{\"type\":\"integer\",\"min\":-5,\"max\":100,\"deprecated\":false,\"ratio\":0.5,\"default\":null},\"Nested\":{\"type\":\"list\",\"member\":{\"shape\":\"String\"}},\"Other\":{\"type\":\"list\",\"member\":{\"shape\":\"String\"}}}}";
+static NSString *const AWSServiceDefinitionTestsDigest = @"4b5d07d8c681ac7497861d5845485d68a87f21505bd443185bebb26a915679f9";
+static NSString *const AWSServiceDefinitionTestsCompiled =
+    @"QVdTRAEAAABLXQfYxoGsdJeGHVhFSF1oqH8hUFvUQxhb67JqkVZ5+ScAAABEAAAAAwAAAJACAACoAgAAWAEAAG4CAAB8AQAAAQAA"
+    @"AH4BAAADAAAAggEAAAoAAACNAQAACAAAAJYBAAAHAAAAngEAAAUAAACkAQAABAAAAKkBAAAGAAAAsAEAAAUAAAC2AQAABAAAALsB"
+    @"AAAHAAAAwwEAAAYAAADKAQAACgAAANUBAAADAAAA2QEAAAcAAADhAQAACgAAAOwBAAAEAAAA8QEAAAUAAAD3AQAABwAAAP8BAAAE"
+    @"AAAABAIAAAQAAAAJAgAAAwAAAA0CAAAGAAAAFAIAAAcAAAAcAgAACAAAACUCAAAGAAAALAIAAAMAAAAwAgAABAAAADUCAAAKAAAA"
+    @"QAIAAAgAAABJAgAABQAAAE8CAAAKAAAAWgIAAAgAAABjAgAABQAAAGkCAAAGAAAAcAIAAAYAAAB3AgAACQAAAIECAAAEAAAAhgIA"
+    @"AAcAAAAvADIuMAAyMDE1LTAxLTAxAERlc2NyaWJlAEludGVnZXIATGltaXQATmFtZQBOZXN0ZWQAT3RoZXIAUE9TVABSZXF1ZXN0"
+    @"AFN0cmluZwBhcGlWZXJzaW9uAGJveABkZWZhdWx0AGRlcHJlY2F0ZWQAaHR0cABpbnB1dABpbnRlZ2VyAGpzb24AbGlzdABtYXgA"
+    @"bWVtYmVyAG1lbWJlcnMAbWV0YWRhdGEAbWV0aG9kAG1pbgBuYW1lAG9wZXJhdGlvbnMAcHJvdG9jb2wAcmF0aW8AcmVxdWVzdFVy"
+    @"aQByZXF1aXJlZABzaGFwZQBzaGFwZXMAc3RyaW5nAHN0cnVjdHVyZQB0eXBlAHZlcnNpb24AAAD7/////////2QAAAAAAAAAAAAA"
+    @"AAAA4D8CAAAADAAAABMAAAAdAAAAmwAAAAIAAAAZAAAASwAAAB8AAAADAAAAAQAAACEAAABTAAAAAwAAABAAAAAuAAAAEQAAAFYA"
+    @"AAAbAAAAGwAAAAEAAAADAAAAbgAAAAEAAAAzAAAAAQAAACEAAABbAAAAAgAAAA0AAAACAAAAIQAAACMAAAACAAAABQAAAOYAAAAG"
+    @"AAAAzgAAAAMAAAAXAAAADgEAACAAAAC/AAAAJQAAACMBAAABAAAAJQAAABsBAAAGAAAADgAAAAAAAAAPAAAAAQAAABUAAAAMAAAA"
+    @"GgAAAAQAAAAeAAAAFQAAACUAAACTAAAAAgAAABYAAADOAAAAJQAAAKMAAAAFAAAABAAAAIYBAAAHAAAA7gEAAAgAAADuAQAACgAA"
+    @"ADYBAAALAAAAbgEAAAQAAAAYAAAABgAAABwAAACmAAAAIgAAABYCAAAmAAAACwAAAA==";
+
+@interface AWSServiceDefinitionTests : XCTestCase
+
+@end
+
+@implementation AWSServiceDefinitionTests
+
+- (NSData *)compiledData {
+    return [NSData aws_dataWithBase64EncodedString:AWSServiceDefinitionTestsCompiled];
+}
+
+- (NSDictionary *)expectedDefinition {
+    NSMutableDictionary *definition = [NSJSONSerialization JSONObjectWithData:[AWSServiceDefinitionTestsJSON dataUsingEncoding:NSUTF8StringEncoding]
+                                                                      options:NSJSONReadingMutableContainers
+                                                                        error:nil];
+    [definition[@"shapes"][@"String"] removeObjectForKey:@"documentation"];
+    return definition;
+}
+
+- (void)testDefinitionMatchesJSON {
+    NSError *error = nil;
+    NSDictionary *definition = [AWSServiceDefinition definitionWithData:[self compiledData]
+                                                                 digest:AWSServiceDefinitionTestsDigest
+                                                                  error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(definition, [self expectedDefinition]);
+
+    NSDictionary *integer = definition[@"shapes"][@"Integer"];
+    XCTAssertEqualObjects(integer[@"min"], @(-5));
+    XCTAssertEqualObjects(integer[@"max"], @100);
+    XCTAssertEqualObjects(integer[@"ratio"], @0.5);
+    XCTAssertEqualObjects(integer[@"deprecated"], @NO);
+    XCTAssertEqualObjects(integer[@"default"], [NSNull null]);
+    XCTAssertNil(integer[@"documentation"]);
+    XCTAssertNil(definition[@"shapes"][@"Missing"]);
+    XCTAssertNil(definition[@(1)]);
+
+    NSArray *keys = [[definition[@"shapes"] allKeys] sortedArrayUsingSelector:@selector(compare:)];
+    XCTAssertEqualObjects(keys, (@[@"Integer", @"Nested", @"Other", @"Request", @"String"]));
+    XCTAssertEqualObjects(definition[@"shapes"][@"Request"][@"required"], @[@"Name"]);
+}
+
+- (void)testCollectionsAreImmutable {
+    NSDictionary *definition = [AWSServiceDefinition definitionWithData:[self compiledData] digest:nil error:nil];
+    XCTAssertEqual([definition copy], definition);
+    NSArray *required = definition[@"shapes"][@"Request"][@"required"];
+    XCTAssertEqual([required copy], required);
+
+    NSMutableDictionary *mutableDefinition = [definition mutableCopy];
+    mutableDefinition[@"version"] = @"3.0";
+    XCTAssertEqualObjects(definition[@"version"], @"2.0");
+}
+
+- (void)testJSONDictionaryLookups {
+    NSDictionary *definition = [AWSServiceDefinition definitionWithData:[self compiledData] digest:nil error:nil];
+    NSDictionary *shapes = definition[@"shapes"];
+    AWSJSONDictionary *member = [[AWSJSONDictionary alloc] initWithDictionary:shapes[@"Request"][@"members"][@"Limit"]
+                                                           JSONDefinitionRule:shapes];
+    XCTAssertEqualObjects([member objectForKey:@"type"], @"integer");
+    XCTAssertEqualObjects([member objectForKey:@"box"], @YES);
+    XCTAssertEqualObjects([member objectForKey:@"max"], @100);
+}
+
+- (void)testJSONDefinitionMatchesJSON {
+    NSError *error = nil;
+    NSDictionary *definition = [AWSServiceDefinition definitionWithJSONString:AWSServiceDefinitionTestsJSON error:&error];
+    XCTAssertNil(error);
+    NSDictionary *expected = [NSJSONSerialization JSONObjectWithData:[AWSServiceDefinitionTestsJSON dataUsingEncoding:NSUTF8StringEncoding]
+                                                             options:kNilOptions
+                                                               error:nil];
+    XCTAssertEqualObjects(definition, expected);
+    XCTAssertEqual(definition[@"shapes"][@"Request"], definition[@"shapes"][@"Request"]);
+    XCTAssertEqual([definition[@"shapes"] copy], definition[@"shapes"]);
+    XCTAssertNil(definition[@"shapes"][@"Missing"]);
+    XCTAssertNil(definition[@"operations"][@(1)]);
+}
+
+- (void)testJSONDefinitionEdgeCases {
+    // Whitespace, repeated keys, escaped keys and non-ASCII text are handled as NSJSONSerialization handles them.
+    NSArray<NSString *> *definitions = @[@" { \"shapes\" : { \"A\" : { \"type\" : \"string\" } , \"B\":[1, 2.5, true, null] } }\n",
+                                         @"{\"shapes\":{\"A\":{\"max\":1},\"A\":{\"max\":2}},\"operations\":{}}",
+                                         @"{\"shapes\":{\"A\\\"B\":{\"type\":\"string\"}}}",
+                                         @"{\"metadata\":{\"serviceFullName\":\"Amazon “Example”\"},\"shapes\":{\"Ünïcode\":{\"pattern\":\"[\\\\}\\\\]]\"}}}"];
+    for (NSString *JSONString in definitions) {
+        NSError *error = nil;
+        NSDictionary *definition = [AWSServiceDefinition definitionWithJSONString:JSONString error:&error];
+        XCTAssertNil(error, @"%@", JSONString);
+        NSDictionary *expected = [NSJSONSerialization JSONObjectWithData:[JSONString dataUsingEncoding:NSUTF8StringEncoding] options:kNilOptions error:nil];
+        XCTAssertEqualObjects(definition, expected, @"%@", JSONString);
+    }
+
+    NSError *error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithJSONString:@"{\"shapes\":{\"A\":{}" error:&error]);
+    XCTAssertNotNil(error);
+    error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithJSONString:@"[]" error:&error]);
+    XCTAssertEqual(error.code, AWSServiceDefinitionErrorInvalidFormat);
+}
+
+- (void)testInvalidData {
+    NSError *error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithData:[NSData data] digest:nil error:&error]);
+    XCTAssertEqualObjects(error.domain, AWSServiceDefinitionErrorDomain);
+    XCTAssertEqual(error.code, AWSServiceDefinitionErrorInvalidFormat);
+
+    NSData *compiled = [self compiledData];
+    error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithData:[compiled subdataWithRange:NSMakeRange(0, compiled.length / 2)] digest:nil error:&error]);
+    XCTAssertEqual(error.code, AWSServiceDefinitionErrorInvalidFormat);
+
+    NSMutableData *badMagic = [compiled mutableCopy];
+    ((uint8_t *)badMagic.mutableBytes)[0] = 'X';
+    error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithData:badMagic digest:nil error:&error]);
+    XCTAssertEqual(error.code, AWSServiceDefinitionErrorInvalidFormat);
+
+    NSMutableData *badVersion = [compiled mutableCopy];
+    ((uint8_t *)badVersion.mutableBytes)[4] = 2;
+    error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithData:badVersion digest:nil error:&error]);
+    XCTAssertEqual(error.code, AWSServiceDefinitionErrorUnsupportedVersion);
+
+    error = nil;
+    XCTAssertNil([AWSServiceDefinition definitionWithData:compiled
+                                                   digest:@"0000000000000000000000000000000000000000000000000000000000000000"
+                                                    error:&error]);
+    XCTAssertEqual(error.code, AWSServiceDefinitionErrorDigestMismatch);
+}
+
+@end
@@ -0,0 +1,65 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Measures the cost of the first call of a process to a service: loading the service definition and serializing one
+ request. It is compiled into the test targets of the services with large definitions, and a subclass sets the
+ properties below in `setUp` and calls the methods below from its tests.
+ */
+@interface AWSServiceStartupTestCase : XCTestCase
+
+/**
+ The Resources class of the service, e.g. `AWSEC2Resources`.
+ */
+@property (nonatomic, strong) Class resourcesClass;
+
+/**
+ The request serializer class of the service's protocol, e.g. `AWSJSONRequestSerializer`.
+ */
+@property (nonatomic, strong) Class requestSerializerClass;
+
+@property (nonatomic, copy) NSString *actionName;
+
+/**
+ The input of the first call.
+ */
+@property (nonatomic, strong) AWSModel *input;
+
+@property (nonatomic, strong) NSURL *URL;
+
+@property (nonatomic, copy) NSString *HTTPMethod;
+
+/**
+ Asserts that the parsed, bundled and lazy definitions serialize the same request.
+ */
+- (void)assertDefinitionsSerializeTheSameRequest;
+
+- (void)measureFirstRequestWithParsedDefinition;
+
+- (void)measureFirstRequestWithLazyDefinition;
+
+/**
+ Measures the first request with the definition a new Resources instance loads, as the service does.
+ */
+- (void)measureFirstRequestWithBundledDefinition;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,98 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSServiceStartupTestCase.h"
+
+// The methods every generated Resources class has. `definitionString` is private to the service.
+@protocol AWSServiceStartupTestResources <NSObject>
+
++ (instancetype)sharedInstance;
+
+- (NSDictionary *)JSONObject;
+
+- (NSString *)definitionString;
+
+@end
+
+@implementation AWSServiceStartupTestCase
+
+- (id<AWSServiceStartupTestResources>)sharedResources {
+    return [(id<AWSServiceStartupTestResources>)self.resourcesClass sharedInstance];
+}
+
+- (NSMutableURLRequest *)firstRequestWithDefinition:(NSDictionary *)definition {
+    NSDictionary *parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:self.input] aws_removeNullValues];
+
+    id<AWSURLRequestSerializer> serializer = [[self.requestSerializerClass alloc] initWithJSONDefinition:definition
+                                                                                              actionName:self.actionName];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:self.URL];
+    request.HTTPMethod = self.HTTPMethod;
+    AWSTask *task = [serializer serializeRequest:request headers:@{} parameters:parameters];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    return request;
+}
+
+- (NSDictionary *)parsedDefinitionOfString:(NSString *)definitionString {
+    return [NSJSONSerialization JSONObjectWithData:[definitionString dataUsingEncoding:NSUTF8StringEncoding] options:kNilOptions error:nil];
+}
+
+- (void)assertDefinitionsSerializeTheSameRequest {
+    NSString *definitionString = [[self sharedResources] definitionString];
+    NSMutableURLRequest *expected = [self firstRequestWithDefinition:[self parsedDefinitionOfString:definitionString]];
+    NSArray<NSDictionary *> *definitions = @[[[self sharedResources] JSONObject],
+                                             [AWSServiceDefinition definitionWithJSONString:definitionString error:nil]];
+    for (NSDictionary *definition in definitions) {
+        NSMutableURLRequest *request = [self firstRequestWithDefinition:definition];
+        XCTAssertEqualObjects(request.URL, expected.URL);
+        XCTAssertEqualObjects(request.HTTPBody, expected.HTTPBody);
+        XCTAssertEqualObjects(request.allHTTPHeaderFields, expected.allHTTPHeaderFields);
+    }
+}
+
+#pragma mark - Benchmarks
+
+// Wall clock time and resident memory when available, since the definitions mostly cost memory.
+- (void)measureStartup:(void (^)(void))block {
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:block];
+    } else {
+        [self measureBlock:block];
+    }
+}
+
+- (void)measureFirstRequestWithParsedDefinition {
+    NSString *definitionString = [[self sharedResources] definitionString];
+    [self measureStartup:^{
+        [self firstRequestWithDefinition:[self parsedDefinitionOfString:definitionString]];
+    }];
+}
+
+- (void)measureFirstRequestWithLazyDefinition {
+    NSString *definitionString = [[self sharedResources] definitionString];
+    [self measureStartup:^{
+        [self firstRequestWithDefinition:[AWSServiceDefinition definitionWithJSONString:definitionString error:nil]];
+    }];
+}
+
+- (void)measureFirstRequestWithBundledDefinition {
+    Class resourcesClass = self.resourcesClass;
+    [self measureStartup:^{
+        // A new instance instead of the shared one, so the definition is loaded on every iteration.
+        [self firstRequestWithDefinition:[(id<AWSServiceStartupTestResources>)[resourcesClass new] JSONObject]];
+    }];
+}
+
+@end
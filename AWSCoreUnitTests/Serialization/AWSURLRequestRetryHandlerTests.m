@@ -0,0 +1,378 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+#import "AWSURLRequestRetryHandler.h"
+
+@interface AWSRetrySimulationEvent : NSObject
+
+@property (nonatomic, assign) NSTimeInterval time;
+@property (nonatomic, assign) NSUInteger sequence;
+@property (nonatomic, copy) dispatch_block_t block;
+
+@end
+
+@implementation AWSRetrySimulationEvent
+
+@end
+
+// Runs blocks in order of a simulated time, so the rate limiter can be tested without waiting.
+@interface AWSRetrySimulationScheduler : NSObject
+
+@property (nonatomic, assign) NSTimeInterval now;
+@property (nonatomic, strong) NSMutableArray<AWSRetrySimulationEvent *> *events;
+@property (nonatomic, assign) NSUInteger sequence;
+
+@end
+
+@implementation AWSRetrySimulationScheduler
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _events = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)runBlock:(dispatch_block_t)block afterDelay:(NSTimeInterval)delay {
+    AWSRetrySimulationEvent *event = [AWSRetrySimulationEvent new];
+    event.time = self.now + delay;
+    event.sequence = self.sequence++;
+    event.block = block;
+    NSUInteger index = [self.events indexOfObject:event
+                                    inSortedRange:NSMakeRange(0, self.events.count)
+                                          options:NSBinarySearchingInsertionIndex
+                                  usingComparator:^NSComparisonResult(AWSRetrySimulationEvent *event1, AWSRetrySimulationEvent *event2) {
+        if (event1.time != event2.time) {
+            return event1.time < event2.time ? NSOrderedAscending : NSOrderedDescending;
+        }
+        if (event1.sequence != event2.sequence) {
+            return event1.sequence < event2.sequence ? NSOrderedAscending : NSOrderedDescending;
+        }
+        return NSOrderedSame;
+    }];
+    [self.events insertObject:event atIndex:index];
+}
+
+- (void)run {
+    while (self.events.count > 0) {
+        AWSRetrySimulationEvent *event = self.events.firstObject;
+        [self.events removeObjectAtIndex:0];
+        self.now = event.time;
+        event.block();
+    }
+}
+
+- (AWSClientSideRateLimiter *)rateLimiter {
+    __weak AWSRetrySimulationScheduler *weakSelf = self;
+    return [[AWSClientSideRateLimiter alloc] initWithClock:^NSTimeInterval{
+        return weakSelf.now;
+    } scheduler:^(NSTimeInterval delay, dispatch_block_t block) {
+        [weakSelf runBlock:block afterDelay:delay];
+    }];
+}
+
+@end
+
+// The outcome of sending requests in one retry mode to a service that throttles above a fixed rate.
+@interface AWSRetrySimulationResult : NSObject
+
+@property (nonatomic, assign) NSUInteger attemptCount;
+@property (nonatomic, assign) NSUInteger throttledCount;
+@property (nonatomic, assign) NSUInteger failureCount;
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *latencies;
+@property (nonatomic, assign) double goodput;
+
+- (NSTimeInterval)latencyAtPercentile:(double)percentile;
+
+@end
+
+@implementation AWSRetrySimulationResult
+
+- (NSTimeInterval)latencyAtPercentile:(double)percentile {
+    NSArray<NSNumber *> *latencies = [self.latencies sortedArrayUsingSelector:@selector(compare:)];
+    NSUInteger index = MIN(latencies.count - 1, (NSUInteger)(percentile * latencies.count));
+    return [latencies[index] doubleValue];
+}
+
+@end
+
+static NSUInteger const AWSRetrySimulationCallerCount = 64;
+static double const AWSRetrySimulationServiceCapacity = 100;
+static NSTimeInterval const AWSRetrySimulationDuration = 30;
+static NSTimeInterval const AWSRetrySimulationLatency = 0.02;
+static uint32_t const AWSRetrySimulationMaximumRetryCount = 3;
+
+@interface AWSURLRequestRetryHandlerTests : XCTestCase
+
+@end
+
+@implementation AWSURLRequestRetryHandlerTests
+
+#pragma mark - Retry quota
+
+- (void)testRetryQuota {
+    AWSRetryQuota *quota = [[AWSRetryQuota alloc] initWithCapacity:20];
+    NSError *throttlingError = [NSError errorWithDomain:AWSServiceErrorDomain code:AWSServiceErrorThrottling userInfo:nil];
+    NSError *timeoutError = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil];
+
+    XCTAssertEqual(5, [quota acquireTokensForRetryAfterError:throttlingError]);
+    XCTAssertEqual(10, [quota acquireTokensForRetryAfterError:timeoutError]);
+    XCTAssertEqual(5, quota.availableTokens);
+    XCTAssertEqual(0, [quota acquireTokensForRetryAfterError:timeoutError]);
+    XCTAssertEqual(5, [quota acquireTokensForRetryAfterError:throttlingError]);
+    XCTAssertEqual(0, quota.availableTokens);
+    XCTAssertEqual(0, [quota acquireTokensForRetryAfterError:throttlingError]);
+
+    [quota releaseTokensAfterSuccessWithCost:5];
+    XCTAssertEqual(5, quota.availableTokens);
+    [quota releaseTokensAfterSuccessWithCost:0];
+    XCTAssertEqual(6, quota.availableTokens);
+    [quota releaseTokensAfterSuccessWithCost:10];
+    [quota releaseTokensAfterSuccessWithCost:10];
+    XCTAssertEqual(20, quota.availableTokens);
+}
+
+- (void)testDefaultRetryQuotaCapacity {
+    XCTAssertEqual(500, [AWSRetryQuota new].capacity);
+    XCTAssertEqual(500, [AWSRetryQuota new].availableTokens);
+}
+
+#pragma mark - Client-side rate limiter
+
+// Reports responses at 10 per second, up to `end`.
+- (void)updateRateLimiter:(AWSClientSideRateLimiter *)rateLimiter
+                scheduler:(AWSRetrySimulationScheduler *)scheduler
+                     from:(NSTimeInterval)start
+                       to:(NSTimeInterval)end {
+    for (NSUInteger i = 1; start + i * 0.1 < end; i++) {
+        scheduler.now = start + i * 0.1;
+        [rateLimiter updateSendingRateWithThrottlingResponse:NO];
+    }
+}
+
+- (void)testRateLimiterLetsRequestsThroughUntilThrottled {
+    AWSRetrySimulationScheduler *scheduler = [AWSRetrySimulationScheduler new];
+    AWSClientSideRateLimiter *rateLimiter = [scheduler rateLimiter];
+    [self updateRateLimiter:rateLimiter scheduler:scheduler from:0 to:5];
+
+    __block NSUInteger sentCount = 0;
+    for (NSUInteger i = 0; i < 100; i++) {
+        [rateLimiter acquireTokenWithBlock:^{
+            sentCount++;
+        }];
+    }
+    XCTAssertFalse(rateLimiter.isEnabled);
+    XCTAssertEqual(100, sentCount);
+    XCTAssertEqualWithAccuracy(10, rateLimiter.measuredRate, 0.1);
+}
+
+- (void)testRateLimiterSendsRequestsInOrderAfterThrottling {
+    AWSRetrySimulationScheduler *scheduler = [AWSRetrySimulationScheduler new];
+    AWSClientSideRateLimiter *rateLimiter = [scheduler rateLimiter];
+    [self updateRateLimiter:rateLimiter scheduler:scheduler from:0 to:5];
+
+    scheduler.now = 5.05;
+    [rateLimiter updateSendingRateWithThrottlingResponse:YES];
+    XCTAssertTrue(rateLimiter.isEnabled);
+    XCTAssertEqualWithAccuracy(rateLimiter.measuredRate * 0.7, rateLimiter.sendingRate, 1e-9);
+
+    NSMutableArray<NSNumber *> *order = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *sendTimes = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 20; i++) {
+        [rateLimiter acquireTokenWithBlock:^{
+            [order addObject:@(i)];
+            [sendTimes addObject:@(scheduler.now)];
+        }];
+    }
+    NSUInteger immediateCount = order.count;
+    XCTAssertLessThan(immediateCount, 20);
+    XCTAssertEqual(20 - immediateCount, rateLimiter.waitingCount);
+
+    [scheduler run];
+    XCTAssertEqual(0, rateLimiter.waitingCount);
+    XCTAssertEqual(20, order.count);
+    for (NSUInteger i = 0; i < order.count; i++) {
+        XCTAssertEqual(i, [order[i] unsignedIntegerValue]);
+    }
+
+    // The requests that waited were let through one token refill apart.
+    NSTimeInterval interval = ([sendTimes.lastObject doubleValue] - [sendTimes[immediateCount] doubleValue]) / (19 - immediateCount);
+    XCTAssertEqualWithAccuracy(1 / rateLimiter.sendingRate, interval, 1e-6);
+}
+
+- (void)testRateLimiterRecoversAlongCubicCurve {
+    AWSRetrySimulationScheduler *scheduler = [AWSRetrySimulationScheduler new];
+    AWSClientSideRateLimiter *rateLimiter = [scheduler rateLimiter];
+    [self updateRateLimiter:rateLimiter scheduler:scheduler from:0 to:5];
+
+    NSTimeInterval throttleTime = 5.05;
+    scheduler.now = throttleTime;
+    [rateLimiter updateSendingRateWithThrottlingResponse:YES];
+    double lastMaxRate = rateLimiter.sendingRate / 0.7;
+
+    // The rate is back to where it was throttled after cbrt(lastMaxRate * (1 - 0.7) / 0.4) seconds.
+    NSTimeInterval timeWindow = cbrt(lastMaxRate * 0.3 / 0.4);
+    [self updateRateLimiter:rateLimiter scheduler:scheduler from:throttleTime to:throttleTime + timeWindow];
+    XCTAssertLessThan(rateLimiter.sendingRate, lastMaxRate);
+    scheduler.now = throttleTime + timeWindow;
+    [rateLimiter updateSendingRateWithThrottlingResponse:NO];
+    XCTAssertEqualWithAccuracy(lastMaxRate, rateLimiter.sendingRate, 1e-6);
+
+    // Then it probes past it.
+    [self updateRateLimiter:rateLimiter scheduler:scheduler from:scheduler.now to:scheduler.now + 2.05];
+    XCTAssertEqualWithAccuracy(lastMaxRate + 0.4 * 8, rateLimiter.sendingRate, 0.01);
+    XCTAssertLessThanOrEqual(rateLimiter.sendingRate, 2 * rateLimiter.measuredRate);
+}
+
+- (void)testRateLimiterAcquireTokenTask {
+    AWSClientSideRateLimiter *rateLimiter = [AWSClientSideRateLimiter new];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"The token is acquired."];
+    [[rateLimiter acquireToken] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        XCTAssertNil(task.error);
+        [expectation fulfill];
+        return nil;
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+}
+
+#pragma mark - Throttling classification
+
+- (void)testThrottlingResponse {
+    AWSURLRequestRetryHandler *retryHandler = [AWSURLRequestRetryHandler new];
+    NSURL *URL = [NSURL URLWithString:@"https://service.us-east-1.amazonaws.com"];
+    NSHTTPURLResponse *tooManyRequests = [[NSHTTPURLResponse alloc] initWithURL:URL statusCode:429 HTTPVersion:@"HTTP/1.1" headerFields:nil];
+    NSHTTPURLResponse *badRequest = [[NSHTTPURLResponse alloc] initWithURL:URL statusCode:400 HTTPVersion:@"HTTP/1.1" headerFields:nil];
+
+    XCTAssertTrue([retryHandler isThrottlingResponse:tooManyRequests data:nil error:nil]);
+    XCTAssertTrue([retryHandler isThrottlingResponse:badRequest
+                                                data:nil
+                                               error:[NSError errorWithDomain:AWSServiceErrorDomain code:AWSServiceErrorThrottlingException userInfo:nil]]);
+    XCTAssertFalse([retryHandler isThrottlingResponse:badRequest
+                                                 data:nil
+                                                error:[NSError errorWithDomain:AWSServiceErrorDomain code:AWSServiceErrorAccessDenied userInfo:nil]]);
+}
+
+#pragma mark - Simulation
+
+/**
+ Simulates `AWSRetrySimulationCallerCount` callers sending requests back to back to a service that lets through
+ `AWSRetrySimulationServiceCapacity` requests per second, with a burst of a tenth of that, and throttles the rest.
+ Throttled requests are retried up to `AWSRetrySimulationMaximumRetryCount` times with exponential backoff.
+ */
+- (AWSRetrySimulationResult *)simulateRetryMode:(AWSRetryMode)retryMode {
+    AWSRetrySimulationScheduler *scheduler = [AWSRetrySimulationScheduler new];
+    AWSClientSideRateLimiter *rateLimiter = retryMode == AWSRetryModeAdaptive ? [scheduler rateLimiter] : nil;
+    AWSRetryQuota *retryQuota = retryMode == AWSRetryModeLegacy ? nil : [AWSRetryQuota new];
+    NSError *throttlingError = [NSError errorWithDomain:AWSServiceErrorDomain code:AWSServiceErrorThrottling userInfo:nil];
+
+    AWSRetrySimulationResult *result = [AWSRetrySimulationResult new];
+    result.latencies = [NSMutableArray new];
+
+    __block double serviceTokens = AWSRetrySimulationServiceCapacity / 10;
+    __block NSTimeInterval serviceRefillTime = 0;
+    BOOL (^serviceAcceptsRequest)(void) = ^BOOL{
+        serviceTokens = MIN(AWSRetrySimulationServiceCapacity / 10,
+                            serviceTokens + (scheduler.now - serviceRefillTime) * AWSRetrySimulationServiceCapacity);
+        serviceRefillTime = scheduler.now;
+        if (serviceTokens >= 1) {
+            serviceTokens -= 1;
+            return YES;
+        }
+        return NO;
+    };
+
+    __block void (^sendRequest)(NSTimeInterval start, uint32_t retryCount, NSUInteger retryQuotaCost);
+    void (^sendNextRequest)(void) = ^{
+        if (scheduler.now < AWSRetrySimulationDuration) {
+            sendRequest(scheduler.now, 0, 0);
+        }
+    };
+    sendRequest = ^(NSTimeInterval start, uint32_t retryCount, NSUInteger retryQuotaCost) {
+        dispatch_block_t send = ^{
+            [scheduler runBlock:^{
+                result.attemptCount++;
+                BOOL accepted = serviceAcceptsRequest();
+                [scheduler runBlock:^{
+                    [rateLimiter updateSendingRateWithThrottlingResponse:!accepted];
+                    if (accepted) {
+                        [retryQuota releaseTokensAfterSuccessWithCost:retryQuotaCost];
+                        [result.latencies addObject:@(scheduler.now - start)];
+                        sendNextRequest();
+                        return;
+                    }
+
+                    result.throttledCount++;
+                    NSUInteger cost = 0;
+                    if (retryCount < AWSRetrySimulationMaximumRetryCount
+                        && (!retryQuota || (cost = [retryQuota acquireTokensForRetryAfterError:throttlingError]) > 0)) {
+                        [scheduler runBlock:^{
+                            sendRequest(start, retryCount + 1, cost);
+                        } afterDelay:0.1 * pow(2, retryCount)];
+                    } else {
+                        result.failureCount++;
+                        sendNextRequest();
+                    }
+                } afterDelay:AWSRetrySimulationLatency / 2];
+            } afterDelay:AWSRetrySimulationLatency / 2];
+        };
+
+        if (rateLimiter) {
+            [rateLimiter acquireTokenWithBlock:send];
+        } else {
+            send();
+        }
+    };
+
+    for (NSUInteger i = 0; i < AWSRetrySimulationCallerCount; i++) {
+        [scheduler runBlock:sendNextRequest afterDelay:i * 0.001];
+    }
+    [scheduler run];
+    sendRequest = nil;
+
+    result.goodput = result.latencies.count / AWSRetrySimulationDuration;
+    NSLog(@"Retry mode %ld: %lu attempts, %lu throttled, %lu failed, %.1f requests per second, p50 %.0f ms, p99 %.0f ms",
+          (long)retryMode,
+          (unsigned long)result.attemptCount,
+          (unsigned long)result.throttledCount,
+          (unsigned long)result.failureCount,
+          result.goodput,
+          [result latencyAtPercentile:0.5] * 1000,
+          [result latencyAtPercentile:0.99] * 1000);
+    return result;
+}
+
+- (void)testAdaptiveRetryModeUnderSustainedThrottling {
+    AWSRetrySimulationResult *legacy = [self simulateRetryMode:AWSRetryModeLegacy];
+    AWSRetrySimulationResult *standard = [self simulateRetryMode:AWSRetryModeStandard];
+    AWSRetrySimulationResult *adaptive = [self simulateRetryMode:AWSRetryModeAdaptive];
+
+    // Without a client-side limit, most attempts are throttled, and requests fail once they run out of retries.
+    XCTAssertGreaterThan(legacy.throttledCount, legacy.latencies.count);
+    XCTAssertGreaterThan(legacy.failureCount, 0);
+    // The retry quota stops the retries, but not the throttling.
+    XCTAssertGreaterThan(standard.failureCount, legacy.failureCount);
+
+    XCTAssertLessThan(adaptive.throttledCount * 100, legacy.throttledCount);
+    XCTAssertEqual(0, adaptive.failureCount);
+    XCTAssertGreaterThanOrEqual(adaptive.goodput, 0.7 * AWSRetrySimulationServiceCapacity);
+    // Adaptive mode trades tail latency for fewer throttles: requests wait in the rate limiter, and its p99 is seconds
+    // rather than the few hundred milliseconds of the legacy mode. This bounds how long they wait.
+    XCTAssertGreaterThan([adaptive latencyAtPercentile:0.99], [legacy latencyAtPercentile:0.99]);
+    XCTAssertLessThan([adaptive latencyAtPercentile:0.99], 10);
+}
+
+@end
@@ -0,0 +1,291 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <XCTest/XCTest.h>
+
+#import "AWSURLRequestSerialization.h"
+#import "AWSValidation.h"
+
+static NSUInteger const AWSValidationBenchmarkItemCount = 25;
+static NSUInteger const AWSValidationBenchmarkIterations = 2000;
+
+@interface AWSValidationTests : XCTestCase
+
+@property (nonatomic, assign) BOOL requestValidationWasEnabled;
+
+@end
+
+@implementation AWSValidationTests
+
+- (void)setUp {
+    [super setUp];
+    self.requestValidationWasEnabled = AWSValidation.requestValidationEnabled;
+    AWSValidation.requestValidationEnabled = YES;
+}
+
+- (void)tearDown {
+    AWSValidation.requestValidationEnabled = self.requestValidationWasEnabled;
+    [super tearDown];
+}
+
+// A trimmed down Amazon DynamoDB definition of BatchWriteItem, with the constraints of the service model.
++ (NSDictionary *)serviceDefinition {
+    static NSDictionary *serviceDefinition = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        serviceDefinition = @{
+            @"metadata" : @{@"protocol" : @"json"},
+            @"operations" : @{
+                    @"BatchWriteItem" : @{@"input" : @{@"shape" : @"BatchWriteItemInput"}},
+                    @"ListTables" : @{@"input" : @{@"shape" : @"ListTablesInput"}},
+                    },
+            @"shapes" : @{
+                    @"BatchWriteItemInput" : @{
+                            @"type" : @"structure",
+                            @"required" : @[@"RequestItems"],
+                            @"members" : @{
+                                    @"RequestItems" : @{@"shape" : @"BatchWriteItemRequestMap"},
+                                    @"ReturnConsumedCapacity" : @{@"shape" : @"ReturnConsumedCapacity"},
+                                    },
+                            },
+                    @"BatchWriteItemRequestMap" : @{
+                            @"type" : @"map",
+                            @"key" : @{@"shape" : @"TableName"},
+                            @"value" : @{@"shape" : @"WriteRequests"},
+                            @"min" : @1,
+                            @"max" : @25,
+                            },
+                    @"TableName" : @{@"type" : @"string", @"min" : @3, @"max" : @255, @"pattern" : @"[a-zA-Z0-9_.-]+"},
+                    @"WriteRequests" : @{@"type" : @"list", @"member" : @{@"shape" : @"WriteRequest"}, @"min" : @1, @"max" : @25},
+                    @"WriteRequest" : @{
+                            @"type" : @"structure",
+                            @"members" : @{@"PutRequest" : @{@"shape" : @"PutRequest"}},
+                            },
+                    @"PutRequest" : @{
+                            @"type" : @"structure",
+                            @"required" : @[@"Item"],
+                            @"members" : @{@"Item" : @{@"shape" : @"PutItemInputAttributeMap"}},
+                            },
+                    @"PutItemInputAttributeMap" : @{
+                            @"type" : @"map",
+                            @"key" : @{@"shape" : @"AttributeName"},
+                            @"value" : @{@"shape" : @"AttributeValue"},
+                            },
+                    @"AttributeName" : @{@"type" : @"string", @"max" : @65535},
+                    @"AttributeValue" : @{
+                            @"type" : @"structure",
+                            @"members" : @{
+                                    @"S" : @{@"shape" : @"StringAttributeValue"},
+                                    @"N" : @{@"shape" : @"NumberAttributeValue"},
+                                    @"B" : @{@"shape" : @"BinaryAttributeValue"},
+                                    @"L" : @{@"shape" : @"ListAttributeValue"},
+                                    },
+                            },
+                    @"ListAttributeValue" : @{@"type" : @"list", @"member" : @{@"shape" : @"AttributeValue"}},
+                    @"ListTablesInput" : @{
+                            @"type" : @"structure",
+                            @"members" : @{
+                                    @"ExclusiveStartTableName" : @{@"shape" : @"TableName"},
+                                    @"Limit" : @{@"shape" : @"ListTablesInputLimit"},
+                                    @"Token" : @{@"shape" : @"String", @"min" : @2},
+                                    @"Key" : @{@"shape" : @"BinaryAttributeValue", @"max" : @4},
+                                    },
+                            },
+                    @"ListTablesInputLimit" : @{@"type" : @"integer", @"min" : @1, @"max" : @100},
+                    @"ReturnConsumedCapacity" : @{@"type" : @"string", @"enum" : @[@"INDEXES", @"TOTAL", @"NONE"]},
+                    @"StringAttributeValue" : @{@"type" : @"string"},
+                    @"NumberAttributeValue" : @{@"type" : @"string"},
+                    @"BinaryAttributeValue" : @{@"type" : @"blob"},
+                    @"String" : @{@"type" : @"string"},
+                    },
+        };
+    });
+    return serviceDefinition;
+}
+
+- (NSDictionary *)batchWriteItemParametersWithCount:(NSUInteger)count {
+    NSMutableArray *writeRequests = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [writeRequests addObject:@{@"PutRequest" : @{@"Item" : @{@"id" : @{@"S" : [NSString stringWithFormat:@"item-%lu", (unsigned long)i]},
+                                                                  @"count" : @{@"N" : [NSString stringWithFormat:@"%lu", (unsigned long)i]},
+                                                                  @"tags" : @{@"L" : @[@{@"S" : @"a"}, @{@"S" : @"b"}]}}}}];
+    }
+    return @{@"RequestItems" : @{@"Music.Collection-2024" : writeRequests}, @"ReturnConsumedCapacity" : @"TOTAL"};
+}
+
+- (NSError *)errorForParameters:(NSDictionary *)parameters actionName:(NSString *)actionName {
+    NSError *error = nil;
+    BOOL valid = [AWSValidation validateParameters:parameters
+                                        actionName:actionName
+                             serviceDefinitionRule:[[self class] serviceDefinition]
+                                             error:&error];
+    XCTAssertEqual(valid, error == nil);
+    return error;
+}
+
+- (void)testValidParameters {
+    XCTAssertNil([self errorForParameters:[self batchWriteItemParametersWithCount:25] actionName:@"BatchWriteItem"]);
+    XCTAssertNil([self errorForParameters:@{} actionName:@"ListTables"]);
+    XCTAssertNil([self errorForParameters:@{@"ExclusiveStartTableName" : @"abc", @"Limit" : @100, @"Token" : @"ab", @"Key" : [NSData dataWithBytes:"1234" length:4]}
+                               actionName:@"ListTables"]);
+    // Unknown operations and members, and values of another type, are left to the serializer.
+    XCTAssertNil([self errorForParameters:@{@"RequestItems" : @{}} actionName:@"Unknown"]);
+    XCTAssertNil([self errorForParameters:@{@"Limit" : @"1000", @"Unknown" : @""} actionName:@"ListTables"]);
+}
+
+- (void)testMissingRequiredParameter {
+    NSError *error = [self errorForParameters:@{@"ReturnConsumedCapacity" : @"TOTAL"} actionName:@"BatchWriteItem"];
+    XCTAssertEqualObjects(AWSValidationErrorDomain, error.domain);
+    XCTAssertEqual(AWSValidationMissingRequiredParameter, error.code);
+    XCTAssertEqualObjects(@"Invalid parameter RequestItems of BatchWriteItem: is required", error.localizedDescription);
+
+    error = [self errorForParameters:@{@"RequestItems" : @{@"table" : @[@{@"PutRequest" : @{@"Item" : [NSNull null]}}]}} actionName:@"BatchWriteItem"];
+    XCTAssertEqual(AWSValidationMissingRequiredParameter, error.code);
+    XCTAssertEqualObjects(@"Invalid parameter RequestItems[table][0].PutRequest.Item of BatchWriteItem: is required", error.localizedDescription);
+}
+
+- (void)testOutOfRangeParameter {
+    NSError *error = [self errorForParameters:@{@"Limit" : @0} actionName:@"ListTables"];
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, error.code);
+    XCTAssertEqualObjects(@"Invalid parameter Limit of ListTables: value 0 is less than 1", error.localizedDescription);
+
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, [self errorForParameters:@{@"Limit" : @101} actionName:@"ListTables"].code);
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, [self errorForParameters:@{@"ExclusiveStartTableName" : @"ab"} actionName:@"ListTables"].code);
+    // Lengths count characters, not UTF-16 code units.
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, [self errorForParameters:@{@"Token" : @"😀"} actionName:@"ListTables"].code);
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, [self errorForParameters:@{@"Key" : [NSData dataWithBytes:"12345" length:5]} actionName:@"ListTables"].code);
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, [self errorForParameters:[self batchWriteItemParametersWithCount:26] actionName:@"BatchWriteItem"].code);
+    XCTAssertEqual(AWSValidationOutOfRangeParameter, [self errorForParameters:@{@"RequestItems" : @{}} actionName:@"BatchWriteItem"].code);
+}
+
+- (void)testPatternMismatch {
+    NSError *error = [self errorForParameters:@{@"RequestItems" : @{@"***" : @[@{}]}} actionName:@"BatchWriteItem"];
+    XCTAssertEqual(AWSValidationInvalidStringParameter, error.code);
+    XCTAssertEqualObjects(@"Invalid parameter RequestItems[***] of BatchWriteItem: does not match the pattern [a-zA-Z0-9_.-]+", error.localizedDescription);
+}
+
+- (void)testPatternMustMatchWholeValue {
+    for (NSString *tableName in @[@"a***", @"***a", @"table\n"]) {
+        NSError *error = [self errorForParameters:@{@"RequestItems" : @{tableName : @[@{}]}} actionName:@"BatchWriteItem"];
+        XCTAssertEqual(AWSValidationInvalidStringParameter, error.code, @"%@", tableName);
+    }
+}
+
+- (void)testRecursiveShapes {
+    NSDictionary *item = @{@"L" : @[@{@"L" : @[@{@"S" : @"nested"}]}]};
+    NSDictionary *parameters = @{@"RequestItems" : @{@"table" : @[@{@"PutRequest" : @{@"Item" : @{@"nested" : item}}}]}};
+    XCTAssertNil([self errorForParameters:parameters actionName:@"BatchWriteItem"]);
+}
+
+- (void)testValidationCanBeDisabled {
+    AWSValidation.requestValidationEnabled = NO;
+    XCTAssertNil([self errorForParameters:@{} actionName:@"BatchWriteItem"]);
+}
+
+- (void)testSerializerFailsForInvalidParameters {
+    AWSJSONRequestSerializer *serializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[self class] serviceDefinition]
+                                                                                         actionName:@"ListTables"];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]];
+    request.HTTPMethod = @"POST";
+    AWSTask *task = [serializer serializeRequest:request headers:@{} parameters:@{@"Limit" : @0}];
+    [task waitUntilFinished];
+    XCTAssertEqualObjects(AWSValidationErrorDomain, task.error.domain);
+    XCTAssertNil(request.HTTPBody);
+}
+
+#pragma mark - Benchmarks
+
+// Validates by walking the definition dictionaries and compiling patterns for every request.
+- (BOOL)interpretedValidationOfValue:(id)value rule:(NSDictionary *)rule shapes:(NSDictionary *)shapes {
+    NSDictionary *shape = shapes[rule[@"shape"]];
+    NSString *type = shape[@"type"];
+    NSNumber *minimum = rule[@"min"] ?: shape[@"min"];
+    NSNumber *maximum = rule[@"max"] ?: shape[@"max"];
+    if ([type isEqualToString:@"structure"]) {
+        for (NSString *name in shape[@"required"]) {
+            if (value[name] == nil) {
+                return NO;
+            }
+        }
+        for (NSString *name in shape[@"members"]) {
+            id memberValue = value[name];
+            if (memberValue && ![self interpretedValidationOfValue:memberValue rule:shape[@"members"][name] shapes:shapes]) {
+                return NO;
+            }
+        }
+    } else if ([type isEqualToString:@"list"]) {
+        if ((minimum && [value count] < [minimum unsignedIntegerValue]) || (maximum && [value count] > [maximum unsignedIntegerValue])) {
+            return NO;
+        }
+        for (id memberValue in value) {
+            if (![self interpretedValidationOfValue:memberValue rule:shape[@"member"] shapes:shapes]) {
+                return NO;
+            }
+        }
+    } else if ([type isEqualToString:@"map"]) {
+        if ((minimum && [value count] < [minimum unsignedIntegerValue]) || (maximum && [value count] > [maximum unsignedIntegerValue])) {
+            return NO;
+        }
+        for (id key in value) {
+            if (![self interpretedValidationOfValue:key rule:shape[@"key"] shapes:shapes]
+                || ![self interpretedValidationOfValue:value[key] rule:shape[@"value"] shapes:shapes]) {
+                return NO;
+            }
+        }
+    } else if ([type isEqualToString:@"string"]) {
+        if ((minimum && [value length] < [minimum unsignedIntegerValue]) || (maximum && [value length] > [maximum unsignedIntegerValue])) {
+            return NO;
+        }
+        NSString *pattern = rule[@"pattern"] ?: shape[@"pattern"];
+        if (pattern) {
+            NSString *wholeValuePattern = [NSString stringWithFormat:@"\\A(?:%@)\\z", pattern];
+            NSRegularExpression *regularExpression = [NSRegularExpression regularExpressionWithPattern:wholeValuePattern options:0 error:nil];
+            if ([regularExpression rangeOfFirstMatchInString:value options:0 range:NSMakeRange(0, [value length])].location == NSNotFound) {
+                return NO;
+            }
+        }
+    }
+    return YES;
+}
+
+- (void)testPerformanceInterpretedValidation {
+    NSDictionary *parameters = [self batchWriteItemParametersWithCount:AWSValidationBenchmarkItemCount];
+    NSDictionary *serviceDefinition = [[self class] serviceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSValidationBenchmarkIterations; i++) {
+            @autoreleasepool {
+                XCTAssertTrue([self interpretedValidationOfValue:parameters
+                                                            rule:serviceDefinition[@"operations"][@"BatchWriteItem"][@"input"]
+                                                          shapes:serviceDefinition[@"shapes"]]);
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceCompiledValidation {
+    NSDictionary *parameters = [self batchWriteItemParametersWithCount:AWSValidationBenchmarkItemCount];
+    NSDictionary *serviceDefinition = [[self class] serviceDefinition];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSValidationBenchmarkIterations; i++) {
+            @autoreleasepool {
+                XCTAssertTrue([AWSValidation validateParameters:parameters
+                                                     actionName:@"BatchWriteItem"
+                                          serviceDefinitionRule:serviceDefinition
+                                                          error:nil]);
+            }
+        }
+    }];
+}
+
+@end
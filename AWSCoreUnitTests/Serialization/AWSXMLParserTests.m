@@ -0,0 +1,447 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSSerialization.h"
+#import "AWSXMLDictionary.h"
+#import "AWSXMLStreamingDecoder.h"
+
+static NSUInteger const AWSXMLParserTestsConcurrentParses = 32;
+
+@interface AWSXMLParser (AWSXMLParserTests)
+
+@property (nonatomic, strong) AWSXMLDictionaryParser *xmlDictionaryParser;
+
++ (NSMutableDictionary *)preprocessDictionary:(NSMutableDictionary *)fromDictionary operationName:(NSString *)operationName actionRule:(NSDictionary *)actionRule serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
++ (NSMutableDictionary *)parseStructure:(NSDictionary *)structure rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error;
+
+@end
+
+@interface AWSXMLParserTests : XCTestCase
+
+@end
+
+@implementation AWSXMLParserTests
+
+// A rest-xml ListObjects model, trimmed to the members the response below uses.
+- (NSDictionary *)listObjectsDefinition {
+    return @{@"metadata": @{@"protocol": @"rest-xml"},
+             @"operations": @{@"ListObjects": @{@"name": @"ListObjects",
+                                                @"output": @{@"shape": @"ListObjectsOutput"}}},
+             @"shapes": @{@"ListObjectsOutput": @{@"type": @"structure",
+                                                  @"members": @{@"Name": @{@"shape": @"String"},
+                                                                @"IsTruncated": @{@"shape": @"Boolean"},
+                                                                @"Contents": @{@"shape": @"ObjectList"}}},
+                          @"ObjectList": @{@"type": @"list",
+                                           @"member": @{@"shape": @"Object"},
+                                           @"flattened": @YES},
+                          @"Object": @{@"type": @"structure",
+                                       @"members": @{@"Key": @{@"shape": @"String"},
+                                                     @"Size": @{@"shape": @"Integer"},
+                                                     @"ETag": @{@"shape": @"String"},
+                                                     @"StorageClass": @{@"shape": @"String"}}},
+                          @"String": @{@"type": @"string"},
+                          @"Integer": @{@"type": @"integer"},
+                          @"Boolean": @{@"type": @"boolean"}}};
+}
+
+- (NSData *)listObjectsResponseWithCount:(NSUInteger)count {
+    NSMutableString *xml = [NSMutableString stringWithString:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                            "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                            "<Name>examplebucket</Name><IsTruncated>false</IsTruncated>"];
+    for (NSUInteger i = 0; i < count; i++) {
+        [xml appendFormat:@"<Contents><Key>photos/2026/%05lu.jpg</Key><Size>%lu</Size>"
+         "<ETag>&quot;fba9dede5f27731c9771645a39863328&quot;</ETag><StorageClass>STANDARD</StorageClass></Contents>",
+         (unsigned long)i, (unsigned long)(i * 1024)];
+    }
+    [xml appendString:@"</ListBucketResult>"];
+    return [xml dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+// A query model with a result wrapper, a non-flattened list and a non-flattened map.
+- (NSDictionary *)describeStacksDefinition {
+    return @{@"metadata": @{@"protocol": @"query"},
+             @"operations": @{@"DescribeStacks": @{@"name": @"DescribeStacks",
+                                                   @"output": @{@"shape": @"DescribeStacksOutput",
+                                                                @"resultWrapper": @"DescribeStacksResult"}}},
+             @"shapes": @{@"DescribeStacksOutput": @{@"type": @"structure",
+                                                     @"members": @{@"Stacks": @{@"shape": @"Stacks"},
+                                                                   @"NextToken": @{@"shape": @"String"}}},
+                          @"Stacks": @{@"type": @"list",
+                                       @"member": @{@"shape": @"Stack"}},
+                          @"Stack": @{@"type": @"structure",
+                                      @"members": @{@"StackName": @{@"shape": @"String"},
+                                                    @"CreationTime": @{@"shape": @"String"},
+                                                    @"EnableTerminationProtection": @{@"shape": @"Boolean"},
+                                                    @"Outputs": @{@"shape": @"Outputs"},
+                                                    @"Tags": @{@"shape": @"Tags"}}},
+                          @"Outputs": @{@"type": @"list",
+                                        @"member": @{@"shape": @"String"}},
+                          @"Tags": @{@"type": @"map",
+                                     @"key": @{@"shape": @"String"},
+                                     @"value": @{@"shape": @"String"}},
+                          @"String": @{@"type": @"string"},
+                          @"Boolean": @{@"type": @"boolean"}}};
+}
+
+- (NSData *)describeStacksResponse {
+    NSString *xml = @"<DescribeStacksResponse xmlns=\"http://cloudformation.amazonaws.com/doc/2010-05-15/\">"
+    "<DescribeStacksResult><Stacks>"
+    "<member><StackName>first</StackName><CreationTime>2026-01-01T00:00:00Z</CreationTime>"
+    "<EnableTerminationProtection>true</EnableTerminationProtection>"
+    "<Outputs><member>a</member><member><![CDATA[<b>]]></member><member/></Outputs>"
+    "<Tags><entry><key>team</key><value>storage</value></entry><entry><key>empty</key><value/></entry></Tags></member>"
+    "<member><StackName>second</StackName><Outputs/><Tags/></member>"
+    "</Stacks><NextToken>token</NextToken></DescribeStacksResult>"
+    "<ResponseMetadata><RequestId>b9b4b068-3a41-11e5-94eb-example</RequestId></ResponseMetadata>"
+    "</DescribeStacksResponse>";
+    return [xml dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+// An EC2 model, where lists are not flattened and their members are named `item`.
+- (NSDictionary *)describeInstancesDefinition {
+    return @{@"metadata": @{@"protocol": @"ec2"},
+             @"operations": @{@"DescribeInstances": @{@"name": @"DescribeInstances",
+                                                      @"output": @{@"shape": @"DescribeInstancesResult"}}},
+             @"shapes": @{@"DescribeInstancesResult": @{@"type": @"structure",
+                                                        @"members": @{@"Reservations": @{@"shape": @"ReservationList",
+                                                                                         @"locationName": @"reservationSet"}}},
+                          @"ReservationList": @{@"type": @"list",
+                                                @"member": @{@"shape": @"Reservation",
+                                                             @"locationName": @"item"}},
+                          @"Reservation": @{@"type": @"structure",
+                                            @"members": @{@"ReservationId": @{@"shape": @"String",
+                                                                              @"locationName": @"reservationId"},
+                                                          @"Instances": @{@"shape": @"InstanceList",
+                                                                          @"locationName": @"instancesSet"}}},
+                          @"InstanceList": @{@"type": @"list",
+                                             @"member": @{@"shape": @"Instance",
+                                                          @"locationName": @"item"}},
+                          @"Instance": @{@"type": @"structure",
+                                         @"members": @{@"InstanceId": @{@"shape": @"String",
+                                                                        @"locationName": @"instanceId"},
+                                                       @"AmiLaunchIndex": @{@"shape": @"Integer",
+                                                                            @"locationName": @"amiLaunchIndex"},
+                                                       @"EbsOptimized": @{@"shape": @"Boolean",
+                                                                          @"locationName": @"ebsOptimized"}}},
+                          @"String": @{@"type": @"string"},
+                          @"Integer": @{@"type": @"integer"},
+                          @"Boolean": @{@"type": @"boolean"}}};
+}
+
+- (NSData *)describeInstancesResponse {
+    NSString *xml = @"<DescribeInstancesResponse xmlns=\"http://ec2.amazonaws.com/doc/2016-11-15/\">"
+    "<requestId>8f7724cf-496f-496e-8fe3-example</requestId><reservationSet>"
+    "<item><reservationId>r-1234567890abcdef0</reservationId><instancesSet>"
+    "<item><instanceId>i-1234567890abcdef0</instanceId><amiLaunchIndex>0</amiLaunchIndex><ebsOptimized>false</ebsOptimized></item>"
+    "<item><instanceId>i-0598c7d356eba48d7</instanceId><amiLaunchIndex>1</amiLaunchIndex><ebsOptimized>true</ebsOptimized></item>"
+    "</instancesSet></item>"
+    "<item><reservationId>r-0598c7d356eba48d7</reservationId><instancesSet/></item>"
+    "</reservationSet></DescribeInstancesResponse>";
+    return [xml dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+// A rest-xml model with a flattened map.
+- (NSDictionary *)getAttributesDefinition {
+    return @{@"metadata": @{@"protocol": @"rest-xml"},
+             @"operations": @{@"GetAttributes": @{@"name": @"GetAttributes",
+                                                  @"output": @{@"shape": @"GetAttributesOutput"}}},
+             @"shapes": @{@"GetAttributesOutput": @{@"type": @"structure",
+                                                    @"members": @{@"Attributes": @{@"shape": @"AttributeMap",
+                                                                                   @"locationName": @"Attribute"}}},
+                          @"AttributeMap": @{@"type": @"map",
+                                             @"key": @{@"shape": @"String", @"locationName": @"Name"},
+                                             @"value": @{@"shape": @"String", @"locationName": @"Value"},
+                                             @"flattened": @YES},
+                          @"String": @{@"type": @"string"}}};
+}
+
+- (NSData *)getAttributesResponse {
+    NSString *xml = @"<GetAttributesResult>"
+    "<Attribute><Name>Policy</Name><Value>{&quot;Version&quot;:&quot;2012-10-17&quot;}</Value></Attribute>"
+    "<Attribute><Name>DisplayName</Name><Value>Example</Value></Attribute>"
+    "</GetAttributesResult>";
+    return [xml dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSMutableDictionary *)parse:(NSData *)data definition:(NSDictionary *)definition {
+    return [self parse:data definition:definition actionName:@"ListObjects"];
+}
+
+- (NSMutableDictionary *)parse:(NSData *)data definition:(NSDictionary *)definition actionName:(NSString *)actionName {
+    NSError *error = nil;
+    NSMutableDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                                           actionName:actionName
+                                                                serviceDefinitionRule:definition
+                                                                                error:&error];
+    XCTAssertNil(error);
+    return result;
+}
+
+// Builds a dictionary of the whole document, then walks it with the output rules, as successful responses used to be
+// decoded.
+- (NSMutableDictionary *)treeParse:(NSData *)data definition:(NSDictionary *)definition actionName:(NSString *)actionName {
+    AWSXMLDictionaryParser *xmlDictionaryParser = [[AWSXMLParser sharedInstance].xmlDictionaryParser copy];
+    NSDictionary *rootXmlDictionary = [xmlDictionaryParser dictionaryWithData:data];
+    NSString *rootNodeName = [[rootXmlDictionary allKeys] firstObject];
+    NSMutableDictionary *xmlDictionary = rootXmlDictionary[rootNodeName];
+
+    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:definition[@"operations"][actionName][@"output"]
+                                                          JSONDefinitionRule:definition[@"shapes"]];
+    xmlDictionary = [AWSXMLParser preprocessDictionary:xmlDictionary
+                                         operationName:actionName
+                                            actionRule:rules
+                                 serviceDefinitionRule:definition];
+    NSError *error = nil;
+    NSMutableDictionary *result = [AWSXMLParser parseStructure:xmlDictionary rules:rules[@"members"] error:&error];
+    XCTAssertNil(error);
+    return result;
+}
+
+- (void)assertStreamingParseMatchesTreeParse:(NSData *)data definition:(NSDictionary *)definition actionName:(NSString *)actionName {
+    NSMutableDictionary *expected = [self treeParse:data definition:definition actionName:actionName];
+    XCTAssertGreaterThan(expected.count, 0);
+    XCTAssertEqualObjects([self parse:data definition:definition actionName:actionName], expected);
+}
+
+- (void)testParse {
+    NSMutableDictionary *result = [self parse:[self listObjectsResponseWithCount:2] definition:[self listObjectsDefinition]];
+    XCTAssertEqualObjects(result[@"Name"], @"examplebucket");
+    XCTAssertEqualObjects(result[@"IsTruncated"], @NO);
+    NSArray *contents = result[@"Contents"];
+    XCTAssertEqual(contents.count, 2);
+    XCTAssertEqualObjects(contents[1][@"Key"], @"photos/2026/00001.jpg");
+    XCTAssertEqualObjects(contents[1][@"Size"], @1024);
+    XCTAssertEqualObjects(contents[1][@"ETag"], @"\"fba9dede5f27731c9771645a39863328\"");
+}
+
+- (void)testStreamingParseMatchesTreeParse {
+    [self assertStreamingParseMatchesTreeParse:[self listObjectsResponseWithCount:3]
+                                    definition:[self listObjectsDefinition]
+                                    actionName:@"ListObjects"];
+    [self assertStreamingParseMatchesTreeParse:[self describeStacksResponse]
+                                    definition:[self describeStacksDefinition]
+                                    actionName:@"DescribeStacks"];
+    [self assertStreamingParseMatchesTreeParse:[self describeInstancesResponse]
+                                    definition:[self describeInstancesDefinition]
+                                    actionName:@"DescribeInstances"];
+    [self assertStreamingParseMatchesTreeParse:[self getAttributesResponse]
+                                    definition:[self getAttributesDefinition]
+                                    actionName:@"GetAttributes"];
+}
+
+- (void)testStreamingParseOfQueryResponse {
+    NSMutableDictionary *result = [self parse:[self describeStacksResponse]
+                                   definition:[self describeStacksDefinition]
+                                   actionName:@"DescribeStacks"];
+    XCTAssertEqualObjects(result[@"NextToken"], @"token");
+    NSArray *stacks = result[@"Stacks"];
+    XCTAssertEqual(stacks.count, 2);
+    XCTAssertEqualObjects(stacks[0][@"EnableTerminationProtection"], @YES);
+    XCTAssertEqualObjects(stacks[0][@"Outputs"], (@[@"a", @"<b>", @""]));
+    XCTAssertEqualObjects(stacks[0][@"Tags"], (@{@"team": @"storage", @"empty": @""}));
+    XCTAssertEqualObjects(stacks[1][@"Outputs"], @[]);
+    XCTAssertEqualObjects(stacks[1][@"Tags"], @{});
+}
+
+- (void)testErrorResponseIsNotStreamed {
+    NSData *data = [@"<Error><Code>NoSuchBucket</Code><Message>The specified bucket does not exist</Message></Error>" dataUsingEncoding:NSUTF8StringEncoding];
+    __block BOOL handled = NO;
+    NSError *error = nil;
+    NSMutableDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                                           actionName:@"ListObjects"
+                                                                serviceDefinitionRule:[self listObjectsDefinition]
+                                                                    listMemberHandler:^BOOL(NSString *listName, id member) {
+                                                                        handled = YES;
+                                                                        return YES;
+                                                                    }
+                                                                                error:&error];
+    XCTAssertNil(error);
+    XCTAssertFalse(handled);
+    XCTAssertEqualObjects(result[@"Error"][@"Code"], @"NoSuchBucket");
+}
+
+// The documents the decoder can not decode from the output shape, which it forwards to the document parser.
+- (NSArray<NSData *> *)documentsWithoutOutputMembers {
+    NSArray<NSString *> *documents = @[
+        // Amazon S3
+        @"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<Error>\n  <Code>NoSuchKey</Code>\n  <Message>The resource you requested does not exist</Message>\n  <Resource>/mybucket/myfoto.jpg</Resource>\n  <RequestId>4442587FB7D0A2F9</RequestId>\n</Error>",
+        // Query protocol
+        @"<ErrorResponse xmlns=\"http://sqs.amazonaws.com/doc/2012-11-05/\">\n  <Error>\n    <Type>Sender</Type>\n    <Code>InvalidParameterValue</Code>\n    <Message>Value (quename_nonalpha) for parameter QueueName is invalid.</Message>\n    <Detail/>\n  </Error>\n  <RequestId>42d59b56-7407-4c4a-be0f-4c88daeea257</RequestId>\n</ErrorResponse>",
+        // Amazon EC2
+        @"<Response><Errors><Error><Code>InvalidInstanceID.NotFound</Code><Message>The instance ID 'i-1a2b3c4d' does not exist</Message></Error></Errors><RequestID>ea966190-f9aa-478e-9ede-example</RequestID></Response>",
+        // Root elements without child elements
+        @"<LocationConstraint xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">us-west-2</LocationConstraint>",
+        @"<LocationConstraint xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"/>",
+    ];
+    NSMutableArray<NSData *> *data = [NSMutableArray new];
+    for (NSString *document in documents) {
+        [data addObject:[document dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    return data;
+}
+
+- (void)testDocumentDictionaryMatchesDictionaryParser {
+    AWSXMLDictionaryParser *documentParser = [AWSXMLParser sharedInstance].xmlDictionaryParser;
+    for (NSData *data in [self documentsWithoutOutputMembers]) {
+        AWSXMLStreamingDecoder *decoder = [[AWSXMLStreamingDecoder alloc] initWithActionName:@"ListObjects"
+                                                                       serviceDefinitionRule:[self listObjectsDefinition]];
+        decoder.documentParser = documentParser;
+        NSError *error = nil;
+        XCTAssertNil([decoder decodeData:data error:&error]);
+        XCTAssertNil(error);
+        XCTAssertEqualObjects(decoder.documentDictionary, [[documentParser copy] dictionaryWithData:data]);
+    }
+}
+
+- (void)testErrorResponseAfterOtherMembersIsParsedAgain {
+    NSData *data = [@"<Response><RequestID>ea966190</RequestID><Errors><Error><Code>Throttling</Code></Error></Errors></Response>" dataUsingEncoding:NSUTF8StringEncoding];
+    AWSXMLStreamingDecoder *decoder = [[AWSXMLStreamingDecoder alloc] initWithActionName:@"ListObjects"
+                                                                   serviceDefinitionRule:[self listObjectsDefinition]];
+    decoder.documentParser = [AWSXMLParser sharedInstance].xmlDictionaryParser;
+    XCTAssertNil([decoder decodeData:data error:nil]);
+    XCTAssertNil(decoder.documentDictionary);
+
+    NSMutableDictionary *result = [self parse:data definition:[self listObjectsDefinition]];
+    XCTAssertEqualObjects(result[@"Error"][@"Code"], @"Throttling");
+}
+
+- (void)testStreamingPayloadIsNotParsed {
+    NSDictionary *definition = @{@"metadata": @{@"protocol": @"rest-xml"},
+                                 @"operations": @{@"GetObject": @{@"name": @"GetObject",
+                                                                  @"output": @{@"shape": @"GetObjectOutput"}}},
+                                 @"shapes": @{@"GetObjectOutput": @{@"type": @"structure",
+                                                                    @"members": @{@"Body": @{@"shape": @"Body"}},
+                                                                    @"payload": @"Body"},
+                                              @"Body": @{@"type": @"blob", @"streaming": @YES}}};
+
+    NSData *xmlObject = [@"<Contents><Errors>none</Errors><Key>a</Key></Contents>" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertEqualObjects([self parse:xmlObject definition:definition actionName:@"GetObject"], @{@"Body": xmlObject});
+
+    uint8_t bytes[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A, 0x00};
+    NSData *binaryObject = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+    XCTAssertEqualObjects([self parse:binaryObject definition:definition actionName:@"GetObject"], @{@"Body": binaryObject});
+
+    XCTAssertEqualObjects([self parse:[NSData data] definition:definition actionName:@"GetObject"], @{@"Body": [NSData data]});
+
+    NSData *error = [@"<Error><Code>NoSuchKey</Code><Message>The specified key does not exist.</Message></Error>" dataUsingEncoding:NSUTF8StringEncoding];
+    NSMutableDictionary *result = [self parse:error definition:definition actionName:@"GetObject"];
+    XCTAssertEqualObjects(result[@"Error"][@"Code"], @"NoSuchKey");
+}
+
+- (void)testListMemberHandlerReceivesMembersInOrder {
+    NSMutableArray<NSString *> *keys = [NSMutableArray new];
+    NSError *error = nil;
+    NSMutableDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:[self listObjectsResponseWithCount:5]
+                                                                           actionName:@"ListObjects"
+                                                                serviceDefinitionRule:[self listObjectsDefinition]
+                                                                    listMemberHandler:^BOOL(NSString *listName, id member) {
+                                                                        XCTAssertEqualObjects(listName, @"Contents");
+                                                                        [keys addObject:member[@"Key"]];
+                                                                        // Keep every other member in the output.
+                                                                        return keys.count % 2 == 1;
+                                                                    }
+                                                                                error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(keys, (@[@"photos/2026/00000.jpg", @"photos/2026/00001.jpg", @"photos/2026/00002.jpg",
+                                   @"photos/2026/00003.jpg", @"photos/2026/00004.jpg"]));
+    XCTAssertEqualObjects([result[@"Contents"] valueForKey:@"Key"], (@[@"photos/2026/00001.jpg", @"photos/2026/00003.jpg"]));
+    XCTAssertEqualObjects(result[@"Name"], @"examplebucket");
+
+    // Members of nested lists stay in their structures.
+    NSMutableArray<NSString *> *listNames = [NSMutableArray new];
+    result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:[self describeInstancesResponse]
+                                                      actionName:@"DescribeInstances"
+                                           serviceDefinitionRule:[self describeInstancesDefinition]
+                                               listMemberHandler:^BOOL(NSString *listName, id member) {
+                                                   [listNames addObject:listName];
+                                                   XCTAssertEqual([member[@"Instances"] count], listNames.count == 1 ? 2 : 0);
+                                                   return YES;
+                                               }
+                                                           error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(listNames, (@[@"Reservations", @"Reservations"]));
+    XCTAssertEqualObjects(result[@"Reservations"], @[]);
+}
+
+- (void)testConcurrentParsesMatchSerialParse {
+    NSDictionary *definition = [self listObjectsDefinition];
+    NSMutableArray<NSData *> *responses = [NSMutableArray new];
+    NSMutableArray<NSDictionary *> *expected = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSXMLParserTestsConcurrentParses; i++) {
+        NSData *response = [self listObjectsResponseWithCount:i + 1];
+        [responses addObject:response];
+        [expected addObject:[self parse:response definition:definition]];
+    }
+
+    NSMutableArray *results = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSXMLParserTestsConcurrentParses; i++) {
+        [results addObject:[NSNull null]];
+    }
+    dispatch_apply(AWSXMLParserTestsConcurrentParses * 4, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        NSUInteger index = iteration % AWSXMLParserTestsConcurrentParses;
+        NSMutableDictionary *result = [self parse:responses[index] definition:definition];
+        @synchronized (results) {
+            results[index] = result;
+        }
+    });
+
+    XCTAssertEqualObjects(results, expected);
+}
+
+#pragma mark - Benchmarks
+
+// The parse behind the global lock the parser used to take, as a baseline for the concurrent benchmark.
+- (void)testPerformanceSerializedParses {
+    NSDictionary *definition = [self listObjectsDefinition];
+    NSData *response = [self listObjectsResponseWithCount:1000];
+    NSObject *lock = [NSObject new];
+    [self measureBlock:^{
+        dispatch_apply(AWSXMLParserTestsConcurrentParses, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+            @synchronized (lock) {
+                [self parse:response definition:definition];
+            }
+        });
+    }];
+}
+
+- (void)testPerformanceTreeParse {
+    NSDictionary *definition = [self listObjectsDefinition];
+    NSData *response = [self listObjectsResponseWithCount:10000];
+    [self measureBlock:^{
+        [self treeParse:response definition:definition actionName:@"ListObjects"];
+    }];
+}
+
+- (void)testPerformanceStreamingParse {
+    NSDictionary *definition = [self listObjectsDefinition];
+    NSData *response = [self listObjectsResponseWithCount:10000];
+    [self measureBlock:^{
+        [self parse:response definition:definition];
+    }];
+}
+
+- (void)testPerformanceConcurrentParses {
+    NSDictionary *definition = [self listObjectsDefinition];
+    NSData *response = [self listObjectsResponseWithCount:1000];
+    [self measureBlock:^{
+        dispatch_apply(AWSXMLParserTestsConcurrentParses, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+            [self parse:response definition:definition];
+        });
+    }];
+}
+
+@end
@@ -0,0 +1,241 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSSignature.h"
+#import "AWSCategory.h"
+
+static NSString *const AWSChunkedEncodingTestSecretKey = @"wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY";
+static NSString *const AWSChunkedEncodingTestScope = @"20130524/us-east-1/s3/aws4_request";
+static NSString *const AWSChunkedEncodingTestSeedSignature = @"4f232c4386841ef735655705268965c44a0e4690baa4adea153f7db9fa80a0a9";
+static NSUInteger const AWSChunkedEncodingBenchmarkLength = 64 * 1024 * 1024;
+
+@interface AWSS3ChunkedEncodingInputStreamTests : XCTestCase
+
+@end
+
+@implementation AWSS3ChunkedEncodingInputStreamTests
+
+- (AWSS3ChunkedEncodingInputStream *)chunkedStreamWithData:(NSData *)data chunkSize:(NSUInteger)chunkSize {
+    NSDate *date = [NSDate aws_dateFromString:@"20130524T000000Z" format:AWSDateISO8601DateFormat2];
+    NSData *kSigning = [AWSSignatureV4Signer getV4DerivedKey:AWSChunkedEncodingTestSecretKey
+                                                        date:@"20130524"
+                                                      region:@"us-east-1"
+                                                     service:@"s3"];
+    return [[AWSS3ChunkedEncodingInputStream alloc] initWithInputStream:[NSInputStream inputStreamWithData:data]
+                                                                   date:date
+                                                                  scope:AWSChunkedEncodingTestScope
+                                                               kSigning:kSigning
+                                                        headerSignature:AWSChunkedEncodingTestSeedSignature
+                                                              chunkSize:chunkSize];
+}
+
+- (NSData *)readStream:(NSInputStream *)stream bufferLength:(NSUInteger)bufferLength {
+    NSMutableData *output = [NSMutableData new];
+    uint8_t *buffer = malloc(bufferLength);
+    [stream open];
+    NSInteger read;
+    while ((read = [stream read:buffer maxLength:bufferLength]) > 0) {
+        XCTAssertLessThanOrEqual(read, bufferLength);
+        [output appendBytes:buffer length:read];
+    }
+    [stream close];
+    free(buffer);
+    return output;
+}
+
+// Splits the encoded body into chunks, returning the data length and signature of each one.
+- (NSArray<NSArray *> *)chunksFromEncodedData:(NSData *)encodedData {
+    NSMutableArray *chunks = [NSMutableArray new];
+    const char *bytes = [encodedData bytes];
+    NSUInteger length = [encodedData length];
+    NSUInteger location = 0;
+    while (location < length) {
+        NSString *header = [[NSString alloc] initWithBytes:bytes + location
+                                                    length:MIN((NSUInteger)89, length - location)
+                                                  encoding:NSASCIIStringEncoding];
+        NSArray *components = [header componentsSeparatedByString:@";chunk-signature="];
+        XCTAssertEqual(2, [components count]);
+        XCTAssertTrue([header hasSuffix:@"\r\n"]);
+
+        unsigned int dataLength = 0;
+        [[NSScanner scannerWithString:components[0]] scanHexInt:&dataLength];
+        NSString *signature = [components[1] stringByTrimmingCharactersInSet:[NSCharacterSet newlineCharacterSet]];
+        [chunks addObject:@[@(dataLength), signature]];
+
+        location += [header length] + dataLength;
+        XCTAssertEqual(0, memcmp(bytes + location, "\r\n", 2));
+        location += 2;
+    }
+    return chunks;
+}
+
+- (void)testChunkSignaturesMatchReferenceValues {
+    // https://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+    NSMutableData *data = [NSMutableData dataWithLength:66560];
+    memset([data mutableBytes], 'a', [data length]);
+    AWSS3ChunkedEncodingInputStream *stream = [self chunkedStreamWithData:data chunkSize:64 * 1024];
+
+    NSData *encodedData = [self readStream:stream bufferLength:32 * 1024];
+    NSArray *chunks = [self chunksFromEncodedData:encodedData];
+
+    NSArray *expected = @[@[@65536, @"ad80c730a21e5b8d04586a2213dd63b9a0e99e0e2307b0ade35a65485a288648"],
+                          @[@1024, @"0055627c9e194cb4542bae2aa5492e3c1575bbb81b612b7d234b86a503ef5497"],
+                          @[@0, @"b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9"]];
+    XCTAssertEqualObjects(expected, chunks);
+    XCTAssertEqual([AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:66560 chunkSize:64 * 1024], [encodedData length]);
+    XCTAssertEqual([encodedData length] - 66560, stream.totalLengthOfChunkSignatureSent);
+}
+
+- (void)testContentLengthForChunkSizes {
+    NSMutableData *data = [NSMutableData dataWithLength:3 * 1024 * 1024 + 17];
+    memset([data mutableBytes], 'b', [data length]);
+
+    for (NSNumber *chunkSize in @[@(8 * 1024), @(64 * 1024), @(1024 * 1024), @(8 * 1024 * 1024)]) {
+        AWSS3ChunkedEncodingInputStream *stream = [self chunkedStreamWithData:data chunkSize:[chunkSize unsignedIntegerValue]];
+        XCTAssertEqual([chunkSize unsignedIntegerValue], stream.chunkSize);
+
+        // Read in pieces smaller than a chunk, so every frame is drained over several reads.
+        NSData *encodedData = [self readStream:stream bufferLength:4096];
+        XCTAssertEqual([AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:[data length]
+                                                                                 chunkSize:[chunkSize unsignedIntegerValue]],
+                       [encodedData length]);
+
+        NSArray *chunks = [self chunksFromEncodedData:encodedData];
+        NSUInteger decodedLength = 0;
+        for (NSUInteger i = 0; i + 2 < [chunks count]; i++) {
+            XCTAssertEqualObjects(chunkSize, chunks[i][0]);
+        }
+        for (NSArray *chunk in chunks) {
+            decodedLength += [chunk[0] unsignedIntegerValue];
+        }
+        XCTAssertEqual([data length], decodedLength);
+        XCTAssertEqualObjects(@0, [chunks lastObject][0]);
+    }
+}
+
+- (void)testChunkSizeIsClamped {
+    NSData *data = [NSData data];
+    XCTAssertEqual(0, [self chunkedStreamWithData:data chunkSize:0].chunkSize);
+    XCTAssertEqual(AWSS3ChunkedEncodingMinimumChunkSize, [self chunkedStreamWithData:data chunkSize:1].chunkSize);
+    XCTAssertEqual(AWSS3ChunkedEncodingMaximumChunkSize, [self chunkedStreamWithData:data chunkSize:NSUIntegerMax].chunkSize);
+}
+
+- (void)testDefaultChunkSizeFitsReadBuffer {
+    NSMutableData *data = [NSMutableData dataWithLength:200 * 1024];
+    memset([data mutableBytes], 'c', [data length]);
+    AWSS3ChunkedEncodingInputStream *stream = [self chunkedStreamWithData:data chunkSize:0];
+
+    NSData *encodedData = [self readStream:stream bufferLength:32 * 1024];
+    XCTAssertEqual([AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:[data length]], [encodedData length]);
+
+    NSArray *chunks = [self chunksFromEncodedData:encodedData];
+    XCTAssertEqualObjects(@(32 * 1024 - 91), chunks[0][0]);
+}
+
+- (void)testEmptyBody {
+    AWSS3ChunkedEncodingInputStream *stream = [self chunkedStreamWithData:[NSData data] chunkSize:64 * 1024];
+    NSData *encodedData = [self readStream:stream bufferLength:32 * 1024];
+    XCTAssertEqual([AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:0 chunkSize:64 * 1024], [encodedData length]);
+    XCTAssertEqual(1, [[self chunksFromEncodedData:encodedData] count]);
+}
+
+- (void)testUnsignedChunksWithChecksumTrailer {
+    NSData *data = [@"123456789" dataUsingEncoding:NSUTF8StringEncoding];
+    AWSS3ChunkedEncodingInputStream *stream = [[AWSS3ChunkedEncodingInputStream alloc] initWithUnsignedInputStream:[NSInputStream inputStreamWithData:data]
+                                                                                                          chunkSize:0];
+    NSData *encodedData = [self readStream:stream bufferLength:32 * 1024];
+    NSString *encodedString = [[NSString alloc] initWithData:encodedData encoding:NSUTF8StringEncoding];
+
+    // The CRC32C check value of "123456789" is 0xe3069283.
+    XCTAssertEqualObjects(@"9\r\n123456789\r\n0\r\nx-amz-checksum-crc32c:4waSgw==\r\n\r\n", encodedString);
+    XCTAssertEqual([AWSS3ChunkedEncodingInputStream computeContentLengthForUnsignedChunkedData:[data length] chunkSize:0], [encodedData length]);
+    XCTAssertEqual([encodedData length] - [data length], stream.totalLengthOfChunkSignatureSent);
+}
+
+- (void)testUnsignedContentLengthForChunkSizes {
+    NSMutableData *data = [NSMutableData dataWithLength:3 * 1024 * 1024 + 17];
+    memset([data mutableBytes], 'e', [data length]);
+
+    for (NSNumber *chunkSize in @[@(8 * 1024), @(64 * 1024), @(1024 * 1024), @(8 * 1024 * 1024)]) {
+        AWSS3ChunkedEncodingInputStream *stream = [[AWSS3ChunkedEncodingInputStream alloc] initWithUnsignedInputStream:[NSInputStream inputStreamWithData:data]
+                                                                                                              chunkSize:[chunkSize unsignedIntegerValue]];
+        NSData *encodedData = [self readStream:stream bufferLength:4096];
+        XCTAssertEqual([AWSS3ChunkedEncodingInputStream computeContentLengthForUnsignedChunkedData:[data length]
+                                                                                         chunkSize:[chunkSize unsignedIntegerValue]],
+                       [encodedData length]);
+
+        NSString *header = [NSString stringWithFormat:@"%lx\r\n", (unsigned long)MIN([chunkSize unsignedIntegerValue], [data length])];
+        XCTAssertEqual(0, memcmp([encodedData bytes], [header UTF8String], [header length]));
+    }
+}
+
+#pragma mark - Benchmarks
+
+- (void)measureThroughputWithChunkSize:(NSUInteger)chunkSize {
+    NSMutableData *data = [NSMutableData dataWithLength:AWSChunkedEncodingBenchmarkLength];
+    memset([data mutableBytes], 'd', [data length]);
+    uint8_t *buffer = malloc(64 * 1024);
+
+    [self measureBlock:^{
+        AWSS3ChunkedEncodingInputStream *stream = [self chunkedStreamWithData:data chunkSize:chunkSize];
+        NSDate *start = [NSDate date];
+        [stream open];
+        while ([stream read:buffer maxLength:64 * 1024] > 0);
+        [stream close];
+        NSTimeInterval elapsed = -[start timeIntervalSinceNow];
+        NSLog(@"Chunk size %lu: %.1f MB/s", (unsigned long)chunkSize, AWSChunkedEncodingBenchmarkLength / elapsed / (1024 * 1024));
+    }];
+
+    free(buffer);
+}
+
+- (void)testPerformanceDefaultChunkSize {
+    [self measureThroughputWithChunkSize:0];
+}
+
+- (void)testPerformance64KiBChunks {
+    [self measureThroughputWithChunkSize:64 * 1024];
+}
+
+- (void)testPerformance1MiBChunks {
+    [self measureThroughputWithChunkSize:1024 * 1024];
+}
+
+- (void)testPerformance8MiBChunks {
+    [self measureThroughputWithChunkSize:8 * 1024 * 1024];
+}
+
+- (void)testPerformanceUnsignedChunksWithChecksum {
+    NSMutableData *data = [NSMutableData dataWithLength:AWSChunkedEncodingBenchmarkLength];
+    memset([data mutableBytes], 'd', [data length]);
+    uint8_t *buffer = malloc(64 * 1024);
+
+    [self measureBlock:^{
+        AWSS3ChunkedEncodingInputStream *stream = [[AWSS3ChunkedEncodingInputStream alloc] initWithUnsignedInputStream:[NSInputStream inputStreamWithData:data]
+                                                                                                              chunkSize:1024 * 1024];
+        NSDate *start = [NSDate date];
+        [stream open];
+        while ([stream read:buffer maxLength:64 * 1024] > 0);
+        [stream close];
+        NSTimeInterval elapsed = -[start timeIntervalSinceNow];
+        NSLog(@"Unsigned with CRC32C trailer: %.1f MB/s", AWSChunkedEncodingBenchmarkLength / elapsed / (1024 * 1024));
+    }];
+
+    free(buffer);
+}
+
+@end
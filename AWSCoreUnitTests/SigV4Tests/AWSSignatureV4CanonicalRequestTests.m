@@ -0,0 +1,163 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSSignature.h"
+
+static NSUInteger const AWSCanonicalRequestBenchmarkIterations = 10000;
+
+@interface AWSSignatureV4CanonicalRequestTests : XCTestCase
+
+@end
+
+@implementation AWSSignatureV4CanonicalRequestTests
+
+// A header-heavy S3 PUT, similar to a multipart upload with user metadata and SSE settings.
+- (NSDictionary<NSString *, NSString *> *)s3PutObjectHeaders {
+    NSMutableDictionary *headers = [@{@"Host": @"examplebucket.s3.amazonaws.com",
+                                      @"Content-Type": @"binary/octet-stream",
+                                      @"Content-Length": @"5242880",
+                                      @"Content-MD5": @"1B2M2Y8AsgTpgAmY7PhCfg==",
+                                      @"User-Agent": @"aws-sdk-iOS/2.40.1 iOS/17.0 en_US transfer-utility",
+                                      @"X-Amz-Date": @"20130524T000000Z",
+                                      @"x-amz-content-sha256": @"44ce7dd67c959e0d3524ffac1771dfbba87d2b6b4b4e99e42034a8b803f8b072",
+                                      @"x-amz-security-token": @"AQoDYXdzEJr...<remainder of security token>",
+                                      @"x-amz-storage-class": @"REDUCED_REDUNDANCY",
+                                      @"x-amz-server-side-encryption": @"aws:kms",
+                                      @"x-amz-server-side-encryption-aws-kms-key-id": @"arn:aws:kms:us-east-1:123456789012:key/abcd",
+                                      @"x-amz-acl": @"bucket-owner-full-control",
+                                      @"Cache-Control": @"max-age=3600,  must-revalidate",
+                                      @"Content-Disposition": @"attachment; filename=\"photo.jpg\""} mutableCopy];
+    for (NSUInteger i = 0; i < 16; i++) {
+        headers[[NSString stringWithFormat:@"x-amz-meta-Attribute%lu", (unsigned long)i]] = [NSString stringWithFormat:@"  value   %lu\twith  whitespace  ", (unsigned long)i];
+    }
+    return headers;
+}
+
+- (NSString *)legacyHashForMethod:(NSString *)method
+                             path:(NSString *)path
+                            query:(NSString *)query
+                          headers:(NSDictionary *)headers
+                    contentSha256:(NSString *)contentSha256 {
+    NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:method
+                                                                          path:path
+                                                                         query:query
+                                                                       headers:headers
+                                                                 contentSha256:contentSha256];
+    return [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]];
+}
+
+- (void)assertHashMatchesLegacyForMethod:(NSString *)method
+                                    path:(NSString *)path
+                                   query:(NSString *)query
+                                 headers:(NSDictionary *)headers
+                           contentSha256:(NSString *)contentSha256 {
+    NSString *expected = [self legacyHashForMethod:method path:path query:query headers:headers contentSha256:contentSha256];
+    NSString *actual = [AWSSignatureV4Signer getCanonicalizedRequestHash:method
+                                                                    path:path
+                                                                   query:query
+                                                                 headers:headers
+                                                           contentSha256:contentSha256];
+    XCTAssertEqualObjects(expected, actual);
+}
+
+- (void)testHashMatchesReferenceValue {
+    // https://docs.aws.amazon.com/general/latest/gr/sigv4-create-canonical-request.html
+    NSDictionary *headers = @{@"Content-Type": @"application/x-www-form-urlencoded; charset=utf-8",
+                              @"Host": @"iam.amazonaws.com",
+                              @"X-Amz-Date": @"20150830T123600Z"};
+    NSString *hash = [AWSSignatureV4Signer getCanonicalizedRequestHash:@"GET"
+                                                                  path:@"/"
+                                                                 query:@"Action=ListUsers&Version=2010-05-08"
+                                                               headers:headers
+                                                         contentSha256:@"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"];
+    XCTAssertEqualObjects(@"f536975d06c0309214f805bb90ccff089219ecd68b2577efef23edd43b7e1a59", hash);
+}
+
+- (void)testHashMatchesLegacyBuilder {
+    [self assertHashMatchesLegacyForMethod:@"PUT"
+                                      path:@"/examplebucket/photos/2013/05/photo%20one.jpg"
+                                     query:@""
+                                   headers:[self s3PutObjectHeaders]
+                             contentSha256:@"UNSIGNED-PAYLOAD"];
+
+    // Sorting, repeated names, names without values and malformed parameters
+    [self assertHashMatchesLegacyForMethod:@"GET"
+                                      path:@"/"
+                                     query:@"Z=5&z=6&a=1&A=2&b=3&B=4&b=1&flag&&=orphan&x=1=2"
+                                   headers:@{@"Host": @"example.amazonaws.com"}
+                             contentSha256:@"UNSIGNED-PAYLOAD"];
+
+    // Whitespace collapsing, including non-ASCII space separators
+    [self assertHashMatchesLegacyForMethod:@"POST"
+                                      path:@"/"
+                                     query:nil
+                                   headers:@{@"Host": @"example.amazonaws.com",
+                                             @"My-Header1": @"    a   b   c  ",
+                                             @"My-Header2": @"\"a  b　c\"",
+                                             @"My-Header3": @"",
+                                             @"my_header4": @"\tvalue\t"}
+                             contentSha256:@"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"];
+
+    // More headers than fit in the inline scratch space
+    NSMutableDictionary *manyHeaders = [NSMutableDictionary new];
+    NSMutableArray *queryItems = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 100; i++) {
+        manyHeaders[[NSString stringWithFormat:@"X-Amz-Meta-%03lu", (unsigned long)(100 - i)]] = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+        [queryItems addObject:[NSString stringWithFormat:@"p%lu=%lu", (unsigned long)(i % 7), (unsigned long)i]];
+    }
+    [self assertHashMatchesLegacyForMethod:@"GET"
+                                      path:@"/"
+                                     query:[queryItems componentsJoinedByString:@"&"]
+                                   headers:manyHeaders
+                             contentSha256:@"UNSIGNED-PAYLOAD"];
+
+    [self assertHashMatchesLegacyForMethod:@"GET" path:@"/" query:nil headers:nil contentSha256:@""];
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceLegacyCanonicalRequestForS3PutObject {
+    NSDictionary *headers = [self s3PutObjectHeaders];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSCanonicalRequestBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [self legacyHashForMethod:@"PUT"
+                                     path:@"/examplebucket/photos/2013/05/photo.jpg"
+                                    query:@"partNumber=1&uploadId=VXBsb2FkIElEIGZvciA2aWWpbmcncyBteS1tb3ZpZS5tMnRzIHVwbG9hZA"
+                                  headers:headers
+                            contentSha256:@"UNSIGNED-PAYLOAD"];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceStreamingCanonicalRequestForS3PutObject {
+    NSDictionary *headers = [self s3PutObjectHeaders];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSCanonicalRequestBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [AWSSignatureV4Signer getCanonicalizedRequestHash:@"PUT"
+                                                             path:@"/examplebucket/photos/2013/05/photo.jpg"
+                                                            query:@"partNumber=1&uploadId=VXBsb2FkIElEIGZvciA2aWWpbmcncyBteS1tb3ZpZS5tMnRzIHVwbG9hZA"
+                                                          headers:headers
+                                                    contentSha256:@"UNSIGNED-PAYLOAD"];
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,117 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSSignature.h"
+
+static NSString *const AWSTestSecretKey = @"wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+
+@interface AWSSignatureV4SigningKeyCacheTests : XCTestCase
+
+@end
+
+@implementation AWSSignatureV4SigningKeyCacheTests
+
+- (NSString *)hexStringFromData:(NSData *)data {
+    NSMutableString *hexString = [NSMutableString new];
+    const unsigned char *bytes = [data bytes];
+    for (NSUInteger i = 0; i < [data length]; i++) {
+        [hexString appendFormat:@"%02x", bytes[i]];
+    }
+    return hexString;
+}
+
+- (void)testDerivedKeyMatchesReferenceValue {
+    // https://docs.aws.amazon.com/general/latest/gr/signature-v4-examples.html
+    AWSSignatureV4SigningKeyCache *cache = [AWSSignatureV4SigningKeyCache new];
+    NSData *signingKey = [cache signingKeyForSecretKey:AWSTestSecretKey
+                                             dateStamp:@"20120215"
+                                            regionName:@"us-east-1"
+                                           serviceName:@"iam"];
+
+    XCTAssertEqualObjects(@"f4780e2d9f65fa895f9c67b32ce1baf0b0d8a43505a000a1a9e090d414db404d", [self hexStringFromData:signingKey]);
+}
+
+- (void)testHitAndMissCounters {
+    AWSSignatureV4SigningKeyCache *cache = [AWSSignatureV4SigningKeyCache new];
+
+    NSData *first = [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+    NSData *second = [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+    NSData *otherService = [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"s3"];
+    NSData *otherSecret = [cache signingKeyForSecretKey:@"anotherSecret" dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+
+    XCTAssertEqualObjects(first, second);
+    XCTAssertNotEqualObjects(first, otherService);
+    XCTAssertNotEqualObjects(first, otherSecret);
+    XCTAssertEqual(1, cache.hitCount);
+    XCTAssertEqual(3, cache.missCount);
+    XCTAssertEqual(3, cache.count);
+
+    [cache resetStatistics];
+    XCTAssertEqual(0, cache.hitCount);
+    XCTAssertEqual(0, cache.missCount);
+
+    [cache removeAllSigningKeys];
+    XCTAssertEqual(0, cache.count);
+}
+
+- (void)testCountLimitEvictsOldestEntries {
+    AWSSignatureV4SigningKeyCache *cache = [AWSSignatureV4SigningKeyCache new];
+    cache.countLimit = 2;
+
+    [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+    [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120216" regionName:@"us-east-1" serviceName:@"iam"];
+    [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120217" regionName:@"us-east-1" serviceName:@"iam"];
+    XCTAssertEqual(2, cache.count);
+
+    // The oldest entry has been evicted, so it has to be derived again.
+    [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+    XCTAssertEqual(0, cache.hitCount);
+    XCTAssertEqual(4, cache.missCount);
+
+    cache.countLimit = 0;
+    XCTAssertEqual(0, cache.count);
+    [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+    XCTAssertEqual(0, cache.count);
+}
+
+- (void)testConcurrentLookups {
+    AWSSignatureV4SigningKeyCache *cache = [AWSSignatureV4SigningKeyCache new];
+    NSData *expected = [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+    [cache resetStatistics];
+
+    size_t count = 1000;
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    dispatch_apply(count, queue, ^(size_t index) {
+        NSData *signingKey = [cache signingKeyForSecretKey:AWSTestSecretKey dateStamp:@"20120215" regionName:@"us-east-1" serviceName:@"iam"];
+        XCTAssertEqualObjects(expected, signingKey);
+    });
+
+    XCTAssertEqual(count, cache.hitCount);
+    XCTAssertEqual(0, cache.missCount);
+}
+
+- (void)testSignerUsesSharedCache {
+    AWSSignatureV4SigningKeyCache *sharedCache = [AWSSignatureV4SigningKeyCache sharedCache];
+    NSData *signingKey = [AWSSignatureV4Signer getV4DerivedKey:AWSTestSecretKey date:@"20120215" region:@"us-east-1" service:@"iam"];
+    uint64_t hitCount = sharedCache.hitCount;
+
+    NSData *cachedSigningKey = [AWSSignatureV4Signer getV4DerivedKey:AWSTestSecretKey date:@"20120215" region:@"us-east-1" service:@"iam"];
+    XCTAssertEqualObjects(signingKey, cachedSigningKey);
+    XCTAssertGreaterThan(sharedCache.hitCount, hitCount);
+}
+
+@end
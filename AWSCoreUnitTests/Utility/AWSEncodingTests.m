@@ -0,0 +1,189 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSCategory.h"
+#import "AWSSignature.h"
+
+static NSUInteger const AWSEncodingDigestBenchmarkIterations = 100000;
+static NSUInteger const AWSEncodingBlobBenchmarkLength = 4 * 1024 * 1024;
+
+@interface AWSEncodingTests : XCTestCase
+
+@end
+
+@implementation AWSEncodingTests
+
+- (NSData *)randomDataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    arc4random_buf([data mutableBytes], length);
+    return data;
+}
+
+// The reference implementation hexEncode: used before it took the byte kernel.
+- (NSString *)formattedHexStringFromData:(NSData *)data {
+    const uint8_t *bytes = [data bytes];
+    NSMutableString *hexString = [NSMutableString new];
+    for (NSUInteger i = 0; i < [data length]; i++) {
+        [hexString appendFormat:@"%02x", bytes[i]];
+    }
+    return hexString;
+}
+
+- (void)testHexMatchesReference {
+    // Cover every tail length around the 16 byte vector width.
+    for (NSUInteger length = 0; length < 100; length++) {
+        NSData *data = [self randomDataWithLength:length];
+        NSString *hex = [data aws_hexEncodedString];
+        XCTAssertEqualObjects([self formattedHexStringFromData:data], hex);
+        XCTAssertEqualObjects(data, [NSData aws_dataWithHexEncodedString:hex]);
+        XCTAssertEqualObjects(data, [NSData aws_dataWithHexEncodedString:[hex uppercaseString]]);
+    }
+
+    NSData *large = [self randomDataWithLength:100000];
+    XCTAssertEqualObjects([self formattedHexStringFromData:large], [large aws_hexEncodedString]);
+}
+
+- (void)testHexDecodeRejectsInvalidInput {
+    XCTAssertNil([NSData aws_dataWithHexEncodedString:@"abc"]);
+    XCTAssertNil([NSData aws_dataWithHexEncodedString:@"0g"]);
+    XCTAssertNil([NSData aws_dataWithHexEncodedString:@"00 0"]);
+    XCTAssertNil([NSData aws_dataWithHexEncodedString:@"é0"]);
+    XCTAssertEqualObjects([NSData data], [NSData aws_dataWithHexEncodedString:@""]);
+}
+
+- (void)testLegacyHexEncodeIsUnchanged {
+    NSData *digest = [AWSSignatureSignerUtility hashData:[@"" dataUsingEncoding:NSUTF8StringEncoding]];
+    NSString *digestString = [[NSString alloc] initWithData:digest encoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects(@"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                          [AWSSignatureSignerUtility hexEncode:digestString]);
+    XCTAssertEqualObjects(@"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+                          [digest aws_hexEncodedString]);
+
+    // Characters wider than a byte keep their variable width formatting.
+    XCTAssertEqualObjects(@"0a4120ac", [AWSSignatureSignerUtility hexEncode:@"\nA€"]);
+    XCTAssertEqualObjects(@"", [AWSSignatureSignerUtility hexEncode:@""]);
+}
+
+- (void)testBase64MatchesFoundation {
+    for (NSUInteger length = 0; length < 200; length++) {
+        NSData *data = [self randomDataWithLength:length];
+        NSString *base64 = [data aws_base64EncodedString];
+        XCTAssertEqualObjects([data base64EncodedStringWithOptions:0], base64);
+        XCTAssertEqualObjects(data, [NSData aws_dataWithBase64EncodedString:base64]);
+    }
+
+    NSData *large = [self randomDataWithLength:1000003];
+    NSString *base64 = [large aws_base64EncodedString];
+    XCTAssertEqualObjects([large base64EncodedStringWithOptions:0], base64);
+    XCTAssertEqualObjects(large, [NSData aws_dataWithBase64EncodedString:base64]);
+}
+
+- (void)testBase64ReferenceValues {
+    // https://tools.ietf.org/html/rfc4648#section-10
+    NSDictionary<NSString *, NSString *> *vectors = @{@"": @"",
+                                                      @"f": @"Zg==",
+                                                      @"fo": @"Zm8=",
+                                                      @"foo": @"Zm9v",
+                                                      @"foob": @"Zm9vYg==",
+                                                      @"fooba": @"Zm9vYmE=",
+                                                      @"foobar": @"Zm9vYmFy"};
+    [vectors enumerateKeysAndObjectsUsingBlock:^(NSString *plain, NSString *encoded, BOOL *stop) {
+        NSData *data = [plain dataUsingEncoding:NSUTF8StringEncoding];
+        XCTAssertEqualObjects(encoded, [data aws_base64EncodedString]);
+        XCTAssertEqualObjects(data, [NSData aws_dataWithBase64EncodedString:encoded]);
+    }];
+
+    XCTAssertEqualObjects([@"fo" dataUsingEncoding:NSUTF8StringEncoding], [NSData aws_dataWithBase64EncodedString:@"Zm8"]);
+    XCTAssertEqualObjects(@"1B2M2Y8AsgTpgAmY7PhCfg==", [NSString aws_base64md5FromData:[NSData data]]);
+}
+
+- (void)testBase64DecodeRejectsInvalidInput {
+    XCTAssertNil([NSData aws_dataWithBase64EncodedString:@"Z"]);
+    XCTAssertNil([NSData aws_dataWithBase64EncodedString:@"Zm9v\nYmFy"]);
+    XCTAssertNil([NSData aws_dataWithBase64EncodedString:@"Zm=v"]);
+    XCTAssertNil([NSData aws_dataWithBase64EncodedString:@"Zg==="]);
+    XCTAssertNil([NSData aws_dataWithBase64EncodedString:@"Zm9v-mFy"]);
+
+    // Invalid characters inside a vector-sized block.
+    NSMutableString *base64 = [[[self randomDataWithLength:300] aws_base64EncodedString] mutableCopy];
+    [base64 replaceCharactersInRange:NSMakeRange(100, 1) withString:@"*"];
+    XCTAssertNil([NSData aws_dataWithBase64EncodedString:base64]);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceLegacyHexEncodeDigest {
+    NSData *digest = [self randomDataWithLength:32];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSEncodingDigestBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [self formattedHexStringFromData:digest];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceHexEncodeDigest {
+    NSData *digest = [self randomDataWithLength:32];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSEncodingDigestBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [digest aws_hexEncodedString];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceFoundationBase64EncodeDigest {
+    NSData *digest = [self randomDataWithLength:16];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSEncodingDigestBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [digest base64EncodedStringWithOptions:0];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceBase64EncodeDigest {
+    NSData *digest = [self randomDataWithLength:16];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < AWSEncodingDigestBenchmarkIterations; i++) {
+            @autoreleasepool {
+                [digest aws_base64EncodedString];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceFoundationBase64Blob {
+    NSData *blob = [self randomDataWithLength:AWSEncodingBlobBenchmarkLength];
+    [self measureBlock:^{
+        NSString *base64 = [blob base64EncodedStringWithOptions:0];
+        [[NSData alloc] initWithBase64EncodedString:base64 options:0];
+    }];
+}
+
+- (void)testPerformanceBase64Blob {
+    NSData *blob = [self randomDataWithLength:AWSEncodingBlobBenchmarkLength];
+    [self measureBlock:^{
+        NSString *base64 = [blob aws_base64EncodedString];
+        [NSData aws_dataWithBase64EncodedString:base64];
+    }];
+}
+
+@end
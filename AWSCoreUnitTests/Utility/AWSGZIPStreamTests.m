@@ -0,0 +1,276 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <CommonCrypto/CommonDigest.h>
+
+#import "AWSGZIP.h"
+#import "AWSGZIPStream.h"
+#import "AWSSignature.h"
+#import "AWSURLRequestSerialization.h"
+
+static NSUInteger const AWSGZIPBenchmarkRecordCount = 500;
+static NSUInteger const AWSGZIPBenchmarkRecordLength = 16 * 1024;
+
+@interface AWSGZIPStreamTests : XCTestCase
+
+@end
+
+@implementation AWSGZIPStreamTests
+
+// Text-like data: compressible, but not trivially.
+- (NSData *)sampleDataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithLength:length];
+    uint8_t *bytes = [data mutableBytes];
+    static const char words[] = "records shard partition sequence metric namespace dimension timestamp ";
+    for (NSUInteger i = 0; i < length; i++) {
+        bytes[i] = arc4random_uniform(8) == 0 ? (uint8_t)arc4random_uniform(256) : (uint8_t)words[i % (sizeof(words) - 1)];
+    }
+    return data;
+}
+
+// A Kinesis PutRecords body of base64 encoded records.
+- (NSData *)putRecordsBody {
+    NSMutableArray *records = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSGZIPBenchmarkRecordCount; i++) {
+        [records addObject:@{@"Data": [[self sampleDataWithLength:AWSGZIPBenchmarkRecordLength] base64EncodedStringWithOptions:0],
+                             @"PartitionKey": [NSString stringWithFormat:@"partition-%lu", (unsigned long)(i % 16)]}];
+    }
+    return [NSJSONSerialization dataWithJSONObject:@{@"Records": records, @"StreamName": @"benchmark-stream"} options:0 error:nil];
+}
+
+- (NSData *)readStream:(NSInputStream *)stream {
+    NSMutableData *data = [NSMutableData new];
+    uint8_t buffer[70000];
+    [stream open];
+    NSInteger bytesRead = 0;
+    while ((bytesRead = [stream read:buffer maxLength:1 + arc4random_uniform(sizeof(buffer))]) > 0) {
+        [data appendBytes:buffer length:bytesRead];
+    }
+    XCTAssertEqual(0, bytesRead);
+    [stream close];
+    return data;
+}
+
+// The deflate data of a gzip member written by zlib, which has a 10 byte header and an 8 byte trailer.
+- (NSData *)rawDeflateData:(NSData *)data {
+    NSData *compressed = [data awsgzip_gzippedData];
+    return [compressed subdataWithRange:NSMakeRange(10, [compressed length] - 18)];
+}
+
+- (NSData *)zlibData:(NSData *)data {
+    uint32_t a = 1, b = 0;
+    const uint8_t *bytes = [data bytes];
+    for (NSUInteger i = 0; i < [data length]; i++) {
+        a = (a + bytes[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    uint32_t adler = CFSwapInt32HostToBig((b << 16) | a);
+
+    NSMutableData *zlibData = [NSMutableData dataWithBytes:"\x78\x9c" length:2];
+    [zlibData appendData:[self rawDeflateData:data]];
+    [zlibData appendBytes:&adler length:sizeof(adler)];
+    return zlibData;
+}
+
+- (NSData *)inflateData:(NSData *)data bufferSize:(NSUInteger)bufferSize error:(NSError **)error {
+    NSMutableData *output = [NSMutableData new];
+    AWSGZIPInflater *inflater = [[AWSGZIPInflater alloc] initWithBufferSize:bufferSize outputHandler:^(const void *bytes, NSUInteger length) {
+        [output appendBytes:bytes length:length];
+    }];
+    // Feed the data in pieces of varying size, including single bytes.
+    NSUInteger location = 0;
+    while (location < [data length]) {
+        NSUInteger length = MIN([data length] - location, (NSUInteger)(arc4random_uniform(2) ? 1 + arc4random_uniform(3) : 1 + arc4random_uniform(40000)));
+        if (![inflater appendData:[data subdataWithRange:NSMakeRange(location, length)] error:error]) {
+            return nil;
+        }
+        location += length;
+    }
+    if (![inflater finishWithError:error]) {
+        return nil;
+    }
+    XCTAssertEqual([output length], inflater.totalBytesInflated);
+    return output;
+}
+
+- (void)testInputStreamMatchesInMemoryCompression {
+    for (NSNumber *length in @[@0, @1, @100, @16384, @16385, @1000000]) {
+        NSData *data = [self sampleDataWithLength:[length unsignedIntegerValue]];
+        for (NSNumber *level in @[@(-1.0f), @0.0f, @0.5f, @1.0f]) {
+            AWSGZIPInputStream *stream = [[AWSGZIPInputStream alloc] initWithData:data compressionLevel:[level floatValue]];
+            NSData *compressed = [self readStream:stream];
+            XCTAssertEqual([compressed length], stream.totalBytesRead);
+            if ([data length] > 0) {
+                XCTAssertEqualObjects([data awsgzip_gzippedDataWithCompressionLevel:[level floatValue]], compressed);
+            }
+            NSError *error = nil;
+            XCTAssertEqualObjects(data, [self inflateData:compressed bufferSize:4096 error:&error]);
+            XCTAssertNil(error);
+        }
+    }
+}
+
+- (void)testInflaterDecodesDeflateFormats {
+    NSData *data = [self sampleDataWithLength:300000];
+    NSError *error = nil;
+
+    XCTAssertEqualObjects(data, [self inflateData:[data awsgzip_gzippedData] bufferSize:1024 error:&error]);
+    XCTAssertEqualObjects(data, [self inflateData:[self zlibData:data] bufferSize:1024 error:&error]);
+    XCTAssertEqualObjects(data, [self inflateData:[self rawDeflateData:data] bufferSize:1024 error:&error]);
+    XCTAssertNil(error);
+
+    // Concatenated gzip members
+    NSMutableData *members = [[data awsgzip_gzippedData] mutableCopy];
+    [members appendData:[data awsgzip_gzippedData]];
+    NSMutableData *expected = [data mutableCopy];
+    [expected appendData:data];
+    XCTAssertEqualObjects(expected, [self inflateData:members bufferSize:[data length] * 2 error:&error]);
+    XCTAssertNil(error);
+
+    XCTAssertEqualObjects([NSData data], [self inflateData:[NSData data] bufferSize:1024 error:&error]);
+    XCTAssertNil(error);
+}
+
+- (void)testInflaterReportsInvalidData {
+    NSData *compressed = [[self sampleDataWithLength:100000] awsgzip_gzippedData];
+    NSError *error = nil;
+
+    XCTAssertNil([self inflateData:[compressed subdataWithRange:NSMakeRange(0, [compressed length] - 3)] bufferSize:1024 error:&error]);
+    XCTAssertEqualObjects(AWSGZIPErrorDomain, error.domain);
+    XCTAssertEqual(AWSGZIPErrorTruncatedData, error.code);
+
+    NSMutableData *corrupted = [compressed mutableCopy];
+    memset((uint8_t *)[corrupted mutableBytes] + 100, 0xff, 64);
+    error = nil;
+    XCTAssertNil([self inflateData:corrupted bufferSize:1024 error:&error]);
+    XCTAssertEqual(AWSGZIPErrorInvalidData, error.code);
+}
+
+- (void)testGunzippedData {
+    for (NSNumber *length in @[@1, @100, @100000, @3000000]) {
+        NSData *data = [self sampleDataWithLength:[length unsignedIntegerValue]];
+        XCTAssertEqualObjects(data, [[data awsgzip_gzippedData] awsgzip_gunzippedData]);
+    }
+
+    // Close to the largest deflate ratio, where the length in the trailer may not be trusted.
+    NSData *zeros = [NSMutableData dataWithLength:5000000];
+    XCTAssertEqualObjects(zeros, [[zeros awsgzip_gzippedData] awsgzip_gunzippedData]);
+}
+
+- (void)testJSONSerializerStreamsLargeBodies {
+    NSDictionary *parameters = @{@"Data": [[self sampleDataWithLength:1024 * 1024] base64EncodedStringWithOptions:0]};
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://kinesis.us-east-1.amazonaws.com"]];
+    request.HTTPMethod = @"POST";
+    AWSTask *task = [[AWSJSONRequestSerializer new] serializeRequest:request
+                                                             headers:@{@"Content-Encoding": @"gzip"}
+                                                          parameters:parameters];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    XCTAssertNil(request.HTTPBody);
+    XCTAssertTrue([request.HTTPBodyStream isKindOfClass:[AWSGZIPInputStream class]]);
+    NSData *payloadHash = [AWSSignatureSignerUtility payloadHashOfRequest:request];
+
+    NSData *compressed = [self readStream:request.HTTPBodyStream];
+    XCTAssertEqualObjects([NSString stringWithFormat:@"%lu", (unsigned long)[compressed length]], [request valueForHTTPHeaderField:@"Content-Length"]);
+    XCTAssertEqualObjects([AWSSignatureSignerUtility hashData:compressed], payloadHash);
+    XCTAssertEqualObjects(parameters, [NSJSONSerialization JSONObjectWithData:[compressed awsgzip_gunzippedData] options:0 error:nil]);
+
+    // Small bodies are still compressed in memory.
+    NSMutableURLRequest *smallRequest = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://kinesis.us-east-1.amazonaws.com"]];
+    smallRequest.HTTPMethod = @"POST";
+    [[[AWSJSONRequestSerializer new] serializeRequest:smallRequest
+                                              headers:@{@"Content-Encoding": @"gzip"}
+                                           parameters:@{@"Data": @"small"}] waitUntilFinished];
+    XCTAssertNotNil(smallRequest.HTTPBody);
+    XCTAssertNil(smallRequest.HTTPBodyStream);
+}
+
+#pragma mark - Benchmarks
+
+- (void)measureMemoryOfBlock:(void (^)(void))block {
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTMemoryMetric new], [XCTClockMetric new]] block:block];
+    } else {
+        [self measureBlock:block];
+    }
+}
+
+// What the serializer and signer did with a large gzip body: compress it into a second buffer, then hash that buffer.
+- (void)testPerformanceInMemoryGZIPBody {
+    NSData *body = [self putRecordsBody];
+    [self measureMemoryOfBlock:^{
+        @autoreleasepool {
+            NSData *compressed = [body awsgzip_gzippedData];
+            [AWSSignatureSignerUtility hashData:compressed];
+        }
+    }];
+}
+
+// Hashing one compressing stream, then sending another, without holding the compressed body.
+- (void)testPerformanceStreamingGZIPBody {
+    NSData *body = [self putRecordsBody];
+    [self measureMemoryOfBlock:^{
+        @autoreleasepool {
+            uint8_t buffer[16384];
+            CC_SHA256_CTX context;
+            CC_SHA256_Init(&context);
+            AWSGZIPInputStream *digestStream = [[AWSGZIPInputStream alloc] initWithData:body compressionLevel:-1.0f];
+            [digestStream open];
+            NSInteger bytesRead = 0;
+            while ((bytesRead = [digestStream read:buffer maxLength:sizeof(buffer)]) > 0) {
+                CC_SHA256_Update(&context, buffer, (CC_LONG)bytesRead);
+            }
+            [digestStream close];
+            unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+            CC_SHA256_Final(digest, &context);
+
+            AWSGZIPInputStream *bodyStream = [[AWSGZIPInputStream alloc] initWithData:body compressionLevel:-1.0f];
+            [bodyStream open];
+            while ([bodyStream read:buffer maxLength:sizeof(buffer)] > 0) {
+            }
+            [bodyStream close];
+        }
+    }];
+}
+
+- (void)testPerformanceGunzippedData {
+    NSData *compressed = [[self putRecordsBody] awsgzip_gzippedData];
+    [self measureMemoryOfBlock:^{
+        @autoreleasepool {
+            [compressed awsgzip_gunzippedData];
+        }
+    }];
+}
+
+- (void)testPerformanceStreamingInflater {
+    NSData *compressed = [[self putRecordsBody] awsgzip_gzippedData];
+    [self measureMemoryOfBlock:^{
+        @autoreleasepool {
+            __block uint8_t checksum = 0;
+            AWSGZIPInflater *inflater = [[AWSGZIPInflater alloc] initWithOutputHandler:^(const void *bytes, NSUInteger length) {
+                checksum ^= ((const uint8_t *)bytes)[length - 1];
+            }];
+            for (NSUInteger location = 0; location < [compressed length]; location += 65536) {
+                NSData *chunk = [compressed subdataWithRange:NSMakeRange(location, MIN((NSUInteger)65536, [compressed length] - location))];
+                [inflater appendData:chunk error:nil];
+            }
+            XCTAssertTrue([inflater finishWithError:nil]);
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,251 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+#import <XCTest/XCTest.h>
+
+#import "AWSMantle.h"
+#import "AWSModel.h"
+#import "AWSMTLClassDescriptor.h"
+#import "AWSMTLReflection.h"
+
+static NSUInteger const AWSModelBenchmarkCount = 100000;
+
+typedef NS_ENUM(NSInteger, AWSModelTestStatus) {
+    AWSModelTestStatusUnknown,
+    AWSModelTestStatusActive,
+    AWSModelTestStatusDeleted,
+};
+
+@interface AWSModelTestItem : AWSModel
+
+@property (nonatomic, strong) NSString *name;
+@property (nonatomic, strong) NSNumber *size;
+@property (nonatomic, assign) AWSModelTestStatus status;
+@property (nonatomic, strong) NSDate *lastModified;
+@property (nonatomic, strong) NSString *owner;
+
+@end
+
+@implementation AWSModelTestItem
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{
+             @"name" : @"Name",
+             @"size" : @"Size",
+             @"status" : @"Status",
+             @"lastModified" : @"LastModified",
+             @"owner" : @"Owner.DisplayName",
+             };
+}
+
++ (NSValueTransformer *)statusJSONTransformer {
+    return [AWSMTLValueTransformer reversibleTransformerWithForwardBlock:^NSNumber *(NSString *value) {
+        if ([value caseInsensitiveCompare:@"ACTIVE"] == NSOrderedSame) {
+            return @(AWSModelTestStatusActive);
+        }
+        if ([value caseInsensitiveCompare:@"DELETED"] == NSOrderedSame) {
+            return @(AWSModelTestStatusDeleted);
+        }
+        return @(AWSModelTestStatusUnknown);
+    } reverseBlock:^NSString *(NSNumber *value) {
+        switch ([value integerValue]) {
+            case AWSModelTestStatusActive:
+                return @"ACTIVE";
+            case AWSModelTestStatusDeleted:
+                return @"DELETED";
+            default:
+                return nil;
+        }
+    }];
+}
+
++ (NSValueTransformer *)lastModifiedJSONTransformer {
+    return [AWSMTLValueTransformer reversibleTransformerWithForwardBlock:^id(NSNumber *number) {
+        return [NSDate dateWithTimeIntervalSince1970:[number doubleValue]];
+    } reverseBlock:^id(NSDate *date) {
+        return [NSString stringWithFormat:@"%f", [date timeIntervalSince1970]];
+    }];
+}
+
+@end
+
+// A model with a validation method, which is set through -validateValue:forKey:error:.
+@interface AWSModelTestValidatedItem : AWSModel
+
+@property (nonatomic, strong) NSString *name;
+
+@end
+
+@implementation AWSModelTestValidatedItem
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    return @{@"name" : @"Name"};
+}
+
+- (BOOL)validateName:(NSString **)name error:(NSError **)error {
+    *name = [*name uppercaseString];
+    return YES;
+}
+
+@end
+
+@interface AWSModelTests : XCTestCase
+
+@end
+
+@implementation AWSModelTests
+
+- (NSDictionary *)JSONDictionaryForItem:(NSUInteger)index {
+    return @{@"Name" : [NSString stringWithFormat:@"photos/2013/%lu.jpg", (unsigned long)index],
+             @"Size" : @(index * 1024),
+             @"Status" : index % 2 ? @"ACTIVE" : @"DELETED",
+             @"LastModified" : @(1369353600 + index),
+             @"Owner" : @{@"DisplayName" : @"mtd@amazon.com"}};
+}
+
+// How AWSMTLJSONAdapter decoded a model before it cached the class descriptor: the key paths, transformers and
+// accessors are looked up again for every model.
+- (id)legacyModelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary *)JSONDictionary {
+    NSDictionary *JSONKeyPathsByPropertyKey = [[modelClass JSONKeyPathsByPropertyKey] copy];
+    NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+
+    for (NSString *propertyKey in [modelClass propertyKeys]) {
+        NSString *JSONKeyPath = JSONKeyPathsByPropertyKey[propertyKey] ?: propertyKey;
+        id value = [JSONDictionary valueForKeyPath:JSONKeyPath];
+        if (value == nil) continue;
+
+        NSValueTransformer *transformer = nil;
+        SEL selector = AWSMTLSelectorWithKeyPattern(propertyKey, "JSONTransformer");
+        if ([modelClass respondsToSelector:selector]) {
+            NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[modelClass methodSignatureForSelector:selector]];
+            invocation.target = modelClass;
+            invocation.selector = selector;
+            [invocation invoke];
+
+            __unsafe_unretained id result = nil;
+            [invocation getReturnValue:&result];
+            transformer = result;
+        }
+        if (transformer != nil) {
+            if ([value isEqual:NSNull.null]) value = nil;
+            value = [transformer transformedValue:value] ?: NSNull.null;
+        }
+        dictionaryValue[propertyKey] = value;
+    }
+
+    id model = [modelClass new];
+    for (NSString *key in dictionaryValue) {
+        __autoreleasing id value = dictionaryValue[key];
+        if ([value isEqual:NSNull.null]) value = nil;
+        if ([model validateValue:&value forKey:key error:NULL]) {
+            [model setValue:value forKey:key];
+        }
+    }
+    return model;
+}
+
+- (void)testDecodingMatchesLegacyAdapter {
+    for (NSUInteger i = 0; i < 10; i++) {
+        NSDictionary *JSONDictionary = [self JSONDictionaryForItem:i];
+        NSError *error = nil;
+        AWSModelTestItem *item = [AWSMTLJSONAdapter modelOfClass:[AWSModelTestItem class]
+                                              fromJSONDictionary:JSONDictionary
+                                                           error:&error];
+        XCTAssertNil(error);
+        XCTAssertEqualObjects([self legacyModelOfClass:[AWSModelTestItem class] fromJSONDictionary:JSONDictionary], item);
+        XCTAssertEqual(i % 2 ? AWSModelTestStatusActive : AWSModelTestStatusDeleted, item.status);
+        XCTAssertEqualObjects(@"mtd@amazon.com", item.owner);
+    }
+}
+
+- (void)testJSONRoundTrip {
+    AWSModelTestItem *item = [AWSMTLJSONAdapter modelOfClass:[AWSModelTestItem class]
+                                          fromJSONDictionary:[self JSONDictionaryForItem:3]
+                                                       error:nil];
+    NSDictionary *JSONDictionary = [AWSMTLJSONAdapter JSONDictionaryFromModel:item];
+    XCTAssertEqualObjects(@"photos/2013/3.jpg", JSONDictionary[@"Name"]);
+    XCTAssertEqualObjects(@"ACTIVE", JSONDictionary[@"Status"]);
+    XCTAssertEqualObjects(@"mtd@amazon.com", JSONDictionary[@"Owner"][@"DisplayName"]);
+
+    AWSModelTestItem *decoded = [AWSMTLJSONAdapter modelOfClass:[AWSModelTestItem class]
+                                             fromJSONDictionary:JSONDictionary
+                                                          error:nil];
+    XCTAssertEqualObjects(item, decoded);
+    XCTAssertEqual(item.hash, decoded.hash);
+}
+
+- (void)testDictionaryValueOmitsNilProperties {
+    AWSModelTestItem *item = [AWSModelTestItem new];
+    item.name = @"photo.jpg";
+    XCTAssertEqualObjects((@{@"name" : @"photo.jpg", @"status" : @(AWSModelTestStatusUnknown)}), item.dictionaryValue);
+
+    NSDictionary *JSONDictionary = [AWSMTLJSONAdapter JSONDictionaryFromModel:item];
+    XCTAssertEqualObjects(@"photo.jpg", JSONDictionary[@"Name"]);
+    XCTAssertNil(JSONDictionary[@"Size"]);
+    XCTAssertNil(JSONDictionary[@"Owner"]);
+}
+
+- (void)testValidationMethodIsCalled {
+    XCTAssertTrue([AWSMTLClassDescriptor descriptorForClass:[AWSModelTestValidatedItem class]].propertiesByKey[@"name"].validates);
+    XCTAssertFalse([AWSMTLClassDescriptor descriptorForClass:[AWSModelTestItem class]].propertiesByKey[@"name"].validates);
+
+    AWSModelTestValidatedItem *item = [AWSMTLJSONAdapter modelOfClass:[AWSModelTestValidatedItem class]
+                                                   fromJSONDictionary:@{@"Name" : @"photo.jpg"}
+                                                                error:nil];
+    XCTAssertEqualObjects(@"PHOTO.JPG", item.name);
+}
+
+- (void)testDescriptorIsCached {
+    AWSMTLClassDescriptor *descriptor = [AWSMTLClassDescriptor descriptorForClass:[AWSModelTestItem class]];
+    XCTAssertEqual(descriptor, [AWSMTLClassDescriptor descriptorForClass:[AWSModelTestItem class]]);
+    XCTAssertTrue(descriptor.hasValidJSONMapping);
+    XCTAssertEqualObjects(@"Owner.DisplayName", descriptor.propertiesByKey[@"owner"].JSONKeyPath);
+    XCTAssertFalse(descriptor.propertiesByKey[@"owner"].JSONKeyPathIsKey);
+    XCTAssertTrue(descriptor.propertiesByKey[@"name"].JSONKeyPathIsKey);
+    XCTAssertEqual(descriptor.propertiesByKey[@"size"], descriptor.propertiesByJSONKeyPath[@"Size"]);
+}
+
+#pragma mark - Benchmarks
+
+- (NSArray *)benchmarkJSONDictionaries {
+    NSMutableArray *JSONDictionaries = [NSMutableArray arrayWithCapacity:AWSModelBenchmarkCount];
+    for (NSUInteger i = 0; i < AWSModelBenchmarkCount; i++) {
+        [JSONDictionaries addObject:[self JSONDictionaryForItem:i]];
+    }
+    return JSONDictionaries;
+}
+
+- (void)testPerformanceLegacyDecoding {
+    NSArray *JSONDictionaries = [self benchmarkJSONDictionaries];
+    [self measureBlock:^{
+        @autoreleasepool {
+            for (NSDictionary *JSONDictionary in JSONDictionaries) {
+                [self legacyModelOfClass:[AWSModelTestItem class] fromJSONDictionary:JSONDictionary];
+            }
+        }
+    }];
+}
+
+- (void)testPerformanceDescriptorDecoding {
+    NSArray *JSONDictionaries = [self benchmarkJSONDictionaries];
+    [self measureBlock:^{
+        @autoreleasepool {
+            for (NSDictionary *JSONDictionary in JSONDictionaries) {
+                [AWSMTLJSONAdapter modelOfClass:[AWSModelTestItem class] fromJSONDictionary:JSONDictionary error:nil];
+            }
+        }
+    }];
+}
+
+@end
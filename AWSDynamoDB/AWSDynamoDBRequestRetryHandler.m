@@ -44,4 +44,15 @@
     return retryType;
 }
 
+- (BOOL)isThrottlingResponse:(NSHTTPURLResponse *)response
+                        data:(NSData *)data
+                       error:(NSError *)error {
+    if ([error.domain isEqualToString:AWSDynamoDBErrorDomain]
+        && error.code == AWSDynamoDBErrorProvisionedThroughputExceeded) {
+        return YES;
+    }
+
+    return [super isThrottlingResponse:response data:data error:error];
+}
+
 @end
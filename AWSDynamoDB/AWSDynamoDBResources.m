@@ -15,6 +15,7 @@
 
 #import "AWSDynamoDBResources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSServiceDefinition.h>
 
 @interface AWSDynamoDBResources ()
 
@@ -43,9 +44,8 @@
     if (self = [super init]) {
         //init method
         NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
+        _definitionDictionary = [AWSServiceDefinition definitionWithJSONString:[self definitionString]
+                                                                         error:&error];
         if (_definitionDictionary == nil) {
             if (error) {
                 AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
@@ -89,6 +89,7 @@
     },\
     \"BatchGetItem\":{\
       \"name\":\"BatchGetItem\",\
+      \"readonly\":true,\
       \"http\":{\
         \"method\":\"POST\",\
         \"requestUri\":\"/\"\
@@ -405,6 +406,7 @@
     },\
     \"DescribeTable\":{\
       \"name\":\"DescribeTable\",\
+      \"readonly\":true,\
       \"http\":{\
         \"method\":\"POST\",\
         \"requestUri\":\"/\"\
@@ -544,6 +546,7 @@
     },\
     \"GetItem\":{\
       \"name\":\"GetItem\",\
+      \"readonly\":true,\
       \"http\":{\
         \"method\":\"POST\",\
         \"requestUri\":\"/\"\
@@ -736,6 +739,7 @@
     },\
     \"Query\":{\
       \"name\":\"Query\",\
+      \"readonly\":true,\
       \"http\":{\
         \"method\":\"POST\",\
         \"requestUri\":\"/\"\
@@ -795,6 +799,7 @@
     },\
     \"Scan\":{\
       \"name\":\"Scan\",\
+      \"readonly\":true,\
       \"http\":{\
         \"method\":\"POST\",\
         \"requestUri\":\"/\"\
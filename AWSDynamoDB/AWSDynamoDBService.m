@@ -289,9 +289,11 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         networkingRequest.HTTPMethod = HTTPMethod;
         networkingRequest.requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
                                                                                                    actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSDynamoDBResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        AWSDynamoDBResponseSerializer *responseSerializer = [[AWSDynamoDBResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                                                           actionName:operationName
+                                                                                                          outputClass:outputClass];
+        responseSerializer.decodesModels = YES;
+        networkingRequest.responseSerializer = responseSerializer;
         
         return [self.networking sendRequest:networkingRequest];
     }
@@ -0,0 +1,146 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSDynamoDBService.h"
+
+static NSUInteger const AWSDynamoDBModelDecodingBenchmarkItemCount = 2000;
+
+// Decodes Query responses with and without AWSJSONResponseSerializer.decodesModels.
+@interface AWSDynamoDBModelDecodingTests : XCTestCase
+
+@end
+
+@implementation AWSDynamoDBModelDecodingTests
+
+// A Query response as returned by DynamoDB, with every attribute value type.
+- (NSData *)queryResponseWithItemCount:(NSUInteger)itemCount {
+    NSMutableArray *items = [NSMutableArray new];
+    for (NSUInteger i = 0; i < itemCount; i++) {
+        [items addObject:@{@"ForumName": @{@"S": @"Amazon DynamoDB"},
+                           @"Subject": @{@"S": [NSString stringWithFormat:@"Thread %lu", (unsigned long)i]},
+                           @"Replies": @{@"N": [NSString stringWithFormat:@"%lu", (unsigned long)(i % 17)]},
+                           @"Answered": @{@"BOOL": @(i % 2 == 0)},
+                           @"Thumbnail": @{@"B": @"iVBORw0KGgoAAAANSUhEUgAAAAEAAAABCAYAAAAfFcSJAAAADUlEQVR42mNkYPhfDwAChwGA60e6kgAAAABJRU5ErkJggg=="},
+                           @"Tags": @{@"SS": @[@"Update", @"Multiple Items", @"HelpMe"]},
+                           @"Moderator": @{@"NULL": @YES},
+                           @"LastPostedBy": @{@"M": @{@"Name": @{@"S": @"User A"},
+                                                      @"Ids": @{@"NS": @[@"1", @"2"]}}},
+                           @"Posts": @{@"L": @[@{@"S": @"First post"}, @{@"N": @"3"}]}}];
+    }
+    NSDictionary *response = @{@"Count": @(itemCount),
+                               @"ScannedCount": @(itemCount),
+                               @"Items": items,
+                               @"LastEvaluatedKey": @{@"ForumName": @{@"S": @"Amazon DynamoDB"},
+                                                      @"Subject": @{@"S": @"Thread 1"}},
+                               @"ConsumedCapacity": @{@"TableName": @"Thread",
+                                                      @"CapacityUnits": @1.5,
+                                                      @"Table": @{@"CapacityUnits": @1.5}}};
+    return [NSJSONSerialization dataWithJSONObject:response options:kNilOptions error:nil];
+}
+
+- (id)responseObjectForData:(NSData *)data statusCode:(NSInteger)statusCode decodesModels:(BOOL)decodesModels error:(NSError **)error {
+    AWSJSONResponseSerializer *serializer = [[AWSJSONResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                                           actionName:@"Query"
+                                                                                          outputClass:[AWSDynamoDBQueryOutput class]];
+    serializer.decodesModels = decodesModels;
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]
+                                                              statusCode:statusCode
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"Content-Type": @"application/x-amz-json-1.0"}];
+    return [serializer responseObjectForResponse:response
+                                 originalRequest:nil
+                                  currentRequest:nil
+                                            data:data
+                                           error:error];
+}
+
+// The dictionary from AWSJSONParser, then the model from AWSMTLJSONAdapter, as AWSDynamoDBResponseSerializer did.
+- (AWSDynamoDBQueryOutput *)adapterModelForData:(NSData *)data {
+    NSError *error = nil;
+    NSDictionary *dictionary = [self responseObjectForData:data statusCode:200 decodesModels:NO error:&error];
+    XCTAssertNil(error);
+    return [AWSMTLJSONAdapter modelOfClass:[AWSDynamoDBQueryOutput class] fromJSONDictionary:dictionary error:&error];
+}
+
+- (AWSDynamoDBQueryOutput *)decodedModelForData:(NSData *)data {
+    NSError *error = nil;
+    AWSDynamoDBQueryOutput *output = [self responseObjectForData:data statusCode:200 decodesModels:YES error:&error];
+    XCTAssertNil(error);
+    return output;
+}
+
+- (void)testDecodedModelMatchesAdapterModel {
+    NSData *data = [self queryResponseWithItemCount:3];
+    AWSDynamoDBQueryOutput *output = [self decodedModelForData:data];
+    XCTAssertTrue([output isKindOfClass:[AWSDynamoDBQueryOutput class]]);
+    XCTAssertEqualObjects(output, [self adapterModelForData:data]);
+
+    XCTAssertEqualObjects(output.count, @3);
+    XCTAssertEqual(output.items.count, 3);
+    AWSDynamoDBAttributeValue *subject = output.items[1][@"Subject"];
+    XCTAssertEqualObjects(subject.S, @"Thread 1");
+    AWSDynamoDBAttributeValue *thumbnail = output.items[0][@"Thumbnail"];
+    XCTAssertEqual(thumbnail.B.length, 70);
+    AWSDynamoDBAttributeValue *lastPostedBy = output.items[0][@"LastPostedBy"];
+    XCTAssertEqualObjects(lastPostedBy.M[@"Ids"].NS, (@[@"1", @"2"]));
+    AWSDynamoDBAttributeValue *posts = output.items[0][@"Posts"];
+    XCTAssertEqualObjects(posts.L[1].N, @"3");
+    XCTAssertEqualObjects(output.consumedCapacity.table.capacityUnits, @1.5);
+    XCTAssertEqualObjects(output.lastEvaluatedKey[@"Subject"].S, @"Thread 1");
+}
+
+- (void)testNullMembersMatchAdapterModel {
+    NSDictionary *response = @{@"Count": [NSNull null],
+                               @"Items": @[@{@"Subject": [NSNull null]}],
+                               @"ConsumedCapacity": [NSNull null],
+                               @"LastEvaluatedKey": [NSNull null]};
+    NSData *data = [NSJSONSerialization dataWithJSONObject:response options:kNilOptions error:nil];
+    XCTAssertEqualObjects([self decodedModelForData:data], [self adapterModelForData:data]);
+}
+
+- (void)testErrorResponseIsNotDecodedIntoModel {
+    NSData *data = [@"{\"__type\":\"com.amazonaws.dynamodb.v20120810#ResourceNotFoundException\",\"message\":\"Requested resource not found\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    NSError *error = nil;
+    id responseObject = [self responseObjectForData:data statusCode:400 decodesModels:YES error:&error];
+    XCTAssertTrue([responseObject isKindOfClass:[NSDictionary class]]);
+    XCTAssertEqualObjects(responseObject[@"message"], @"Requested resource not found");
+}
+
+- (void)testMismatchedValueFallsBackToDictionary {
+    NSData *data = [@"{\"Items\":\"not a list\"}" dataUsingEncoding:NSUTF8StringEncoding];
+    NSError *error = nil;
+    id responseObject = [self responseObjectForData:data statusCode:200 decodesModels:YES error:&error];
+    XCTAssertTrue([responseObject isKindOfClass:[NSDictionary class]]);
+    XCTAssertNotNil(error);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceAdapterDecoding {
+    NSData *data = [self queryResponseWithItemCount:AWSDynamoDBModelDecodingBenchmarkItemCount];
+    [self measureBlock:^{
+        [self adapterModelForData:data];
+    }];
+}
+
+- (void)testPerformanceSinglePassDecoding {
+    NSData *data = [self queryResponseWithItemCount:AWSDynamoDBModelDecodingBenchmarkItemCount];
+    [self measureBlock:^{
+        [self decodedModelForData:data];
+    }];
+}
+
+@end
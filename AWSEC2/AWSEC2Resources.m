@@ -15,6 +15,10 @@
 
 #import "AWSEC2Resources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSServiceDefinition.h>
+
+// The SHA-256 of `definitionString`, kept up to date by Scripts/compile_service_definitions.py.
+static NSString *const AWSEC2DefinitionDigest = @"3a9b329a4dc449b1877d98c5e7626f6fecc8e8e30f3de2b15098c72ca3103c95";
 
 @interface AWSEC2Resources ()
 
@@ -42,13 +46,18 @@
 - (instancetype)init {
     if (self = [super init]) {
         //init method
-        NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
+        _definitionDictionary = [AWSServiceDefinition definitionNamed:@"AWSEC2"
+                                                          bundleClass:[self class]
+                                                   resourceBundleName:@"AWSEC2"
+                                                               digest:AWSEC2DefinitionDigest];
         if (_definitionDictionary == nil) {
-            if (error) {
-                AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+            NSError *error = nil;
+            _definitionDictionary = [AWSServiceDefinition definitionWithJSONString:[self definitionString]
+                                                                             error:&error];
+            if (_definitionDictionary == nil) {
+                if (error) {
+                    AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+                }
             }
         }
     }
@@ -44,6 +44,10 @@
 @property (nonatomic, strong) NSString *actionName;
 
 - (void)processParameters:(NSDictionary *)parameters queryString:(NSMutableString *)queryString;
+- (BOOL)writeFormBodyOfRequest:(NSMutableURLRequest *)request
+                    parameters:(NSDictionary *)parameters
+                  usesEC2Rules:(BOOL)usesEC2Rules
+                         error:(NSError *__autoreleasing *)error;
 
 @end
 
@@ -60,20 +64,34 @@
         [parameters setValue:obj forKey:key];
     }];
     
-    //Need to add version and actionName
-    NSError *error = nil;
-    NSDictionary *formattedParams = [AWSEC2ParamBuilder buildFormattedParams:parameters
-                                                                  actionName:self.actionName
-                                                       serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
-    if (error) {
-        return [AWSTask taskWithError:error];
+    NSError *validationError = nil;
+    if (![AWSValidation validateParameters:parameters
+                                actionName:self.actionName
+                     serviceDefinitionRule:self.serviceDefinitionJSON
+                                     error:&validationError]) {
+        return [AWSTask taskWithError:validationError];
     }
     
-    NSMutableString *queryString = [NSMutableString new];
-    [self processParameters:formattedParams queryString:queryString];
-    
-    if ([queryString length] > 0) {
-        request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+    NSError *error = nil;
+    if (![self writeFormBodyOfRequest:request parameters:parameters usesEC2Rules:YES error:&error]) {
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
+        
+        //Need to add version and actionName
+        NSDictionary *formattedParams = [AWSEC2ParamBuilder buildFormattedParams:parameters
+                                                                      actionName:self.actionName
+                                                           serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
+        
+        NSMutableString *queryString = [NSMutableString new];
+        [self processParameters:formattedParams queryString:queryString];
+        
+        if ([queryString length] > 0) {
+            request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        }
     }
     
     //contruct additional headers
@@ -0,0 +1,58 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSServiceStartupTestCase.h"
+#import "AWSEC2Service.h"
+
+// Measures the cost of the first DescribeInstances call of a process: loading the service definition and serializing one request.
+@interface AWSEC2StartupTests : AWSServiceStartupTestCase
+
+@end
+
+@implementation AWSEC2StartupTests
+
+- (void)setUp {
+    [super setUp];
+    self.resourcesClass = [AWSEC2Resources class];
+    // AWSEC2RequestSerializer is private to the framework; the query serializer resolves the same shapes.
+    self.requestSerializerClass = [AWSQueryStringRequestSerializer class];
+    self.actionName = @"DescribeInstances";
+    self.URL = [NSURL URLWithString:@"https://ec2.us-east-1.amazonaws.com"];
+    self.HTTPMethod = @"POST";
+
+    AWSEC2DescribeInstancesRequest *describeInstances = [AWSEC2DescribeInstancesRequest new];
+    describeInstances.instanceIds = @[@"i-1234567890abcdef0"];
+    self.input = describeInstances;
+}
+
+- (void)testDefinitionsSerializeTheSameRequest {
+    [self assertDefinitionsSerializeTheSameRequest];
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceFirstRequestWithParsedDefinition {
+    [self measureFirstRequestWithParsedDefinition];
+}
+
+- (void)testPerformanceFirstRequestWithLazyDefinition {
+    [self measureFirstRequestWithLazyDefinition];
+}
+
+- (void)testPerformanceFirstRequestWithBundledDefinition {
+    [self measureFirstRequestWithBundledDefinition];
+}
+
+@end
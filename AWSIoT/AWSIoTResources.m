@@ -15,6 +15,10 @@
 
 #import "AWSIoTResources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSServiceDefinition.h>
+
+// The SHA-256 of `definitionString`, kept up to date by Scripts/compile_service_definitions.py.
+static NSString *const AWSIoTDefinitionDigest = @"68a431a2377407f4fd94b8abacec54a7157a575b35f78c0c8d886f6068bccbec";
 
 @interface AWSIoTResources ()
 
@@ -42,13 +46,18 @@
 - (instancetype)init {
     if (self = [super init]) {
         //init method
-        NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
+        _definitionDictionary = [AWSServiceDefinition definitionNamed:@"AWSIoT"
+                                                          bundleClass:[self class]
+                                                   resourceBundleName:@"AWSIoT"
+                                                               digest:AWSIoTDefinitionDigest];
         if (_definitionDictionary == nil) {
-            if (error) {
-                AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+            NSError *error = nil;
+            _definitionDictionary = [AWSServiceDefinition definitionWithJSONString:[self definitionString]
+                                                                             error:&error];
+            if (_definitionDictionary == nil) {
+                if (error) {
+                    AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+                }
             }
         }
     }
@@ -137,17 +137,10 @@ typedef void (^StatusCallback)(AWSIoTMQTTStatus status);
                            regionName:(NSString *)regionName
                           serviceName:(NSString *)serviceName;
 {
-    // AWS4 uses a series of derived keys, formed by hashing different pieces of data
-    NSString *kSecret = [NSString stringWithFormat:@"AWS4%@", secretKey];
-    NSData *kDate = [AWSSignatureSignerUtility sha256HMacWithData:[dateStamp dataUsingEncoding:NSUTF8StringEncoding]
-                                                          withKey:[kSecret dataUsingEncoding:NSUTF8StringEncoding]];
-    NSData *kRegion = [AWSSignatureSignerUtility sha256HMacWithData:[regionName dataUsingEncoding:NSASCIIStringEncoding]
-                                                            withKey:kDate];
-    NSData *kService = [AWSSignatureSignerUtility sha256HMacWithData:[serviceName dataUsingEncoding:NSUTF8StringEncoding]
-                                                             withKey:kRegion];
-    NSData *kSigning = [AWSSignatureSignerUtility sha256HMacWithData:[AWSSignatureV4Terminator dataUsingEncoding:NSUTF8StringEncoding]
-                                                             withKey:kService];
-    return kSigning;
+    return [[AWSSignatureV4SigningKeyCache sharedCache] signingKeyForSecretKey:secretKey
+                                                                      dateStamp:dateStamp
+                                                                     regionName:regionName
+                                                                    serviceName:serviceName];
 }
 
 - (NSString *)signWebSocketUrlForMethod:(NSString *)method
@@ -182,8 +175,7 @@ typedef void (^StatusCallback)(AWSIoTMQTTStatus status);
     NSData *signingKey = [self getDerivedKeyForSecretKey:secretKey dateStamp:today regionName:regionName serviceName:serviceName];
     NSData *signature  = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
                                                                withKey:signingKey];
-    NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                           encoding:NSASCIIStringEncoding]];
+    NSString *signatureString = [signature aws_hexEncodedString];
     NSString *url = nil;
 
     if (sessionKey != nil)
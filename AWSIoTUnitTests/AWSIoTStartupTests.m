@@ -0,0 +1,57 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSServiceStartupTestCase.h"
+#import "AWSIoTService.h"
+
+// Measures the cost of the first DescribeThing call of a process: loading the service definition and serializing one request.
+@interface AWSIoTStartupTests : AWSServiceStartupTestCase
+
+@end
+
+@implementation AWSIoTStartupTests
+
+- (void)setUp {
+    [super setUp];
+    self.resourcesClass = [AWSIoTResources class];
+    self.requestSerializerClass = [AWSJSONRequestSerializer class];
+    self.actionName = @"DescribeThing";
+    self.URL = [NSURL URLWithString:@"https://iot.us-east-1.amazonaws.com"];
+    self.HTTPMethod = @"GET";
+
+    AWSIoTDescribeThingRequest *describeThing = [AWSIoTDescribeThingRequest new];
+    describeThing.thingName = @"thermostat";
+    self.input = describeThing;
+}
+
+- (void)testDefinitionsSerializeTheSameRequest {
+    [self assertDefinitionsSerializeTheSameRequest];
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceFirstRequestWithParsedDefinition {
+    [self measureFirstRequestWithParsedDefinition];
+}
+
+- (void)testPerformanceFirstRequestWithLazyDefinition {
+    [self measureFirstRequestWithLazyDefinition];
+}
+
+- (void)testPerformanceFirstRequestWithBundledDefinition {
+    [self measureFirstRequestWithBundledDefinition];
+}
+
+@end
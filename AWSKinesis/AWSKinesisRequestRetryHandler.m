@@ -42,4 +42,15 @@
     
     return retryType;
 }
+
+- (BOOL)isThrottlingResponse:(NSHTTPURLResponse *)response
+                        data:(NSData *)data
+                       error:(NSError *)error {
+    if ([error.domain isEqualToString:AWSKinesisErrorDomain]
+        && error.code == AWSKinesisErrorProvisionedThroughputExceeded) {
+        return YES;
+    }
+
+    return [super isThrottlingResponse:response data:data error:error];
+}
 @end
@@ -272,9 +272,11 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         networkingRequest.HTTPMethod = HTTPMethod;
 		networkingRequest.requestSerializer = [[AWSKinesisRequestSerializer alloc] initWithJSONDefinition:[[AWSKinesisResources sharedInstance] JSONObject]
 		 															     actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSKinesisResponseSerializer alloc] initWithJSONDefinition:[[AWSKinesisResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        AWSKinesisResponseSerializer *responseSerializer = [[AWSKinesisResponseSerializer alloc] initWithJSONDefinition:[[AWSKinesisResources sharedInstance] JSONObject]
+                                                                                                           actionName:operationName
+                                                                                                          outputClass:outputClass];
+        responseSerializer.decodesModels = YES;
+        networkingRequest.responseSerializer = responseSerializer;
         
         return [self.networking sendRequest:networkingRequest];
     }
@@ -0,0 +1,96 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSKinesisService.h"
+
+static NSUInteger const AWSKinesisModelDecodingBenchmarkRecordCount = 5000;
+
+// Decodes GetRecords responses with and without AWSJSONResponseSerializer.decodesModels.
+@interface AWSKinesisModelDecodingTests : XCTestCase
+
+@end
+
+@implementation AWSKinesisModelDecodingTests
+
+- (NSData *)getRecordsResponseWithRecordCount:(NSUInteger)recordCount {
+    NSMutableArray *records = [NSMutableArray new];
+    for (NSUInteger i = 0; i < recordCount; i++) {
+        NSString *payload = [NSString stringWithFormat:@"{\"sensor\":\"%lu\",\"temperature\":%lu}", (unsigned long)(i % 64), (unsigned long)(i % 40)];
+        [records addObject:@{@"SequenceNumber": [NSString stringWithFormat:@"4959037223463902874617706609585484%05lu", (unsigned long)i],
+                             @"ApproximateArrivalTimestamp": @(1761955200 + i),
+                             @"Data": [[payload dataUsingEncoding:NSUTF8StringEncoding] base64EncodedStringWithOptions:0],
+                             @"PartitionKey": [NSString stringWithFormat:@"partition-%lu", (unsigned long)(i % 8)],
+                             @"EncryptionType": i % 2 ? @"KMS" : @"NONE"}];
+    }
+    NSDictionary *response = @{@"Records": records,
+                               @"NextShardIterator": @"AAAAAAAAAAHsW8zCWf9164uy8Epue6WS3w6wmj4a4USt+CNvMd6uXQ+HL5vAJMznqqC0DLKsIjuoiTi1BpT6nW0LN2M2D56zM5H8anHm30Gbri9ua+qaGgj+3XTyvbhpERfrezgLHbPB/rIcVpykJbaSj5tmcXYRmFnqZBEyHwtZYFmh6hvWVFkIwLuMZLMrpWhG5r5hzkE=",
+                               @"MillisBehindLatest": @2100};
+    return [NSJSONSerialization dataWithJSONObject:response options:kNilOptions error:nil];
+}
+
+- (id)responseObjectForData:(NSData *)data decodesModels:(BOOL)decodesModels {
+    AWSJSONResponseSerializer *serializer = [[AWSJSONResponseSerializer alloc] initWithJSONDefinition:[[AWSKinesisResources sharedInstance] JSONObject]
+                                                                                           actionName:@"GetRecords"
+                                                                                          outputClass:[AWSKinesisGetRecordsOutput class]];
+    serializer.decodesModels = decodesModels;
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://kinesis.us-east-1.amazonaws.com"]
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"Content-Type": @"application/x-amz-json-1.1"}];
+    NSError *error = nil;
+    id responseObject = [serializer responseObjectForResponse:response
+                                              originalRequest:nil
+                                               currentRequest:nil
+                                                         data:data
+                                                        error:&error];
+    XCTAssertNil(error);
+    if (!decodesModels) {
+        responseObject = [AWSMTLJSONAdapter modelOfClass:[AWSKinesisGetRecordsOutput class] fromJSONDictionary:responseObject error:&error];
+    }
+    return responseObject;
+}
+
+- (void)testDecodedModelMatchesAdapterModel {
+    NSData *data = [self getRecordsResponseWithRecordCount:4];
+    AWSKinesisGetRecordsOutput *output = [self responseObjectForData:data decodesModels:YES];
+    XCTAssertTrue([output isKindOfClass:[AWSKinesisGetRecordsOutput class]]);
+    XCTAssertEqualObjects(output, [self responseObjectForData:data decodesModels:NO]);
+
+    XCTAssertEqual(output.records.count, 4);
+    AWSKinesisRecord *record = output.records[1];
+    XCTAssertEqualObjects(record.data, [@"{\"sensor\":\"1\",\"temperature\":1}" dataUsingEncoding:NSUTF8StringEncoding]);
+    XCTAssertEqualObjects(record.approximateArrivalTimestamp, [NSDate dateWithTimeIntervalSince1970:1761955201]);
+    XCTAssertEqual(record.encryptionType, AWSKinesisEncryptionTypeKms);
+    XCTAssertEqualObjects(output.millisBehindLatest, @2100);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceAdapterDecoding {
+    NSData *data = [self getRecordsResponseWithRecordCount:AWSKinesisModelDecodingBenchmarkRecordCount];
+    [self measureBlock:^{
+        [self responseObjectForData:data decodesModels:NO];
+    }];
+}
+
+- (void)testPerformanceSinglePassDecoding {
+    NSData *data = [self getRecordsResponseWithRecordCount:AWSKinesisModelDecodingBenchmarkRecordCount];
+    [self measureBlock:^{
+        [self responseObjectForData:data decodesModels:YES];
+    }];
+}
+
+@end
@@ -89,7 +89,7 @@ static NSString *const AWSLexSignatureScope = @"lex";
         contentSha256 = @"UNSIGNED-PAYLOAD";
         [request setValue:contentSha256 forHTTPHeaderField:@"x-amz-content-sha256"];
     }else{
-        contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hashData:request.HTTPBody] encoding:NSASCIIStringEncoding]];
+        contentSha256 = [[AWSSignatureSignerUtility hashData:request.HTTPBody] aws_hexEncodedString];
     }
     
     NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
@@ -125,7 +125,7 @@ static NSString *const AWSLexSignatureScope = @"lex";
     
     NSString *credentialsAuthorizationHeader = [NSString stringWithFormat:@"Credential=%@", signingCredentials];
     NSString *signedHeadersAuthorizationHeader = [NSString stringWithFormat:@"SignedHeaders=%@", [AWSSignatureV4Signer getSignedHeadersString:request.allHTTPHeaderFields]];
-    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature encoding:NSASCIIStringEncoding]]];
+    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", [signature aws_hexEncodedString]];
     
     NSString *authorization = [NSString stringWithFormat:@"%@ %@, %@, %@",
                                AWSSignatureV4Algorithm,
@@ -280,9 +280,11 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         networkingRequest.HTTPMethod = HTTPMethod;
         networkingRequest.requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSLogsResources sharedInstance] JSONObject]
                                                                                                    actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSLogsResponseSerializer alloc] initWithJSONDefinition:[[AWSLogsResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        AWSLogsResponseSerializer *responseSerializer = [[AWSLogsResponseSerializer alloc] initWithJSONDefinition:[[AWSLogsResources sharedInstance] JSONObject]
+                                                                                                           actionName:operationName
+                                                                                                          outputClass:outputClass];
+        responseSerializer.decodesModels = YES;
+        networkingRequest.responseSerializer = responseSerializer;
         
         return [self.networking sendRequest:networkingRequest];
     }
@@ -15,6 +15,10 @@
 
 #import "AWSPinpointTargetingResources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSServiceDefinition.h>
+
+// The SHA-256 of `definitionString`, kept up to date by Scripts/compile_service_definitions.py.
+static NSString *const AWSPinpointTargetingDefinitionDigest = @"e1691d6f28c59529e2564a0ce902e9b8e045e55308b0a6e49b487dcef7dacbde";
 
 @interface AWSPinpointTargetingResources ()
 
@@ -42,13 +46,18 @@
 - (instancetype)init {
     if (self = [super init]) {
         //init method
-        NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
+        _definitionDictionary = [AWSServiceDefinition definitionNamed:@"AWSPinpointTargeting"
+                                                          bundleClass:[self class]
+                                                   resourceBundleName:@"AWSPinpoint"
+                                                               digest:AWSPinpointTargetingDefinitionDigest];
         if (_definitionDictionary == nil) {
-            if (error) {
-                AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+            NSError *error = nil;
+            _definitionDictionary = [AWSServiceDefinition definitionWithJSONString:[self definitionString]
+                                                                             error:&error];
+            if (_definitionDictionary == nil) {
+                if (error) {
+                    AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+                }
             }
         }
     }
@@ -198,6 +198,19 @@ typedef NS_ENUM(NSInteger, AWSS3PresignedURLErrorType) {
  */
 - (AWSTask<NSURL *> *)getPreSignedURL:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest;
 
+/**
+ Build time-limited pre-signed URLs for a batch of requests.
+
+ The credentials are resolved once for the whole batch, all URLs are signed with the same date and signing key, and
+ the requests are signed concurrently. This is considerably faster than calling `getPreSignedURL:` for each request
+ when thousands of URLs are needed at once. The task fails with the first validation error in the batch.
+
+ @param getPreSignedURLRequests The AWSS3GetPreSignedURLRequests that define the parameters of each URL.
+ @return The pre-signed NSURLs, in the order of `getPreSignedURLRequests`.
+ @see AWSS3GetPreSignedURLRequest
+ */
+- (AWSTask<NSArray<NSURL *> *> *)getPreSignedURLs:(NSArray<AWSS3GetPreSignedURLRequest *> *)getPreSignedURLRequests;
+
 @end
 
 /** The GetPreSignedURLRequest contains the parameters used to create
@@ -154,111 +154,14 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
 
 - (AWSTask<NSURL *> *)getPreSignedURL:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest {
     //retrive parameters from request;
-    NSString *bucketName = getPreSignedURLRequest.bucket;
-    NSString *keyName = getPreSignedURLRequest.key;
     AWSHTTPMethod httpMethod = getPreSignedURLRequest.HTTPMethod;
-    AWSServiceConfiguration *configuration = self.configuration;
-    id<AWSCredentialsProvider>credentialsProvider = configuration.credentialsProvider;
-    AWSEndpoint *endpoint = self.configuration.endpoint;
-    BOOL isAccelerateModeEnabled = getPreSignedURLRequest.isAccelerateModeEnabled;
-
+    id<AWSCredentialsProvider>credentialsProvider = self.configuration.credentialsProvider;
     NSDate *expires = getPreSignedURLRequest.expires;
 
     return [[[AWSTask taskWithResult:nil] continueWithBlock:^id(AWSTask *task) {
-
-        //validate additionalParams
-        for (id key in getPreSignedURLRequest.requestParameters) {
-            id value = getPreSignedURLRequest.requestParameters[key];
-            if (![key isKindOfClass:[NSString class]]
-                || ![value isKindOfClass:[NSString class]]) {
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                                  code:AWSS3PresignedURLErrorInvalidRequestParameters
-                                                              userInfo:@{NSLocalizedDescriptionKey: @"requestParameters can only contain key-value pairs in NSString type."}]
-                        ];
-            }
-        }
-
-        //validate endpoint
-        if (!endpoint) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorEndpointIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"endpoint in configuration can not be nil"}]
-                    ];
-        } else if (endpoint.serviceType != AWSServiceS3) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidServiceType
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"Invalid serviceType: serviceType in endpoint must be AWSServiceS3"}]
-                    ];
-        }
-
-        //validate credentialsProvider
-        if (!credentialsProvider) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PreSignedURLErrorCredentialProviderIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"credentialsProvider in configuration can not be nil"}]
-                    ];
-        }
-
-        //validate bucketName
-        if (!bucketName || [bucketName length] < 1) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorBucketNameIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"S3 bucket can not be nil or empty"}]];
-        }
-
-        // validate values for transfer acceleration.
-        if (isAccelerateModeEnabled) {
-            // validate the bucket name
-            if (![bucketName aws_isVirtualHostedStyleCompliant]) {
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                                  code:AWSS3PresignedURLErrorInvalidBucketNameForAccelerateModeEnabled
-                                                              userInfo:@{
-                                                                         NSLocalizedDescriptionKey: @"For your bucket to work with transfer acceleration, the bucket name must conform to DNS naming requirements and must not contain periods."}]];
-            }
-            
-            // validate the preferred access style
-            if (getPreSignedURLRequest.preferredAccessStyle == AWSS3BucketAccessStylePath) {
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                                  code:AWSS3PresignedURLErrorInvalidAccessStyleForAccelerateModeEnabled
-                                                              userInfo:@{
-                                                                         NSLocalizedDescriptionKey: @"Transfer Acceleration is only supported on virtual-hosted style requests."}]];
-            }
-        }
-
-        //validate keyName
-        if (!keyName || [keyName length] < 1) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorKeyNameIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"S3 key can not be nil or empty"}]
-                    ];
-        }
-
-        //validate expires Date
-        if (!expires) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidExpiresDate
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"expires can not be nil"}]
-                    ];
-        }else if ([expires timeIntervalSinceNow] < 0.0) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidExpiresDate
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"expires can not be in past"}]
-                    ];
-        }
-
-        //validate httpMethod
-        switch (httpMethod) {
-            case AWSHTTPMethodGET:
-            case AWSHTTPMethodPUT:
-            case AWSHTTPMethodHEAD:
-            case AWSHTTPMethodDELETE:
-                break;
-            default:
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                                  code:AWSS3PresignedURLErrorUnsupportedHTTPVerbs
-                                                              userInfo:@{NSLocalizedDescriptionKey: @"unsupported HTTP Method, currently only support AWSHTTPMethodGET, AWSHTTPMethodPUT, AWSHTTPMethodHEAD, AWSHTTPMethodDELETE"}]
-                        ];
-                break;
+        NSError *error = [self validateGetPreSignedURLRequest:getPreSignedURLRequest];
+        if (error) {
+            return [AWSTask taskWithError:error];
         }
 
         return [[credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
@@ -270,49 +173,13 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
             return credentialsProvider;
         }];
     }] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
-        //generate baseURL String (use virtualHostStyle if possible)
-        //base url is not url encoded.
         NSString *keyPath = nil;
-        if (bucketName == nil || [self shouldUseVirtualHostStyleForRequest:getPreSignedURLRequest]) {
-            keyPath = (keyName == nil ? @"" : [NSString stringWithFormat:@"%@", [keyName aws_stringWithURLEncodingPath]]);
-        } else {
-            keyPath = (keyName == nil ? [NSString stringWithFormat:@"%@", bucketName] : [NSString stringWithFormat:@"%@/%@", bucketName, [keyName aws_stringWithURLEncodingPath]]);
-        }
+        AWSEndpoint *newEndpoint = [self endpointForGetPreSignedURLRequest:getPreSignedURLRequest
+                                                                   keyPath:&keyPath];
 
-        //generate correct hostName (use virtualHostStyle if possible)
-        NSString *host = nil;
-        if (!self.configuration.localTestingEnabled &&
-            bucketName &&
-            [self shouldUseVirtualHostStyleForRequest:getPreSignedURLRequest]) {
-            if (isAccelerateModeEnabled) {
-                host = [NSString stringWithFormat:@"%@.%@", bucketName, AWSS3PreSignedURLBuilderAcceleratedEndpoint];
-            } else {
-                host = [NSString stringWithFormat:@"%@.%@", bucketName, endpoint.hostName];
-            }
-        } else {
-            host = endpoint.hostName;
-        }
-        [getPreSignedURLRequest setValue:host forRequestHeader:@"host"];
-        
-        //If this is a presigned request for a multipart upload, set the uploadID and partNumber on the request.
-        if (getPreSignedURLRequest.uploadID
-            && getPreSignedURLRequest.partNumber) {
-            
-            [getPreSignedURLRequest setValue:getPreSignedURLRequest.uploadID
-                         forRequestParameter:@"uploadId"];
-            
-            [getPreSignedURLRequest setValue:[NSString stringWithFormat:@"%@", getPreSignedURLRequest.partNumber]
-                         forRequestParameter:@"partNumber"];
-        }
-        NSString *portNumber = endpoint.portNumber != nil ? [NSString stringWithFormat:@":%@", endpoint.portNumber.stringValue]: @"";
-        AWSEndpoint *newEndpoint = [[AWSEndpoint alloc]initWithRegion:configuration.regionType service:AWSServiceS3 URL:[NSURL URLWithString:[NSString stringWithFormat:@"%@://%@%@", endpoint.useUnsafeURL?@"http":@"https", host, portNumber]]];
-        
         int32_t expireDuration = [expires timeIntervalSinceNow];
         if (expireDuration > 604800) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidExpiresDate
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"Invalid ExpiresDate, must be less than seven days in future"}]
-                    ];
+            return [AWSTask taskWithError:[self invalidExpireDurationError]];
         }
 
         return [AWSSignatureV4Signer  generateQueryStringForSignatureV4WithCredentialProvider:task.result
@@ -326,6 +193,246 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
     }];
 }
 
+- (AWSTask<NSArray<NSURL *> *> *)getPreSignedURLs:(NSArray<AWSS3GetPreSignedURLRequest *> *)getPreSignedURLRequests {
+    NSArray<AWSS3GetPreSignedURLRequest *> *requests = [getPreSignedURLRequests copy];
+    id<AWSCredentialsProvider>credentialsProvider = self.configuration.credentialsProvider;
+    if ([requests count] == 0) {
+        return [AWSTask taskWithResult:@[]];
+    }
+
+    return [[[AWSTask taskWithResult:nil] continueWithBlock:^id(AWSTask *task) {
+        NSTimeInterval minimumCredentialsExpirationInterval = 0;
+        for (AWSS3GetPreSignedURLRequest *getPreSignedURLRequest in requests) {
+            NSError *error = [self validateGetPreSignedURLRequest:getPreSignedURLRequest];
+            if (error) {
+                return [AWSTask taskWithError:error];
+            }
+            minimumCredentialsExpirationInterval = MAX(minimumCredentialsExpirationInterval,
+                                                       getPreSignedURLRequest.minimumCredentialsExpirationInterval);
+        }
+
+        // The credentials are resolved once for the whole batch, so they have to outlive the most demanding request.
+        return [[credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+            AWSCredentials *credentials = task.result;
+            if ([credentials.expiration timeIntervalSinceNow] < minimumCredentialsExpirationInterval) {
+                [credentialsProvider invalidateCachedTemporaryCredentials];
+                return [credentialsProvider credentials];
+            }
+
+            return task;
+        }];
+    }] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        // No nullability specifier on `credentials` return value means that we need to check for nil here to be safe
+        if (!task.result) {
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSCognitoCredentialsProviderErrorDomain
+                                                              code:AWSCognitoCredentialsProviderErrorUnknown
+                                                          userInfo:@{NSLocalizedDescriptionKey: @"Credentials result unexpectedly nil generating presigned URL"}]];
+        }
+        AWSCredentials *credentials = task.result;
+
+        // All the URLs of a batch share one signing date, and therefore one credential scope and signing key.
+        NSDate *currentDate = [NSDate aws_clockSkewFixedDate];
+        AWSEndpoint *signingEndpoint = nil;
+
+        NSMutableArray<NSURLRequest *> *urlRequests = [NSMutableArray arrayWithCapacity:[requests count]];
+        NSMutableArray<NSNumber *> *expireDurations = [NSMutableArray arrayWithCapacity:[requests count]];
+        for (AWSS3GetPreSignedURLRequest *getPreSignedURLRequest in requests) {
+            NSString *keyPath = nil;
+            AWSEndpoint *newEndpoint = [self endpointForGetPreSignedURLRequest:getPreSignedURLRequest
+                                                                       keyPath:&keyPath];
+            // Only the host differs between the endpoints of a batch; the region and service names are the same.
+            signingEndpoint = newEndpoint;
+
+            int32_t expireDuration = [getPreSignedURLRequest.expires timeIntervalSinceDate:currentDate];
+            if (expireDuration > 604800) {
+                return [AWSTask taskWithError:[self invalidExpireDurationError]];
+            }
+
+            NSURLComponents *urlComponents = [[NSURLComponents alloc] initWithURL:newEndpoint.URL resolvingAgainstBaseURL:NO];
+            urlComponents.percentEncodedPath = [NSString stringWithFormat:@"/%@", keyPath];
+            urlComponents.queryItems = [AWSNetworkingHelpers queryItemsFromDictionary:getPreSignedURLRequest.requestParameters];
+
+            NSMutableURLRequest *urlRequest = [[NSMutableURLRequest alloc] initWithURL:urlComponents.URL];
+            urlRequest.HTTPMethod = [NSString aws_stringWithHTTPMethod:getPreSignedURLRequest.HTTPMethod];
+            urlRequest.allHTTPHeaderFields = getPreSignedURLRequest.requestHeaders;
+
+            [urlRequests addObject:urlRequest];
+            [expireDurations addObject:@(expireDuration)];
+        }
+
+        NSArray *URLs = [AWSSignatureV4Signer sigV4SignedURLsWithRequests:urlRequests
+                                                          expireDurations:expireDurations
+                                                              credentials:credentials
+                                                               regionName:signingEndpoint.regionName
+                                                              serviceName:signingEndpoint.serviceName
+                                                                     date:currentDate
+                                                                 signBody:NO
+                                                         signSessionToken:YES];
+        NSUInteger failedIndex = [URLs indexOfObject:[NSNull null]];
+        if (failedIndex != NSNotFound) {
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                                              code:AWSS3PresignedURLErrorInvalidRequestParameters
+                                                          userInfo:@{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Failed to build the presigned URL for key %@", requests[failedIndex].key]}]];
+        }
+
+        return [AWSTask taskWithResult:URLs];
+    }];
+}
+
+- (NSError *)validateGetPreSignedURLRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest {
+    NSString *bucketName = getPreSignedURLRequest.bucket;
+    NSString *keyName = getPreSignedURLRequest.key;
+    AWSHTTPMethod httpMethod = getPreSignedURLRequest.HTTPMethod;
+    id<AWSCredentialsProvider>credentialsProvider = self.configuration.credentialsProvider;
+    AWSEndpoint *endpoint = self.configuration.endpoint;
+    BOOL isAccelerateModeEnabled = getPreSignedURLRequest.isAccelerateModeEnabled;
+    NSDate *expires = getPreSignedURLRequest.expires;
+
+    //validate additionalParams
+    for (id key in getPreSignedURLRequest.requestParameters) {
+        id value = getPreSignedURLRequest.requestParameters[key];
+        if (![key isKindOfClass:[NSString class]]
+            || ![value isKindOfClass:[NSString class]]) {
+            return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                       code:AWSS3PresignedURLErrorInvalidRequestParameters
+                                   userInfo:@{NSLocalizedDescriptionKey: @"requestParameters can only contain key-value pairs in NSString type."}];
+        }
+    }
+
+    //validate endpoint
+    if (!endpoint) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorEndpointIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"endpoint in configuration can not be nil"}];
+    } else if (endpoint.serviceType != AWSServiceS3) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidServiceType
+                               userInfo:@{NSLocalizedDescriptionKey: @"Invalid serviceType: serviceType in endpoint must be AWSServiceS3"}];
+    }
+
+    //validate credentialsProvider
+    if (!credentialsProvider) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PreSignedURLErrorCredentialProviderIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"credentialsProvider in configuration can not be nil"}];
+    }
+
+    //validate bucketName
+    if (!bucketName || [bucketName length] < 1) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorBucketNameIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"S3 bucket can not be nil or empty"}];
+    }
+
+    // validate values for transfer acceleration.
+    if (isAccelerateModeEnabled) {
+        // validate the bucket name
+        if (![bucketName aws_isVirtualHostedStyleCompliant]) {
+            return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                       code:AWSS3PresignedURLErrorInvalidBucketNameForAccelerateModeEnabled
+                                   userInfo:@{
+                                              NSLocalizedDescriptionKey: @"For your bucket to work with transfer acceleration, the bucket name must conform to DNS naming requirements and must not contain periods."}];
+        }
+        
+        // validate the preferred access style
+        if (getPreSignedURLRequest.preferredAccessStyle == AWSS3BucketAccessStylePath) {
+            return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                       code:AWSS3PresignedURLErrorInvalidAccessStyleForAccelerateModeEnabled
+                                   userInfo:@{
+                                              NSLocalizedDescriptionKey: @"Transfer Acceleration is only supported on virtual-hosted style requests."}];
+        }
+    }
+
+    //validate keyName
+    if (!keyName || [keyName length] < 1) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorKeyNameIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"S3 key can not be nil or empty"}];
+    }
+
+    //validate expires Date
+    if (!expires) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidExpiresDate
+                               userInfo:@{NSLocalizedDescriptionKey: @"expires can not be nil"}];
+    }else if ([expires timeIntervalSinceNow] < 0.0) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidExpiresDate
+                               userInfo:@{NSLocalizedDescriptionKey: @"expires can not be in past"}];
+    }
+
+    //validate httpMethod
+    switch (httpMethod) {
+        case AWSHTTPMethodGET:
+        case AWSHTTPMethodPUT:
+        case AWSHTTPMethodHEAD:
+        case AWSHTTPMethodDELETE:
+            break;
+        default:
+            return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                       code:AWSS3PresignedURLErrorUnsupportedHTTPVerbs
+                                   userInfo:@{NSLocalizedDescriptionKey: @"unsupported HTTP Method, currently only support AWSHTTPMethodGET, AWSHTTPMethodPUT, AWSHTTPMethodHEAD, AWSHTTPMethodDELETE"}];
+            break;
+    }
+
+
+    return nil;
+}
+
+- (NSError *)invalidExpireDurationError {
+    return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                               code:AWSS3PresignedURLErrorInvalidExpiresDate
+                           userInfo:@{NSLocalizedDescriptionKey: @"Invalid ExpiresDate, must be less than seven days in future"}];
+}
+
+// Sets the host header and the multipart parameters on a validated request, and returns the endpoint to sign it for.
+- (AWSEndpoint *)endpointForGetPreSignedURLRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest
+                                           keyPath:(NSString **)keyPathOut {
+    NSString *bucketName = getPreSignedURLRequest.bucket;
+    NSString *keyName = getPreSignedURLRequest.key;
+    AWSEndpoint *endpoint = self.configuration.endpoint;
+    BOOL isAccelerateModeEnabled = getPreSignedURLRequest.isAccelerateModeEnabled;
+    BOOL useVirtualHostStyle = [self shouldUseVirtualHostStyleForRequest:getPreSignedURLRequest];
+
+    //generate baseURL String (use virtualHostStyle if possible)
+    //base url is not url encoded.
+    NSString *keyPath = nil;
+    if (bucketName == nil || useVirtualHostStyle) {
+        keyPath = (keyName == nil ? @"" : [NSString stringWithFormat:@"%@", [keyName aws_stringWithURLEncodingPath]]);
+    } else {
+        keyPath = (keyName == nil ? [NSString stringWithFormat:@"%@", bucketName] : [NSString stringWithFormat:@"%@/%@", bucketName, [keyName aws_stringWithURLEncodingPath]]);
+    }
+    *keyPathOut = keyPath;
+
+    //generate correct hostName (use virtualHostStyle if possible)
+    NSString *host = nil;
+    if (!self.configuration.localTestingEnabled &&
+        bucketName &&
+        useVirtualHostStyle) {
+        if (isAccelerateModeEnabled) {
+            host = [NSString stringWithFormat:@"%@.%@", bucketName, AWSS3PreSignedURLBuilderAcceleratedEndpoint];
+        } else {
+            host = [NSString stringWithFormat:@"%@.%@", bucketName, endpoint.hostName];
+        }
+    } else {
+        host = endpoint.hostName;
+    }
+    [getPreSignedURLRequest setValue:host forRequestHeader:@"host"];
+
+    //If this is a presigned request for a multipart upload, set the uploadID and partNumber on the request.
+    if (getPreSignedURLRequest.uploadID
+        && getPreSignedURLRequest.partNumber) {
+
+        [getPreSignedURLRequest setValue:getPreSignedURLRequest.uploadID
+                     forRequestParameter:@"uploadId"];
+
+        [getPreSignedURLRequest setValue:[NSString stringWithFormat:@"%@", getPreSignedURLRequest.partNumber]
+                     forRequestParameter:@"partNumber"];
+    }
+    NSString *portNumber = endpoint.portNumber != nil ? [NSString stringWithFormat:@":%@", endpoint.portNumber.stringValue]: @"";
+    return [[AWSEndpoint alloc]initWithRegion:self.configuration.regionType service:AWSServiceS3 URL:[NSURL URLWithString:[NSString stringWithFormat:@"%@://%@%@", endpoint.useUnsafeURL?@"http":@"https", host, portNumber]]];
+}
+
 - (BOOL)shouldUseVirtualHostStyleForRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest  {
     if (getPreSignedURLRequest.preferredAccessStyle == AWSS3BucketAccessStylePath) {
         AWSDDLogVerbose(@"Using path-style access because it is set as preferred access style");
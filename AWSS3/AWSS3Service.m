@@ -157,6 +157,8 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
                                                                          
         AWSSignatureV4Signer *signer = [[AWSSignatureV4Signer alloc] initWithCredentialsProvider:_configuration.credentialsProvider
                                                                                         endpoint:_configuration.endpoint];
+        signer.chunkedEncodingChunkSize = _configuration.chunkedEncodingChunkSize;
+        signer.payloadSigningMode = _configuration.payloadSigningMode;
         AWSNetworkingRequestInterceptor *baseInterceptor = [[AWSNetworkingRequestInterceptor alloc] initWithUserAgent:_configuration.userAgent];
         _configuration.requestInterceptors = @[baseInterceptor, signer];
 
@@ -705,6 +705,13 @@ handleEventsForBackgroundURLSession:(NSString *)identifier
  */
 @property (nonatomic, assign) AWSS3BucketAccessStyle preferredAccessStyle;
 
+/**
+ How the payload of the requests made by the transfer utility's Amazon S3 client is signed. The default is
+ `AWSS3PayloadSigningModeSigned`, which keeps the mode of the service configuration. Transfers themselves use
+ presigned URLs, which never sign the payload.
+ */
+@property (nonatomic, assign) AWSS3PayloadSigningMode payloadSigningMode;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -315,6 +315,9 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
         else {
             _transferUtilityConfiguration = [AWSS3TransferUtilityConfiguration new];
         }
+        if (_transferUtilityConfiguration.payloadSigningMode != AWSS3PayloadSigningModeSigned) {
+            _configuration.payloadSigningMode = _transferUtilityConfiguration.payloadSigningMode;
+        }
         
         _preSignedURLBuilder = [[AWSS3PreSignedURLBuilder alloc] initWithConfiguration:_configuration];
         _s3 = [[AWSS3 alloc] initWithConfiguration:_configuration];
@@ -2597,6 +2600,7 @@ totalBytesExpectedToWrite:(int64_t)totalBytesExpectedToWrite {
         _multiPartConcurrencyLimit = @(AWSS3TransferUtilityMultiPartDefaultConcurrencyLimit);
         _timeoutIntervalForResource = AWSS3TransferUtilityTimeoutIntervalForResource;
         _preferredAccessStyle = AWSS3BucketAccessStyleVirtualHosted;
+        _payloadSigningMode = AWSS3PayloadSigningModeSigned;
     }
     return self;
 }
@@ -2609,6 +2613,7 @@ totalBytesExpectedToWrite:(int64_t)totalBytesExpectedToWrite {
     configuration.multiPartConcurrencyLimit = self.multiPartConcurrencyLimit;
     configuration.timeoutIntervalForResource = self.timeoutIntervalForResource;
     configuration.preferredAccessStyle = self.preferredAccessStyle;
+    configuration.payloadSigningMode = self.payloadSigningMode;
     return configuration;
 }
 
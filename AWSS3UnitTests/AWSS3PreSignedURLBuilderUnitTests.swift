@@ -147,6 +147,95 @@ final class AWSS3PreSignedURLBuilderUnitTests: XCTestCase {
         }
         waitForExpectations(timeout: 1)
     }
+
+    /// Given: an array of `AWSS3GetPreSignedURLRequest`s
+    /// When: `AWSS3PreSignedURLBuilder.getPreSignedURLs(_:)` is invoked
+    /// Then: One URL is generated per request, in order, all signed with the same date.
+    func testGetPreSignedURLs_returnsURLsInOrder() {
+        let keys = (0..<200).map { "folder/key \($0).txt" }
+        let requests = keys.map {
+            createRequest(bucket: "batchbucket", key: $0, preferredAccessStyle: .virtualHosted)
+        }
+
+        let expectation = expectation(description: "getPreSignedURLs")
+        builder.getPreSignedURLs(requests).continueWith { task in
+            defer {
+                expectation.fulfill()
+            }
+
+            XCTAssertNil(task.error)
+            guard let presignedURLs = task.result as? [URL] else {
+                XCTFail("Expected result")
+                return nil
+            }
+            XCTAssertEqual(presignedURLs.count, keys.count)
+
+            var dates = Set<String>()
+            for (key, presignedURL) in zip(keys, presignedURLs) {
+                guard let components = URLComponents(url: presignedURL, resolvingAgainstBaseURL: true) else {
+                    XCTFail("Unable to retrieve components")
+                    return nil
+                }
+
+                XCTAssertEqual(components.host, "batchbucket.s3.us-east-1.amazonaws.com")
+                XCTAssertEqual(components.path, "/\(key)")
+                let queryItems = components.queryItems ?? []
+                XCTAssertEqual(queryItems.first { $0.name == "X-Amz-Signature" }?.value?.count, 64)
+                XCTAssertEqual(queryItems.first { $0.name == "X-Amz-Security-Token" }?.value, "sessionKey")
+                dates.insert(queryItems.first { $0.name == "X-Amz-Date" }?.value ?? "")
+            }
+            XCTAssertEqual(dates.count, 1)
+            return nil
+        }
+        waitForExpectations(timeout: 5)
+    }
+
+    /// Given: an array of `AWSS3GetPreSignedURLRequest`s where one request has no key
+    /// When: `AWSS3PreSignedURLBuilder.getPreSignedURLs(_:)` is invoked
+    /// Then: The whole batch fails with the validation error of that request.
+    func testGetPreSignedURLs_withInvalidRequest_fails() {
+        let requests = [
+            createRequest(bucket: "batchbucket", key: "valid", preferredAccessStyle: .virtualHosted),
+            createRequest(bucket: "batchbucket", key: "", preferredAccessStyle: .virtualHosted)
+        ]
+
+        let expectation = expectation(description: "getPreSignedURLs")
+        builder.getPreSignedURLs(requests).continueWith { task in
+            defer {
+                expectation.fulfill()
+            }
+
+            let error = task.error as NSError?
+            XCTAssertEqual(error?.domain, AWSS3PresignedURLErrorDomain)
+            XCTAssertEqual(error?.code, AWSS3PresignedURLErrorType.keyNameIsNil.rawValue)
+            return nil
+        }
+        waitForExpectations(timeout: 1)
+    }
+
+    // MARK: - Benchmarks
+
+    private let benchmarkKeyCount = 5000
+
+    func testPerformanceGetPreSignedURL_perKeyLoop() {
+        let requests = (0..<benchmarkKeyCount).map {
+            createRequest(bucket: "batchbucket", key: "photos/\($0).jpg", preferredAccessStyle: .virtualHosted)
+        }
+        measure {
+            for request in requests {
+                builder.getPreSignedURL(request).waitUntilFinished()
+            }
+        }
+    }
+
+    func testPerformanceGetPreSignedURLs_batch() {
+        let requests = (0..<benchmarkKeyCount).map {
+            createRequest(bucket: "batchbucket", key: "photos/\($0).jpg", preferredAccessStyle: .virtualHosted)
+        }
+        measure {
+            builder.getPreSignedURLs(requests).waitUntilFinished()
+        }
+    }
 }
 
 extension AWSS3PreSignedURLBuilderUnitTests: AWSCredentialsProvider {
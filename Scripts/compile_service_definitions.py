@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+#
+# Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License").
+# You may not use this file except in compliance with the License.
+# A copy of the License is located at
+#
+# http://aws.amazon.com/apache2.0
+#
+# or in the "license" file accompanying this file. This file is distributed
+# on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+# express or implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+"""Compiles the JSON service definitions embedded in *Resources.m files into .awsdef files.
+
+An .awsdef file is read by AWSServiceDefinition in AWSCore. It is memory-mapped at runtime and decoded lazily, which
+avoids parsing the whole JSON model the first time a large service is used. See AWSServiceDefinition.m for the layout.
+
+The compiled file is written next to the Resources.m file, and the `...DefinitionDigest` constant in the Resources.m
+file is updated to the SHA-256 of the JSON definition, so a definition that changes without being recompiled falls
+back to the JSON parser instead of using a stale model.
+
+usage: compile_service_definitions.py [--check] [RESOURCES_FILE ...]
+
+Without arguments, the services listed in COMPILED_SERVICES are compiled. With --check, nothing is written and the
+script exits with a non-zero status if any compiled definition or digest is out of date.
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+COMPILED_SERVICES = [
+    "AWSConnect/AWSConnectResources.m",
+    "AWSEC2/AWSEC2Resources.m",
+    "AWSIoT/AWSIoTResources.m",
+    "AWSPinpoint/AWSPinpointTargeting/AWSPinpointTargetingResources.m",
+]
+
+MAGIC = b"AWSD"
+VERSION = 1
+
+# Keys that only carry API reference text and are never read at runtime.
+STRIPPED_KEYS = {"documentation"}
+
+TAG_NULL = 0
+TAG_FALSE = 1
+TAG_TRUE = 2
+TAG_STRING = 3
+TAG_INTEGER = 4
+TAG_REAL = 5
+TAG_OBJECT = 6
+TAG_ARRAY = 7
+TAG_BITS = 3
+
+HEADER_FORMAT = "<4sHH32sIIIIIII"
+
+DEFINITION_PATTERN = re.compile(r'- \(NSString \*\)definitionString \{\n    return @"(.*?)";\n\}', re.S)
+DIGEST_PATTERN = re.compile(r'(static NSString \*const \w+DefinitionDigest = @")([0-9a-f]*)(";)')
+ESCAPES = {'"': '"', "\\": "\\", "n": "\n", "t": "\t", "r": "\r", "'": "'"}
+
+
+def definition_text(resources_source):
+    """Returns the contents of the definitionString literal, as the NSString the compiler builds from it."""
+    match = DEFINITION_PATTERN.search(resources_source)
+    if match is None:
+        raise ValueError("no definitionString method found")
+    # Backslash-newline is a line splice, not part of the string.
+    literal = match.group(1).replace("\\\n", "")
+
+    def unescape(escape):
+        character = escape.group(1)
+        if character not in ESCAPES:
+            raise ValueError(f"unsupported escape sequence \\{character}")
+        return ESCAPES[character]
+
+    return re.sub(r"\\(.)", unescape, literal)
+
+
+def strip(value):
+    if isinstance(value, dict):
+        return {key: strip(member) for key, member in value.items() if key not in STRIPPED_KEYS}
+    if isinstance(value, list):
+        return [strip(member) for member in value]
+    return value
+
+
+class Compiler:
+    def __init__(self, model):
+        self.model = model
+        self.strings = {}
+        self.numbers = []
+        self.number_indices = {}
+        self.nodes = []
+        # Identical subtrees, such as `{"type":"string"}`, are stored once.
+        self.node_refs = {}
+
+    def collect_strings(self, value):
+        if isinstance(value, dict):
+            for key, member in value.items():
+                self.strings[key] = None
+                self.collect_strings(member)
+        elif isinstance(value, list):
+            for member in value:
+                self.collect_strings(member)
+        elif isinstance(value, str):
+            self.strings[value] = None
+
+    def number(self, tag, packed):
+        key = (tag, packed)
+        if key not in self.number_indices:
+            self.number_indices[key] = len(self.numbers)
+            self.numbers.append(packed)
+        return (self.number_indices[key] << TAG_BITS) | tag
+
+    def node(self, tag, words, identity):
+        if identity not in self.node_refs:
+            self.node_refs[identity] = ((len(self.nodes)) << TAG_BITS) | tag
+            self.nodes.extend(words)
+        return self.node_refs[identity]
+
+    def value(self, value):
+        if value is None:
+            return TAG_NULL
+        if value is True:
+            return TAG_TRUE
+        if value is False:
+            return TAG_FALSE
+        if isinstance(value, str):
+            return (self.string_indices[value] << TAG_BITS) | TAG_STRING
+        if isinstance(value, int):
+            return self.number(TAG_INTEGER, struct.pack("<q", value))
+        if isinstance(value, float):
+            return self.number(TAG_REAL, struct.pack("<d", value))
+        if isinstance(value, dict):
+            entries = sorted((self.string_indices[key], self.value(member)) for key, member in value.items())
+            words = [len(entries)]
+            for key, member in entries:
+                words.extend((key, member))
+            return self.node(TAG_OBJECT, words, (TAG_OBJECT, tuple(words)))
+        if isinstance(value, list):
+            words = [len(value)] + [self.value(member) for member in value]
+            return self.node(TAG_ARRAY, words, (TAG_ARRAY, tuple(words)))
+        raise TypeError(f"unsupported JSON value {value!r}")
+
+    def compile(self, digest):
+        self.collect_strings(self.model)
+        encoded = sorted(string.encode("utf-8") for string in self.strings)
+        self.string_indices = {string.decode("utf-8"): index for index, string in enumerate(encoded)}
+        root = self.value(self.model)
+
+        header_length = struct.calcsize(HEADER_FORMAT)
+        string_table_offset = align(header_length)
+        string_data_offset = string_table_offset + 8 * len(encoded)
+        string_table = bytearray()
+        string_data = bytearray()
+        for string in encoded:
+            string_table += struct.pack("<II", string_data_offset + len(string_data), len(string))
+            string_data += string + b"\0"
+        string_data += b"\0" * (align(len(string_data)) - len(string_data))
+
+        number_table_offset = string_data_offset + len(string_data)
+        number_table = b"".join(self.numbers)
+        node_offset = number_table_offset + len(number_table)
+        node_data = struct.pack(f"<{len(self.nodes)}I", *self.nodes)
+
+        header = struct.pack(HEADER_FORMAT, MAGIC, VERSION, 0, digest,
+                             len(encoded), string_table_offset,
+                             len(self.numbers), number_table_offset,
+                             node_offset, len(node_data), root)
+        header += b"\0" * (string_table_offset - len(header))
+        return header + bytes(string_table) + bytes(string_data) + number_table + node_data
+
+
+def align(length):
+    return (length + 3) & ~3
+
+
+def compile_resources(path, check):
+    """Compiles one Resources.m file. Returns False if --check found it out of date."""
+    with open(path, encoding="utf-8") as source_file:
+        source = source_file.read()
+
+    text = definition_text(source)
+    digest = hashlib.sha256(text.encode("utf-8")).digest()
+    compiled = Compiler(strip(json.loads(text))).compile(digest)
+
+    updated_source, digest_count = DIGEST_PATTERN.subn(lambda m: m.group(1) + digest.hex() + m.group(3), source)
+    if digest_count != 1:
+        raise ValueError(f"{path} must declare exactly one ...DefinitionDigest constant")
+
+    name = os.path.basename(path)[: -len("Resources.m")]
+    output_path = os.path.join(os.path.dirname(path), name + ".awsdef")
+    existing = None
+    if os.path.exists(output_path):
+        with open(output_path, "rb") as output_file:
+            existing = output_file.read()
+
+    up_to_date = existing == compiled and updated_source == source
+    if check:
+        if not up_to_date:
+            print(f"{os.path.relpath(output_path, ROOT)} is out of date", file=sys.stderr)
+        return up_to_date
+
+    if existing != compiled:
+        with open(output_path, "wb") as output_file:
+            output_file.write(compiled)
+    if updated_source != source:
+        with open(path, "w", encoding="utf-8") as source_file:
+            source_file.write(updated_source)
+    print(f"{os.path.relpath(output_path, ROOT)}: {len(text.encode('utf-8'))} -> {len(compiled)} bytes")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile service definitions into .awsdef files.")
+    parser.add_argument("--check", action="store_true", help="verify the compiled definitions are up to date")
+    parser.add_argument("resources", nargs="*", help="Resources.m files to compile")
+    arguments = parser.parse_args()
+
+    paths = arguments.resources or [os.path.join(ROOT, path) for path in COMPILED_SERVICES]
+    results = [compile_resources(path, arguments.check) for path in paths]
+    return 0 if all(results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())